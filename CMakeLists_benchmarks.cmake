@@ -0,0 +1,30 @@
+
+add_custom_target(hikogui_benchmarks_resources
+    COMMAND ${CMAKE_COMMAND} -E copy_directory ${CMAKE_CURRENT_SOURCE_DIR}/tests/data ${CMAKE_CURRENT_BINARY_DIR}
+)
+
+add_executable(hikogui_benchmarks)
+target_link_libraries(hikogui_benchmarks PRIVATE benchmark::benchmark_main hikogui)
+target_include_directories(hikogui_benchmarks PRIVATE ${CMAKE_CURRENT_BINARY_DIR})
+add_dependencies(hikogui_benchmarks hikogui_benchmarks_resources)
+
+target_sources(hikogui_benchmarks PRIVATE
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_graph_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/codec/inflate_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/huffman_tests.hpp
+    ${HIKOGUI_SOURCE_DIR}/codec/JSON_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/codec/png_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/concurrency/rcu_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_biquad_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_float_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_resampler_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/formula/formula_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/GUI/hitbox_index_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/unicode/unicode_normalization_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/widgets/virtual_list_widget_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/counters_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/datum_benchmarks.cpp
+    ${HIKOGUI_SOURCE_DIR}/wfree_growable_unordered_map_benchmarks.cpp
+)
+
+show_build_target_properties(hikogui_benchmarks)
@@ -1,6 +1,7 @@
 
 target_sources(hikogui PRIVATE
     ${HIKOGUI_SOURCE_DIR}/concurrency/dead_lock_detector_impl.cpp
+    ${HIKOGUI_SOURCE_DIR}/concurrency/rcu_impl.cpp
     ${HIKOGUI_SOURCE_DIR}/concurrency/thread_impl.cpp
     $<$<PLATFORM_ID:Darwin>:${HIKOGUI_SOURCE_DIR}/concurrency/thread_macos_impl.cpp>
     $<$<PLATFORM_ID:Windows>:${HIKOGUI_SOURCE_DIR}/concurrency/thread_win32_impl.cpp>
@@ -26,6 +26,9 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/concurrency/subsystem.hpp
     ${HIKOGUI_SOURCE_DIR}/concurrency/thread.hpp
     ${HIKOGUI_SOURCE_DIR}/concurrency/wfree_idle_count.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_biquad.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_float.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_resampler.hpp
     ${HIKOGUI_SOURCE_DIR}/font/elusive_icon.hpp
     ${HIKOGUI_SOURCE_DIR}/font/font.hpp
     ${HIKOGUI_SOURCE_DIR}/font/font_book.hpp
@@ -101,6 +104,7 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_simd_conversions_x86.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_simd_utility.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x4_sse2.hpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/native_u8x16_sse2.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/simd.hpp
     ${HIKOGUI_SOURCE_DIR}/utility/architecture.hpp
     ${HIKOGUI_SOURCE_DIR}/utility/assert.hpp
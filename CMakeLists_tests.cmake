@@ -12,6 +12,7 @@ add_dependencies(hikogui_tests hikogui_tests_resources)
 add_dependencies(hikogui_all_tests hikogui_tests)
 
 target_sources(hikogui_tests PRIVATE
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_graph_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/audio/audio_sample_unpacker_tests.cpp
     #${HIKOGUI_SOURCE_DIR}/audio/audio_sample_packer_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/char_maps/random_char.hpp
@@ -24,16 +25,25 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/char_maps/utf_32_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/codec/BON8_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/codec/JSON_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/codec/deflate_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/codec/gzip_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/codec/base_n_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/codec/png_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/codec/SHA2_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/codec/zlib_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/color/color_space_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_biquad_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_float_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_resampler_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/file/file_view_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/file/glob_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/file/URI_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/file/URL_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/font/font_char_map_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/formula/formula_program_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/formula/formula_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/damage_region_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/GUI/hitbox_index_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/geometry/identity_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/geometry/matrix_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/geometry/point_tests.cpp
@@ -47,6 +57,7 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/i18n/language_tag_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/image/pixmap_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/image/pixmap_span_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/layout/extent_index_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/layout/spreadsheet_address_tests.cpp
     #${HIKOGUI_SOURCE_DIR}/random/dither_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/random/seed_tests.cpp
@@ -57,6 +68,9 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/unicode/unicode_break_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/unicode/unicode_normalization_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/widgets/text_widget_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/widgets/virtual_list_widget_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/widgets/widget_draw_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/widgets/widget_relayout_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/concurrency/dead_lock_detector_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/concurrency/rcu_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/utility/cast_tests.cpp
@@ -80,15 +94,20 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/forward_value_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/gap_buffer_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/generator_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/huffman_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/huffman_tests.hpp
     ${HIKOGUI_SOURCE_DIR}/interval_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/int_carry_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/int_overflow_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/jsonpath_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/lean_vector_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/log_binary_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/log_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/group_ptr_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/notifier_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/graphic_path_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/packed_int_array_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/ordered_hash_map_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/polymorphic_optional_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/polynomial_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/ranges_tests.cpp
@@ -98,8 +117,11 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/sip_hash_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/small_map_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/strings_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/thread_pool_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/tokenizer_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/trace_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/tree_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/wfree_growable_unordered_map_tests.cpp
 )
 
 install(DIRECTORY tests/data/ DESTINATION tests COMPONENT tests EXCLUDE_FROM_ALL)
@@ -136,11 +158,13 @@ if (${CMAKE_SYSTEM_PROCESSOR} MATCHES "AMD64|x86_64")
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x4_tests.cpp
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x4_tests.cpp
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x4_tests.cpp
+        ${HIKOGUI_SOURCE_DIR}/SIMD/native_u8x16_tests.cpp
     )
     target_sources(hikogui_x64v2_tests PRIVATE
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x4_tests.cpp
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x4_tests.cpp
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x4_tests.cpp
+        ${HIKOGUI_SOURCE_DIR}/SIMD/native_u8x16_tests.cpp
     )
     target_sources(hikogui_x64v3_tests PRIVATE
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x4_tests.cpp
@@ -148,6 +172,7 @@ if (${CMAKE_SYSTEM_PROCESSOR} MATCHES "AMD64|x86_64")
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x4_tests.cpp
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_i64x4_tests.cpp
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x4_tests.cpp
+        ${HIKOGUI_SOURCE_DIR}/SIMD/native_u8x16_tests.cpp
     )
     target_sources(hikogui_x64v4_tests PRIVATE
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x4_tests.cpp
@@ -155,6 +180,7 @@ if (${CMAKE_SYSTEM_PROCESSOR} MATCHES "AMD64|x86_64")
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x4_tests.cpp
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_i64x4_tests.cpp
         ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x4_tests.cpp
+        ${HIKOGUI_SOURCE_DIR}/SIMD/native_u8x16_tests.cpp
     )
     install(TARGETS hikogui_tests hikogui_x64v1_tests DESTINATION tests COMPONENT tests EXCLUDE_FROM_ALL)
     install(TARGETS hikogui_tests hikogui_x64v2_tests DESTINATION tests COMPONENT tests EXCLUDE_FROM_ALL)
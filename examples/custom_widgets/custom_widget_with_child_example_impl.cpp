@@ -30,8 +30,9 @@ public:
         // trigger the calculations in `set_layout()` as well.
         _layout = {};
 
-        // We need to recursively set the constraints of any child widget here as well
-        _label_constraints = _label_widget->update_constraints();
+        // We need to recursively set the constraints of any child widget here as well,
+        // `reconstrain()` only calls `update_constraints()` on the child when needed.
+        _label_constraints = _label_widget->reconstrain();
 
         // We add the ability to resize the widget beyond the size of the label.
         auto r = hi::box_constraints{};
@@ -63,8 +64,9 @@ public:
         }
 
         // The layout of any child widget must always be set, even if the layout didn't actually change.
-        // This is because child widgets may need to re-layout for other reasons.
-        _label_widget->set_layout(context.transform(_label_shape));
+        // This is because child widgets may need to re-layout for other reasons; `relayout()` will
+        // skip the child when nothing changed.
+        _label_widget->relayout(context.transform(_label_shape));
     }
 
     // The `draw()` function is called when all or part of the window requires redrawing.
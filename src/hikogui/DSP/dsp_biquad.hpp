@@ -0,0 +1,232 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file DSP/dsp_biquad.hpp Biquad filters.
+ * @ingroup DSP
+ */
+
+#pragma once
+
+#include "../SIMD/simd.hpp"
+#include "../utility/module.hpp"
+#include <span>
+#include <vector>
+#include <cmath>
+#include <numbers>
+#include <algorithm>
+#include <array>
+
+namespace hi { inline namespace v1 {
+
+/** The coefficients of a biquad filter.
+ *
+ * The coefficients are normalized so that a0 is 1. The filter designs are
+ * from the "Audio EQ Cookbook" by Robert Bristow-Johnson.
+ */
+struct dsp_biquad_coefficients {
+    float b0 = 1.0f;
+    float b1 = 0.0f;
+    float b2 = 0.0f;
+    float a1 = 0.0f;
+    float a2 = 0.0f;
+
+    [[nodiscard]] static dsp_biquad_coefficients low_pass(double sample_rate, double frequency, double q) noexcept
+    {
+        hilet [cos_w0, alpha] = prepare(sample_rate, frequency, q);
+        return normalize(
+            (1.0 - cos_w0) / 2.0, 1.0 - cos_w0, (1.0 - cos_w0) / 2.0, 1.0 + alpha, -2.0 * cos_w0, 1.0 - alpha);
+    }
+
+    [[nodiscard]] static dsp_biquad_coefficients high_pass(double sample_rate, double frequency, double q) noexcept
+    {
+        hilet [cos_w0, alpha] = prepare(sample_rate, frequency, q);
+        return normalize(
+            (1.0 + cos_w0) / 2.0, -(1.0 + cos_w0), (1.0 + cos_w0) / 2.0, 1.0 + alpha, -2.0 * cos_w0, 1.0 - alpha);
+    }
+
+    /** Band-pass filter with a peak gain of 0 dB.
+     */
+    [[nodiscard]] static dsp_biquad_coefficients band_pass(double sample_rate, double frequency, double q) noexcept
+    {
+        hilet [cos_w0, alpha] = prepare(sample_rate, frequency, q);
+        return normalize(alpha, 0.0, -alpha, 1.0 + alpha, -2.0 * cos_w0, 1.0 - alpha);
+    }
+
+    [[nodiscard]] static dsp_biquad_coefficients notch(double sample_rate, double frequency, double q) noexcept
+    {
+        hilet [cos_w0, alpha] = prepare(sample_rate, frequency, q);
+        return normalize(1.0, -2.0 * cos_w0, 1.0, 1.0 + alpha, -2.0 * cos_w0, 1.0 - alpha);
+    }
+
+    /** Peaking equalizer.
+     *
+     * @param sample_rate The sample rate in Hz.
+     * @param frequency The center frequency in Hz.
+     * @param q The quality factor, the inverse of the bandwidth.
+     * @param gain The gain at the center frequency in dB.
+     */
+    [[nodiscard]] static dsp_biquad_coefficients
+    peak(double sample_rate, double frequency, double q, double gain) noexcept
+    {
+        hilet [cos_w0, alpha] = prepare(sample_rate, frequency, q);
+        hilet A = std::pow(10.0, gain / 40.0);
+        return normalize(1.0 + alpha * A, -2.0 * cos_w0, 1.0 - alpha * A, 1.0 + alpha / A, -2.0 * cos_w0, 1.0 - alpha / A);
+    }
+
+private:
+    [[nodiscard]] static std::pair<double, double> prepare(double sample_rate, double frequency, double q) noexcept
+    {
+        hi_axiom(sample_rate > 0.0);
+        hi_axiom(frequency > 0.0 and frequency < sample_rate / 2.0);
+        hi_axiom(q > 0.0);
+
+        hilet w0 = 2.0 * std::numbers::pi * frequency / sample_rate;
+        return {std::cos(w0), std::sin(w0) / (2.0 * q)};
+    }
+
+    [[nodiscard]] static dsp_biquad_coefficients
+    normalize(double b0, double b1, double b2, double a0, double a1, double a2) noexcept
+    {
+        return {
+            static_cast<float>(b0 / a0),
+            static_cast<float>(b1 / a0),
+            static_cast<float>(b2 / a0),
+            static_cast<float>(a1 / a0),
+            static_cast<float>(a2 / a0)};
+    }
+};
+
+/** A bank of independent biquad filters.
+ *
+ * Each filter in the bank processes its own channel, for example the channels of
+ * a surround stream, or the bands of a multi-band equalizer. A biquad is recursive so
+ * a single filter can not be vectorized over time; instead four filters are processed
+ * at once, one in each lane of a `f32x4`.
+ *
+ * The filters use the transposed direct form II.
+ *
+ * @ingroup DSP
+ */
+class dsp_biquad_bank {
+public:
+    dsp_biquad_bank(dsp_biquad_bank const&) = default;
+    dsp_biquad_bank(dsp_biquad_bank&&) noexcept = default;
+    dsp_biquad_bank& operator=(dsp_biquad_bank const&) = default;
+    dsp_biquad_bank& operator=(dsp_biquad_bank&&) noexcept = default;
+
+    /** Create a bank of filters which pass the signal unchanged.
+     *
+     * @param num_filters The number of filters in the bank.
+     */
+    dsp_biquad_bank(std::size_t num_filters = 0) : _num_filters(num_filters), _groups(ceil(num_filters, 4_uz) / 4)
+    {
+        for (auto i = 0_uz; i != num_filters; ++i) {
+            set_coefficients(i, dsp_biquad_coefficients{});
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _num_filters;
+    }
+
+    /** Change the coefficients of a filter.
+     *
+     * The state of the filter is retained.
+     *
+     * @param i The index of the filter.
+     * @param coefficients The new coefficients of the filter.
+     */
+    void set_coefficients(std::size_t i, dsp_biquad_coefficients const& coefficients) noexcept
+    {
+        hi_axiom(i < _num_filters);
+
+        auto& group = _groups[i / 4];
+        hilet lane = i % 4;
+        group.b0[lane] = coefficients.b0;
+        group.b1[lane] = coefficients.b1;
+        group.b2[lane] = coefficients.b2;
+        group.a1[lane] = coefficients.a1;
+        group.a2[lane] = coefficients.a2;
+    }
+
+    /** Clear the state of all filters.
+     */
+    void reset() noexcept
+    {
+        for (auto& group : _groups) {
+            group.s1 = f32x4{};
+            group.s2 = f32x4{};
+        }
+    }
+
+    /** Filter the samples in-place.
+     *
+     * @param channels A pointer to the samples for each filter in the bank.
+     * @param num_samples The number of samples of each channel.
+     */
+    void process(std::span<float *const> channels, std::size_t num_samples) noexcept
+    {
+        hi_axiom(channels.size() == _num_filters);
+
+        for (auto g = 0_uz; g != _groups.size(); ++g) {
+            auto& group = _groups[g];
+            hilet c = channels.subspan(g * 4, std::min(4_uz, _num_filters - g * 4));
+
+            // Transpose 4 samples of each channel, so that each vector holds the
+            // samples at the same time for all four filters. The lanes of a partial group
+            // are filtered as silence, and not stored.
+            auto i = 0_uz;
+            for (; i + 4 <= num_samples; i += 4) {
+                auto x = std::array<f32x4, 4>{};
+                for (auto j = 0_uz; j != c.size(); ++j) {
+                    x[j] = f32x4::load(c[j] + i);
+                }
+                x = transpose(x[0], x[1], x[2], x[3]);
+                for (auto& x_ : x) {
+                    x_ = group.process(x_);
+                }
+                hilet y = transpose(x[0], x[1], x[2], x[3]);
+                for (auto j = 0_uz; j != c.size(); ++j) {
+                    y[j].store(c[j] + i);
+                }
+            }
+
+            for (; i != num_samples; ++i) {
+                auto x = f32x4{};
+                for (auto j = 0_uz; j != c.size(); ++j) {
+                    x[j] = c[j][i];
+                }
+                hilet y = group.process(x);
+                for (auto j = 0_uz; j != c.size(); ++j) {
+                    c[j][i] = y[j];
+                }
+            }
+        }
+    }
+
+private:
+    struct group_type {
+        f32x4 b0 = {};
+        f32x4 b1 = {};
+        f32x4 b2 = {};
+        f32x4 a1 = {};
+        f32x4 a2 = {};
+        f32x4 s1 = {};
+        f32x4 s2 = {};
+
+        [[nodiscard]] f32x4 process(f32x4 x) noexcept
+        {
+            hilet y = b0 * x + s1;
+            s1 = b1 * x - a1 * y + s2;
+            s2 = b2 * x - a2 * y;
+            return y;
+        }
+    };
+
+    std::size_t _num_filters;
+    std::vector<group_type> _groups;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,42 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_biquad.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <random>
+
+using namespace hi;
+
+/** A bank of biquad filters, one for each channel of a 512 sample block.
+ */
+static void dsp_biquad_bank_block(benchmark::State& state)
+{
+    hilet num_filters = narrow_cast<std::size_t>(state.range(0));
+    constexpr auto block_size = 512_uz;
+
+    auto engine = std::mt19937{};
+    auto dist = std::uniform_real_distribution<float>{-1.0f, 1.0f};
+
+    auto bank = dsp_biquad_bank{num_filters};
+    auto channels = std::vector<std::vector<float>>{};
+    auto pointers = std::vector<float *>{};
+    for (auto i = 0_uz; i != num_filters; ++i) {
+        // Without gain, so that processing the same block again does not change its level.
+        bank.set_coefficients(i, dsp_biquad_coefficients::peak(48000.0, 100.0 * narrow_cast<double>(i + 1), 1.0, 0.0));
+
+        auto& channel = channels.emplace_back(block_size);
+        for (auto& x : channel) {
+            x = dist(engine);
+        }
+        pointers.push_back(channel.data());
+    }
+
+    for (auto _ : state) {
+        bank.process(pointers, block_size);
+        benchmark::DoNotOptimize(channels.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_filters * block_size);
+}
+BENCHMARK(dsp_biquad_bank_block)->Arg(1)->Arg(2)->Arg(8)->Arg(32);
@@ -0,0 +1,154 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_biquad.hpp"
+#include "dsp_float.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <numbers>
+
+using namespace hi;
+
+namespace {
+
+/** A single biquad filter, one sample at a time.
+ */
+class dsp_biquad_tests_reference {
+public:
+    dsp_biquad_tests_reference(dsp_biquad_coefficients const& coefficients) noexcept : _c(coefficients) {}
+
+    float operator()(float x) noexcept
+    {
+        hilet y = _c.b0 * x + _s1;
+        _s1 = _c.b1 * x - _c.a1 * y + _s2;
+        _s2 = _c.b2 * x - _c.a2 * y;
+        return y;
+    }
+
+private:
+    dsp_biquad_coefficients _c;
+    float _s1 = 0.0f;
+    float _s2 = 0.0f;
+};
+
+[[nodiscard]] std::vector<float> dsp_biquad_tests_noise(std::size_t size, unsigned int seed)
+{
+    auto engine = std::mt19937{seed};
+    auto dist = std::uniform_real_distribution<float>{-1.0f, 1.0f};
+
+    auto r = std::vector<float>(size);
+    for (auto& x : r) {
+        x = dist(engine);
+    }
+    return r;
+}
+
+[[nodiscard]] std::vector<float> dsp_biquad_tests_sine(std::size_t size, double frequency)
+{
+    auto r = std::vector<float>(size);
+    for (auto i = 0_uz; i != size; ++i) {
+        r[i] = static_cast<float>(std::sin(2.0 * std::numbers::pi * frequency * narrow_cast<double>(i) / 48000.0));
+    }
+    return r;
+}
+
+} // namespace
+
+TEST(dsp_biquad, reference)
+{
+    hilet designs = std::vector<dsp_biquad_coefficients>{
+        dsp_biquad_coefficients::low_pass(48000.0, 1000.0, 0.707),
+        dsp_biquad_coefficients::high_pass(48000.0, 200.0, 0.707),
+        dsp_biquad_coefficients::band_pass(48000.0, 3000.0, 2.0),
+        dsp_biquad_coefficients::notch(48000.0, 1000.0, 2.0),
+        dsp_biquad_coefficients::peak(48000.0, 8000.0, 1.0, 6.0),
+        dsp_biquad_coefficients::peak(48000.0, 400.0, 2.0, -12.0),
+        dsp_biquad_coefficients{}};
+
+    // Include a partial group of filters, and a number of samples which is not a multiple of four.
+    for (hilet num_filters : {1_uz, 4_uz, 7_uz}) {
+        auto bank = dsp_biquad_bank{num_filters};
+        auto expected = std::vector<std::vector<float>>{};
+        auto channels = std::vector<std::vector<float>>{};
+        auto references = std::vector<dsp_biquad_tests_reference>{};
+        for (auto i = 0_uz; i != num_filters; ++i) {
+            bank.set_coefficients(i, designs[i]);
+            references.emplace_back(designs[i]);
+            channels.push_back(dsp_biquad_tests_noise(1001, narrow_cast<unsigned int>(i)));
+            expected.push_back(channels.back());
+        }
+
+        auto pointers = std::vector<float *>{};
+        for (auto& channel : channels) {
+            pointers.push_back(channel.data());
+        }
+
+        // Process in blocks to check that the state is kept between blocks.
+        for (auto [offset, size] : {std::pair{0_uz, 3_uz}, std::pair{3_uz, 500_uz}, std::pair{503_uz, 498_uz}}) {
+            for (auto& pointer : pointers) {
+                pointer += offset;
+            }
+            bank.process(pointers, size);
+            for (auto& pointer : pointers) {
+                pointer -= offset;
+            }
+        }
+
+        for (auto i = 0_uz; i != num_filters; ++i) {
+            for (auto& x : expected[i]) {
+                x = references[i](x);
+            }
+            for (auto j = 0_uz; j != expected[i].size(); ++j) {
+                ASSERT_NEAR(channels[i][j], expected[i][j], 1e-4f) << "filter " << i << " sample " << j;
+            }
+        }
+    }
+}
+
+TEST(dsp_biquad, response)
+{
+    auto bank = dsp_biquad_bank{4};
+    bank.set_coefficients(0, dsp_biquad_coefficients::low_pass(48000.0, 1000.0, 0.707));
+    bank.set_coefficients(1, dsp_biquad_coefficients::low_pass(48000.0, 1000.0, 0.707));
+    bank.set_coefficients(2, dsp_biquad_coefficients::notch(48000.0, 1000.0, 1.0));
+    bank.set_coefficients(3, dsp_biquad_coefficients::peak(48000.0, 1000.0, 1.0, 6.0));
+
+    auto pass = dsp_biquad_tests_sine(48000, 100.0);
+    auto stop = dsp_biquad_tests_sine(48000, 10000.0);
+    auto notch = dsp_biquad_tests_sine(48000, 1000.0);
+    auto peak = dsp_biquad_tests_sine(48000, 1000.0);
+    auto pointers = std::vector<float *>{pass.data(), stop.data(), notch.data(), peak.data()};
+    bank.process(pointers, 48000);
+
+    // Measure after the filters have settled.
+    hilet settled = [](std::vector<float> const& x) {
+        return dsp_rms(std::span{x}.subspan(24000));
+    };
+
+    hilet sine_rms = std::sqrt(0.5f);
+    ASSERT_NEAR(settled(pass), sine_rms, 0.01f);
+    ASSERT_LT(settled(stop), sine_rms * 0.02f);
+    ASSERT_LT(settled(notch), sine_rms * 0.001f);
+    ASSERT_NEAR(settled(peak), sine_rms * std::pow(10.0f, 6.0f / 20.0f), 0.01f);
+}
+
+TEST(dsp_biquad, reset)
+{
+    auto bank = dsp_biquad_bank{1};
+    bank.set_coefficients(0, dsp_biquad_coefficients::low_pass(48000.0, 1000.0, 0.707));
+
+    auto first = dsp_biquad_tests_noise(100, 1);
+    auto second = first;
+
+    auto pointer = first.data();
+    bank.process(std::span{&pointer, 1}, first.size());
+
+    bank.reset();
+    pointer = second.data();
+    bank.process(std::span{&pointer, 1}, second.size());
+
+    ASSERT_EQ(first, second);
+}
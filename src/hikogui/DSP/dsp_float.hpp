@@ -1,122 +1,335 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
+/** @file DSP/dsp_float.hpp Element-wise functions on arrays of samples.
+ * @ingroup DSP
+ */
 
 #pragma once
 
-namespace hi {
-inline namespace v1 {
+#include "../SIMD/simd.hpp"
+#include "../utility/module.hpp"
+#include <span>
+#include <cmath>
+#include <algorithm>
+#include <concepts>
 
-template<typename Context>
-concept dsp_argument =
-    std::same_as<Context, float> or
-    std::same_as<Context. double> or
-    std::same_as<Context. std::span<float>> or
-    std::same_as<Context. std::span<double>> or
-    std::same_as<Context. std::span<float const>> or
-    std::same_as<Context. std::span<double const>>;
+namespace hi { inline namespace v1 {
+namespace detail {
 
-template<typename T, typename Op>
-void dsp_visit(std::span<T> r, std::span<T const> a, std::span<T const> b, Op op) noexcept
+template<typename T, typename Op, typename... Args>
+void dsp_visit(std::span<T> r, Op const& op, Args... args) noexcept
 {
-    hi_axiom(r.size() == a.size());
-    hi_axiom(r.size() == b.size());
-
     using S = fast_simd<T>;
     constexpr auto stride = S::size;
 
-    auto size = r.size();
-    auto wide_size = (size / stride) * stride;
-
-    auto r_ = r.data();
-    auto a_ = a.data();
-    auto b_ = b.data();
+    hilet size = r.size();
+    hi_axiom(((args.size() == size) and ...));
 
-    hilet a_wide_end = a.data() + wide_size;
-    while (a_ != a_wide_end) {
-        op(S{a_}, S{b_}).store(r_);
+    hilet wide_size = floor(size, stride);
 
-        a_ += stride;
-        b_ += stride;
-        r_ += stride;
+    auto i = 0_uz;
+    for (; i != wide_size; i += stride) {
+        op(S::load(args.data() + i)...).store(r.data() + i);
     }
 
-    hilet a_end = a_ptr + size;
-    while (a_ != size) {
-        *r_++ = op(*a_++, *b_++);
+    for (; i != size; ++i) {
+        r[i] = op(args[i]...);
     }
 }
 
-template<typename T, typename Op>
-void dsp_visit(std::span<T> r, std::span<T const> a, T b, Op op) noexcept
+} // namespace detail
+
+/** Apply an operation on each element of the arrays.
+ *
+ * The operation is called with `fast_simd<T>` arguments for the bulk of the arrays
+ * and with `T` arguments for the remainder, so it should be a generic lambda.
+ * The result may be one of the arguments, for operations that work in-place.
+ *
+ * @param[out] r The array where the results are written to.
+ * @param op The operation: `r[i] = op(args[i]...)`.
+ * @param args The arrays used as arguments to the operation, each the same size as @a r.
+ */
+template<typename T, typename Op, typename... Args>
+void dsp_visit(std::span<T> r, Op const& op, Args const&...args) noexcept
+    requires(std::convertible_to<Args const&, std::span<T const>> and ...)
 {
-    hi_axiom(r.size() == a.size());
+    detail::dsp_visit(r, op, std::span<T const>{args}...);
+}
 
-    using S = fast_simd<T>;
-    constexpr auto stride = S::size;
+/** r[i] = a[i] + b[i]
+ */
+template<typename T>
+void dsp_add(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b) noexcept
+{
+    dsp_visit(r, [](auto a, auto b) { return a + b; }, a, b);
+}
 
-    auto size = r.size();
-    auto wide_size = (size / stride) * stride;
+/** r[i] = a[i] + b
+ */
+template<typename T>
+void dsp_add(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::type_identity_t<T> b) noexcept
+{
+    dsp_visit(r, [b](auto a) { return a + b; }, a);
+}
 
-    auto r_ = r.data();
-    auto a_ = a.data();
+/** r[i] = a[i] - b[i]
+ */
+template<typename T>
+void dsp_sub(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b) noexcept
+{
+    dsp_visit(r, [](auto a, auto b) { return a - b; }, a, b);
+}
+
+/** r[i] = a[i] - b
+ */
+template<typename T>
+void dsp_sub(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::type_identity_t<T> b) noexcept
+{
+    dsp_visit(r, [b](auto a) { return a - b; }, a);
+}
 
-    hilet b_wide = S::broadcast(b);
-    hilet a_wide_end = a.data() + wide_size;
-    while (a_ != a_wide_end) {
-        op(S{a_}, b_wide).store(r_);
+/** r[i] = a[i] * b[i]
+ */
+template<typename T>
+void dsp_mul(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b) noexcept
+{
+    dsp_visit(r, [](auto a, auto b) { return a * b; }, a, b);
+}
 
-        a_ += stride;
-        r_ += stride;
-    }
+/** r[i] = a[i] * b
+ */
+template<typename T>
+void dsp_mul(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::type_identity_t<T> b) noexcept
+{
+    dsp_visit(r, [b](auto a) { return a * b; }, a);
+}
 
-    hilet a_end = a_ptr + size;
-    while (a_ != size) {
-        *r_++ = op(*a_++, b);
-    }
+/** Apply gain to samples.
+ *
+ * r[i] = a[i] * gain
+ */
+template<typename T>
+void dsp_gain(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::type_identity_t<T> gain) noexcept
+{
+    dsp_mul(r, a, gain);
 }
 
-template<typename T, typename Op>
-void dsp_visit(std::span<float> r, float a, Op op) noexcept
+/** Apply gain to samples in-place.
+ *
+ * r[i] = r[i] * gain
+ */
+template<typename T>
+void dsp_gain(std::span<T> r, std::type_identity_t<T> gain) noexcept
 {
-    using S = fast_simd<float>;
-    constexpr auto stride = S::size;
+    dsp_visit(r, [gain](auto r) { return r * gain; }, r);
+}
 
-    hilet size = r.size();
-    hilet wide_size = (size / stride) * stride;
+/** Mix samples with gain into a bus.
+ *
+ * r[i] = r[i] + a[i] * gain
+ */
+template<typename T>
+void dsp_mix(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::type_identity_t<T> gain) noexcept
+{
+    dsp_visit(r, [gain](auto r, auto a) { return r + a * gain; }, r, a);
+}
 
-    auto r_ = a.data();
-    hilet a_ = S::broadcast(b);
+/** Multiply-accumulate.
+ *
+ * r[i] = r[i] + a[i] * b[i]
+ */
+template<typename T>
+void dsp_mac(std::span<T> r, std::span<std::type_identity_t<T> const> a, std::span<std::type_identity_t<T> const> b) noexcept
+{
+    dsp_visit(r, [](auto r, auto a, auto b) { return r + a * b; }, r, a, b);
+}
 
-    hilet r_wide_end = r.data() + wide_size;
-    while (r_ != r_wide_end) {
-        op(S{r_} + a_wide).store(r_);
+/** Interleave the samples of separate channels into frames.
+ *
+ * r[i * channels.size() + j] = channels[j][i]
+ *
+ * @param[out] r The interleaved samples, `channels.size()` times the size of each channel.
+ * @param channels The samples of each channel, all the same size.
+ */
+template<typename T>
+void dsp_interleave(std::span<T> r, std::span<std::span<std::type_identity_t<T> const> const> channels) noexcept
+{
+    hilet num_channels = channels.size();
+    if (num_channels == 0) {
+        return;
+    }
 
-        a_ += stride;
+    hilet num_frames = channels[0].size();
+    hi_axiom(r.size() == num_frames * num_channels);
+    hi_axiom(std::ranges::all_of(channels, [num_frames](hilet& channel) {
+        return channel.size() == num_frames;
+    }));
+
+    auto i = 0_uz;
+#if defined(HI_HAS_SSE)
+    if constexpr (std::same_as<T, float>) {
+        hilet wide_num_frames = floor(num_frames, 4_uz);
+
+        if (num_channels == 2) {
+            for (; i != wide_num_frames; i += 4) {
+                hilet a = _mm_loadu_ps(channels[0].data() + i);
+                hilet b = _mm_loadu_ps(channels[1].data() + i);
+                _mm_storeu_ps(r.data() + i * 2, _mm_unpacklo_ps(a, b));
+                _mm_storeu_ps(r.data() + i * 2 + 4, _mm_unpackhi_ps(a, b));
+            }
+
+        } else if (num_channels == 4) {
+            for (; i != wide_num_frames; i += 4) {
+                hilet frames = transpose(
+                    f32x4::load(channels[0].data() + i),
+                    f32x4::load(channels[1].data() + i),
+                    f32x4::load(channels[2].data() + i),
+                    f32x4::load(channels[3].data() + i));
+                for (auto j = 0_uz; j != 4; ++j) {
+                    frames[j].store(r.data() + (i + j) * 4);
+                }
+            }
+        }
     }
+#endif
 
-    hilet r_end = r_ + size;
-    while (r_ != size) {
-        *r_++ += a;
+    for (; i != num_frames; ++i) {
+        for (auto j = 0_uz; j != num_channels; ++j) {
+            r[i * num_channels + j] = channels[j][i];
+        }
     }
 }
 
-void dsp_add(dsp_argument auto... args) noexcept
+/** De-interleave frames into the samples of separate channels.
+ *
+ * channels[j][i] = a[i * channels.size() + j]
+ *
+ * @param[out] channels The samples of each channel, all the same size.
+ * @param a The interleaved samples, `channels.size()` times the size of each channel.
+ */
+template<typename T>
+void dsp_deinterleave(std::span<std::span<std::type_identity_t<T>> const> channels, std::span<T const> a) noexcept
 {
-    return dsp_operator(args..., [](auto a, auto b) { return a + b; });
-}
+    hilet num_channels = channels.size();
+    if (num_channels == 0) {
+        return;
+    }
 
-void dsp_sub(dsp-argument auto... args) noexcept
-{
-    return dsp_operator(args..., [](auto a, auto b) { return a - b; });
+    hilet num_frames = channels[0].size();
+    hi_axiom(a.size() == num_frames * num_channels);
+    hi_axiom(std::ranges::all_of(channels, [num_frames](hilet& channel) {
+        return channel.size() == num_frames;
+    }));
+
+    auto i = 0_uz;
+#if defined(HI_HAS_SSE)
+    if constexpr (std::same_as<T, float>) {
+        hilet wide_num_frames = floor(num_frames, 4_uz);
+
+        if (num_channels == 2) {
+            for (; i != wide_num_frames; i += 4) {
+                hilet low = _mm_loadu_ps(a.data() + i * 2);
+                hilet high = _mm_loadu_ps(a.data() + i * 2 + 4);
+                _mm_storeu_ps(channels[0].data() + i, _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+                _mm_storeu_ps(channels[1].data() + i, _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+            }
+
+        } else if (num_channels == 4) {
+            for (; i != wide_num_frames; i += 4) {
+                hilet samples = transpose(
+                    f32x4::load(a.data() + i * 4),
+                    f32x4::load(a.data() + i * 4 + 4),
+                    f32x4::load(a.data() + i * 4 + 8),
+                    f32x4::load(a.data() + i * 4 + 12));
+                for (auto j = 0_uz; j != 4; ++j) {
+                    samples[j].store(channels[j].data() + i);
+                }
+            }
+        }
+    }
+#endif
+
+    for (; i != num_frames; ++i) {
+        for (auto j = 0_uz; j != num_channels; ++j) {
+            channels[j][i] = a[i * num_channels + j];
+        }
+    }
 }
 
-void dsp_mul(dsp-argument auto... args) noexcept
+/** The peak level of the samples.
+ *
+ * @return The largest absolute value of the samples, or zero when there are no samples.
+ */
+template<typename T>
+[[nodiscard]] T dsp_peak(std::span<T const> a) noexcept
 {
-    return dsp_operator(args..., [](auto a, auto b) { return a * b; });
-}
+    using S = fast_simd<T>;
+    constexpr auto stride = S::size;
+
+    hilet size = a.size();
+    hilet wide_size = floor(size, stride);
+
+    auto i = 0_uz;
+    auto wide_peak = S{};
+    for (; i != wide_size; i += stride) {
+        wide_peak = max(wide_peak, abs(S::load(a.data() + i)));
+    }
 
+    auto r = T{};
+    for (hilet x : wide_peak) {
+        r = std::max(r, x);
+    }
+    for (; i != size; ++i) {
+        r = std::max(r, std::abs(a[i]));
+    }
+    return r;
+}
 
+/** The sum of the squares of the samples.
+ */
+template<typename T>
+[[nodiscard]] T dsp_sum_of_squares(std::span<T const> a) noexcept
+{
+    using S = fast_simd<T>;
+    constexpr auto stride = S::size;
 
+    hilet size = a.size();
+    hilet wide_size = floor(size, stride * 2);
+
+    // Two accumulators to hide the latency of the additions.
+    auto i = 0_uz;
+    auto sum0 = S{};
+    auto sum1 = S{};
+    for (; i != wide_size; i += stride * 2) {
+        hilet x0 = S::load(a.data() + i);
+        hilet x1 = S::load(a.data() + i + stride);
+        sum0 += x0 * x0;
+        sum1 += x1 * x1;
+    }
 
+    auto r = T{};
+    for (hilet x : sum0 + sum1) {
+        r += x;
+    }
+    for (; i != size; ++i) {
+        r += a[i] * a[i];
+    }
+    return r;
+}
 
-}}
+/** The RMS (root mean square) level of the samples.
+ *
+ * @return The RMS level of the samples, or zero when there are no samples.
+ */
+template<typename T>
+[[nodiscard]] T dsp_rms(std::span<T const> a) noexcept
+{
+    if (a.empty()) {
+        return T{};
+    }
+    return std::sqrt(dsp_sum_of_squares(a) / static_cast<T>(a.size()));
+}
 
+}} // namespace hi::v1
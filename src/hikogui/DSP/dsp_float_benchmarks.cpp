@@ -0,0 +1,124 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_float.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <array>
+#include <random>
+
+using namespace hi;
+
+namespace {
+
+/** The number of samples in a block; a typical block size for low latency audio.
+ */
+constexpr auto dsp_float_benchmarks_block_size = 512_uz;
+
+[[nodiscard]] std::vector<float> dsp_float_benchmarks_samples(std::size_t size, unsigned int seed)
+{
+    auto engine = std::mt19937{seed};
+    auto dist = std::uniform_real_distribution<float>{-1.0f, 1.0f};
+
+    auto r = std::vector<float>(size);
+    for (auto& x : r) {
+        x = dist(engine);
+    }
+    return r;
+}
+
+} // namespace
+
+static void dsp_gain_block(benchmark::State& state)
+{
+    hilet a = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size, 1);
+    auto r = std::vector<float>(dsp_float_benchmarks_block_size);
+
+    for (auto _ : state) {
+        dsp_gain(std::span{r}, a, 0.5f);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetItemsProcessed(state.iterations() * r.size());
+}
+BENCHMARK(dsp_gain_block);
+
+static void dsp_mix_block(benchmark::State& state)
+{
+    hilet a = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size, 1);
+    auto r = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size, 2);
+
+    for (auto _ : state) {
+        dsp_mix(std::span{r}, a, 0.001f);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetItemsProcessed(state.iterations() * r.size());
+}
+BENCHMARK(dsp_mix_block);
+
+static void dsp_mac_block(benchmark::State& state)
+{
+    hilet a = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size, 1);
+    hilet b = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size, 2);
+    auto r = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size, 3);
+
+    for (auto _ : state) {
+        dsp_mac(std::span{r}, a, b);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetItemsProcessed(state.iterations() * r.size());
+}
+BENCHMARK(dsp_mac_block);
+
+static void dsp_interleave_stereo_block(benchmark::State& state)
+{
+    hilet left = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size, 1);
+    hilet right = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size, 2);
+    hilet channels = std::array{std::span<float const>{left}, std::span<float const>{right}};
+    auto r = std::vector<float>(dsp_float_benchmarks_block_size * 2);
+
+    for (auto _ : state) {
+        dsp_interleave(std::span{r}, channels);
+        benchmark::DoNotOptimize(r.data());
+    }
+    state.SetItemsProcessed(state.iterations() * r.size());
+}
+BENCHMARK(dsp_interleave_stereo_block);
+
+static void dsp_deinterleave_stereo_block(benchmark::State& state)
+{
+    hilet frames = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size * 2, 1);
+    auto left = std::vector<float>(dsp_float_benchmarks_block_size);
+    auto right = std::vector<float>(dsp_float_benchmarks_block_size);
+    hilet channels = std::array{std::span<float>{left}, std::span<float>{right}};
+
+    for (auto _ : state) {
+        dsp_deinterleave(channels, std::span{frames});
+        benchmark::DoNotOptimize(left.data());
+        benchmark::DoNotOptimize(right.data());
+    }
+    state.SetItemsProcessed(state.iterations() * frames.size());
+}
+BENCHMARK(dsp_deinterleave_stereo_block);
+
+static void dsp_peak_block(benchmark::State& state)
+{
+    hilet a = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size, 1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dsp_peak(std::span{a}));
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(dsp_peak_block);
+
+static void dsp_rms_block(benchmark::State& state)
+{
+    hilet a = dsp_float_benchmarks_samples(dsp_float_benchmarks_block_size, 1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dsp_rms(std::span{a}));
+    }
+    state.SetItemsProcessed(state.iterations() * a.size());
+}
+BENCHMARK(dsp_rms_block);
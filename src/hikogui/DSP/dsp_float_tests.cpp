@@ -0,0 +1,174 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_float.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+#include <random>
+#include <cmath>
+
+using namespace hi;
+
+namespace {
+
+/** Random samples between -1.0 and 1.0.
+ *
+ * The sizes used by the tests are not a multiple of the simd width, to test the remainder.
+ */
+[[nodiscard]] std::vector<float> dsp_float_tests_samples(std::size_t size, unsigned int seed)
+{
+    auto engine = std::mt19937{seed};
+    auto dist = std::uniform_real_distribution<float>{-1.0f, 1.0f};
+
+    auto r = std::vector<float>(size);
+    for (auto& x : r) {
+        x = dist(engine);
+    }
+    return r;
+}
+
+} // namespace
+
+TEST(dsp_float, add_sub_mul)
+{
+    for (hilet size : {0_uz, 1_uz, 3_uz, 4_uz, 17_uz, 1000_uz}) {
+        hilet a = dsp_float_tests_samples(size, 1);
+        hilet b = dsp_float_tests_samples(size, 2);
+        auto r = std::vector<float>(size);
+
+        dsp_add(std::span{r}, a, b);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], a[i] + b[i]);
+        }
+
+        dsp_add(std::span{r}, a, 0.5f);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], a[i] + 0.5f);
+        }
+
+        dsp_sub(std::span{r}, a, b);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], a[i] - b[i]);
+        }
+
+        dsp_sub(std::span{r}, a, 0.5f);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], a[i] - 0.5f);
+        }
+
+        dsp_mul(std::span{r}, a, b);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], a[i] * b[i]);
+        }
+
+        dsp_mul(std::span{r}, a, 0.5f);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], a[i] * 0.5f);
+        }
+    }
+}
+
+TEST(dsp_float, add_double)
+{
+    auto a = std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+    auto b = std::vector<double>{7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0};
+    auto r = std::vector<double>(a.size());
+
+    dsp_add(std::span{r}, a, b);
+    ASSERT_EQ(r, std::vector<double>(7, 8.0));
+}
+
+TEST(dsp_float, gain_mix_mac)
+{
+    for (hilet size : {0_uz, 1_uz, 3_uz, 4_uz, 17_uz, 1000_uz}) {
+        hilet a = dsp_float_tests_samples(size, 1);
+        hilet b = dsp_float_tests_samples(size, 2);
+        hilet bus = dsp_float_tests_samples(size, 3);
+
+        auto r = std::vector<float>(size);
+        dsp_gain(std::span{r}, a, 0.25f);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], a[i] * 0.25f);
+        }
+
+        r = a;
+        dsp_gain(std::span{r}, 0.25f);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], a[i] * 0.25f);
+        }
+
+        r = bus;
+        dsp_mix(std::span{r}, a, 0.25f);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_FLOAT_EQ(r[i], bus[i] + a[i] * 0.25f);
+        }
+
+        r = bus;
+        dsp_mac(std::span{r}, a, b);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_FLOAT_EQ(r[i], bus[i] + a[i] * b[i]);
+        }
+    }
+}
+
+TEST(dsp_float, interleave)
+{
+    for (hilet num_channels : {1_uz, 2_uz, 3_uz, 4_uz, 6_uz}) {
+        for (hilet num_frames : {0_uz, 1_uz, 5_uz, 64_uz, 67_uz}) {
+            auto channels = std::vector<std::vector<float>>{};
+            auto channel_spans = std::vector<std::span<float const>>{};
+            for (auto j = 0_uz; j != num_channels; ++j) {
+                channels.push_back(dsp_float_tests_samples(num_frames, narrow_cast<unsigned int>(j)));
+                channel_spans.emplace_back(channels.back());
+            }
+
+            auto frames = std::vector<float>(num_frames * num_channels);
+            dsp_interleave(std::span{frames}, channel_spans);
+            for (auto i = 0_uz; i != num_frames; ++i) {
+                for (auto j = 0_uz; j != num_channels; ++j) {
+                    ASSERT_EQ(frames[i * num_channels + j], channels[j][i]);
+                }
+            }
+
+            auto result = std::vector<std::vector<float>>(num_channels, std::vector<float>(num_frames));
+            auto result_spans = std::vector<std::span<float>>{};
+            for (auto& channel : result) {
+                result_spans.emplace_back(channel);
+            }
+
+            dsp_deinterleave(result_spans, std::span<float const>{frames});
+            ASSERT_EQ(result, channels);
+        }
+    }
+}
+
+TEST(dsp_float, peak_rms)
+{
+    ASSERT_EQ(dsp_peak(std::span<float const>{}), 0.0f);
+    ASSERT_EQ(dsp_rms(std::span<float const>{}), 0.0f);
+
+    for (hilet size : {1_uz, 3_uz, 4_uz, 17_uz, 1000_uz}) {
+        hilet a = dsp_float_tests_samples(size, 4);
+
+        auto peak = 0.0f;
+        auto sum = 0.0;
+        for (hilet x : a) {
+            peak = std::max(peak, std::abs(x));
+            sum += static_cast<double>(x) * static_cast<double>(x);
+        }
+        hilet rms = std::sqrt(sum / static_cast<double>(size));
+
+        ASSERT_EQ(dsp_peak(std::span{a}), peak);
+        ASSERT_NEAR(dsp_rms(std::span{a}), rms, 1e-5);
+    }
+
+    // A full-scale sine wave.
+    auto sine = std::vector<float>(4800);
+    for (auto i = 0_uz; i != sine.size(); ++i) {
+        sine[i] = static_cast<float>(std::sin(2.0 * std::numbers::pi * narrow_cast<double>(i) / 48.0));
+    }
+    ASSERT_NEAR(dsp_peak(std::span<float const>{sine}), 1.0f, 1e-6);
+    ASSERT_NEAR(dsp_rms(std::span<float const>{sine}), std::sqrt(0.5f), 1e-5);
+}
@@ -0,0 +1,216 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file DSP/dsp_resampler.hpp Sample-rate conversion.
+ * @ingroup DSP
+ */
+
+#pragma once
+
+#include "../SIMD/simd.hpp"
+#include "../utility/module.hpp"
+#include <span>
+#include <vector>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+#include <algorithm>
+#include <utility>
+
+namespace hi { inline namespace v1 {
+
+/** A polyphase sample-rate converter.
+ *
+ * The ratio between the sample rates is reduced to `L / M`. Conceptually the input is
+ * up-sampled by `L`, low-pass filtered and down-sampled by `M`. Instead the low-pass filter is
+ * split into `L` phases, and for each output sample only a single phase is applied to the
+ * last input samples; this is a dot-product of `num_taps` samples.
+ *
+ * The low-pass filter is a Blackman windowed-sinc with the cut-off just below the
+ * Nyquist frequency of the lowest of the two sample rates.
+ *
+ * All memory is allocated by the constructor, `process()` is wait-free and can be used
+ * on the audio thread.
+ *
+ * @ingroup DSP
+ */
+class dsp_resampler {
+public:
+    dsp_resampler(dsp_resampler const&) = default;
+    dsp_resampler(dsp_resampler&&) noexcept = default;
+    dsp_resampler& operator=(dsp_resampler const&) = default;
+    dsp_resampler& operator=(dsp_resampler&&) noexcept = default;
+
+    /** Create a sample-rate converter.
+     *
+     * @param input_rate The sample rate of the input.
+     * @param output_rate The sample rate of the output.
+     * @param num_taps The number of taps of each phase of the filter, rounded up to a multiple of 8.
+     *                 More taps make the transition band of the low-pass filter narrower.
+     */
+    dsp_resampler(std::size_t input_rate, std::size_t output_rate, std::size_t num_taps = 32) :
+        _num_taps(ceil(std::max(num_taps, 8_uz), 8_uz))
+    {
+        hi_axiom(input_rate > 0 and output_rate > 0);
+
+        hilet divisor = std::gcd(input_rate, output_rate);
+        _num_phases = output_rate / divisor;
+        _step = input_rate / divisor;
+
+        hilet length = _num_phases * _num_taps;
+        hilet cut_off = 0.45 / narrow_cast<double>(std::max(_num_phases, _step));
+        hilet center = narrow_cast<double>(length - 1) / 2.0;
+
+        // The prototype filter, at the up-sampled rate.
+        auto prototype = std::vector<double>(length);
+        for (auto i = 0_uz; i != length; ++i) {
+            hilet t = narrow_cast<double>(i) - center;
+            hilet x = 2.0 * cut_off * t;
+            hilet sinc = x == 0.0 ? 1.0 : std::sin(std::numbers::pi * x) / (std::numbers::pi * x);
+
+            hilet w = 2.0 * std::numbers::pi * narrow_cast<double>(i) / narrow_cast<double>(length - 1);
+            hilet window = 0.42 - 0.5 * std::cos(w) + 0.08 * std::cos(2.0 * w);
+
+            prototype[i] = sinc * window;
+        }
+
+        // Split the prototype in phases; the taps of a phase are ordered from the oldest to
+        // the newest input sample. Each phase is normalized to unity gain at DC.
+        _coefficients.resize(length);
+        for (auto phase = 0_uz; phase != _num_phases; ++phase) {
+            auto sum = 0.0;
+            for (auto k = 0_uz; k != _num_taps; ++k) {
+                sum += prototype[phase + k * _num_phases];
+            }
+
+            for (auto k = 0_uz; k != _num_taps; ++k) {
+                hilet coefficient = prototype[phase + (_num_taps - 1 - k) * _num_phases] / sum;
+                _coefficients[phase * _num_taps + k] = static_cast<float>(coefficient);
+            }
+        }
+
+        _history.resize(_num_taps * 2);
+        reset();
+    }
+
+    /** The delay of the filter in input samples.
+     */
+    [[nodiscard]] double delay() const noexcept
+    {
+        return narrow_cast<double>(_num_phases * _num_taps - 1) / 2.0 / narrow_cast<double>(_num_phases);
+    }
+
+    /** The maximum number of output samples for the given number of input samples.
+     */
+    [[nodiscard]] std::size_t max_output_size(std::size_t input_size) const noexcept
+    {
+        return (input_size * _num_phases + _step - 1) / _step + 1;
+    }
+
+    /** Clear the input history.
+     */
+    void reset() noexcept
+    {
+        std::ranges::fill(_history, 0.0f);
+        _history_offset = 0;
+        _phase = 0;
+        _num_needed = 1;
+    }
+
+    /** Convert samples.
+     *
+     * The conversion stops when all the input is consumed or when the output is full.
+     * The input and output may be split in blocks of any size; the result is the same.
+     *
+     * @param input The input samples.
+     * @param[out] output The buffer for the output samples.
+     * @return The number of input samples consumed, and the number of output samples written.
+     */
+    std::pair<std::size_t, std::size_t> process(std::span<float const> input, std::span<float> output) noexcept
+    {
+        auto num_read = 0_uz;
+        auto num_written = 0_uz;
+
+        while (true) {
+            for (; _num_needed != 0; --_num_needed) {
+                if (num_read == input.size()) {
+                    return {num_read, num_written};
+                }
+                push(input[num_read++]);
+            }
+
+            if (num_written == output.size()) {
+                return {num_read, num_written};
+            }
+
+            output[num_written++] = apply(_phase);
+
+            _phase += _step;
+            _num_needed = _phase / _num_phases;
+            _phase %= _num_phases;
+        }
+    }
+
+private:
+    /** The number of phases of the filter, the up-sampling factor L.
+     */
+    std::size_t _num_phases = 0;
+
+    /** The down-sampling factor M.
+     */
+    std::size_t _step = 0;
+
+    std::size_t _num_taps = 0;
+
+    /** The coefficients of the filter, `_num_taps` for each phase.
+     */
+    std::vector<float> _coefficients;
+
+    /** The last input samples.
+     *
+     * Each sample is stored twice, so that the last `_num_taps` samples are always
+     * contiguous, starting at `_history_offset`.
+     */
+    std::vector<float> _history;
+    std::size_t _history_offset = 0;
+
+    /** The phase of the filter for the next output sample.
+     */
+    std::size_t _phase = 0;
+
+    /** The number of input samples needed before the next output sample.
+     */
+    std::size_t _num_needed = 1;
+
+    void push(float sample) noexcept
+    {
+        _history[_history_offset] = sample;
+        _history[_history_offset + _num_taps] = sample;
+        if (++_history_offset == _num_taps) {
+            _history_offset = 0;
+        }
+    }
+
+    [[nodiscard]] float apply(std::size_t phase) const noexcept
+    {
+        hilet *coefficients = _coefficients.data() + phase * _num_taps;
+        hilet *history = _history.data() + _history_offset;
+
+        // Two accumulators to hide the latency of the additions.
+        auto sum0 = f32x4{};
+        auto sum1 = f32x4{};
+        for (auto k = 0_uz; k != _num_taps; k += 8) {
+            sum0 += f32x4::load(coefficients + k) * f32x4::load(history + k);
+            sum1 += f32x4::load(coefficients + k + 4) * f32x4::load(history + k + 4);
+        }
+
+        auto r = 0.0f;
+        for (hilet x : sum0 + sum1) {
+            r += x;
+        }
+        return r;
+    }
+};
+
+}} // namespace hi::v1
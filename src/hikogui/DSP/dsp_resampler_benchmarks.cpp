@@ -0,0 +1,37 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_resampler.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <cmath>
+#include <numbers>
+
+using namespace hi;
+
+/** Convert a 512 sample block, measured in output samples.
+ */
+static void dsp_resampler_block(benchmark::State& state)
+{
+    hilet input_rate = narrow_cast<std::size_t>(state.range(0));
+    hilet output_rate = narrow_cast<std::size_t>(state.range(1));
+    constexpr auto block_size = 512_uz;
+
+    auto input = std::vector<float>(block_size);
+    for (auto i = 0_uz; i != input.size(); ++i) {
+        input[i] = static_cast<float>(std::sin(2.0 * std::numbers::pi * narrow_cast<double>(i) / 48.0));
+    }
+
+    auto resampler = dsp_resampler{input_rate, output_rate};
+    auto output = std::vector<float>(resampler.max_output_size(block_size));
+
+    auto num_samples = 0_uz;
+    for (auto _ : state) {
+        hilet [num_read, num_written] = resampler.process(input, output);
+        benchmark::DoNotOptimize(output.data());
+        num_samples += num_written;
+    }
+    state.SetItemsProcessed(narrow_cast<int64_t>(num_samples));
+}
+BENCHMARK(dsp_resampler_block)->Args({44100, 48000})->Args({48000, 44100})->Args({48000, 96000});
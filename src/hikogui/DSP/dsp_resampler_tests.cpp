@@ -0,0 +1,99 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_resampler.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <numbers>
+
+using namespace hi;
+
+namespace {
+
+[[nodiscard]] double dsp_resampler_tests_sine(double frequency, double sample_rate, double t)
+{
+    return std::sin(2.0 * std::numbers::pi * frequency * t / sample_rate);
+}
+
+/** Resample all the input at once.
+ */
+[[nodiscard]] std::vector<float> dsp_resampler_tests_process(dsp_resampler& resampler, std::vector<float> const& input)
+{
+    auto r = std::vector<float>(resampler.max_output_size(input.size()));
+    hilet [num_read, num_written] = resampler.process(input, r);
+    hi_assert(num_read == input.size());
+    r.resize(num_written);
+    return r;
+}
+
+} // namespace
+
+TEST(dsp_resampler, sine)
+{
+    // Each pair of sample rates is tested in both directions, with a 1 kHz sine wave.
+    for (hilet [input_rate, output_rate] : {
+             std::pair{48000_uz, 44100_uz},
+             std::pair{44100_uz, 48000_uz},
+             std::pair{48000_uz, 96000_uz},
+             std::pair{96000_uz, 48000_uz},
+             std::pair{48000_uz, 48000_uz}}) {
+        auto resampler = dsp_resampler{input_rate, output_rate};
+
+        auto input = std::vector<float>(input_rate / 10);
+        for (auto i = 0_uz; i != input.size(); ++i) {
+            input[i] = static_cast<float>(dsp_resampler_tests_sine(1000.0, narrow_cast<double>(input_rate), narrow_cast<double>(i)));
+        }
+
+        hilet output = dsp_resampler_tests_process(resampler, input);
+        ASSERT_NEAR(narrow_cast<double>(output.size()), narrow_cast<double>(output_rate / 10), 2.0);
+
+        // The output is the input delayed by the filter; skip the start, where the filter is filling.
+        hilet ratio = narrow_cast<double>(input_rate) / narrow_cast<double>(output_rate);
+        for (auto i = output.size() / 2; i != output.size(); ++i) {
+            hilet t = narrow_cast<double>(i) * ratio - resampler.delay();
+            ASSERT_NEAR(output[i], dsp_resampler_tests_sine(1000.0, narrow_cast<double>(input_rate), t), 0.002)
+                << input_rate << " -> " << output_rate << " sample " << i;
+        }
+    }
+}
+
+TEST(dsp_resampler, blocks)
+{
+    auto input = std::vector<float>(10000);
+    for (auto i = 0_uz; i != input.size(); ++i) {
+        input[i] = static_cast<float>(dsp_resampler_tests_sine(440.0, 44100.0, narrow_cast<double>(i)));
+    }
+
+    auto resampler = dsp_resampler{44100, 48000};
+    hilet expected = dsp_resampler_tests_process(resampler, input);
+
+    // The same result when both the input and output are split in small irregular blocks.
+    resampler.reset();
+    auto output = std::vector<float>{};
+    auto buffer = std::array<float, 7>{};
+    auto input_offset = 0_uz;
+    auto input_block = 1_uz;
+    while (input_offset != input.size()) {
+        hilet input_span = std::span{input}.subspan(input_offset, std::min(input_block, input.size() - input_offset));
+        hilet [num_read, num_written] = resampler.process(input_span, buffer);
+        output.insert(output.end(), buffer.begin(), buffer.begin() + num_written);
+        input_offset += num_read;
+        input_block = input_block % 13 + 1;
+    }
+
+    ASSERT_EQ(output, expected);
+}
+
+TEST(dsp_resampler, dc)
+{
+    auto resampler = dsp_resampler{48000, 44100};
+    hilet output = dsp_resampler_tests_process(resampler, std::vector<float>(4800, 0.5f));
+
+    // Each phase of the filter has unity gain at DC.
+    for (auto i = 100_uz; i != output.size(); ++i) {
+        ASSERT_NEAR(output[i], 0.5f, 1e-6f);
+    }
+}
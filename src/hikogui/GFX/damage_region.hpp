@@ -0,0 +1,258 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../geometry/module.hpp"
+#include "../utility/module.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace hi::inline v1 {
+
+/** The part of a window that needs to be redrawn.
+ *
+ * The region consists of a small set of disjoint rectangles, so that two small
+ * changes on opposite sides of a window do not cause the whole window to be redrawn.
+ *
+ * When a rectangle is added it is merged with each rectangle it overlaps, to keep
+ * the rectangles disjoint. It is also merged with a nearby rectangle when the bounding
+ * rectangle of both does not add much area that did not need to be redrawn. When the
+ * region is full the rectangle is merged with the rectangle which adds the least area.
+ *
+ * @ingroup GFX
+ */
+class damage_region {
+public:
+    using value_type = aarectanglei;
+    using const_iterator = value_type const *;
+
+    /** The maximum number of rectangles in a region.
+     */
+    constexpr static std::size_t max_size = 8;
+
+    constexpr damage_region() noexcept = default;
+    constexpr damage_region(damage_region const&) noexcept = default;
+    constexpr damage_region(damage_region&&) noexcept = default;
+    constexpr damage_region& operator=(damage_region const&) noexcept = default;
+    constexpr damage_region& operator=(damage_region&&) noexcept = default;
+
+    constexpr damage_region(aarectanglei const& rectangle) noexcept
+    {
+        *this |= rectangle;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept
+    {
+        return not empty();
+    }
+
+    /** The number of disjoint rectangles in the region.
+     */
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept
+    {
+        return _rectangles.data();
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept
+    {
+        return _rectangles.data() + _size;
+    }
+
+    [[nodiscard]] constexpr value_type const& operator[](std::size_t index) const noexcept
+    {
+        hi_axiom(index < _size);
+        return _rectangles[index];
+    }
+
+    constexpr void clear() noexcept
+    {
+        _size = 0;
+    }
+
+    /** The total area of all the rectangles in the region.
+     */
+    [[nodiscard]] constexpr int64_t area() const noexcept
+    {
+        auto r = int64_t{0};
+        for (hilet& rectangle : *this) {
+            r += area(rectangle);
+        }
+        return r;
+    }
+
+    /** The rectangle that encloses the whole region.
+     */
+    [[nodiscard]] constexpr friend aarectanglei bounding_rectangle(damage_region const& rhs) noexcept
+    {
+        auto r = aarectanglei{};
+        for (hilet& rectangle : rhs) {
+            r = r | rectangle;
+        }
+        return r;
+    }
+
+    /** Check if a rectangle overlaps with any part of the region.
+     */
+    [[nodiscard]] constexpr friend bool overlaps(damage_region const& lhs, aarectanglei const& rhs) noexcept
+    {
+        for (hilet& rectangle : lhs) {
+            if (overlaps(rectangle, rhs)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Add a rectangle to the region.
+     */
+    constexpr damage_region& operator|=(aarectanglei rhs) noexcept
+    {
+        if (not rhs) {
+            return *this;
+        }
+
+        // Merging may grow the rectangle so that it overlaps rectangles that were
+        // checked before; repeat until the rectangle is disjoint from the rest.
+        auto i = 0_uz;
+        while (i != _size) {
+            hilet& rectangle = _rectangles[i];
+            if (contains(rectangle, rhs)) {
+                return *this;
+
+            } else if (overlaps(rectangle, rhs) or should_merge(rectangle, rhs)) {
+                rhs = rhs | rectangle;
+                erase(i);
+                i = 0;
+
+            } else {
+                ++i;
+            }
+        }
+
+        if (_size == max_size) {
+            // Merge with the rectangle that adds the least amount of area, and then
+            // add it again as the merged rectangle may overlap with others.
+            hilet index = cheapest_merge(rhs);
+            rhs = rhs | _rectangles[index];
+            erase(index);
+            return *this |= rhs;
+        }
+
+        _rectangles[_size++] = rhs;
+        return *this;
+    }
+
+    constexpr damage_region& operator|=(damage_region const& rhs) noexcept
+    {
+        for (hilet& rectangle : rhs) {
+            *this |= rectangle;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] constexpr friend damage_region operator|(damage_region lhs, aarectanglei const& rhs) noexcept
+    {
+        return lhs |= rhs;
+    }
+
+    [[nodiscard]] constexpr friend damage_region operator|(damage_region lhs, damage_region const& rhs) noexcept
+    {
+        return lhs |= rhs;
+    }
+
+    /** Clip each rectangle of the region.
+     */
+    [[nodiscard]] constexpr friend damage_region intersect(damage_region const& lhs, aarectanglei const& rhs) noexcept
+    {
+        auto r = damage_region{};
+        for (hilet& rectangle : lhs) {
+            r |= intersect(rectangle, rhs);
+        }
+        return r;
+    }
+
+    /** Extend each rectangle of the region to a multiple of the granularity.
+     */
+    [[nodiscard]] constexpr friend damage_region ceil(damage_region const& lhs, extent2i const& rhs) noexcept
+    {
+        // Extended rectangles may overlap, add them one by one so that they are merged again.
+        auto r = damage_region{};
+        for (hilet& rectangle : lhs) {
+            r |= ceil(rectangle, rhs);
+        }
+        return r;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(damage_region const& lhs, damage_region const& rhs) noexcept
+    {
+        if (lhs._size != rhs._size) {
+            return false;
+        }
+        for (auto i = 0_uz; i != lhs._size; ++i) {
+            if (lhs._rectangles[i] != rhs._rectangles[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::array<aarectanglei, max_size> _rectangles = {};
+    std::size_t _size = 0;
+
+    [[nodiscard]] constexpr static int64_t area(aarectanglei const& rhs) noexcept
+    {
+        return int64_t{rhs.width()} * int64_t{rhs.height()};
+    }
+
+    [[nodiscard]] constexpr static bool contains(aarectanglei const& lhs, aarectanglei const& rhs) noexcept
+    {
+        return lhs.left() <= rhs.left() and lhs.right() >= rhs.right() and lhs.bottom() <= rhs.bottom() and
+            lhs.top() >= rhs.top();
+    }
+
+    /** Two rectangles are merged when their bounding rectangle is at most 50% larger than the sum of both.
+     */
+    [[nodiscard]] constexpr static bool should_merge(aarectanglei const& lhs, aarectanglei const& rhs) noexcept
+    {
+        return area(lhs | rhs) * 2 <= (area(lhs) + area(rhs)) * 3;
+    }
+
+    [[nodiscard]] constexpr std::size_t cheapest_merge(aarectanglei const& rhs) const noexcept
+    {
+        hi_axiom(_size != 0);
+
+        auto r = 0_uz;
+        auto r_cost = std::numeric_limits<int64_t>::max();
+        for (auto i = 0_uz; i != _size; ++i) {
+            hilet cost = area(_rectangles[i] | rhs) - area(_rectangles[i]);
+            if (cost < r_cost) {
+                r = i;
+                r_cost = cost;
+            }
+        }
+        return r;
+    }
+
+    constexpr void erase(std::size_t index) noexcept
+    {
+        hi_axiom(index < _size);
+        _rectangles[index] = _rectangles[--_size];
+    }
+};
+
+} // namespace hi::inline v1
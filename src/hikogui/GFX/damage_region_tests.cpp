@@ -0,0 +1,105 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "damage_region.hpp"
+#include <gtest/gtest.h>
+
+using namespace hi;
+
+TEST(damage_region, empty)
+{
+    auto region = damage_region{};
+    ASSERT_TRUE(region.empty());
+    ASSERT_FALSE(region);
+
+    region |= aarectanglei{};
+    ASSERT_TRUE(region.empty());
+    ASSERT_FALSE(overlaps(region, aarectanglei{0, 0, 100, 100}));
+}
+
+TEST(damage_region, far_apart)
+{
+    // A cursor in the bottom-left and a progress bar in the top-right of a window.
+    auto region = damage_region{aarectanglei{10, 10, 2, 20}};
+    region |= aarectanglei{800, 550, 100, 10};
+
+    ASSERT_EQ(region.size(), 2);
+    ASSERT_EQ(region.area(), 2 * 20 + 100 * 10);
+    ASSERT_EQ(bounding_rectangle(region), (aarectanglei{10, 10, 890, 550}));
+
+    ASSERT_TRUE(overlaps(region, aarectanglei{0, 0, 11, 11}));
+    ASSERT_TRUE(overlaps(region, aarectanglei{850, 555, 10, 10}));
+    ASSERT_FALSE(overlaps(region, aarectanglei{400, 300, 10, 10}));
+}
+
+TEST(damage_region, overlapping_are_merged)
+{
+    auto region = damage_region{aarectanglei{0, 0, 100, 10}};
+    region |= aarectanglei{50, 5, 100, 10};
+
+    ASSERT_EQ(region.size(), 1);
+    ASSERT_EQ(region[0], (aarectanglei{0, 0, 150, 15}));
+
+    // A rectangle inside the region does not change it.
+    region |= aarectanglei{10, 2, 5, 5};
+    ASSERT_EQ(region.size(), 1);
+    ASSERT_EQ(region[0], (aarectanglei{0, 0, 150, 15}));
+}
+
+TEST(damage_region, nearby_are_merged)
+{
+    // Two characters next to each other, with a small gap.
+    auto region = damage_region{aarectanglei{0, 0, 10, 20}};
+    region |= aarectanglei{12, 0, 10, 20};
+    ASSERT_EQ(region.size(), 1);
+    ASSERT_EQ(region[0], (aarectanglei{0, 0, 22, 20}));
+}
+
+TEST(damage_region, merge_chain)
+{
+    auto region = damage_region{aarectanglei{0, 0, 10, 10}};
+    region |= aarectanglei{100, 0, 10, 10};
+    ASSERT_EQ(region.size(), 2);
+
+    // Merging with the first rectangle causes the result to overlap the second.
+    region |= aarectanglei{5, 0, 100, 10};
+    ASSERT_EQ(region.size(), 1);
+    ASSERT_EQ(region[0], (aarectanglei{0, 0, 110, 10}));
+}
+
+TEST(damage_region, full)
+{
+    auto region = damage_region{};
+    for (auto i = 0; i != narrow_cast<int>(damage_region::max_size) + 4; ++i) {
+        region |= aarectanglei{i * 100, i * 100, 5, 5};
+
+        ASSERT_LE(region.size(), damage_region::max_size);
+        // Every rectangle that was added is still covered.
+        for (auto j = 0; j <= i; ++j) {
+            ASSERT_TRUE(overlaps(region, aarectanglei{j * 100 + 2, j * 100 + 2, 1, 1}));
+        }
+    }
+
+    // The rectangles are disjoint.
+    for (auto i = 0_uz; i != region.size(); ++i) {
+        for (auto j = i + 1; j != region.size(); ++j) {
+            ASSERT_FALSE(intersect(region[i], region[j]));
+        }
+    }
+}
+
+TEST(damage_region, clip_and_granularity)
+{
+    auto region = damage_region{aarectanglei{-10, 5, 20, 10}};
+    region |= aarectanglei{500, 500, 20, 20};
+
+    hilet clipped = intersect(region, aarectanglei{0, 0, 100, 100});
+    ASSERT_EQ(clipped.size(), 1);
+    ASSERT_EQ(clipped[0], (aarectanglei{0, 5, 10, 10}));
+
+    hilet rounded = ceil(region, extent2i{16, 16});
+    ASSERT_EQ(rounded.size(), 2);
+    ASSERT_EQ(rounded[0], (aarectanglei{-16, 0, 32, 16}));
+    ASSERT_EQ(rounded[1], (aarectanglei{496, 496, 32, 32}));
+}
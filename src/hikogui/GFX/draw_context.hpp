@@ -9,6 +9,7 @@
 #include "pipeline_SDF_vertex.hpp"
 #include "pipeline_alpha_vertex.hpp"
 #include "subpixel_orientation.hpp"
+#include "damage_region.hpp"
 #include "../geometry/module.hpp"
 #include "../unicode/unicode_bidi_class.hpp"
 #include "../text/text_cursor.hpp"
@@ -210,15 +211,19 @@ concept draw_quad_shape = std::same_as<Context, quad> or std::same_as<Context, r
  */
 class draw_context {
 public:
-    gfx_device_vulkan& device;
+    /** The device to draw images and glyphs with.
+     *
+     * May be nullptr when drawing headless, in which case no images and glyphs can be drawn.
+     */
+    gfx_device_vulkan *device;
 
     /** The frame buffer index of the image we are currently rendering.
      */
     std::size_t frame_buffer_index;
 
-    /** This is the rectangle of the window that is being redrawn.
+    /** The parts of the window that are being redrawn.
      */
-    aarectanglei scissor_rectangle;
+    damage_region scissor_region;
 
     /** The background color to clear the window with.
      */
@@ -247,7 +252,7 @@ public:
     ~draw_context() = default;
 
     draw_context(
-        gfx_device_vulkan& device,
+        gfx_device_vulkan *device,
         vector_span<pipeline_box::vertex>& box_vertices,
         vector_span<pipeline_image::vertex>& image_vertices,
         vector_span<pipeline_SDF::vertex>& sdf_vertices,
@@ -556,14 +561,14 @@ public:
 
     /** Checks if a widget's layout overlaps with the part of the window that is being drawn.
      *
-     * @param context The draw context which contains the scissor rectangle.
+     * @param context The draw context which contains the scissor region.
      * @param layout The layout of a widget which contains the rectangle where the widget is located
      *               on the window
      * @return True if the widget needs to draw into the context.
      */
     [[nodiscard]] friend bool overlaps(draw_context const& context, widget_layout const& layout) noexcept
     {
-        return overlaps(context.scissor_rectangle, layout.clipping_rectangle_on_window());
+        return overlaps(context.scissor_region, layout.clipping_rectangle_on_window());
     }
 
 private:
@@ -15,14 +15,14 @@
 namespace hi::inline v1 {
 
 draw_context::draw_context(
-    gfx_device_vulkan& device,
+    gfx_device_vulkan *device,
     vector_span<pipeline_box::vertex>& box_vertices,
     vector_span<pipeline_image::vertex>& image_vertices,
     vector_span<pipeline_SDF::vertex>& sdf_vertices,
     vector_span<pipeline_alpha::vertex>& alpha_vertices) noexcept :
     device(device),
     frame_buffer_index(std::numeric_limits<size_t>::max()),
-    scissor_rectangle(),
+    scissor_region(),
     _box_vertices(&box_vertices),
     _image_vertices(&image_vertices),
     _sdf_vertices(&sdf_vertices),
@@ -87,7 +87,8 @@ draw_context::_draw_image(aarectanglei const& clipping_rectangle, quad const& bo
         return false;
     }
 
-    auto &pipeline = *down_cast<gfx_device_vulkan&>(device).image_pipeline;
+    hi_assert_not_null(device);
+    auto &pipeline = *device->image_pipeline;
     pipeline.place_vertices(*_image_vertices, narrow_cast<aarectangle>(clipping_rectangle), box, image);
     return true;
 }
@@ -99,7 +100,8 @@ void draw_context::_draw_glyph(
     draw_attributes const& attributes) const noexcept
 {
     hi_assert_not_null(_sdf_vertices);
-    auto &pipeline = *down_cast<gfx_device_vulkan&>(device).SDF_pipeline;
+    hi_assert_not_null(device);
+    auto &pipeline = *device->SDF_pipeline;
 
     if (_sdf_vertices->full()) {
         auto box_attributes = attributes;
@@ -124,7 +126,8 @@ void draw_context::_draw_text(
     draw_attributes const& attributes) const noexcept
 {
     hi_assert_not_null(_sdf_vertices);
-    auto &pipeline = *down_cast<gfx_device_vulkan&>(device).SDF_pipeline;
+    hi_assert_not_null(device);
+    auto &pipeline = *device->SDF_pipeline;
 
     auto atlas_was_updated = false;
     for (hilet& c : text) {
@@ -93,6 +93,11 @@ public:
      */
     std::vector<const char *> requiredExtensions;
 
+    /** The device supports VK_KHR_incremental_present.
+     * When supported, only the parts of the window that were redrawn are presented.
+     */
+    bool supportsIncrementalPresent = false;
+
     bool supportsLazyTransientImages = false;
     vk::ImageUsageFlags transientImageUsageFlags = vk::ImageUsageFlags{};
     VmaMemoryUsage lazyMemoryUsage = VMA_MEMORY_USAGE_GPU_ONLY;
@@ -550,14 +550,23 @@ void gfx_device_vulkan::initialize_device()
     device_descriptor_indexing_features.setPNext(&physical_device_features);
     device_descriptor_indexing_features.setShaderSampledImageArrayNonUniformIndexing(VK_TRUE);
 
+    // Enable optional extensions.
+    auto device_extensions = requiredExtensions;
+    for (auto extension_properties : physicalIntrinsic.enumerateDeviceExtensionProperties()) {
+        if (std::string(extension_properties.extensionName.data()) == VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME) {
+            device_extensions.push_back(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME);
+            supportsIncrementalPresent = true;
+        }
+    }
+
     auto device_create_info = vk::DeviceCreateInfo{
         vk::DeviceCreateFlags(),
         narrow_cast<uint32_t>(device_queue_create_infos.size()),
         device_queue_create_infos.data(),
         0,
         nullptr,
-        narrow_cast<uint32_t>(requiredExtensions.size()),
-        requiredExtensions.data(),
+        narrow_cast<uint32_t>(device_extensions.size()),
+        device_extensions.data(),
         nullptr};
     device_create_info.setPNext(&device_descriptor_indexing_features);
 
@@ -56,7 +56,12 @@ public:
      */
     virtual void update(extent2i new_size) noexcept = 0;
 
-    [[nodiscard]] virtual draw_context render_start(aarectanglei redraw_rectangle) = 0;
+    /** Start rendering a frame.
+     *
+     * @param redraw_region The parts of the window that need to be redrawn.
+     * @return The draw context, which is false when nothing needs to be drawn.
+     */
+    [[nodiscard]] virtual draw_context render_start(damage_region const& redraw_region) = 0;
     virtual void render_finish(draw_context const &context) = 0;
 
     /** Add a delegate to handle extra rendering.
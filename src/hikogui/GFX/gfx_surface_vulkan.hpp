@@ -9,6 +9,7 @@
 #include <vulkan/vulkan.hpp>
 #include <vma/vk_mem_alloc.h>
 #include <optional>
+#include <vector>
 
 namespace hi::inline v1 {
 class gfx_surface_delegate_vulkan;
@@ -33,7 +34,7 @@ struct swapchain_image_info {
     vk::Image image;
     vk::ImageView image_view;
     vk::Framebuffer frame_buffer;
-    aarectanglei redraw_rectangle;
+    damage_region redraw_region;
     bool layout_is_present = false;
 };
 
@@ -95,7 +96,7 @@ public:
 
     void update(extent2i new_size) noexcept override;
 
-    [[nodiscard]] draw_context render_start(aarectanglei redraw_rectangle) override;
+    [[nodiscard]] draw_context render_start(damage_region const& redraw_region) override;
     void render_finish(draw_context const& context) override;
 
     void add_delegate(gfx_surface_delegate *delegate) noexcept override;
@@ -125,13 +126,23 @@ private:
     void teardown_for_window_lost() noexcept;
 
     std::optional<uint32_t> acquire_next_image_from_swapchain();
-    void present_image_to_queue(uint32_t frameBufferIndex, vk::Semaphore renderFinishedSemaphore);
+    void present_image_to_queue(
+        uint32_t frameBufferIndex,
+        vk::Semaphore renderFinishedSemaphore,
+        std::vector<vk::Rect2D> const& render_areas);
 
-    /**
+    /** Record a single render pass, which draws into each of the render areas.
+     *
      * @param current_image Information about the swapchain-image to be rendered.
      * @param context The drawing context.
+     * @param bounding_render_area The area that encloses all the render areas.
+     * @param render_areas The disjoint areas of the swapchain-image that are redrawn.
      */
-    void fill_command_buffer(swapchain_image_info const& current_image, draw_context const& context, vk::Rect2D render_area);
+    void fill_command_buffer(
+        swapchain_image_info const& current_image,
+        draw_context const& context,
+        vk::Rect2D bounding_render_area,
+        std::vector<vk::Rect2D> const& render_areas);
 
     /** Submit the command buffer updated with fill command buffer.
      *
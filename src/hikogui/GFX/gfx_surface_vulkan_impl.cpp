@@ -171,7 +171,10 @@ std::optional<uint32_t> gfx_surface_vulkan::acquire_next_image_from_swapchain()
     }
 }
 
-void gfx_surface_vulkan::present_image_to_queue(uint32_t frameBufferIndex, vk::Semaphore semaphore)
+void gfx_surface_vulkan::present_image_to_queue(
+    uint32_t frameBufferIndex,
+    vk::Semaphore semaphore,
+    std::vector<vk::Rect2D> const& render_areas)
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
@@ -182,14 +185,31 @@ void gfx_surface_vulkan::present_image_to_queue(uint32_t frameBufferIndex, vk::S
     std::array<uint32_t, 1> const presentImageIndices = {frameBufferIndex};
     hi_assert(presentSwapchains.size() == presentImageIndices.size());
 
+    auto present_info = vk::PresentInfoKHR{
+        narrow_cast<uint32_t>(renderFinishedSemaphores.size()),
+        renderFinishedSemaphores.data(),
+        narrow_cast<uint32_t>(presentSwapchains.size()),
+        presentSwapchains.data(),
+        presentImageIndices.data()};
+
+    // Tell the presentation engine which parts of the image have changed, so that it
+    // only has to copy or compose those parts.
+    auto present_rectangles = std::vector<vk::RectLayerKHR>{};
+    auto present_region = vk::PresentRegionKHR{};
+    auto present_regions = vk::PresentRegionsKHR{};
+    if (vulkan_device().supportsIncrementalPresent) {
+        present_rectangles.reserve(render_areas.size());
+        for (hilet& render_area : render_areas) {
+            present_rectangles.emplace_back(render_area.offset, render_area.extent, 0);
+        }
+        present_region = vk::PresentRegionKHR{narrow_cast<uint32_t>(present_rectangles.size()), present_rectangles.data()};
+        present_regions = vk::PresentRegionsKHR{1, &present_region};
+        present_info.setPNext(&present_regions);
+    }
+
     try {
         // hi_log_debug("presentQueue {}", presentImageIndices.at(0));
-        hilet result = _present_queue->queue.presentKHR(
-            {narrow_cast<uint32_t>(renderFinishedSemaphores.size()),
-             renderFinishedSemaphores.data(),
-             narrow_cast<uint32_t>(presentSwapchains.size()),
-             presentSwapchains.data(),
-             presentImageIndices.data()});
+        hilet result = _present_queue->queue.presentKHR(present_info);
 
         switch (result) {
         case vk::Result::eSuccess:
@@ -406,22 +426,22 @@ void gfx_surface_vulkan::update(extent2i new_size) noexcept
     build(new_size);
 }
 
-draw_context gfx_surface_vulkan::render_start(aarectanglei redraw_rectangle)
+draw_context gfx_surface_vulkan::render_start(damage_region const& redraw_region)
 {
-    // Extent the redraw_rectangle to the render-area-granularity to improve performance on tile based GPUs.
-    redraw_rectangle = ceil(redraw_rectangle, _render_area_granularity);
+    // Extent the redraw_region to the render-area-granularity to improve performance on tile based GPUs.
+    hilet redraw_region_ = ceil(redraw_region, _render_area_granularity);
 
     hilet lock = std::scoped_lock(gfx_system_mutex);
 
     auto r = draw_context{
-        *down_cast<gfx_device_vulkan *>(_device),
+        down_cast<gfx_device_vulkan *>(_device),
         box_pipeline->vertexBufferData,
         image_pipeline->vertexBufferData,
         SDF_pipeline->vertexBufferData,
         alpha_pipeline->vertexBufferData};
 
     // Bail out when the window is not yet ready to be rendered, or if there is nothing to render.
-    if (state != gfx_surface_state::has_swapchain or not redraw_rectangle) {
+    if (state != gfx_surface_state::has_swapchain or not redraw_region_) {
         return r;
     }
 
@@ -437,15 +457,21 @@ draw_context gfx_surface_vulkan::render_start(aarectanglei redraw_rectangle)
 
     // Record which part of the image will be redrawn on the current swapchain image.
     auto& current_image = swapchain_image_infos.at(r.frame_buffer_index);
-    current_image.redraw_rectangle = redraw_rectangle;
+    current_image.redraw_region = redraw_region_;
 
-    // Calculate the scissor rectangle, from the combined redraws of the complete swapchain.
+    // Calculate the scissor region, from the combined redraws of the complete swapchain.
     // We need to do this so that old redraws are also executed in the current swapchain image.
-    r.scissor_rectangle = std::accumulate(
-        swapchain_image_infos.cbegin(), swapchain_image_infos.cend(), aarectanglei{}, [](hilet& sum, hilet& item) {
-            return sum | item.redraw_rectangle;
+    r.scissor_region = std::accumulate(
+        swapchain_image_infos.cbegin(), swapchain_image_infos.cend(), damage_region{}, [](hilet& sum, hilet& item) {
+            return sum | item.redraw_region;
         });
 
+    if (not _delegates.empty()) {
+        // Delegates draw into the area enclosing the region, which means the user interface must be
+        // redrawn in that whole area.
+        r.scissor_region = damage_region{bounding_rectangle(r.scissor_region)};
+    }
+
     // Wait until previous rendering has finished, before the next rendering.
     vulkan_device().waitForFences({renderFinishedFence}, VK_TRUE, std::numeric_limits<uint64_t>::max());
 
@@ -471,36 +497,48 @@ void gfx_surface_vulkan::render_finish(draw_context const& context)
         current_image.layout_is_present = true;
     }
 
-    // Clamp the scissor rectangle to the size of the window.
-    hilet clamped_scissor_rectangle =
-        intersect(context.scissor_rectangle, aarectanglei{0, 0, narrow_cast<int>(swapchainImageExtent.width), narrow_cast<int>(swapchainImageExtent.height)});
+    // Clamp the scissor region to the size of the window.
+    hilet clamped_scissor_region = intersect(
+        context.scissor_region,
+        aarectanglei{0, 0, narrow_cast<int>(swapchainImageExtent.width), narrow_cast<int>(swapchainImageExtent.height)});
+
+    // The window's coordinate system has its origin at the bottom-left, Vulkan at the top-left.
+    hilet to_render_area = [&](aarectanglei const& rectangle) {
+        return vk::Rect2D{
+            vk::Offset2D(
+                narrow_cast<uint32_t>(rectangle.left()),
+                narrow_cast<uint32_t>(swapchainImageExtent.height - rectangle.bottom() - rectangle.height())),
+            vk::Extent2D(narrow_cast<uint32_t>(rectangle.width()), narrow_cast<uint32_t>(rectangle.height()))};
+    };
+
+    // The delegates render underneath the user interface; they are given the area that encloses the region.
+    hilet bounding_render_area = to_render_area(bounding_rectangle(clamped_scissor_region));
 
-    hilet render_area = vk::Rect2D{
-        vk::Offset2D(
-            narrow_cast<uint32_t>(clamped_scissor_rectangle.left()),
-            narrow_cast<uint32_t>(
-                swapchainImageExtent.height - clamped_scissor_rectangle.bottom() - clamped_scissor_rectangle.height())),
-        vk::Extent2D(
-            narrow_cast<uint32_t>(clamped_scissor_rectangle.width()), narrow_cast<uint32_t>(clamped_scissor_rectangle.height()))};
+    // Each disjoint rectangle of the scissor region is drawn with its own scissor.
+    auto render_areas = std::vector<vk::Rect2D>{};
+    render_areas.reserve(clamped_scissor_region.size());
+    for (hilet& rectangle : clamped_scissor_region) {
+        render_areas.push_back(to_render_area(rectangle));
+    }
 
     // Start the first delegate when the swapchain-image becomes available.
     auto start_semaphore = imageAvailableSemaphore;
     for (auto [delegate, end_semaphore] : _delegates) {
         hi_assert_not_null(delegate);
 
-        delegate->draw(narrow_cast<uint32_t>(context.frame_buffer_index), start_semaphore, end_semaphore, render_area);
+        delegate->draw(narrow_cast<uint32_t>(context.frame_buffer_index), start_semaphore, end_semaphore, bounding_render_area);
         start_semaphore = end_semaphore;
     }
 
     // Wait for the semaphore of the last delegate before it will write into the swapchain-image.
-    fill_command_buffer(current_image, context, render_area);
+    fill_command_buffer(current_image, context, bounding_render_area, render_areas);
     submit_command_buffer(start_semaphore);
 
     // Signal the fence when all rendering has finished on the graphics queue.
     // When the fence is signaled we can modify/destroy the command buffers.
     [[maybe_unused]] hilet submit_result = _graphics_queue->queue.submit(0, nullptr, renderFinishedFence);
 
-    present_image_to_queue(narrow_cast<uint32_t>(context.frame_buffer_index), renderFinishedSemaphore);
+    present_image_to_queue(narrow_cast<uint32_t>(context.frame_buffer_index), renderFinishedSemaphore, render_areas);
 
     // Do an early tear down of invalid vulkan objects.
     teardown();
@@ -509,7 +547,8 @@ void gfx_surface_vulkan::render_finish(draw_context const& context)
 void gfx_surface_vulkan::fill_command_buffer(
     swapchain_image_info const& current_image,
     draw_context const& context,
-    vk::Rect2D render_area)
+    vk::Rect2D bounding_render_area,
+    std::vector<vk::Rect2D> const& render_areas)
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
@@ -531,25 +570,29 @@ void gfx_surface_vulkan::fill_command_buffer(
         vk::ClearValue{sdfClearValue},
         vk::ClearValue{colorClearValue}};
 
-    // The scissor and render area makes sure that the frame buffer is not modified where we are not drawing the widgets.
-    hilet scissors = std::array{render_area};
-    commandBuffer.setScissor(0, scissors);
-
+    // Only the depth and color attachments are cleared over the bounding render area; they are not stored.
+    // The swapchain attachment is loaded, and the pipelines only write inside the scissor of each render area,
+    // so that the undamaged parts between the render areas are kept.
     commandBuffer.beginRenderPass(
-        {renderPass, current_image.frame_buffer, render_area, narrow_cast<uint32_t>(clearValues.size()), clearValues.data()},
+        {renderPass,
+         current_image.frame_buffer,
+         bounding_render_area,
+         narrow_cast<uint32_t>(clearValues.size()),
+         clearValues.data()},
         vk::SubpassContents::eInline);
 
-    box_pipeline->draw_in_command_buffer(commandBuffer, context);
+    box_pipeline->draw_in_command_buffer(commandBuffer, context, render_areas);
     commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    image_pipeline->draw_in_command_buffer(commandBuffer, context);
+    image_pipeline->draw_in_command_buffer(commandBuffer, context, render_areas);
     commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    SDF_pipeline->draw_in_command_buffer(commandBuffer, context);
+    SDF_pipeline->draw_in_command_buffer(commandBuffer, context, render_areas);
     commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    alpha_pipeline->draw_in_command_buffer(commandBuffer, context);
+    alpha_pipeline->draw_in_command_buffer(commandBuffer, context, render_areas);
     commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    tone_mapper_pipeline->draw_in_command_buffer(commandBuffer, context);
+    tone_mapper_pipeline->draw_in_command_buffer(commandBuffer, context, render_areas);
 
     commandBuffer.endRenderPass();
+
     commandBuffer.end();
 }
 
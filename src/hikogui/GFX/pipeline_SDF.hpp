@@ -28,7 +28,10 @@ public:
     pipeline_SDF(pipeline_SDF &&) = delete;
     pipeline_SDF &operator=(pipeline_SDF &&) = delete;
 
-    void draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const& context) override;
+    void draw_in_command_buffer(
+        vk::CommandBuffer commandBuffer,
+        draw_context const& context,
+        std::span<vk::Rect2D const> render_areas) override;
 
 protected:
     push_constants pushConstants;
@@ -27,7 +27,10 @@ public:
     pipeline_alpha(pipeline_alpha &&) = delete;
     pipeline_alpha &operator=(pipeline_alpha &&) = delete;
 
-    void draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const& context) override;
+    void draw_in_command_buffer(
+        vk::CommandBuffer commandBuffer,
+        draw_context const& context,
+        std::span<vk::Rect2D const> render_areas) override;
 
 protected:
     push_constants pushConstants;
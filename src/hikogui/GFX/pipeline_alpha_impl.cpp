@@ -25,9 +25,12 @@ std::vector<vk::PipelineColorBlendAttachmentState> pipeline_alpha::getPipelineCo
          vk::ColorComponentFlagBits::eA}};
 }
 
-void pipeline_alpha::draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const& context)
+void pipeline_alpha::draw_in_command_buffer(
+    vk::CommandBuffer commandBuffer,
+    draw_context const& context,
+    std::span<vk::Rect2D const> render_areas)
 {
-    pipeline_vulkan::draw_in_command_buffer(commandBuffer, context);
+    pipeline_vulkan::draw_in_command_buffer(commandBuffer, context, render_areas);
 
     vulkan_device().flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof(vertex));
 
@@ -52,7 +55,9 @@ void pipeline_alpha::draw_in_command_buffer(vk::CommandBuffer commandBuffer, dra
     hilet numberOfTriangles = numberOfRectangles * 2;
 
     vulkan_device().cmdBeginDebugUtilsLabelEXT(commandBuffer, "draw alpha overlays");
-    commandBuffer.drawIndexed(narrow_cast<uint32_t>(numberOfTriangles * 3), 1, 0, 0, 0);
+    draw_in_render_areas(commandBuffer, render_areas, [&] {
+        commandBuffer.drawIndexed(narrow_cast<uint32_t>(numberOfTriangles * 3), 1, 0, 0, 0);
+    });
     vulkan_device().cmdEndDebugUtilsLabelEXT(commandBuffer);
 }
 
@@ -10,9 +10,12 @@ namespace hi::inline v1::pipeline_box {
 
 pipeline_box::pipeline_box(gfx_surface const &surface) : pipeline_vulkan(surface) {}
 
-void pipeline_box::draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const& context)
+void pipeline_box::draw_in_command_buffer(
+    vk::CommandBuffer commandBuffer,
+    draw_context const& context,
+    std::span<vk::Rect2D const> render_areas)
 {
-    pipeline_vulkan::draw_in_command_buffer(commandBuffer, context);
+    pipeline_vulkan::draw_in_command_buffer(commandBuffer, context, render_areas);
 
     vulkan_device().flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof(vertex));
 
@@ -37,7 +40,9 @@ void pipeline_box::draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_
     hilet numberOfTriangles = numberOfRectangles * 2;
 
     vulkan_device().cmdBeginDebugUtilsLabelEXT(commandBuffer, "draw boxes");
-    commandBuffer.drawIndexed(narrow_cast<uint32_t>(numberOfTriangles * 3), 1, 0, 0, 0);
+    draw_in_render_areas(commandBuffer, render_areas, [&] {
+        commandBuffer.drawIndexed(narrow_cast<uint32_t>(numberOfTriangles * 3), 1, 0, 0, 0);
+    });
     vulkan_device().cmdEndDebugUtilsLabelEXT(commandBuffer);
 }
 
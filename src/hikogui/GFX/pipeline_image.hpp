@@ -9,6 +9,7 @@
 #include "pipeline_image_vertex.hpp"
 #include "../vector_span.hpp"
 #include <vma/vk_mem_alloc.h>
+#include <span>
 
 namespace hi::inline v1::pipeline_image {
 
@@ -27,7 +28,10 @@ public:
     pipeline_image(pipeline_image &&) = delete;
     pipeline_image &operator=(pipeline_image &&) = delete;
 
-    void draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const &context) override;
+    void draw_in_command_buffer(
+        vk::CommandBuffer commandBuffer,
+        draw_context const& context,
+        std::span<vk::Rect2D const> render_areas) override;
 
 protected:
     push_constants pushConstants;
@@ -10,9 +10,12 @@ namespace hi::inline v1::pipeline_image {
 
 pipeline_image::pipeline_image(gfx_surface const &surface) : pipeline_vulkan(surface) {}
 
-void pipeline_image::draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const& context)
+void pipeline_image::draw_in_command_buffer(
+    vk::CommandBuffer commandBuffer,
+    draw_context const& context,
+    std::span<vk::Rect2D const> render_areas)
 {
-    pipeline_vulkan::draw_in_command_buffer(commandBuffer, context);
+    pipeline_vulkan::draw_in_command_buffer(commandBuffer, context, render_areas);
 
     vulkan_device().flushAllocation(vertexBufferAllocation, 0, vertexBufferData.size() * sizeof(vertex));
     vulkan_device().image_pipeline->prepare_atlas_for_rendering();
@@ -39,7 +42,9 @@ void pipeline_image::draw_in_command_buffer(vk::CommandBuffer commandBuffer, dra
     hilet numberOfRectangles = vertexBufferData.size() / 4;
     hilet numberOfTriangles = numberOfRectangles * 2;
     vulkan_device().cmdBeginDebugUtilsLabelEXT(commandBuffer, "draw images");
-    commandBuffer.drawIndexed(narrow_cast<uint32_t>(numberOfTriangles * 3), 1, 0, 0, 0);
+    draw_in_render_areas(commandBuffer, render_areas, [&] {
+        commandBuffer.drawIndexed(narrow_cast<uint32_t>(numberOfTriangles * 3), 1, 0, 0, 0);
+    });
     vulkan_device().cmdEndDebugUtilsLabelEXT(commandBuffer);
 }
 
@@ -24,7 +24,10 @@ public:
     pipeline_tone_mapper(pipeline_tone_mapper &&) = delete;
     pipeline_tone_mapper &operator=(pipeline_tone_mapper &&) = delete;
 
-    void draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const& context) override;
+    void draw_in_command_buffer(
+        vk::CommandBuffer commandBuffer,
+        draw_context const& context,
+        std::span<vk::Rect2D const> render_areas) override;
 
 protected:
     push_constants _push_constants;
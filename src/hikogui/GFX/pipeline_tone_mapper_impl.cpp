@@ -11,9 +11,12 @@ namespace hi::inline v1::pipeline_tone_mapper {
 
 pipeline_tone_mapper::pipeline_tone_mapper(gfx_surface const &surface) : pipeline_vulkan(surface) {}
 
-void pipeline_tone_mapper::draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const& context)
+void pipeline_tone_mapper::draw_in_command_buffer(
+    vk::CommandBuffer commandBuffer,
+    draw_context const& context,
+    std::span<vk::Rect2D const> render_areas)
 {
-    pipeline_vulkan::draw_in_command_buffer(commandBuffer, context);
+    pipeline_vulkan::draw_in_command_buffer(commandBuffer, context, render_areas);
 
     vulkan_device().tone_mapper_pipeline->drawInCommandBuffer(commandBuffer);
 
@@ -21,7 +24,9 @@ void pipeline_tone_mapper::draw_in_command_buffer(vk::CommandBuffer commandBuffe
     commandBuffer.pushConstants(pipelineLayout, vk::ShaderStageFlagBits::eFragment, 0, sizeof(push_constants), &_push_constants);
 
     vulkan_device().cmdBeginDebugUtilsLabelEXT(commandBuffer, "tone mapping");
-    commandBuffer.draw(3, 1, 0, 0);
+    draw_in_render_areas(commandBuffer, render_areas, [&] {
+        commandBuffer.draw(3, 1, 0, 0);
+    });
     vulkan_device().cmdEndDebugUtilsLabelEXT(commandBuffer);
 }
 
@@ -9,6 +9,7 @@
 #include <vulkan/vulkan.hpp>
 #include <string>
 #include <vector>
+#include <span>
 
 namespace hi::inline v1 {
 class gfx_device_vulkan;
@@ -27,7 +28,17 @@ public:
 
     gfx_device_vulkan &vulkan_device() const noexcept;
 
-    virtual void draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const &context);
+    /** Record the draw commands of this pipeline.
+     *
+     * The vertices are uploaded and the pipeline is bound once, the draw command
+     * is repeated for each render area with the scissor set to that area.
+     *
+     * @param commandBuffer The command buffer to record into.
+     * @param context The draw context.
+     * @param render_areas The disjoint areas of the swapchain-image that are redrawn.
+     */
+    virtual void
+    draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const &context, std::span<vk::Rect2D const> render_areas);
 
     void build_for_new_device();
     void teardown_for_device_lost();
@@ -62,6 +73,16 @@ protected:
     virtual vk::PipelineDepthStencilStateCreateInfo getPipelineDepthStencilStateCreateInfo() const;
     virtual std::vector<vk::PipelineColorBlendAttachmentState> getPipelineColorBlendAttachmentStates() const;
 
+    /** Record a draw command for each render area, with the scissor set to that area.
+     */
+    static void draw_in_render_areas(vk::CommandBuffer commandBuffer, std::span<vk::Rect2D const> render_areas, auto const& draw)
+    {
+        for (hilet& render_area : render_areas) {
+            commandBuffer.setScissor(0, render_area);
+            draw();
+        }
+    }
+
     virtual void build_vertex_buffers(){};
     virtual void teardown_vertex_buffers(){};
     virtual void build_descriptor_sets();
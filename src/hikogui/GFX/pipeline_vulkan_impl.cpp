@@ -22,7 +22,10 @@ gfx_device_vulkan &pipeline_vulkan::vulkan_device() const noexcept
     return down_cast<gfx_device_vulkan &>(*device);
 }
 
-void pipeline_vulkan::draw_in_command_buffer(vk::CommandBuffer commandBuffer, draw_context const &context)
+void pipeline_vulkan::draw_in_command_buffer(
+    vk::CommandBuffer commandBuffer,
+    draw_context const &context,
+    std::span<vk::Rect2D const> render_areas)
 {
     commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, intrinsic);
 
@@ -7,6 +7,7 @@
 #include "gui_window_size.hpp"
 #include "mouse_cursor.hpp"
 #include "hitbox.hpp"
+#include "hitbox_index.hpp"
 #include "gui_event.hpp"
 #include "keyboard_focus_direction.hpp"
 #include "keyboard_focus_group.hpp"
@@ -89,6 +90,14 @@ public:
      */
     extent2i widget_size;
 
+    /** The number of widgets that updated their constraints during the last frame.
+     */
+    std::size_t num_constrained_widgets = 0;
+
+    /** The number of widgets that updated their layout during the last frame.
+     */
+    std::size_t num_laid_out_widgets = 0;
+
     /** The widget covering the complete window.
      */
     std::unique_ptr<window_widget> widget;
@@ -190,6 +199,15 @@ public:
      */
     virtual void set_window_size(extent2i extent) = 0;
 
+    /** Find the widget that is under the mouse cursor.
+     *
+     * The widgets are found through the hitbox index of the window, which is
+     * updated after each layout, instead of recursing through the widget tree.
+     *
+     * @param position The position of the mouse in window coordinates.
+     */
+    [[nodiscard]] hitbox hitbox_test(point2i position) const noexcept;
+
     void update_mouse_target(widget_id new_target_widget, point2i position = {}) noexcept;
 
     /** Change the keyboard focus to the given widget.
@@ -260,7 +278,9 @@ protected:
 
     box_constraints _widget_constraints = {};
 
-    std::atomic<aarectanglei> _redraw_rectangle = aarectanglei{};
+    /** The parts of the window that need to be redrawn on the next frame.
+     */
+    damage_region _redraw_region;
     std::atomic<bool> _relayout = false;
     std::atomic<bool> _reconstrain = false;
     std::atomic<bool> _resize = false;
@@ -306,6 +326,10 @@ private:
      */
     widget_id _keyboard_target_id;
 
+    /** Spatial index of the widgets, used for routing mouse events.
+     */
+    hitbox_index _hitbox_index;
+
     /** Send event to a target widget.
      *
      * The commands are send in order, until the command is handled, then processing stops immediately.
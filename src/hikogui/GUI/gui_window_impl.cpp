@@ -12,6 +12,7 @@
 #include "../widgets/window_widget.hpp"
 #include "../widgets/grid_widget.hpp"
 #include "../trace.hpp"
+#include "../counters.hpp"
 #include "../log.hpp"
 
 namespace hi::inline v1 {
@@ -43,7 +44,7 @@ void gui_window::init()
     // Execute a constraint check to determine initial window size.
     theme = gui.theme_book->find(*gui.selected_theme, os_settings::theme_mode()).transform(dpi);
 
-    _widget_constraints = widget->update_constraints();
+    _widget_constraints = widget->reconstrain();
     hilet new_size = _widget_constraints.preferred;
 
     // Reset the keyboard target to not focus anything.
@@ -85,8 +86,7 @@ void gui_window::render(utc_nanoseconds display_time_point)
     hi_assert_not_null(surface);
     hi_assert_not_null(widget);
 
-    // When a widget requests it or a window-wide event like language change
-    // has happened all the widgets will be set_constraints().
+    // When a window-wide event like language change has happened all the widgets will be reconstrained.
     auto need_reconstrain = _reconstrain.exchange(false, std::memory_order_relaxed);
 
 #if 0
@@ -95,11 +95,19 @@ void gui_window::render(utc_nanoseconds display_time_point)
 #endif
 
     if (need_reconstrain) {
-        hilet t2 = trace<"window::constrain">();
-
         theme = gui.theme_book->find(*gui.selected_theme, os_settings::theme_mode()).transform(dpi);
+        widget->request_reconstrain_recursive();
+    }
+
+    // Only the widgets that requested it, and their ancestors whose children's constraints changed,
+    // are reconstrained.
+    num_constrained_widgets = 0;
+    if (widget->need_reconstrain()) {
+        hilet t2 = trace<"window::constrain">();
 
-        _widget_constraints = widget->update_constraints();
+        hilet count = static_cast<uint64_t>(global_counter<"widget:update_constraints">);
+        _widget_constraints = widget->reconstrain();
+        num_constrained_widgets = narrow_cast<std::size_t>(global_counter<"widget:update_constraints"> - count);
     }
 
     // Check if the window size matches the preferred size of the window_widget.
@@ -148,27 +156,43 @@ void gui_window::render(utc_nanoseconds display_time_point)
     need_relayout = true;
 #endif
 
-    if (need_reconstrain or need_relayout or widget_size != rectangle.size()) {
+    if (need_relayout) {
+        widget->request_relayout_recursive();
+    }
+
+    num_laid_out_widgets = 0;
+    if (widget->need_relayout() or widget_size != rectangle.size()) {
         hilet t2 = trace<"window::layout">();
+        hilet size_changed = widget_size != rectangle.size();
         widget_size = rectangle.size();
 
         // Guarantee that the layout size is always at least the minimum size.
         // We do this because it simplifies calculations if no minimum checks are necessary inside widget.
         hilet widget_layout_size = max(_widget_constraints.minimum, widget_size);
-        widget->set_layout(widget_layout{widget_layout_size, _size_state, subpixel_orientation(), display_time_point});
+        hilet count = static_cast<uint64_t>(global_counter<"widget:set_layout">);
+        widget->relayout(widget_layout{widget_layout_size, _size_state, subpixel_orientation(), display_time_point});
+        num_laid_out_widgets = narrow_cast<std::size_t>(global_counter<"widget:set_layout"> - count);
+
+        // Only the widgets that were laid out need to move in the hitbox index.
+        if (size_changed) {
+            _hitbox_index.reset(widget_size);
+            widget->reindex(_hitbox_index, true);
+        } else {
+            widget->reindex(_hitbox_index);
+        }
 
         // After layout do a complete redraw.
-        _redraw_rectangle = aarectanglei{widget_size};
+        _redraw_region = aarectanglei{widget_size};
     }
 
 #if 0
     // For performance checks force redraw.
-    _redraw_rectangle = aarectangle{widget_size};
+    _redraw_region = aarectanglei{widget_size};
 #endif
 
-    // Draw widgets if the _redraw_rectangle was set.
-    if (auto draw_context = surface->render_start(_redraw_rectangle)) {
-        _redraw_rectangle = aarectanglei{};
+    // Draw widgets if the _redraw_region was set.
+    if (auto draw_context = surface->render_start(_redraw_region)) {
+        _redraw_region.clear();
         draw_context.display_time_point = display_time_point;
         draw_context.subpixel_orientation = subpixel_orientation();
         draw_context.background_color = widget->background_color();
@@ -190,6 +214,20 @@ void gui_window::render(utc_nanoseconds display_time_point)
     }
 }
 
+hitbox gui_window::hitbox_test(point2i position) const noexcept
+{
+    hi_axiom(loop::main().on_thread());
+    hi_assert_not_null(widget);
+
+    if (_hitbox_index.empty()) {
+        // The widgets have not been laid out yet.
+        return widget->hitbox_test(position);
+    }
+
+    // The index does not include the window-widget itself, which only adds the resize border.
+    return widget->resize_border_hitbox_test(position, _hitbox_index.hitbox_test(position));
+}
+
 void gui_window::update_mouse_target(widget_id new_target_id, point2i position) noexcept
 {
     hi_axiom(loop::main().on_thread());
@@ -287,7 +325,7 @@ bool gui_window::process_event(gui_event const& event) noexcept
 
     switch (event.type()) {
     case window_redraw:
-        _redraw_rectangle.fetch_or(event.rectangle());
+        _redraw_region |= event.rectangle();
         return true;
 
     case window_relayout:
@@ -346,7 +384,7 @@ bool gui_window::process_event(gui_event const& event) noexcept
     case mouse_down:
     case mouse_move:
         {
-            hilet hitbox = widget->hitbox_test(event.mouse().position);
+            hilet hitbox = hitbox_test(event.mouse().position);
             update_mouse_target(hitbox.widget_id, event.mouse().position);
 
             if (event == mouse_down) {
@@ -881,7 +881,7 @@ int gui_window_win32::windowProc(unsigned int uMsg, uint64_t wParam, int64_t lPa
             // Convert to y-axis up coordinate system.
             hilet inv_y = os_settings::primary_monitor_rectangle().height() - y;
 
-            hilet hitbox_type = widget->hitbox_test(screen_to_window() * point2i{x, inv_y}).type;
+            hilet hitbox_type = hitbox_test(screen_to_window() * point2i{x, inv_y}).type;
 
             switch (hitbox_type) {
             case hitbox_type::bottom_resize_border:
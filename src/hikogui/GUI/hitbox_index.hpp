@@ -0,0 +1,263 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "hitbox.hpp"
+#include "../widgets/widget.hpp"
+#include "../geometry/module.hpp"
+#include "../utility/module.hpp"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace hi::inline v1 {
+
+/** A spatial index of the widgets on a window, used for routing the mouse.
+ *
+ * The window is divided in a uniform grid of cells, each cell lists the widgets
+ * whose visible rectangle overlaps the cell. Finding the widget under the mouse
+ * only needs to test the few widgets in a single cell, instead of recursing
+ * through the complete widget tree with `widget::hitbox_test()`.
+ *
+ * The index is updated incrementally after layout by `widget::reindex()`, which
+ * only visits the widgets whose layout has changed.
+ *
+ * @ingroup GUI
+ */
+class hitbox_index {
+public:
+    /** The width and height of a cell in pixels.
+     */
+    constexpr static int cell_size = 32;
+
+    hitbox_index() noexcept = default;
+    hitbox_index(hitbox_index const&) = delete;
+    hitbox_index(hitbox_index&&) = delete;
+    hitbox_index& operator=(hitbox_index const&) = delete;
+    hitbox_index& operator=(hitbox_index&&) = delete;
+
+    ~hitbox_index()
+    {
+        clear();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _rectangles.empty();
+    }
+
+    /** The number of widgets in the index.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _rectangles.size();
+    }
+
+    /** Remove all widgets from the index.
+     */
+    void clear() noexcept
+    {
+        for (hilet& [widget, rectangle] : _rectangles) {
+            widget->_hitbox_index = nullptr;
+        }
+        _rectangles.clear();
+        for (auto& cell : _cells) {
+            cell.clear();
+        }
+    }
+
+    /** Remove all widgets from the index, and change the size of the window.
+     *
+     * @param size The size of the window.
+     */
+    void reset(extent2i size) noexcept
+    {
+        clear();
+        _num_columns = (size.width() + cell_size - 1) / cell_size;
+        _num_rows = (size.height() + cell_size - 1) / cell_size;
+        _cells.resize(narrow_cast<std::size_t>(_num_columns * _num_rows));
+    }
+
+    /** Add a widget to the index, or update the position of a widget already in the index.
+     */
+    void insert(widget const& widget) noexcept
+    {
+        erase(widget);
+
+        hilet rectangle = intersect(widget.layout().rectangle_on_window(), widget.layout().clipping_rectangle_on_window());
+        if (not rectangle) {
+            return;
+        }
+
+        hilet first_column = std::max(rectangle.left() / cell_size, 0);
+        hilet first_row = std::max(rectangle.bottom() / cell_size, 0);
+        hilet last_column = std::min((rectangle.right() - 1) / cell_size + 1, _num_columns);
+        hilet last_row = std::min((rectangle.top() - 1) / cell_size + 1, _num_rows);
+        if (first_column >= last_column or first_row >= last_row) {
+            // The widget is outside the window.
+            return;
+        }
+
+        for (auto row = first_row; row != last_row; ++row) {
+            for (auto column = first_column; column != last_column; ++column) {
+                cell(column, row).emplace_back(std::addressof(widget), rectangle);
+            }
+        }
+        _rectangles.emplace(std::addressof(widget), rectangle);
+        widget._hitbox_index = this;
+    }
+
+    /** Remove a widget from the index.
+     */
+    void erase(widget const& widget) noexcept
+    {
+        hilet it = _rectangles.find(std::addressof(widget));
+        if (it == _rectangles.end()) {
+            return;
+        }
+
+        hilet rectangle = it->second;
+        hilet first_column = std::max(rectangle.left() / cell_size, 0);
+        hilet first_row = std::max(rectangle.bottom() / cell_size, 0);
+        hilet last_column = std::min((rectangle.right() - 1) / cell_size + 1, _num_columns);
+        hilet last_row = std::min((rectangle.top() - 1) / cell_size + 1, _num_rows);
+        for (auto row = first_row; row < last_row; ++row) {
+            for (auto column = first_column; column < last_column; ++column) {
+                auto& cell_ = cell(column, row);
+                hilet jt = std::ranges::find(cell_, std::addressof(widget), &entry_type::ptr);
+                hi_axiom(jt != cell_.end());
+                *jt = cell_.back();
+                cell_.pop_back();
+            }
+        }
+        _rectangles.erase(it);
+        widget._hitbox_index = nullptr;
+    }
+
+    /** Find the widget that is under the mouse cursor.
+     *
+     * The widgets in the index are tested from the highest elevation down, and
+     * the first widget which returns a hitbox wins. For this to give the same result
+     * as the recursive `widget::hitbox_test()` a widget may only return a hitbox for
+     * itself inside its own layout rectangle, and a container that returns a hitbox
+     * for itself must place its children at a higher elevation.
+     *
+     * Top-level widgets are not tested, since their `hitbox_test()` recurses through the
+     * complete widget tree; the caller should combine the result with the hitbox of the
+     * top-level widget itself.
+     *
+     * @param position The position of the mouse in window coordinates.
+     * @return The hitbox of the widget under the mouse, or an empty hitbox.
+     */
+    [[nodiscard]] hitbox hitbox_test(point2i position) const noexcept
+    {
+        if (position.x() < 0 or position.y() < 0) {
+            return {};
+        }
+        hilet column = position.x() / cell_size;
+        hilet row = position.y() / cell_size;
+        if (column >= _num_columns or row >= _num_rows) {
+            return {};
+        }
+
+        _candidates.clear();
+        for (hilet& entry : cell(column, row)) {
+            if (entry.ptr->parent != nullptr and entry.rectangle.contains(position) and is_visible(*entry.ptr)) {
+                _candidates.push_back(entry.ptr);
+            }
+        }
+
+        // Highest elevation first, and at the same elevation children before their parents.
+        std::ranges::sort(_candidates, [](widget const *lhs, widget const *rhs) {
+            if (lhs->layout().elevation != rhs->layout().elevation) {
+                return lhs->layout().elevation > rhs->layout().elevation;
+            } else {
+                return lhs->logical_layer > rhs->logical_layer;
+            }
+        });
+
+        auto r = hitbox{};
+        widget const *hit = nullptr;
+        for (auto *candidate : _candidates) {
+            if (hit != nullptr) {
+                if (candidate->layout().elevation < hit->layout().elevation) {
+                    break;
+                } else if (is_ancestor(*candidate, *hit)) {
+                    // The ancestor would only combine the hitbox of the widget that was hit with its own.
+                    continue;
+                }
+            }
+
+            // Siblings at the same elevation are all tested; the type of hitbox breaks the tie.
+            hilet candidate_hitbox = candidate->hitbox_test(candidate->layout().from_window * position);
+            if (candidate_hitbox.widget_id) {
+                r = std::max(r, candidate_hitbox);
+                if (hit == nullptr) {
+                    hit = candidate;
+                }
+            }
+        }
+        return r;
+    }
+
+private:
+    struct entry_type {
+        widget const *ptr;
+        aarectanglei rectangle;
+    };
+
+    int _num_columns = 0;
+    int _num_rows = 0;
+    std::vector<std::vector<entry_type>> _cells;
+
+    /** The rectangle of each widget in the index, in window coordinates.
+     */
+    std::unordered_map<widget const *, aarectanglei> _rectangles;
+
+    /** Scratch space for hitbox_test() to prevent allocations for each mouse move.
+     */
+    mutable std::vector<widget const *> _candidates;
+
+    [[nodiscard]] std::vector<entry_type>& cell(int column, int row) noexcept
+    {
+        hi_axiom(column >= 0 and column < _num_columns);
+        hi_axiom(row >= 0 and row < _num_rows);
+        return _cells[narrow_cast<std::size_t>(row * _num_columns + column)];
+    }
+
+    [[nodiscard]] std::vector<entry_type> const& cell(int column, int row) const noexcept
+    {
+        hi_axiom(column >= 0 and column < _num_columns);
+        hi_axiom(row >= 0 and row < _num_rows);
+        return _cells[narrow_cast<std::size_t>(row * _num_columns + column)];
+    }
+
+    /** Check if the widget and all its ancestors are visible.
+     *
+     * The index may still contain widgets that have become invisible, since
+     * the layout of invisible widgets is not updated.
+     */
+    [[nodiscard]] static bool is_visible(widget const& widget) noexcept
+    {
+        for (auto *w = std::addressof(widget); w != nullptr; w = w->parent) {
+            if (*w->mode < widget_mode::partial) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] static bool is_ancestor(widget const& ancestor, widget const& widget) noexcept
+    {
+        for (auto *w = widget.parent; w != nullptr; w = w->parent) {
+            if (w == std::addressof(ancestor)) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace hi::inline v1
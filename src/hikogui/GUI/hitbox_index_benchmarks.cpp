@@ -0,0 +1,195 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "hitbox_index.hpp"
+#include "../concurrency/subsystem.hpp"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace hi;
+
+namespace {
+
+/** A button of 8 x 8 pixels.
+ */
+class hitbox_index_benchmarks_cell : public hi::widget {
+public:
+    hitbox_index_benchmarks_cell(widget *parent) noexcept : hi::widget(parent) {}
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        _layout = context;
+    }
+
+    [[nodiscard]] hitbox hitbox_test(point2i position) const noexcept override
+    {
+        if (*mode >= widget_mode::partial and layout().contains(position)) {
+            return {id, _layout.elevation, hitbox_type::button};
+        } else {
+            return {};
+        }
+    }
+};
+
+/** A row of 100 cells, 10 pixels apart.
+ */
+class hitbox_index_benchmarks_row : public hi::widget {
+public:
+    std::vector<std::unique_ptr<hitbox_index_benchmarks_cell>> cells;
+
+    hitbox_index_benchmarks_row(widget *parent) noexcept : hi::widget(parent)
+    {
+        for (auto i = 0; i != 100; ++i) {
+            cells.push_back(std::make_unique<hitbox_index_benchmarks_cell>(this));
+        }
+    }
+
+    [[nodiscard]] generator<widget const&> children(bool include_invisible) const noexcept override
+    {
+        for (hilet& cell : cells) {
+            co_yield *cell;
+        }
+    }
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        _layout = context;
+        for (auto i = 0_uz; i != cells.size(); ++i) {
+            auto shape = box_shape{};
+            shape.rectangle = aarectanglei{narrow_cast<int>(i) * 10 + 1, 1, 8, 8};
+            cells[i]->relayout(context.transform(shape, 0.0f));
+        }
+    }
+
+    [[nodiscard]] hitbox hitbox_test(point2i position) const noexcept override
+    {
+        auto r = hitbox{};
+        if (*mode >= widget_mode::partial) {
+            for (hilet& cell : cells) {
+                r = cell->hitbox_test_from_parent(position, r);
+            }
+        }
+        return r;
+    }
+};
+
+/** A top-level widget with 100 rows of 100 cells; 10,000 widgets on a 1000 x 1000 window.
+ */
+class hitbox_index_benchmarks_window : public hi::widget {
+public:
+    std::vector<std::unique_ptr<hitbox_index_benchmarks_row>> rows;
+
+    hitbox_index_benchmarks_window() noexcept : hi::widget(nullptr)
+    {
+        for (auto i = 0; i != 100; ++i) {
+            rows.push_back(std::make_unique<hitbox_index_benchmarks_row>(this));
+        }
+    }
+
+    [[nodiscard]] generator<widget const&> children(bool include_invisible) const noexcept override
+    {
+        for (hilet& row : rows) {
+            co_yield *row;
+        }
+    }
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        _layout = context;
+        for (auto i = 0_uz; i != rows.size(); ++i) {
+            auto shape = box_shape{};
+            shape.rectangle = aarectanglei{0, narrow_cast<int>(i) * 10, 1000, 10};
+            rows[i]->relayout(context.transform(shape, 0.0f));
+        }
+    }
+
+    [[nodiscard]] hitbox hitbox_test(point2i position) const noexcept override
+    {
+        auto r = hitbox{};
+        for (hilet& row : rows) {
+            r = row->hitbox_test_from_parent(position, r);
+        }
+        return r;
+    }
+};
+
+struct hitbox_index_benchmarks_fixture {
+    // The index must outlive the widgets.
+    hitbox_index index;
+    std::unique_ptr<hitbox_index_benchmarks_window> window_widget;
+
+    hitbox_index_benchmarks_fixture() noexcept
+    {
+        hi::start_system();
+
+        window_widget = std::make_unique<hitbox_index_benchmarks_window>();
+        window_widget->relayout(widget_layout{
+            extent2i{1000, 1000}, gui_window_size::normal, subpixel_orientation::unknown, std::chrono::utc_clock::now()});
+        index.reset(extent2i{1000, 1000});
+        window_widget->reindex(index, true);
+    }
+};
+
+hitbox_index_benchmarks_fixture& hitbox_index_benchmarks_get_fixture() noexcept
+{
+    static auto r = hitbox_index_benchmarks_fixture{};
+    return r;
+}
+
+/** The mouse moves diagonally over the window, as it would during a drag.
+ */
+[[nodiscard]] point2i hitbox_index_benchmarks_mouse_position(int i) noexcept
+{
+    return point2i{(i * 7) % 1000, (i * 3) % 1000};
+}
+
+} // namespace
+
+/** Mouse routing through the hitbox index of the window.
+ */
+static void hitbox_index_mouse_move(benchmark::State& state)
+{
+    auto& fixture = hitbox_index_benchmarks_get_fixture();
+
+    auto i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fixture.index.hitbox_test(hitbox_index_benchmarks_mouse_position(i)));
+        i = (i + 1) % 1000;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(hitbox_index_mouse_move);
+
+/** Mouse routing by recursing through the widget tree, for comparison.
+ */
+static void widget_hitbox_test_mouse_move(benchmark::State& state)
+{
+    auto& fixture = hitbox_index_benchmarks_get_fixture();
+
+    auto i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fixture.window_widget->hitbox_test(hitbox_index_benchmarks_mouse_position(i)));
+        i = (i + 1) % 1000;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(widget_hitbox_test_mouse_move);
+
+/** Laying out a single row again, and updating its position in the index.
+ */
+static void hitbox_index_reindex_row(benchmark::State& state)
+{
+    auto& fixture = hitbox_index_benchmarks_get_fixture();
+
+    auto i = 0_uz;
+    for (auto _ : state) {
+        auto& row = *fixture.window_widget->rows[i++ % fixture.window_widget->rows.size()];
+        row.request_relayout();
+        fixture.window_widget->relayout(fixture.window_widget->layout());
+        fixture.window_widget->reindex(fixture.index);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(hitbox_index_reindex_row);
@@ -0,0 +1,214 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "hitbox_index.hpp"
+#include "../concurrency/subsystem.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace hi;
+
+class hitbox_index_tests : public ::testing::Test {
+protected:
+    /** A button of 20 x 20 pixels.
+     */
+    class cell_widget_moc : public hi::widget {
+    public:
+        cell_widget_moc(widget *parent) noexcept : hi::widget(parent) {}
+
+        void set_layout(widget_layout const& context) noexcept override
+        {
+            _layout = context;
+        }
+
+        [[nodiscard]] hitbox hitbox_test(point2i position) const noexcept override
+        {
+            if (*mode >= widget_mode::partial and layout().contains(position)) {
+                return {id, _layout.elevation, hitbox_type::button};
+            } else {
+                return {};
+            }
+        }
+    };
+
+    /** A row of 8 cells, with 10 pixels between the cells.
+     */
+    class row_widget_moc : public hi::widget {
+    public:
+        std::vector<std::unique_ptr<cell_widget_moc>> cells;
+
+        row_widget_moc(widget *parent) noexcept : hi::widget(parent)
+        {
+            for (auto i = 0; i != 8; ++i) {
+                cells.push_back(std::make_unique<cell_widget_moc>(this));
+            }
+        }
+
+        [[nodiscard]] generator<widget const&> children(bool include_invisible) const noexcept override
+        {
+            for (hilet& cell : cells) {
+                if (include_invisible or *cell->mode > widget_mode::invisible) {
+                    co_yield *cell;
+                }
+            }
+        }
+
+        void set_layout(widget_layout const& context) noexcept override
+        {
+            _layout = context;
+            for (auto i = 0_uz; i != cells.size(); ++i) {
+                if (*cells[i]->mode > widget_mode::invisible) {
+                    auto shape = box_shape{};
+                    shape.rectangle = aarectanglei{narrow_cast<int>(i) * 30 + 10, 5, 20, 20};
+                    cells[i]->relayout(context.transform(shape, 0.0f));
+                }
+            }
+        }
+
+        [[nodiscard]] hitbox hitbox_test(point2i position) const noexcept override
+        {
+            auto r = hitbox{};
+            if (*mode >= widget_mode::partial) {
+                for (hilet& cell : cells) {
+                    r = cell->hitbox_test_from_parent(position, r);
+                }
+            }
+            return r;
+        }
+    };
+
+    /** A top-level widget with 6 rows, with a pop-up covering part of the rows.
+     */
+    class window_widget_moc : public hi::widget {
+    public:
+        std::vector<std::unique_ptr<row_widget_moc>> rows;
+        std::unique_ptr<cell_widget_moc> popup;
+        int offset = 0;
+
+        window_widget_moc() noexcept : hi::widget(nullptr)
+        {
+            for (auto i = 0; i != 6; ++i) {
+                rows.push_back(std::make_unique<row_widget_moc>(this));
+            }
+            popup = std::make_unique<cell_widget_moc>(this);
+        }
+
+        [[nodiscard]] generator<widget const&> children(bool include_invisible) const noexcept override
+        {
+            for (hilet& row : rows) {
+                co_yield *row;
+            }
+            co_yield *popup;
+        }
+
+        void set_layout(widget_layout const& context) noexcept override
+        {
+            _layout = context;
+            for (auto i = 0_uz; i != rows.size(); ++i) {
+                auto shape = box_shape{};
+                shape.rectangle = aarectanglei{offset, narrow_cast<int>(i) * 30, 250, 30};
+                rows[i]->relayout(context.transform(shape, 0.0f));
+            }
+
+            auto shape = box_shape{};
+            shape.rectangle = aarectanglei{50, 50, 40, 40};
+            popup->relayout(context.transform(shape, 20.0f));
+        }
+
+        [[nodiscard]] hitbox hitbox_test(point2i position) const noexcept override
+        {
+            auto r = popup->hitbox_test_from_parent(position);
+            for (hilet& row : rows) {
+                r = row->hitbox_test_from_parent(position, r);
+            }
+            return r;
+        }
+    };
+
+    // The index must outlive the widgets.
+    hitbox_index index;
+    std::unique_ptr<window_widget_moc> window_widget;
+
+    void SetUp() override
+    {
+        hi::start_system();
+
+        window_widget = std::make_unique<window_widget_moc>();
+        relayout();
+        index.reset(extent2i{300, 200});
+        window_widget->reindex(index, true);
+    }
+
+    void relayout()
+    {
+        window_widget->relayout(widget_layout{
+            extent2i{300, 200}, gui_window_size::normal, subpixel_orientation::unknown, std::chrono::utc_clock::now()});
+    }
+
+    /** Check that the index finds the same widget as the recursive hitbox_test() on every pixel.
+     */
+    void check_all_positions()
+    {
+        for (auto y = -5; y != 205; ++y) {
+            for (auto x = -5; x != 305; ++x) {
+                hilet position = point2i{x, y};
+                ASSERT_EQ(index.hitbox_test(position).widget_id, window_widget->hitbox_test(position).widget_id)
+                    << "at " << x << ", " << y;
+            }
+        }
+    }
+};
+
+TEST_F(hitbox_index_tests, find)
+{
+    ASSERT_EQ(index.size(), 1 + 6 + 6 * 8 + 1);
+
+    ASSERT_EQ(index.hitbox_test(point2i{15, 10}).widget_id, window_widget->rows[0]->cells[0]->id);
+    ASSERT_EQ(index.hitbox_test(point2i{45, 40}).widget_id, window_widget->rows[1]->cells[1]->id);
+
+    // Between the cells.
+    ASSERT_FALSE(index.hitbox_test(point2i{35, 10}).widget_id);
+
+    // The pop-up is at a higher elevation than the cells below it.
+    ASSERT_EQ(index.hitbox_test(point2i{75, 70}).widget_id, window_widget->popup->id);
+
+    check_all_positions();
+}
+
+TEST_F(hitbox_index_tests, move)
+{
+    window_widget->offset = 15;
+    window_widget->request_relayout();
+    relayout();
+    window_widget->reindex(index);
+
+    ASSERT_FALSE(index.hitbox_test(point2i{15, 10}).widget_id);
+    ASSERT_EQ(index.hitbox_test(point2i{30, 10}).widget_id, window_widget->rows[0]->cells[0]->id);
+    check_all_positions();
+}
+
+TEST_F(hitbox_index_tests, invisible)
+{
+    // The layout of invisible widgets is not updated, the index must skip them anyway.
+    window_widget->rows[2]->mode = widget_mode::invisible;
+    window_widget->rows[3]->cells[4]->mode = widget_mode::invisible;
+    relayout();
+    window_widget->reindex(index);
+
+    ASSERT_FALSE(index.hitbox_test(point2i{15, 70}).widget_id);
+    ASSERT_FALSE(index.hitbox_test(point2i{135, 100}).widget_id);
+    check_all_positions();
+}
+
+TEST_F(hitbox_index_tests, destroy)
+{
+    // A widget removes itself from the index when it is destroyed.
+    window_widget->rows[5]->cells.pop_back();
+    ASSERT_EQ(index.size(), 1 + 6 + 6 * 8);
+    check_all_positions();
+
+    window_widget = {};
+    ASSERT_TRUE(index.empty());
+}
@@ -16,3 +16,4 @@
 #include "native_simd_conversions_x86.hpp"
 #include "native_simd_utility.hpp"
 #include "native_u32x4_sse2.hpp"
+#include "native_u8x16_sse2.hpp"
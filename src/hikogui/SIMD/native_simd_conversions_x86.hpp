@@ -9,6 +9,8 @@
 #include "native_i32x4_sse2.hpp"
 #include "native_i64x4_avx2.hpp"
 #include "native_u32x4_sse2.hpp"
+#include "native_f16x8_sse2.hpp"
+#include "float16_sse4_1.hpp"
 #include "native_simd_utility.hpp"
 
 namespace hi { inline namespace v1 {
@@ -18,6 +20,31 @@ namespace hi { inline namespace v1 {
 [[nodiscard]] inline native_simd<int32_t, 4>::native_simd(native_simd<float, 4> const& a) noexcept : v(_mm_cvtps_epi32(a.v)) {}
 [[nodiscard]] inline native_simd<int32_t, 4>::native_simd(native_simd<uint32_t, 4> const& a) noexcept : v(a.v) {}
 [[nodiscard]] inline native_simd<uint32_t, 4>::native_simd(native_simd<int32_t, 4> const& a) noexcept : v(a.v) {}
+
+/** Convert two float x 4 to a float16 x 8.
+ *
+ * The mantissa is truncated, denormals are flushed to zero when F16C is not available.
+ */
+[[nodiscard]] inline native_simd<float16, 8>::native_simd(native_simd<float, 4> const& a, native_simd<float, 4> const& b) noexcept
+{
+#if defined(HI_HAS_F16C)
+    v = _mm_unpacklo_epi64(_mm_cvtps_ph(a.v, _MM_FROUND_TO_ZERO), _mm_cvtps_ph(b.v, _MM_FROUND_TO_ZERO));
+#elif defined(HI_HAS_SSE4_1)
+    v = _mm_unpacklo_epi64(_mm_cvtps_ph_sse4_1(a.v), _mm_cvtps_ph_sse4_1(b.v));
+#else
+    hilet a_ = static_cast<native_simd<float, 4>::array_type>(a);
+    hilet b_ = static_cast<native_simd<float, 4>::array_type>(b);
+    v = _mm_set_epi16(
+        std::bit_cast<int16_t>(float16{b_[3]}),
+        std::bit_cast<int16_t>(float16{b_[2]}),
+        std::bit_cast<int16_t>(float16{b_[1]}),
+        std::bit_cast<int16_t>(float16{b_[0]}),
+        std::bit_cast<int16_t>(float16{a_[3]}),
+        std::bit_cast<int16_t>(float16{a_[2]}),
+        std::bit_cast<int16_t>(float16{a_[1]}),
+        std::bit_cast<int16_t>(float16{a_[0]}));
+#endif
+}
 #endif
 #ifdef HI_HAS_AVX
 [[nodiscard]] inline native_simd<float, 4>::native_simd(native_simd<double, 4> const& a) noexcept : v(_mm256_cvtpd_ps(a.v)) {}
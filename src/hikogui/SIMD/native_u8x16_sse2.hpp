@@ -0,0 +1,381 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "native_simd_utility.hpp"
+#include "../utility/module.hpp"
+#include <array>
+#include <cstring>
+#include <ostream>
+
+hi_warning_push();
+// Ignore "C26490: Don't use reinterpret_cast", needed for intrinsic loads and stores.
+hi_warning_ignore_msvc(26490);
+
+namespace hi { inline namespace v1 {
+
+#ifdef HI_HAS_SSE2
+
+/** A uint8_t x 16 (__m128i) SSE2 register.
+ *
+ *
+ * When loading and storing from memory this is the order of the element in the register
+ *
+ * ```
+ *  +---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+
+ *  | 0 | 1 | 2 | 3 | 4 | 5 | 6 | 7 | 8 | 9 |10 |11 |12 |13 |14 |15 |
+ *  +---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+---+
+ *    0   1   2   3   4   5   6   7   8   9  10  11  12  13  14  15   memory address.
+ * ```
+ *
+ * In the function below a `mask` values least-significant-bit corresponds to element 0.
+ *
+ * Arithmetic on this type wraps around modulo 256, the `add_saturate()` and `sub_saturate()`
+ * functions saturate instead.
+ */
+template<>
+struct native_simd<uint8_t, 16> {
+    using value_type = uint8_t;
+    constexpr static size_t size = 16;
+    using register_type = __m128i;
+    using array_type = std::array<value_type, size>;
+
+    register_type v;
+
+    native_simd(native_simd const&) noexcept = default;
+    native_simd(native_simd&&) noexcept = default;
+    native_simd& operator=(native_simd const&) noexcept = default;
+    native_simd& operator=(native_simd&&) noexcept = default;
+
+    /** Initialize all elements to zero.
+     */
+    native_simd() noexcept : v(_mm_setzero_si128()) {}
+
+    [[nodiscard]] explicit native_simd(register_type other) noexcept : v(other) {}
+
+    [[nodiscard]] explicit operator register_type() const noexcept
+    {
+        return v;
+    }
+
+    [[nodiscard]] explicit native_simd(value_type const *other) noexcept
+        : v(_mm_loadu_si128(reinterpret_cast<register_type const *>(other)))
+    {
+    }
+
+    void store(value_type *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm_storeu_si128(reinterpret_cast<register_type *>(out), v);
+    }
+
+    [[nodiscard]] explicit native_simd(void const *other) noexcept : v(_mm_loadu_si128(static_cast<register_type const *>(other)))
+    {
+    }
+
+    void store(void *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm_storeu_si128(static_cast<register_type *>(out), v);
+    }
+
+    [[nodiscard]] explicit native_simd(std::span<value_type const> other) noexcept
+    {
+        hi_axiom(other.size() >= size);
+        v = _mm_loadu_si128(reinterpret_cast<register_type const *>(other.data()));
+    }
+
+    void store(std::span<value_type> out) const noexcept
+    {
+        hi_axiom(out.size() >= size);
+        _mm_storeu_si128(reinterpret_cast<register_type *>(out.data()), v);
+    }
+
+    [[nodiscard]] explicit native_simd(array_type other) noexcept
+        : v(_mm_loadu_si128(reinterpret_cast<register_type const *>(other.data())))
+    {
+    }
+
+    [[nodiscard]] explicit operator array_type() const noexcept
+    {
+        auto r = array_type{};
+        _mm_storeu_si128(reinterpret_cast<register_type *>(r.data()), v);
+        return r;
+    }
+
+    /** Load the first elements from memory.
+     *
+     * Only @a N bytes are read from memory, the rest of the elements are set to zero.
+     *
+     * @tparam N The number of elements to load.
+     * @param other A pointer to the elements in memory.
+     */
+    template<size_t N>
+    [[nodiscard]] static native_simd load(void const *other) noexcept
+        requires(N <= size)
+    {
+        hi_axiom_not_null(other);
+
+        if constexpr (N == size) {
+            return native_simd{other};
+
+        } else if constexpr (N == 8) {
+            return native_simd{_mm_loadl_epi64(static_cast<register_type const *>(other))};
+
+        } else if constexpr (N <= 4) {
+            auto tmp = uint32_t{0};
+            std::memcpy(&tmp, other, N);
+            return native_simd{_mm_cvtsi32_si128(std::bit_cast<int32_t>(tmp))};
+
+        } else if constexpr (N <= 8) {
+            auto tmp = uint64_t{0};
+            std::memcpy(&tmp, other, N);
+            return native_simd{_mm_loadl_epi64(reinterpret_cast<register_type const *>(&tmp))};
+
+        } else {
+            auto tmp = array_type{};
+            std::memcpy(tmp.data(), other, N);
+            return native_simd{tmp};
+        }
+    }
+
+    /** Store the first elements to memory.
+     *
+     * Only @a N bytes are written to memory.
+     *
+     * @tparam N The number of elements to store.
+     * @param out A pointer to memory where to store the elements.
+     */
+    template<size_t N>
+    void store(void *out) const noexcept
+        requires(N <= size)
+    {
+        hi_axiom_not_null(out);
+
+        if constexpr (N == size) {
+            store(out);
+
+        } else if constexpr (N == 8) {
+            _mm_storel_epi64(static_cast<register_type *>(out), v);
+
+        } else if constexpr (N <= 4) {
+            hilet tmp = std::bit_cast<uint32_t>(_mm_cvtsi128_si32(v));
+            std::memcpy(out, &tmp, N);
+
+        } else if constexpr (N <= 8) {
+            auto tmp = uint64_t{0};
+            _mm_storel_epi64(reinterpret_cast<register_type *>(&tmp), v);
+            std::memcpy(out, &tmp, N);
+
+        } else {
+            hilet tmp = static_cast<array_type>(*this);
+            std::memcpy(out, tmp.data(), N);
+        }
+    }
+
+    /** Broadcast a single value to all the elements.
+     *
+     * ```
+     * r[ 0] = a; r[ 1] = a; r[ 2] = a; r[ 3] = a;
+     * r[ 4] = a; r[ 5] = a; r[ 6] = a; r[ 7] = a;
+     * r[ 8] = a; r[ 9] = a; r[10] = a; r[11] = a;
+     * r[12] = a; r[13] = a; r[14] = a; r[15] = a;
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(value_type a) noexcept
+    {
+        return native_simd{_mm_set1_epi8(std::bit_cast<char>(a))};
+    }
+
+    [[nodiscard]] static native_simd ones() noexcept
+    {
+        hilet tmp = _mm_undefined_si128();
+        return native_simd{_mm_cmpeq_epi32(tmp, tmp)};
+    }
+
+    /** Concatenate the top bit of each element.
+     */
+    [[nodiscard]] size_t mask() const noexcept
+    {
+        return narrow_cast<size_t>(_mm_movemask_epi8(v));
+    }
+
+    [[nodiscard]] friend bool equal(native_simd a, native_simd b) noexcept
+    {
+        return (a == b).mask() == 0b1111'1111'1111'1111;
+    }
+
+    [[nodiscard]] friend native_simd operator==(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_cmpeq_epi8(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator!=(native_simd a, native_simd b) noexcept
+    {
+        return ~(a == b);
+    }
+
+    [[nodiscard]] friend native_simd operator<=(native_simd a, native_simd b) noexcept
+    {
+        // SSE2 only has signed byte compare, use unsigned min instead.
+        return min(a, b) == a;
+    }
+
+    [[nodiscard]] friend native_simd operator>=(native_simd a, native_simd b) noexcept
+    {
+        return max(a, b) == a;
+    }
+
+    [[nodiscard]] friend native_simd operator<(native_simd a, native_simd b) noexcept
+    {
+        return ~(a >= b);
+    }
+
+    [[nodiscard]] friend native_simd operator>(native_simd a, native_simd b) noexcept
+    {
+        return ~(a <= b);
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a) noexcept
+    {
+        return a;
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_add_epi8(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator-(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_sub_epi8(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator&(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_and_si128(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator|(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_or_si128(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator^(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_xor_si128(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator~(native_simd a) noexcept
+    {
+        auto ones = _mm_undefined_si128();
+        ones = _mm_cmpeq_epi32(ones, ones);
+        return native_simd{_mm_andnot_si128(a.v, ones)};
+    }
+
+    [[nodiscard]] friend native_simd min(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_min_epu8(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd max(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_max_epu8(a.v, b.v)};
+    }
+
+    /** Add with saturation.
+     *
+     * r[i] = min(a[i] + b[i], 255)
+     */
+    [[nodiscard]] friend native_simd add_saturate(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_adds_epu8(a.v, b.v)};
+    }
+
+    /** Subtract with saturation.
+     *
+     * r[i] = max(a[i] - b[i], 0)
+     */
+    [[nodiscard]] friend native_simd sub_saturate(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_subs_epu8(a.v, b.v)};
+    }
+
+    /** The absolute difference between the elements.
+     *
+     * r[i] = |a[i] - b[i]|
+     */
+    [[nodiscard]] friend native_simd abs_diff(native_simd a, native_simd b) noexcept
+    {
+        return sub_saturate(a, b) | sub_saturate(b, a);
+    }
+
+    /** The average of the elements, rounded up.
+     *
+     * r[i] = (a[i] + b[i] + 1) / 2
+     */
+    [[nodiscard]] friend native_simd avg(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_avg_epu8(a.v, b.v)};
+    }
+
+    /** Sum all elements of a vector.
+     *
+     * The sum does not fit in an element, so it is returned as an integer.
+     *
+     * r = a[0] + a[1] + ... + a[15]
+     */
+    [[nodiscard]] friend std::size_t horizontal_sum(native_simd a) noexcept
+    {
+        hilet sums = _mm_sad_epu8(a.v, _mm_setzero_si128());
+        return narrow_cast<std::size_t>(_mm_cvtsi128_si32(sums) + _mm_extract_epi16(sums, 4));
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @param a A vector for which element are selected when the @a mask element is all zeros.
+     * @param b A vector for which element are selected when the @a mask element is all ones.
+     * @param mask A vector where each element is either all zeros or all ones.
+     * @return A vector with element selected from @a a and @a b
+     */
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b, native_simd mask) noexcept
+    {
+#ifdef HI_HAS_SSE4_1
+        return native_simd{_mm_blendv_epi8(a.v, b.v, mask.v)};
+#else
+        return not_and(mask, a) | (mask & b);
+#endif
+    }
+
+    /** not followed by and.
+     *
+     * r = ~a & b
+     *
+     */
+    [[nodiscard]] friend native_simd not_and(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm_andnot_si128(a.v, b.v)};
+    }
+
+    friend std::ostream& operator<<(std::ostream& a, native_simd b) noexcept
+    {
+        hilet tmp = static_cast<array_type>(b);
+
+        a << "(";
+        for (auto i = 0_uz; i != size; ++i) {
+            if (i != 0) {
+                a << ", ";
+            }
+            a << static_cast<int>(tmp[i]);
+        }
+        return a << ")";
+    }
+};
+
+#endif
+
+}} // namespace hi::v1
+
+hi_warning_pop();
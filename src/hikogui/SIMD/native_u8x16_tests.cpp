@@ -0,0 +1,104 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "native_u8x16_sse2.hpp"
+#include "simd_test_utility.hpp"
+
+hi_warning_push();
+// C26474: Don't cast between pointer types when the conversion could be implicit (type.1).
+// For the test we need to do this explicit.
+hi_warning_ignore_msvc(26474);
+
+using S = hi::native_simd<uint8_t,16>;
+using A = S::array_type;
+
+TEST(native_u8x16, construct)
+{
+    {
+        auto expected = A{};
+        ASSERT_EQ(static_cast<A>(S{}), expected);
+    }
+
+    {
+        auto expected = A{4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4};
+        ASSERT_EQ(static_cast<A>(S::broadcast(4)), expected);
+    }
+
+    {
+        auto from = A{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+        auto expected = A{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+        ASSERT_EQ(static_cast<A>(S{from}), expected);
+        ASSERT_EQ(static_cast<A>(S{from.data()}), expected);
+    }
+}
+
+TEST(native_u8x16, load_store_partial)
+{
+    auto from = A{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+    ASSERT_EQ(static_cast<A>(S::load<3>(from.data())), (A{1, 2, 3}));
+    ASSERT_EQ(static_cast<A>(S::load<4>(from.data())), (A{1, 2, 3, 4}));
+    ASSERT_EQ(static_cast<A>(S::load<6>(from.data())), (A{1, 2, 3, 4, 5, 6}));
+    ASSERT_EQ(static_cast<A>(S::load<8>(from.data())), (A{1, 2, 3, 4, 5, 6, 7, 8}));
+    ASSERT_EQ(static_cast<A>(S::load<12>(from.data())), (A{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}));
+
+    {
+        auto result = A{};
+        S{from}.store<3>(result.data());
+        ASSERT_EQ(result, (A{1, 2, 3}));
+    }
+
+    {
+        auto result = A{};
+        S{from}.store<6>(result.data());
+        ASSERT_EQ(result, (A{1, 2, 3, 4, 5, 6}));
+    }
+
+    {
+        auto result = A{};
+        S{from}.store<8>(result.data());
+        ASSERT_EQ(result, (A{1, 2, 3, 4, 5, 6, 7, 8}));
+    }
+}
+
+TEST(native_u8x16, compare)
+{
+    auto a = S{A{0, 1, 2, 200, 255, 128, 127, 0, 0, 1, 2, 200, 255, 128, 127, 0}};
+    auto b = S{A{0, 2, 1, 100, 0, 127, 128, 255, 0, 2, 1, 100, 0, 127, 128, 255}};
+
+    ASSERT_EQ((a == b).mask(), 0b0000'0001'0000'0001);
+    ASSERT_EQ((a != b).mask(), 0b1111'1110'1111'1110);
+    ASSERT_EQ((a < b).mask(), 0b1100'0010'1100'0010);
+    ASSERT_EQ((a > b).mask(), 0b0011'1100'0011'1100);
+    ASSERT_EQ((a <= b).mask(), 0b1100'0011'1100'0011);
+    ASSERT_EQ((a >= b).mask(), 0b0011'1101'0011'1101);
+}
+
+TEST(native_u8x16, math)
+{
+    auto a = S{A{0, 1, 2, 200, 255, 128, 127, 0, 0, 1, 2, 200, 255, 128, 127, 0}};
+    auto b = S{A{0, 2, 1, 100, 1, 127, 128, 255, 0, 2, 1, 100, 1, 127, 128, 255}};
+
+    ASSERT_EQ(static_cast<A>(a + b), (A{0, 3, 3, 44, 0, 255, 255, 255, 0, 3, 3, 44, 0, 255, 255, 255}));
+    ASSERT_EQ(static_cast<A>(a - b), (A{0, 255, 1, 100, 254, 1, 255, 1, 0, 255, 1, 100, 254, 1, 255, 1}));
+    ASSERT_EQ(static_cast<A>(add_saturate(a, b)), (A{0, 3, 3, 255, 255, 255, 255, 255, 0, 3, 3, 255, 255, 255, 255, 255}));
+    ASSERT_EQ(static_cast<A>(sub_saturate(a, b)), (A{0, 0, 1, 100, 254, 1, 0, 0, 0, 0, 1, 100, 254, 1, 0, 0}));
+    ASSERT_EQ(static_cast<A>(abs_diff(a, b)), (A{0, 1, 1, 100, 254, 1, 1, 255, 0, 1, 1, 100, 254, 1, 1, 255}));
+    ASSERT_EQ(static_cast<A>(avg(a, b)), (A{0, 2, 2, 150, 128, 128, 128, 128, 0, 2, 2, 150, 128, 128, 128, 128}));
+    ASSERT_EQ(static_cast<A>(min(a, b)), (A{0, 1, 1, 100, 1, 127, 127, 0, 0, 1, 1, 100, 1, 127, 127, 0}));
+    ASSERT_EQ(static_cast<A>(max(a, b)), (A{0, 2, 2, 200, 255, 128, 128, 255, 0, 2, 2, 200, 255, 128, 128, 255}));
+    ASSERT_EQ(horizontal_sum(a), 1426);
+    ASSERT_EQ(horizontal_sum(S::broadcast(255)), 4080);
+}
+
+TEST(native_u8x16, blend)
+{
+    auto a = S{A{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}};
+    auto b = S::broadcast(42);
+    auto mask = S{A{255, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255}};
+
+    ASSERT_EQ(static_cast<A>(blend(a, b, mask)), (A{42, 2, 42, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 42}));
+}
+
+hi_warning_pop();
@@ -334,6 +334,15 @@ struct simd {
         store<sizeof(*this)>(ptr);
     }
 
+    /** Store a numeric array into memory.
+     * @param[out] ptr A pointer to an array of values in memory.
+     */
+    constexpr void store(T *ptr) const noexcept
+    {
+        HI_X_runtime_evaluate_if_valid(reg().store(ptr));
+        std::memcpy(ptr, this, sizeof(*this));
+    }
+
     [[nodiscard]] constexpr size_t mask() const noexcept
     {
         HI_X_runtime_evaluate_if_valid(reg().mask());
@@ -1254,6 +1263,27 @@ using f64x2 = simd<double, 2>;
 using f64x4 = simd<double, 4>;
 using f64x8 = simd<double, 8>;
 
+namespace detail {
+
+template<numeric_limited T>
+[[nodiscard]] consteval std::size_t fast_simd_size() noexcept
+{
+    if constexpr (simd<T, 32 / sizeof(T)>::has_native_type) {
+        return 32 / sizeof(T);
+    } else {
+        return 16 / sizeof(T);
+    }
+}
+
+} // namespace detail
+
+/** The numeric array of T which uses the widest native register.
+ *
+ * Used by functions that loop over large arrays, like the DSP functions.
+ */
+template<numeric_limited T>
+using fast_simd = simd<T, detail::fast_simd_size<T>()>;
+
 } // namespace hi::inline v1
 
 template<class T, std::size_t N>
@@ -10,12 +10,17 @@ namespace hi::inline v1 {
 
 class audio_device_delegate {
 public:
-    audio_device_delegate();
-    virtual ~audio_device_delegate() = 0;
+    audio_device_delegate() noexcept = default;
+    virtual ~audio_device_delegate() = default;
 
     /** Process a block of samples.
+     *
+     * This function is called on the audio thread, it must not allocate, lock or block.
+     *
+     * @param input The samples received from the audio device.
+     * @param[out] output The samples to send to the audio device.
      */
-    virtual void process_audio() noexcept = 0;
+    virtual void process_audio(audio_block const& input, audio_block& output) noexcept = 0;
 };
 
 } // namespace hi::inline v1
@@ -0,0 +1,128 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_device.hpp"
+#include "audio_block.hpp"
+#include "../utility/module.hpp"
+#include <vector>
+#include <string>
+
+namespace hi::inline v1 {
+
+/** An audio device without audio hardware.
+ *
+ * The null device is clocked by its owner instead of by an audio driver: each
+ * call to `process_block()` passes one block of samples through the delegate.
+ * The input samples can be written before each block, and the output samples
+ * can be read after each block.
+ *
+ * This allows an audio application, its tests and its benchmarks to run headless,
+ * for example on a build server.
+ */
+class audio_device_null : public audio_device {
+public:
+    /** Create a null audio device.
+     *
+     * @param id The unique id of the device.
+     * @param name The user friendly name of the device.
+     * @param sample_rate The initial sample rate.
+     * @param input_speaker_mapping The initial input speaker mapping, determines the number of input channels.
+     * @param output_speaker_mapping The initial output speaker mapping, determines the number of output channels.
+     */
+    audio_device_null(
+        std::string id,
+        std::string name,
+        double sample_rate = 48000.0,
+        hi::speaker_mapping input_speaker_mapping = hi::speaker_mapping::none,
+        hi::speaker_mapping output_speaker_mapping = hi::speaker_mapping::stereo_2_0) noexcept;
+
+    /// @privatesection
+    void update_state() noexcept override {}
+    [[nodiscard]] hi::label label() const noexcept override;
+    [[nodiscard]] audio_device_state state() const noexcept override;
+    [[nodiscard]] audio_direction direction() const noexcept override;
+    [[nodiscard]] bool exclusive() const noexcept override;
+    void set_exclusive(bool exclusive) noexcept override;
+    [[nodiscard]] double sample_rate() const noexcept override;
+    void set_sample_rate(double sample_rate) noexcept override;
+    [[nodiscard]] hi::speaker_mapping input_speaker_mapping() const noexcept override;
+    void set_input_speaker_mapping(hi::speaker_mapping speaker_mapping) noexcept override;
+    [[nodiscard]] std::vector<hi::speaker_mapping> available_input_speaker_mappings() const noexcept override;
+    [[nodiscard]] hi::speaker_mapping output_speaker_mapping() const noexcept override;
+    void set_output_speaker_mapping(hi::speaker_mapping speaker_mapping) noexcept override;
+    [[nodiscard]] std::vector<hi::speaker_mapping> available_output_speaker_mappings() const noexcept override;
+    /// @endprivatesection
+
+    /** Start a stream of audio blocks to the delegate.
+     *
+     * The sample buffers are allocated for the current sample rate and speaker mappings.
+     *
+     * @param delegate The delegate that processes the audio.
+     * @param block_size The number of samples in each block.
+     */
+    void start_stream(audio_device_delegate& delegate, std::size_t block_size);
+
+    /** Stop the stream of audio.
+     */
+    void stop_stream() noexcept;
+
+    /** Check if a stream was started.
+     */
+    [[nodiscard]] bool streaming() const noexcept
+    {
+        return _delegate != nullptr;
+    }
+
+    /** The block of input samples.
+     *
+     * Write to the sample buffers of this block to simulate audio from the device.
+     * The samples are kept between blocks, and are silent after the stream is started.
+     *
+     * @pre The stream must be started.
+     */
+    [[nodiscard]] audio_block& input() noexcept
+    {
+        hi_axiom(streaming());
+        return _input;
+    }
+
+    /** The block of output samples, written by the delegate during the last block.
+     *
+     * @pre The stream must be started.
+     */
+    [[nodiscard]] audio_block const& output() const noexcept
+    {
+        hi_axiom(streaming());
+        return _output;
+    }
+
+    /** Process a single block of samples.
+     *
+     * Calls the delegate's `process_audio()` with the input and output block, then
+     * advances the sample count of the stream. This function does not allocate.
+     *
+     * @pre The stream must be started.
+     */
+    void process_block() noexcept;
+
+private:
+    double _sample_rate;
+    hi::speaker_mapping _input_speaker_mapping;
+    hi::speaker_mapping _output_speaker_mapping;
+    bool _exclusive = false;
+
+    audio_device_delegate *_delegate = nullptr;
+    int64_t _sample_count = 0;
+
+    std::vector<float> _input_samples;
+    std::vector<float> _output_samples;
+    std::vector<float *> _input_channels;
+    std::vector<float *> _output_channels;
+    audio_block _input = {};
+    audio_block _output = {};
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,158 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_device_null.hpp"
+#include "../utility/module.hpp"
+#include <chrono>
+#include <cmath>
+
+namespace hi::inline v1 {
+
+audio_device_null::audio_device_null(
+    std::string id,
+    std::string name,
+    double sample_rate,
+    hi::speaker_mapping input_speaker_mapping,
+    hi::speaker_mapping output_speaker_mapping) noexcept :
+    _sample_rate(sample_rate), _input_speaker_mapping(input_speaker_mapping), _output_speaker_mapping(output_speaker_mapping)
+{
+    _id = std::move(id);
+    _name = std::move(name);
+}
+
+hi::label audio_device_null::label() const noexcept
+{
+    return {elusive_icon::Speaker, tr("{}", _name)};
+}
+
+audio_device_state audio_device_null::state() const noexcept
+{
+    return audio_device_state::active;
+}
+
+audio_direction audio_device_null::direction() const noexcept
+{
+    auto r = audio_direction::none;
+    if (to_bool(_input_speaker_mapping)) {
+        r = r | audio_direction::input;
+    }
+    if (to_bool(_output_speaker_mapping)) {
+        r = r | audio_direction::output;
+    }
+    return r;
+}
+
+bool audio_device_null::exclusive() const noexcept
+{
+    return _exclusive;
+}
+
+void audio_device_null::set_exclusive(bool exclusive) noexcept
+{
+    _exclusive = exclusive;
+}
+
+double audio_device_null::sample_rate() const noexcept
+{
+    return _sample_rate;
+}
+
+void audio_device_null::set_sample_rate(double sample_rate) noexcept
+{
+    hi_axiom(not streaming());
+    _sample_rate = sample_rate;
+}
+
+hi::speaker_mapping audio_device_null::input_speaker_mapping() const noexcept
+{
+    return _input_speaker_mapping;
+}
+
+void audio_device_null::set_input_speaker_mapping(hi::speaker_mapping speaker_mapping) noexcept
+{
+    hi_axiom(not streaming());
+    _input_speaker_mapping = speaker_mapping;
+}
+
+std::vector<hi::speaker_mapping> audio_device_null::available_input_speaker_mappings() const noexcept
+{
+    return {
+        hi::speaker_mapping::none,
+        hi::speaker_mapping::mono_1_0,
+        hi::speaker_mapping::stereo_2_0,
+        hi::speaker_mapping::surround_5_1,
+        hi::speaker_mapping::surround_7_1};
+}
+
+hi::speaker_mapping audio_device_null::output_speaker_mapping() const noexcept
+{
+    return _output_speaker_mapping;
+}
+
+void audio_device_null::set_output_speaker_mapping(hi::speaker_mapping speaker_mapping) noexcept
+{
+    hi_axiom(not streaming());
+    _output_speaker_mapping = speaker_mapping;
+}
+
+std::vector<hi::speaker_mapping> audio_device_null::available_output_speaker_mappings() const noexcept
+{
+    return available_input_speaker_mappings();
+}
+
+void audio_device_null::start_stream(audio_device_delegate& delegate, std::size_t block_size)
+{
+    hi_axiom(not streaming());
+    hi_axiom(block_size > 0);
+
+    // Like the buffers of real audio devices, each sample buffer is a multiple of 4096 bytes,
+    // so that the delegate may over-read and over-write with vector instructions.
+    hilet stride = ceil(block_size, 1024_uz);
+
+    hilet setup = [&](audio_block& block, std::vector<float>& samples, std::vector<float *>& channels, hi::speaker_mapping mapping) {
+        hilet num_channels = narrow_cast<std::size_t>(popcount(mapping));
+        samples.assign(num_channels * stride, 0.0f);
+        channels.clear();
+        for (auto i = 0_uz; i != num_channels; ++i) {
+            channels.push_back(samples.data() + i * stride);
+        }
+
+        block.samples = channels.data();
+        block.num_samples = block_size;
+        block.num_channels = num_channels;
+        block.sample_rate = narrow_cast<int>(std::lround(_sample_rate));
+        block.sample_count = 0;
+        block.time_stamp = {};
+        block.state = audio_block_state::normal;
+    };
+
+    setup(_input, _input_samples, _input_channels, _input_speaker_mapping);
+    setup(_output, _output_samples, _output_channels, _output_speaker_mapping);
+    _sample_count = 0;
+    _delegate = &delegate;
+}
+
+void audio_device_null::stop_stream() noexcept
+{
+    _delegate = nullptr;
+}
+
+void audio_device_null::process_block() noexcept
+{
+    hi_axiom(streaming());
+
+    // The time stamp is derived from the sample count, so that the stream is deterministic.
+    hilet time_stamp = utc_nanoseconds{std::chrono::nanoseconds{
+        static_cast<int64_t>(static_cast<double>(_sample_count) * 1'000'000'000.0 / _sample_rate)}};
+
+    _input.sample_count = _output.sample_count = _sample_count;
+    _input.time_stamp = _output.time_stamp = time_stamp;
+    _input.state = audio_block_state::normal;
+
+    _delegate->process_audio(_input, _output);
+
+    _sample_count += narrow_cast<int64_t>(_input.num_samples);
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,281 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_node.hpp"
+#include "audio_block.hpp"
+#include "audio_device_delegate.hpp"
+#include "../concurrency/rcu.hpp"
+#include "../wfree_fifo.hpp"
+#include "../utility/module.hpp"
+#include <vector>
+#include <memory>
+#include <span>
+#include <cstddef>
+
+namespace hi::inline v1 {
+namespace detail {
+
+/** A parameter change, send from a control thread to the audio thread.
+ */
+struct audio_graph_parameter {
+    std::size_t node_id;
+    std::size_t parameter_id;
+    float value;
+};
+
+/** A node in the order of execution.
+ */
+struct audio_graph_step {
+    audio_node *node;
+
+    /** Index of the first input port in `audio_graph_schedule::inputs`.
+     */
+    std::size_t first_input;
+
+    /** Index of the first output port in `audio_graph_schedule::outputs`.
+     */
+    std::size_t first_output;
+
+    /** The mixes to execute before the node is processed.
+     */
+    std::size_t first_mix;
+    std::size_t num_mixes;
+};
+
+/** Sum a number of buffers into a single buffer.
+ *
+ * Used for input ports that are connected to more than one output port.
+ */
+struct audio_graph_mix {
+    float *destination;
+
+    /** Index of the first source in `audio_graph_schedule::sources`.
+     */
+    std::size_t first_source;
+    std::size_t num_sources;
+};
+
+/** A compiled audio graph.
+ *
+ * The schedule is created on the control thread, including all the buffers
+ * that are needed, and is then handed over to the audio thread.
+ */
+struct audio_graph_schedule {
+    /** The nodes indexed by node-id, for handling parameter changes.
+     *
+     * The schedule owns the nodes so that a node is never destroyed while the audio
+     * thread is using it; the schedule itself is destroyed by the rcu background thread.
+     */
+    std::vector<std::shared_ptr<audio_node>> nodes;
+
+    /** The nodes in topological order.
+     */
+    std::vector<audio_graph_step> steps;
+
+    std::vector<float const *> inputs;
+    std::vector<float *> outputs;
+    std::vector<audio_graph_mix> mixes;
+    std::vector<float const *> sources;
+
+    /** The buffers where the samples of the input channels are copied to.
+     */
+    std::vector<float *> input_channels;
+
+    /** For each output channel, the index of the first source and the number of sources.
+     */
+    std::vector<std::pair<std::size_t, std::size_t>> output_channels;
+
+    /** A buffer filled with silence for input ports that are not connected.
+     */
+    std::vector<float> silence;
+
+    /** All the buffers, each buffer is `max_block_size` samples.
+     */
+    std::vector<float> buffers;
+};
+
+} // namespace detail
+
+/** A graph of audio processing nodes.
+ *
+ * The output ports of nodes are connected to the input ports of other nodes.
+ * The graph is compiled on the control thread into a schedule: the nodes in
+ * topological order and all the sample buffers between the nodes. A buffer
+ * is reused by a later node once all the nodes reading the buffer have been
+ * processed.
+ *
+ * The audio thread processes the graph without allocating memory or taking locks.
+ * The schedule is published to the audio thread through a `rcu` object, and
+ * parameter changes are send to the audio thread through a wait-free fifo.
+ *
+ * The graph is the delegate of an audio device, the device calls `process_audio()`
+ * for each block of samples.
+ *
+ * The graph has two pseudo nodes:
+ *  - `input_node`: the output ports of this node are the input channels of the audio device.
+ *  - `output_node`: the input ports of this node are the output channels of the audio device.
+ */
+class audio_graph : public audio_device_delegate {
+public:
+    /** The node-id of the pseudo node for the input channels.
+     */
+    constexpr static std::size_t input_node = 0;
+
+    /** The node-id of the pseudo node for the output channels.
+     */
+    constexpr static std::size_t output_node = 1;
+
+    ~audio_graph() override = default;
+    audio_graph(audio_graph const&) = delete;
+    audio_graph(audio_graph&&) = delete;
+    audio_graph& operator=(audio_graph const&) = delete;
+    audio_graph& operator=(audio_graph&&) = delete;
+
+    /** Create an empty audio graph.
+     *
+     * @param num_input_channels The number of channels read from the audio device.
+     * @param num_output_channels The number of channels written to the audio device.
+     * @param sample_rate The sample rate of the audio device.
+     * @param max_block_size The maximum number of samples that are processed at once by a node;
+     *                       larger blocks are split.
+     */
+    audio_graph(std::size_t num_input_channels, std::size_t num_output_channels, double sample_rate, std::size_t max_block_size);
+
+    [[nodiscard]] std::size_t num_input_channels() const noexcept
+    {
+        return _num_input_channels;
+    }
+
+    [[nodiscard]] std::size_t num_output_channels() const noexcept
+    {
+        return _num_output_channels;
+    }
+
+    /** Add a node to the graph.
+     *
+     * The node is prepared for the sample rate and block size of the graph.
+     * The node is processed after the next `commit()`.
+     *
+     * @note Must be called on the control thread.
+     * @param node The node to add.
+     * @return The node-id.
+     */
+    std::size_t add_node(std::shared_ptr<audio_node> node);
+
+    /** Construct a node and add it to the graph.
+     *
+     * @note Must be called on the control thread.
+     * @param args The arguments passed to the constructor of the node.
+     * @return The node-id.
+     */
+    template<std::derived_from<audio_node> Node, typename... Args>
+    std::size_t emplace_node(Args&&...args)
+    {
+        return add_node(std::make_shared<Node>(std::forward<Args>(args)...));
+    }
+
+    /** Remove a node and all of its connections from the graph.
+     *
+     * The node is destroyed after the next `commit()`, once the audio thread no longer uses it.
+     *
+     * @note Must be called on the control thread.
+     * @param node_id The id of the node to remove.
+     */
+    void remove_node(std::size_t node_id) noexcept;
+
+    /** Connect an output port of a node to an input port of another node.
+     *
+     * When multiple output ports are connected to the same input port, they are summed.
+     *
+     * @note Must be called on the control thread.
+     * @param from_id The node-id of the source node, or `input_node`.
+     * @param from_port The index of the output port of the source node, or the input channel.
+     * @param to_id The node-id of the destination node, or `output_node`.
+     * @param to_port The index of the input port of the destination node, or the output channel.
+     * @throw operation_error When the connection would create a cycle.
+     */
+    void connect(std::size_t from_id, std::size_t from_port, std::size_t to_id, std::size_t to_port);
+
+    /** Disconnect an output port from an input port.
+     *
+     * @note Must be called on the control thread.
+     */
+    void disconnect(std::size_t from_id, std::size_t from_port, std::size_t to_id, std::size_t to_port) noexcept;
+
+    /** Compile the graph and hand it over to the audio thread.
+     *
+     * Changes to the nodes and connections only take effect after commit.
+     *
+     * @note Must be called on the control thread.
+     */
+    void commit();
+
+    /** Change a parameter of a node.
+     *
+     * The change is applied by the audio thread before the next block is processed.
+     * Changes to nodes that are not part of the committed graph are ignored.
+     *
+     * @note This function is wait-free while the audio thread keeps up with the
+     *       parameter changes, and may be called from any thread.
+     * @param node_id The id of the node.
+     * @param parameter_id The node specific id of the parameter.
+     * @param value The new value of the parameter.
+     */
+    void set_parameter(std::size_t node_id, std::size_t parameter_id, float value) noexcept
+    {
+        _parameters.insert(detail::audio_graph_parameter{node_id, parameter_id, value});
+    }
+
+    /** Process a block of audio.
+     *
+     * Input channels beyond the channels in @a input are silent, output
+     * channels beyond the channels of the graph are cleared.
+     *
+     * @note Must be called on the audio thread. Does not allocate, lock or block; except
+     *       for the first call on a thread, which registers the thread as a rcu reader.
+     * @param input The samples from the audio device.
+     * @param[out] output The samples to the audio device, `num_samples` must be equal to that of @a input.
+     */
+    void process_audio(audio_block const& input, audio_block& output) noexcept override;
+
+private:
+    struct connection_type {
+        std::size_t from_id;
+        std::size_t from_port;
+        std::size_t to_id;
+        std::size_t to_port;
+
+        [[nodiscard]] friend bool operator==(connection_type const&, connection_type const&) noexcept = default;
+    };
+
+    std::size_t _num_input_channels;
+    std::size_t _num_output_channels;
+    double _sample_rate;
+    std::size_t _max_block_size;
+
+    /** The nodes indexed by node-id; removed nodes and the pseudo nodes are nullptr.
+     */
+    std::vector<std::shared_ptr<audio_node>> _nodes;
+
+    std::vector<connection_type> _connections;
+
+    rcu<detail::audio_graph_schedule> _schedule;
+
+    wfree_fifo<detail::audio_graph_parameter, 32> _parameters;
+    static_assert(sizeof(detail::audio_graph_parameter) <= decltype(_parameters)::slot_type::capacity);
+
+    /** Check if there is a path from one node to another.
+     */
+    [[nodiscard]] bool reachable(std::size_t from_id, std::size_t to_id) const noexcept;
+
+    /** Get the nodes in topological order.
+     */
+    [[nodiscard]] std::vector<std::size_t> sort() const;
+
+    void process_block(detail::audio_graph_schedule const& schedule, audio_block const& input, audio_block& output, std::size_t offset, std::size_t num_samples) noexcept;
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,113 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_graph.hpp"
+#include "audio_node_gain.hpp"
+#include "audio_node_mixer.hpp"
+#include "audio_device_null.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+
+using namespace hi;
+
+/** The time of a single audio callback for a chain of gain nodes, measured in samples.
+ *
+ * The time per iteration is the latency that the graph adds to the audio callback.
+ */
+static void audio_graph_chain(benchmark::State& state)
+{
+    hilet num_nodes = narrow_cast<std::size_t>(state.range(0));
+    hilet block_size = narrow_cast<std::size_t>(state.range(1));
+
+    auto device = audio_device_null{"null", "Null", 48000.0, speaker_mapping::mono_1_0, speaker_mapping::mono_1_0};
+    auto graph = audio_graph{1, 1, device.sample_rate(), block_size};
+
+    auto previous = audio_graph::input_node;
+    for (auto i = 0_uz; i != num_nodes; ++i) {
+        hilet node = graph.emplace_node<audio_node_gain>(1, 1.0f);
+        graph.connect(previous, 0, node, 0);
+        previous = node;
+    }
+    graph.connect(previous, 0, audio_graph::output_node, 0);
+    graph.commit();
+
+    device.start_stream(graph, block_size);
+    std::fill_n(device.input().samples[0], block_size, 0.5f);
+
+    for (auto _ : state) {
+        device.process_block();
+        benchmark::DoNotOptimize(device.output().samples[0]);
+    }
+    state.SetItemsProcessed(narrow_cast<int64_t>(state.iterations() * block_size));
+    device.stop_stream();
+}
+BENCHMARK(audio_graph_chain)->Args({1, 64})->Args({16, 64})->Args({16, 512})->Args({256, 512});
+
+/** Many sources mixed into a stereo output, measured in samples of the output.
+ */
+static void audio_graph_fan_in(benchmark::State& state)
+{
+    hilet num_sources = narrow_cast<std::size_t>(state.range(0));
+    constexpr auto block_size = 256_uz;
+
+    auto device = audio_device_null{"null", "Null", 48000.0, speaker_mapping::stereo_2_0, speaker_mapping::stereo_2_0};
+    auto graph = audio_graph{2, 2, device.sample_rate(), block_size};
+
+    hilet left = graph.emplace_node<audio_node_mixer>(num_sources);
+    hilet right = graph.emplace_node<audio_node_mixer>(num_sources);
+    for (auto i = 0_uz; i != num_sources; ++i) {
+        hilet source = graph.emplace_node<audio_node_gain>(2, 0.5f);
+        graph.connect(audio_graph::input_node, 0, source, 0);
+        graph.connect(audio_graph::input_node, 1, source, 1);
+        graph.connect(source, 0, left, i);
+        graph.connect(source, 1, right, i);
+    }
+    graph.connect(left, 0, audio_graph::output_node, 0);
+    graph.connect(right, 0, audio_graph::output_node, 1);
+    graph.commit();
+
+    device.start_stream(graph, block_size);
+    std::fill_n(device.input().samples[0], block_size, 0.25f);
+    std::fill_n(device.input().samples[1], block_size, -0.25f);
+
+    for (auto _ : state) {
+        device.process_block();
+        benchmark::DoNotOptimize(device.output().samples[0]);
+    }
+    state.SetItemsProcessed(narrow_cast<int64_t>(state.iterations() * block_size));
+    device.stop_stream();
+}
+BENCHMARK(audio_graph_fan_in)->Arg(8)->Arg(64);
+
+/** Parameter changes send from a control thread, measured in parameter changes.
+ *
+ * Each iteration sends a batch of parameter changes, which are applied by the next block.
+ */
+static void audio_graph_parameter(benchmark::State& state)
+{
+    hilet num_changes = narrow_cast<std::size_t>(state.range(0));
+    constexpr auto block_size = 64_uz;
+
+    auto device = audio_device_null{"null", "Null", 48000.0, speaker_mapping::mono_1_0, speaker_mapping::mono_1_0};
+    auto graph = audio_graph{1, 1, device.sample_rate(), block_size};
+    hilet gain = graph.emplace_node<audio_node_gain>(1, 1.0f);
+    graph.connect(audio_graph::input_node, 0, gain, 0);
+    graph.connect(gain, 0, audio_graph::output_node, 0);
+    graph.commit();
+
+    device.start_stream(graph, block_size);
+
+    auto value = 0.0f;
+    for (auto _ : state) {
+        for (auto i = 0_uz; i != num_changes; ++i) {
+            graph.set_parameter(gain, audio_node_gain::gain_id, value);
+            value = value == 0.0f ? 1.0f : 0.0f;
+        }
+        device.process_block();
+        benchmark::DoNotOptimize(device.output().samples[0]);
+    }
+    state.SetItemsProcessed(narrow_cast<int64_t>(state.iterations() * num_changes));
+    device.stop_stream();
+}
+BENCHMARK(audio_graph_parameter)->Arg(1)->Arg(64);
@@ -0,0 +1,337 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_graph.hpp"
+#include "../DSP/dsp_float.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace hi::inline v1 {
+
+audio_graph::audio_graph(
+    std::size_t num_input_channels,
+    std::size_t num_output_channels,
+    double sample_rate,
+    std::size_t max_block_size) :
+    _num_input_channels(num_input_channels),
+    _num_output_channels(num_output_channels),
+    _sample_rate(sample_rate),
+    _max_block_size(max_block_size),
+    _nodes(2)
+{
+    hi_axiom(max_block_size > 0);
+}
+
+std::size_t audio_graph::add_node(std::shared_ptr<audio_node> node)
+{
+    hi_axiom(node != nullptr);
+
+    node->prepare(_sample_rate, _max_block_size);
+    hilet node_id = _nodes.size();
+    _nodes.push_back(std::move(node));
+    return node_id;
+}
+
+void audio_graph::remove_node(std::size_t node_id) noexcept
+{
+    hi_axiom(node_id < _nodes.size() and _nodes[node_id]);
+
+    std::erase_if(_connections, [node_id](hilet& connection) {
+        return connection.from_id == node_id or connection.to_id == node_id;
+    });
+    _nodes[node_id] = nullptr;
+}
+
+void audio_graph::connect(std::size_t from_id, std::size_t from_port, std::size_t to_id, std::size_t to_port)
+{
+    hi_axiom(from_id != output_node and from_id < _nodes.size());
+    hi_axiom(to_id != input_node and to_id < _nodes.size());
+    hi_axiom(from_id == input_node ? from_port < _num_input_channels : _nodes[from_id] and from_port < _nodes[from_id]->num_outputs());
+    hi_axiom(to_id == output_node ? to_port < _num_output_channels : _nodes[to_id] and to_port < _nodes[to_id]->num_inputs());
+
+    hilet connection = connection_type{from_id, from_port, to_id, to_port};
+    if (std::ranges::find(_connections, connection) != _connections.end()) {
+        return;
+    }
+
+    if (from_id == to_id or reachable(to_id, from_id)) {
+        throw operation_error(std::format("Connecting node {} to node {} would create a cycle in the audio graph.", from_id, to_id));
+    }
+
+    _connections.push_back(connection);
+}
+
+void audio_graph::disconnect(std::size_t from_id, std::size_t from_port, std::size_t to_id, std::size_t to_port) noexcept
+{
+    std::erase(_connections, connection_type{from_id, from_port, to_id, to_port});
+}
+
+[[nodiscard]] bool audio_graph::reachable(std::size_t from_id, std::size_t to_id) const noexcept
+{
+    auto visited = std::vector<bool>(_nodes.size(), false);
+    auto todo = std::vector<std::size_t>{from_id};
+    while (not todo.empty()) {
+        hilet node_id = todo.back();
+        todo.pop_back();
+
+        if (node_id == to_id) {
+            return true;
+        }
+
+        for (hilet& connection : _connections) {
+            if (connection.from_id == node_id and not visited[connection.to_id]) {
+                visited[connection.to_id] = true;
+                todo.push_back(connection.to_id);
+            }
+        }
+    }
+    return false;
+}
+
+[[nodiscard]] std::vector<std::size_t> audio_graph::sort() const
+{
+    // Kahn's algorithm; the pseudo nodes are not part of the order.
+    auto num_incoming = std::vector<std::size_t>(_nodes.size(), 0);
+    for (hilet& connection : _connections) {
+        if (connection.from_id != input_node and connection.to_id != output_node) {
+            ++num_incoming[connection.to_id];
+        }
+    }
+
+    auto r = std::vector<std::size_t>{};
+    for (auto node_id = 0_uz; node_id != _nodes.size(); ++node_id) {
+        if (_nodes[node_id] and num_incoming[node_id] == 0) {
+            r.push_back(node_id);
+        }
+    }
+
+    // The nodes at the end of r are the nodes which are ready.
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        for (hilet& connection : _connections) {
+            if (connection.from_id == r[i] and connection.to_id != output_node and --num_incoming[connection.to_id] == 0) {
+                r.push_back(connection.to_id);
+            }
+        }
+    }
+
+    hi_axiom(r.size() == static_cast<std::size_t>(std::ranges::count_if(_nodes, [](hilet& node) {
+                 return to_bool(node);
+             })));
+    return r;
+}
+
+void audio_graph::commit()
+{
+    constexpr auto silence = std::numeric_limits<std::size_t>::max();
+
+    hilet order = sort();
+    auto schedule = detail::audio_graph_schedule{};
+    schedule.nodes = _nodes;
+
+    // The buffer of each output port, and the number of input ports that still need to read it.
+    auto port_buffers = std::vector<std::vector<std::size_t>>(_nodes.size());
+    auto port_readers = std::vector<std::vector<std::size_t>>(_nodes.size());
+    for (auto node_id = 0_uz; node_id != _nodes.size(); ++node_id) {
+        hilet num_ports = node_id == input_node ? _num_input_channels : _nodes[node_id] ? _nodes[node_id]->num_outputs() : 0_uz;
+        port_buffers[node_id].resize(num_ports, silence);
+        port_readers[node_id].resize(num_ports, 0);
+    }
+    for (hilet& connection : _connections) {
+        ++port_readers[connection.from_id][connection.from_port];
+    }
+
+    // The buffers are identified by index until all of them are allocated.
+    auto num_buffers = 0_uz;
+    auto free_buffers = std::vector<std::size_t>{};
+    hilet allocate = [&] {
+        if (free_buffers.empty()) {
+            return num_buffers++;
+        }
+        hilet r = free_buffers.back();
+        free_buffers.pop_back();
+        return r;
+    };
+
+    auto input_channels = std::vector<std::size_t>{};
+    for (auto channel = 0_uz; channel != _num_input_channels; ++channel) {
+        hilet buffer = port_readers[input_node][channel] != 0 ? allocate() : silence;
+        port_buffers[input_node][channel] = buffer;
+        input_channels.push_back(buffer);
+    }
+
+    auto inputs = std::vector<std::size_t>{};
+    auto outputs = std::vector<std::size_t>{};
+    auto mix_destinations = std::vector<std::size_t>{};
+    auto sources = std::vector<std::size_t>{};
+    for (hilet node_id : order) {
+        auto& node = *_nodes[node_id];
+
+        auto step = detail::audio_graph_step{&node, inputs.size(), outputs.size(), mix_destinations.size(), 0};
+        auto mix_buffers = std::vector<std::size_t>{};
+        for (auto port = 0_uz; port != node.num_inputs(); ++port) {
+            hilet first_source = sources.size();
+            for (hilet& connection : _connections) {
+                if (connection.to_id == node_id and connection.to_port == port) {
+                    sources.push_back(port_buffers[connection.from_id][connection.from_port]);
+                }
+            }
+
+            hilet num_sources = sources.size() - first_source;
+            if (num_sources == 0) {
+                inputs.push_back(silence);
+
+            } else if (num_sources == 1) {
+                inputs.push_back(sources.back());
+                sources.pop_back();
+
+            } else {
+                hilet buffer = allocate();
+                mix_buffers.push_back(buffer);
+                mix_destinations.push_back(buffer);
+                schedule.mixes.push_back({nullptr, first_source, num_sources});
+                inputs.push_back(buffer);
+                ++step.num_mixes;
+            }
+        }
+
+        // Allocate the outputs before the inputs are released, so that they never alias.
+        for (auto port = 0_uz; port != node.num_outputs(); ++port) {
+            hilet buffer = allocate();
+            port_buffers[node_id][port] = buffer;
+            outputs.push_back(buffer);
+        }
+
+        for (hilet& connection : _connections) {
+            if (connection.to_id == node_id and --port_readers[connection.from_id][connection.from_port] == 0) {
+                free_buffers.push_back(port_buffers[connection.from_id][connection.from_port]);
+            }
+        }
+        for (auto port = 0_uz; port != node.num_outputs(); ++port) {
+            if (port_readers[node_id][port] == 0) {
+                free_buffers.push_back(port_buffers[node_id][port]);
+            }
+        }
+        free_buffers.insert(free_buffers.end(), mix_buffers.begin(), mix_buffers.end());
+
+        schedule.steps.push_back(step);
+    }
+
+    for (auto channel = 0_uz; channel != _num_output_channels; ++channel) {
+        hilet first_source = sources.size();
+        for (hilet& connection : _connections) {
+            if (connection.to_id == output_node and connection.to_port == channel) {
+                sources.push_back(port_buffers[connection.from_id][connection.from_port]);
+            }
+        }
+        schedule.output_channels.emplace_back(first_source, sources.size() - first_source);
+    }
+
+    // Allocate the buffers, and convert the buffer indices to pointers.
+    // Each buffer is a whole number of cache-lines.
+    hilet stride = ceil(_max_block_size, 16_uz);
+    schedule.buffers.resize(num_buffers * stride, 0.0f);
+    schedule.silence.resize(stride, 0.0f);
+
+    hilet to_pointer = [&](std::size_t buffer) -> float * {
+        return buffer == silence ? schedule.silence.data() : schedule.buffers.data() + buffer * stride;
+    };
+
+    std::ranges::transform(input_channels, std::back_inserter(schedule.input_channels), [&](hilet buffer) -> float * {
+        return buffer == silence ? nullptr : to_pointer(buffer);
+    });
+    std::ranges::transform(inputs, std::back_inserter(schedule.inputs), to_pointer);
+    std::ranges::transform(outputs, std::back_inserter(schedule.outputs), to_pointer);
+    std::ranges::transform(sources, std::back_inserter(schedule.sources), to_pointer);
+    for (auto i = 0_uz; i != schedule.mixes.size(); ++i) {
+        schedule.mixes[i].destination = to_pointer(mix_destinations[i]);
+    }
+
+    _schedule.emplace(std::move(schedule));
+}
+
+void audio_graph::process_audio(audio_block const& input, audio_block& output) noexcept
+{
+    hi_axiom(input.num_samples == output.num_samples);
+
+    _schedule.lock();
+    hilet *schedule = _schedule.get();
+
+    _parameters.take_all([schedule](detail::audio_graph_parameter const& parameter) {
+        if (schedule != nullptr and parameter.node_id < schedule->nodes.size()) {
+            if (auto *node = schedule->nodes[parameter.node_id].get()) {
+                node->set_parameter(parameter.parameter_id, parameter.value);
+            }
+        }
+    });
+
+    if (schedule == nullptr) {
+        for (auto channel = 0_uz; channel != output.num_channels; ++channel) {
+            std::fill_n(output.samples[channel], output.num_samples, 0.0f);
+        }
+
+    } else {
+        for (auto offset = 0_uz; offset < output.num_samples; offset += _max_block_size) {
+            process_block(*schedule, input, output, offset, std::min(_max_block_size, output.num_samples - offset));
+        }
+    }
+
+    _schedule.unlock();
+    output.state = audio_block_state::normal;
+}
+
+void audio_graph::process_block(
+    detail::audio_graph_schedule const& schedule,
+    audio_block const& input,
+    audio_block& output,
+    std::size_t offset,
+    std::size_t num_samples) noexcept
+{
+    hilet input_is_valid = input.state == audio_block_state::normal;
+    for (auto channel = 0_uz; channel != schedule.input_channels.size(); ++channel) {
+        if (auto *buffer = schedule.input_channels[channel]) {
+            if (input_is_valid and channel < input.num_channels) {
+                std::copy_n(input.samples[channel] + offset, num_samples, buffer);
+            } else {
+                std::fill_n(buffer, num_samples, 0.0f);
+            }
+        }
+    }
+
+    // Sum the sources into the destination, which may be a buffer of the audio device.
+    hilet mix = [&](float *destination, std::size_t first_source, std::size_t num_sources) {
+        if (num_sources == 0) {
+            std::fill_n(destination, num_samples, 0.0f);
+            return;
+        }
+
+        hilet r = std::span{destination, num_samples};
+        std::copy_n(schedule.sources[first_source], num_samples, destination);
+        for (auto i = first_source + 1; i != first_source + num_sources; ++i) {
+            dsp_add(r, r, std::span{schedule.sources[i], num_samples});
+        }
+    };
+
+    for (hilet& step : schedule.steps) {
+        for (auto i = step.first_mix; i != step.first_mix + step.num_mixes; ++i) {
+            hilet& m = schedule.mixes[i];
+            mix(m.destination, m.first_source, m.num_sources);
+        }
+
+        step.node->process(
+            std::span{schedule.inputs.data() + step.first_input, step.node->num_inputs()},
+            std::span{schedule.outputs.data() + step.first_output, step.node->num_outputs()},
+            num_samples);
+    }
+
+    for (auto channel = 0_uz; channel != output.num_channels; ++channel) {
+        if (channel < schedule.output_channels.size()) {
+            hilet[first_source, num_sources] = schedule.output_channels[channel];
+            mix(output.samples[channel] + offset, first_source, num_sources);
+        } else {
+            std::fill_n(output.samples[channel] + offset, num_samples, 0.0f);
+        }
+    }
+}
+
+} // namespace hi::inline v1
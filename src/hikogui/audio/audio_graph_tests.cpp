@@ -0,0 +1,289 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_graph.hpp"
+#include "audio_node_gain.hpp"
+#include "audio_node_mixer.hpp"
+#include "audio_device_null.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace hi;
+
+namespace {
+
+/** An audio block that owns its sample buffers.
+ */
+class audio_graph_tests_block {
+public:
+    audio_block block = {};
+
+    audio_graph_tests_block(std::size_t num_channels, std::size_t num_samples) :
+        _samples(num_channels, std::vector<float>(num_samples, 0.0f))
+    {
+        for (auto& channel : _samples) {
+            _pointers.push_back(channel.data());
+        }
+        block.samples = _pointers.data();
+        block.num_samples = num_samples;
+        block.num_channels = num_channels;
+        block.sample_rate = 48000;
+        block.state = audio_block_state::normal;
+    }
+
+    [[nodiscard]] std::vector<float>& operator[](std::size_t channel) noexcept
+    {
+        return _samples[channel];
+    }
+
+private:
+    std::vector<std::vector<float>> _samples;
+    std::vector<float *> _pointers;
+};
+
+/** Fill a channel with the sample index plus one.
+ */
+void audio_graph_tests_ramp(std::vector<float>& channel, float scale = 1.0f)
+{
+    for (auto i = 0_uz; i != channel.size(); ++i) {
+        channel[i] = static_cast<float>(i + 1) * scale;
+    }
+}
+
+} // namespace
+
+TEST(audio_graph, empty)
+{
+    auto graph = audio_graph{1, 2, 48000.0, 64};
+    auto input = audio_graph_tests_block{1, 64};
+    auto output = audio_graph_tests_block{2, 64};
+    audio_graph_tests_ramp(input[0]);
+    audio_graph_tests_ramp(output[0]);
+
+    // Not committed.
+    graph.process_audio(input.block, output.block);
+    ASSERT_EQ(output[0], std::vector<float>(64, 0.0f));
+
+    // Pass the input channel straight to both output channels.
+    graph.connect(audio_graph::input_node, 0, audio_graph::output_node, 0);
+    graph.connect(audio_graph::input_node, 0, audio_graph::output_node, 1);
+    graph.commit();
+    graph.process_audio(input.block, output.block);
+    ASSERT_EQ(output[0], input[0]);
+    ASSERT_EQ(output[1], input[0]);
+}
+
+TEST(audio_graph, chain)
+{
+    auto graph = audio_graph{1, 1, 48000.0, 64};
+
+    // Add the nodes in the reverse order of processing, to check the topological sort.
+    hilet c = graph.emplace_node<audio_node_gain>(1, 4.0f);
+    hilet b = graph.emplace_node<audio_node_gain>(1, 0.5f);
+    hilet a = graph.emplace_node<audio_node_gain>(1, 3.0f);
+    graph.connect(b, 0, c, 0);
+    graph.connect(audio_graph::input_node, 0, a, 0);
+    graph.connect(c, 0, audio_graph::output_node, 0);
+    graph.connect(a, 0, b, 0);
+    graph.commit();
+
+    auto input = audio_graph_tests_block{1, 64};
+    auto output = audio_graph_tests_block{1, 64};
+    audio_graph_tests_ramp(input[0]);
+
+    graph.process_audio(input.block, output.block);
+    auto expected = std::vector<float>(64);
+    audio_graph_tests_ramp(expected, 6.0f);
+    ASSERT_EQ(output[0], expected);
+}
+
+TEST(audio_graph, mix)
+{
+    auto graph = audio_graph{2, 1, 48000.0, 64};
+
+    // Both input channels are connected to the same input port of a gain node, and
+    // both gain nodes are connected to the same output channel.
+    hilet a = graph.emplace_node<audio_node_gain>(1, 1.0f);
+    hilet b = graph.emplace_node<audio_node_gain>(1, 2.0f);
+    graph.connect(audio_graph::input_node, 0, a, 0);
+    graph.connect(audio_graph::input_node, 1, a, 0);
+    graph.connect(audio_graph::input_node, 1, b, 0);
+    graph.connect(a, 0, audio_graph::output_node, 0);
+    graph.connect(b, 0, audio_graph::output_node, 0);
+    graph.commit();
+
+    auto input = audio_graph_tests_block{2, 64};
+    auto output = audio_graph_tests_block{1, 64};
+    audio_graph_tests_ramp(input[0], 1.0f);
+    audio_graph_tests_ramp(input[1], 10.0f);
+
+    graph.process_audio(input.block, output.block);
+    for (auto i = 0_uz; i != 64; ++i) {
+        ASSERT_EQ(output[0][i], input[0][i] + input[1][i] + 2.0f * input[1][i]);
+    }
+}
+
+TEST(audio_graph, mixer_node)
+{
+    auto graph = audio_graph{3, 1, 48000.0, 64};
+    hilet mixer = graph.emplace_node<audio_node_mixer>(3);
+    graph.connect(audio_graph::input_node, 0, mixer, 0);
+    graph.connect(audio_graph::input_node, 1, mixer, 1);
+    graph.connect(audio_graph::input_node, 2, mixer, 2);
+    graph.connect(mixer, 0, audio_graph::output_node, 0);
+    graph.commit();
+
+    auto input = audio_graph_tests_block{3, 64};
+    auto output = audio_graph_tests_block{1, 64};
+    audio_graph_tests_ramp(input[0], 1.0f);
+    audio_graph_tests_ramp(input[1], 2.0f);
+    audio_graph_tests_ramp(input[2], 4.0f);
+
+    graph.set_parameter(mixer, 1, 0.0f);
+    graph.set_parameter(mixer, 2, 0.5f);
+    graph.process_audio(input.block, output.block);
+
+    auto expected = std::vector<float>(64);
+    audio_graph_tests_ramp(expected, 3.0f);
+    ASSERT_EQ(output[0], expected);
+}
+
+TEST(audio_graph, long_chain)
+{
+    // A long chain reuses the buffers of the nodes that were processed before.
+    auto graph = audio_graph{1, 1, 48000.0, 64};
+    auto previous = audio_graph::input_node;
+    for (auto i = 0; i != 100; ++i) {
+        hilet node = graph.emplace_node<audio_node_gain>(1, i % 2 == 0 ? 2.0f : 0.5f);
+        graph.connect(previous, 0, node, 0);
+        previous = node;
+    }
+    graph.connect(previous, 0, audio_graph::output_node, 0);
+    graph.commit();
+
+    auto input = audio_graph_tests_block{1, 64};
+    auto output = audio_graph_tests_block{1, 64};
+    audio_graph_tests_ramp(input[0]);
+
+    graph.process_audio(input.block, output.block);
+    ASSERT_EQ(output[0], input[0]);
+}
+
+TEST(audio_graph, cycle)
+{
+    auto graph = audio_graph{1, 1, 48000.0, 64};
+    hilet a = graph.emplace_node<audio_node_gain>(1);
+    hilet b = graph.emplace_node<audio_node_gain>(1);
+    hilet c = graph.emplace_node<audio_node_gain>(1);
+    graph.connect(a, 0, b, 0);
+    graph.connect(b, 0, c, 0);
+    ASSERT_THROW(graph.connect(c, 0, a, 0), operation_error);
+    ASSERT_THROW(graph.connect(a, 0, a, 0), operation_error);
+
+    // Break the chain, now the connection is allowed.
+    graph.disconnect(b, 0, c, 0);
+    ASSERT_NO_THROW(graph.connect(c, 0, a, 0));
+}
+
+TEST(audio_graph, parameter)
+{
+    auto graph = audio_graph{1, 1, 48000.0, 64};
+    hilet gain = graph.emplace_node<audio_node_gain>(1, 1.0f);
+    graph.connect(audio_graph::input_node, 0, gain, 0);
+    graph.connect(gain, 0, audio_graph::output_node, 0);
+    graph.commit();
+
+    auto input = audio_graph_tests_block{1, 64};
+    auto output = audio_graph_tests_block{1, 64};
+    std::ranges::fill(input[0], 1.0f);
+
+    // The change of gain is ramped over the first block.
+    graph.set_parameter(gain, audio_node_gain::gain_id, 0.0f);
+    graph.process_audio(input.block, output.block);
+    ASSERT_EQ(output[0].front(), 1.0f);
+    ASSERT_NEAR(output[0].back(), 1.0f / 64.0f, 1e-6f);
+    for (auto i = 1_uz; i != 64; ++i) {
+        ASSERT_LT(output[0][i], output[0][i - 1]);
+    }
+
+    graph.process_audio(input.block, output.block);
+    ASSERT_EQ(output[0], std::vector<float>(64, 0.0f));
+
+    // Parameters of unknown nodes are ignored.
+    graph.set_parameter(1000, 0, 1.0f);
+    graph.process_audio(input.block, output.block);
+    ASSERT_EQ(output[0], std::vector<float>(64, 0.0f));
+}
+
+TEST(audio_graph, split_block)
+{
+    // Blocks larger than the maximum block size are processed in parts.
+    auto graph = audio_graph{1, 3, 48000.0, 64};
+    hilet gain = graph.emplace_node<audio_node_gain>(1, 2.0f);
+    graph.connect(audio_graph::input_node, 0, gain, 0);
+    graph.connect(gain, 0, audio_graph::output_node, 0);
+    graph.commit();
+
+    auto input = audio_graph_tests_block{1, 200};
+    auto output = audio_graph_tests_block{4, 200};
+    audio_graph_tests_ramp(input[0]);
+    audio_graph_tests_ramp(output[1]);
+    audio_graph_tests_ramp(output[3]);
+
+    graph.process_audio(input.block, output.block);
+    auto expected = std::vector<float>(200);
+    audio_graph_tests_ramp(expected, 2.0f);
+    ASSERT_EQ(output[0], expected);
+
+    // Unconnected channels and channels that are not part of the graph are cleared.
+    ASSERT_EQ(output[1], std::vector<float>(200, 0.0f));
+    ASSERT_EQ(output[3], std::vector<float>(200, 0.0f));
+}
+
+TEST(audio_graph, remove_node)
+{
+    auto graph = audio_graph{1, 1, 48000.0, 64};
+    hilet a = graph.emplace_node<audio_node_gain>(1, 2.0f);
+    graph.connect(audio_graph::input_node, 0, a, 0);
+    graph.connect(a, 0, audio_graph::output_node, 0);
+    graph.commit();
+
+    auto input = audio_graph_tests_block{1, 64};
+    auto output = audio_graph_tests_block{1, 64};
+    audio_graph_tests_ramp(input[0]);
+    graph.process_audio(input.block, output.block);
+    ASSERT_EQ(output[0][0], 2.0f);
+
+    graph.remove_node(a);
+    graph.commit();
+    graph.process_audio(input.block, output.block);
+    ASSERT_EQ(output[0], std::vector<float>(64, 0.0f));
+}
+
+TEST(audio_graph, null_device)
+{
+    auto device = audio_device_null{"null", "Null", 48000.0, speaker_mapping::mono_1_0, speaker_mapping::stereo_2_0};
+    ASSERT_EQ(device.direction(), audio_direction::bidirectional);
+
+    auto graph = audio_graph{1, 2, device.sample_rate(), 128};
+    hilet gain = graph.emplace_node<audio_node_gain>(1, 0.5f);
+    graph.connect(audio_graph::input_node, 0, gain, 0);
+    graph.connect(gain, 0, audio_graph::output_node, 1);
+    graph.commit();
+
+    device.start_stream(graph, 128);
+    ASSERT_EQ(device.input().num_channels, 1);
+    ASSERT_EQ(device.output().num_channels, 2);
+
+    for (auto i = 0; i != 3; ++i) {
+        std::fill_n(device.input().samples[0], 128, 1.0f);
+        device.process_block();
+        ASSERT_EQ(device.output().sample_count, i * 128);
+        ASSERT_EQ(device.output().samples[0][0], 0.0f);
+        ASSERT_EQ(device.output().samples[1][127], 0.5f);
+    }
+
+    device.stop_stream();
+    ASSERT_FALSE(device.streaming());
+}
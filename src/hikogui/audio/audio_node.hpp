@@ -0,0 +1,84 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/module.hpp"
+#include <span>
+#include <cstddef>
+
+namespace hi::inline v1 {
+
+/** A processing node in an audio graph.
+ *
+ * A node has a fixed number of mono input ports and mono output ports.
+ * The ports are connected to the ports of other nodes by the `audio_graph`.
+ *
+ * The functions of a node are called from two threads:
+ *  - `prepare()` is called on the control thread before the node is
+ *    scheduled, here the node should allocate all the memory it needs.
+ *  - `process()` and `set_parameter()` are called on the audio thread, these
+ *    functions must not allocate, lock or block.
+ */
+class audio_node {
+public:
+    virtual ~audio_node() = default;
+    audio_node(audio_node const&) = delete;
+    audio_node(audio_node&&) = delete;
+    audio_node& operator=(audio_node const&) = delete;
+    audio_node& operator=(audio_node&&) = delete;
+
+    /** Construct a node.
+     *
+     * @param num_inputs The number of mono input ports.
+     * @param num_outputs The number of mono output ports.
+     */
+    audio_node(std::size_t num_inputs, std::size_t num_outputs) noexcept : _num_inputs(num_inputs), _num_outputs(num_outputs) {}
+
+    [[nodiscard]] std::size_t num_inputs() const noexcept
+    {
+        return _num_inputs;
+    }
+
+    [[nodiscard]] std::size_t num_outputs() const noexcept
+    {
+        return _num_outputs;
+    }
+
+    /** Prepare the node for processing.
+     *
+     * Called once on the control thread, before the node is used by the audio thread.
+     *
+     * @param sample_rate The sample rate of the audio.
+     * @param max_block_size The maximum number of samples passed to `process()`.
+     */
+    virtual void prepare(double sample_rate, std::size_t max_block_size) {}
+
+    /** Process a block of samples.
+     *
+     * Each input port and output port is a buffer of at least `num_samples` samples.
+     * An input port that is not connected contains silence. The output buffers
+     * never alias the input buffers.
+     *
+     * @param inputs The sample buffers of the input ports.
+     * @param outputs The sample buffers of the output ports.
+     * @param num_samples The number of samples to process, at most `max_block_size`.
+     */
+    virtual void process(std::span<float const *const> inputs, std::span<float *const> outputs, std::size_t num_samples) noexcept = 0;
+
+    /** Change a parameter of the node.
+     *
+     * Called on the audio thread between calls to `process()`.
+     *
+     * @param id The node specific identifier of the parameter.
+     * @param value The new value of the parameter.
+     */
+    virtual void set_parameter(std::size_t id, float value) noexcept {}
+
+private:
+    std::size_t _num_inputs;
+    std::size_t _num_outputs;
+};
+
+} // namespace hi::inline v1
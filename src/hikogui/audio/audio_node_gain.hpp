@@ -0,0 +1,78 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_node.hpp"
+#include "../DSP/dsp_float.hpp"
+#include "../utility/module.hpp"
+
+namespace hi::inline v1 {
+
+/** A node that changes the volume of each of its channels.
+ *
+ * Each input port is multiplied by the gain and written to the output port with the same index.
+ * When the gain is changed the gain is linearly ramped over the next block, so that the change
+ * does not cause a click.
+ */
+class audio_node_gain : public audio_node {
+public:
+    /** The identifiers of the parameters of this node.
+     */
+    enum parameter_id : std::size_t {
+        /** The linear gain.
+         */
+        gain_id = 0
+    };
+
+    /** Construct a gain node.
+     *
+     * @param num_channels The number of input ports, and the number of output ports.
+     * @param gain The initial linear gain.
+     */
+    audio_node_gain(std::size_t num_channels, float gain = 1.0f) noexcept :
+        audio_node(num_channels, num_channels), _gain(gain), _target_gain(gain)
+    {
+    }
+
+    void process(std::span<float const *const> inputs, std::span<float *const> outputs, std::size_t num_samples) noexcept override
+    {
+        hi_axiom(inputs.size() == outputs.size());
+
+        if (_gain == _target_gain) {
+            for (auto i = 0_uz; i != inputs.size(); ++i) {
+                dsp_gain(std::span{outputs[i], num_samples}, std::span{inputs[i], num_samples}, _gain);
+            }
+            return;
+        }
+
+        hilet step = (_target_gain - _gain) / static_cast<float>(num_samples);
+        for (auto i = 0_uz; i != inputs.size(); ++i) {
+            auto gain = _gain;
+            for (auto j = 0_uz; j != num_samples; ++j) {
+                outputs[i][j] = inputs[i][j] * gain;
+                gain += step;
+            }
+        }
+        _gain = _target_gain;
+    }
+
+    void set_parameter(std::size_t id, float value) noexcept override
+    {
+        if (id == gain_id) {
+            _target_gain = value;
+        }
+    }
+
+private:
+    /** The gain at the start of the next block.
+     */
+    float _gain;
+
+    /** The gain at the end of the next block.
+     */
+    float _target_gain;
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,53 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "audio_node.hpp"
+#include "../DSP/dsp_float.hpp"
+#include "../utility/module.hpp"
+#include <vector>
+
+namespace hi::inline v1 {
+
+/** A node that mixes its inputs into a single output.
+ *
+ * The parameter with the index of an input port is the linear gain of that input.
+ */
+class audio_node_mixer : public audio_node {
+public:
+    /** Construct a mixer node.
+     *
+     * @param num_inputs The number of input ports.
+     */
+    audio_node_mixer(std::size_t num_inputs) : audio_node(num_inputs, 1), _gains(num_inputs, 1.0f) {}
+
+    void process(std::span<float const *const> inputs, std::span<float *const> outputs, std::size_t num_samples) noexcept override
+    {
+        hi_axiom(outputs.size() == 1);
+
+        hilet output = std::span{outputs[0], num_samples};
+        if (inputs.empty()) {
+            std::ranges::fill(output, 0.0f);
+            return;
+        }
+
+        dsp_gain(output, std::span{inputs[0], num_samples}, _gains[0]);
+        for (auto i = 1_uz; i != inputs.size(); ++i) {
+            dsp_mix(output, std::span{inputs[i], num_samples}, _gains[i]);
+        }
+    }
+
+    void set_parameter(std::size_t id, float value) noexcept override
+    {
+        if (id < _gains.size()) {
+            _gains[id] = value;
+        }
+    }
+
+private:
+    std::vector<float> _gains;
+};
+
+} // namespace hi::inline v1
@@ -28,6 +28,13 @@ enum class callback_flags {
     /** Call the function once, then automatically unsubscribe.
      */
     once = 0x1'00,
+
+    /** Coalesce asynchronous calls.
+     *
+     * While a call is waiting in the loop, more notifications do not post another call;
+     * instead the function is called once with the arguments of the last notification.
+     */
+    coalesce = 0x2'00,
 };
 
 [[nodiscard]] constexpr callback_flags operator|(callback_flags const &lhs, callback_flags const &rhs) noexcept
@@ -41,6 +48,11 @@ enum class callback_flags {
     return to_bool(to_underlying(rhs) & to_underlying(callback_flags::once));
 }
 
+[[nodiscard]] constexpr bool is_coalesce(callback_flags const& rhs) noexcept
+{
+    return to_bool(to_underlying(rhs) & to_underlying(callback_flags::coalesce));
+}
+
 [[nodiscard]] constexpr bool is_synchronous(callback_flags const& rhs) noexcept
 {
     return to_bool((to_underlying(rhs) & 0xff) == to_underlying(callback_flags::synchronous));
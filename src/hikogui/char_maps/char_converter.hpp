@@ -9,11 +9,20 @@
 #pragma once
 
 #include "../utility/module.hpp"
+#include <concepts>
+#include <cstring>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #if defined(HI_HAS_SSE2)
 #include <emmintrin.h>
 #endif
+#if defined(HI_HAS_SSE4_1)
+#include <smmintrin.h>
+#endif
+#if defined(HI_HAS_AVX2)
+#include <immintrin.h>
+#endif
 
 namespace hi { inline namespace v1 {
 
@@ -78,6 +87,42 @@ namespace hi { inline namespace v1 {
  * ```
  *  - _chunk_ A chunk of 16 ascii characters. bit 7 is always '0'.
  *  - _ptr_ The pointer to the first code-unit where the ASCII characters must be written to.
+ *
+ *
+ * ### Optional: Validate text.
+ * ```cpp
+ * constexpr bool validate(char_type const *first, char_type const *last) const noexcept
+ * ```
+ *  - _first_ A pointer to the first code-unit of the text.
+ *  - _last_ A pointer one beyond the last code-unit of the text.
+ *  - _return_ True if `read()` would return valid for each code-point in the text.
+ *
+ *
+ * ### Optional: Read a chunk of code-points from the Basic Multilingual Plane.
+ * ```cpp
+ * std::size_t read_bmp_chunk8(char_type const *&ptr, char_type const *last, __m128i &lo, __m128i &hi) const noexcept
+ * ```
+ *  - _[in,out]ptr_ Pointer to the first code-unit of the chunk, on return it will point beyond the code-units that
+ *    were read.
+ *  - _last_ A pointer pointing one beyond the string.
+ *  - _[out]lo_ The first 4 code-points, as 32 bit integers.
+ *  - _[out]hi_ The next 4 code-points, as 32 bit integers.
+ *  - _return_ The number of code-points read, up to 8. Lanes beyond this count are zero.
+ *    Zero if the chunk could not be read, in that case `ptr` is unchanged and `read()` should be used instead.
+ *
+ * The code-points must be valid and below U+10000, so that each code-point is encoded in at most 3 UTF-8
+ * code-units or a single UTF-16 code-unit.
+ *
+ *
+ * ### Optional: Write a chunk of code-points from the Basic Multilingual Plane.
+ * ```cpp
+ * void write_bmp_chunk8(__m128i lo, __m128i hi, std::size_t count, char_type *&ptr) const noexcept
+ * ```
+ *  - _lo_ The first 4 code-points, as 32 bit integers.
+ *  - _hi_ The next 4 code-points, as 32 bit integers.
+ *  - _count_ The number of code-points to write, lanes beyond the count are zero.
+ *  - _[in,out]ptr_ The pointer where the code-units will be written. On return it will point beyond the
+ *    code-units of `count` code-points. The implementation may write up to 32 bytes beyond `ptr`.
  */
 template<fixed_string Encoding>
 struct char_map;
@@ -110,33 +155,25 @@ public:
         using std::cbegin;
         using std::cend;
         using std::begin;
-        using std::end;
-
-        hilet[size, valid] = _size(cbegin(src), cend(src));
-
-        auto r = OutRange{};
-        if constexpr (From == To and std::is_same_v<InRange, OutRange>) {
-            if (valid) {
-                r = std::forward<InRange>(src);
-                // If and identity conversion is requested and the src is valid, then shortcut by return the src.
-                return r;
+        using std::size;
+
+        if constexpr (_is_identity) {
+            if (_validate(cbegin(src), cend(src))) {
+                if constexpr (std::is_same_v<std::remove_cvref_t<InRange>, OutRange>) {
+                    // If an identity conversion is requested and the src is valid, then shortcut by returning the src.
+                    return OutRange{std::forward<InRange>(src)};
+                } else {
+                    auto r = OutRange{};
+                    r.resize(size(src));
+                    if (size(src) != 0) {
+                        std::memcpy(std::addressof(*begin(r)), std::addressof(*cbegin(src)), size(src) * sizeof(from_char_type));
+                    }
+                    return r;
+                }
             }
         }
 
-        if (size == 0) {
-            return r;
-        }
-
-        r.resize(size);
-        if (From == To and valid) {
-            hi_axiom(size != 0);
-
-            using std::size;
-            std::memcpy(std::addressof(*begin(r)), std::addressof(*cbegin(src)), size(src) * sizeof(from_char_type));
-        } else {
-            _convert(cbegin(src), cend(src), begin(r));
-        }
-        return r;
+        return _convert<OutRange>(cbegin(src), cend(src));
     }
 
     /** Convert text between the given encodings.
@@ -151,21 +188,20 @@ public:
     {
         using std::begin;
 
-        hilet[size, valid] = _size(first, last);
-        auto r = OutRange{};
-        if (size == 0) {
-            return r;
-        }
-
-        r.resize(size);
-        if (From == To and valid) {
-            hi_axiom(size != 0);
+        if constexpr (_is_identity) {
+            if (_validate(first, last)) {
+                hilet size = narrow_cast<size_t>(std::distance(first, last));
 
-            std::memcpy(std::addressof(*begin(r)), std::addressof(*first), std::distance(first, last) * sizeof(from_char_type));
-        } else {
-            _convert(first, last, begin(r));
+                auto r = OutRange{};
+                r.resize(size);
+                if (size != 0) {
+                    std::memcpy(std::addressof(*begin(r)), std::addressof(*first), size * sizeof(from_char_type));
+                }
+                return r;
+            }
         }
-        return r;
+
+        return _convert<OutRange>(first, last);
     }
 
     /** Read text from a byte array.
@@ -217,102 +253,113 @@ public:
     }
 
 private:
-#if defined(HI_HAS_SSE2)
-    using chunk16_type = __m128i;
-#else
-    using chunk16_type = void;
+    constexpr static bool _is_identity = std::is_same_v<from_encoder_type, to_encoder_type>;
+
+#if defined(HI_HAS_SSE4_1)
+    constexpr static bool _has_bmp_chunk8 = requires(
+        from_encoder_type const& from,
+        to_encoder_type const& to,
+        from_char_type const *& src,
+        to_char_type *& dst,
+        __m128i& chunk) {
+        {
+            from.read_bmp_chunk8(src, src, chunk, chunk)
+            } -> std::same_as<std::size_t>;
+        to.write_bmp_chunk8(chunk, chunk, std::size_t{}, dst);
+    };
 #endif
 
-    constexpr static bool _has_read_ascii_chunk16 = true;
-    constexpr static bool _has_write_ascii_chunk16 = true;
+    /** The maximum number of code-units written by a single step of `_convert()`.
+     */
+    constexpr static std::size_t _max_step_size = 32;
 
     template<typename It, typename EndIt>
-    [[nodiscard]] constexpr void _size_ascii(It& it, EndIt last, size_t& count) const noexcept
+    [[nodiscard]] constexpr bool _validate(It first, EndIt last) const noexcept
     {
-        if (not std::is_constant_evaluated()) {
-#if defined(HI_HAS_SSE2)
-            if constexpr (_has_read_ascii_chunk16 and _has_write_ascii_chunk16) {
-                while (std::distance(it, last) >= 16) {
-                    hilet chunk = from_encoder_type{}.read_ascii_chunk16(it);
-                    hilet ascii_mask = _mm_movemask_epi8(chunk);
-                    if (ascii_mask) {
-                        // This chunk contains non-ASCII characters.
-                        auto partial_count = std::countr_zero(truncate<uint16_t>(ascii_mask));
-                        it += partial_count;
-                        count += partial_count;
-                        break;
-                    }
-                    it += 16;
-                    count += 16;
+        if constexpr (requires { from_encoder_type{}.validate(first, last); }) {
+            return from_encoder_type{}.validate(first, last);
+        } else {
+            while (first != last) {
+                if (hilet[code_point, valid] = from_encoder_type{}.read(first, last); not valid) {
+                    return false;
                 }
             }
-#endif
+            return true;
         }
     }
 
+    /** Convert a chunk of code-points.
+     *
+     * @return True if a chunk was converted, false if a single code-point needs to be converted instead.
+     */
     template<typename SrcIt, typename SrcEndIt, typename DstIt>
-    void _convert_ascii(SrcIt& src, SrcEndIt src_last, DstIt& dst) const noexcept
+    hi_force_inline bool _convert_chunk(SrcIt& src, SrcEndIt src_last, DstIt& dst) const noexcept
     {
-        if (not std::is_constant_evaluated()) {
 #if defined(HI_HAS_SSE2)
-            if constexpr (_has_read_ascii_chunk16 and _has_write_ascii_chunk16) {
-                while (std::distance(src, src_last) >= 16) {
-                    hilet chunk = from_encoder_type{}.read_ascii_chunk16(src);
-                    hilet ascii_mask = _mm_movemask_epi8(chunk);
-                    if (ascii_mask) {
-                        // This chunk contains non-ASCII characters.
-                        break;
-                    }
-                    // The complete chunk only contains ASCII characters.
-                    to_encoder_type{}.write_ascii_chunk16(chunk, dst);
-                    src += 16;
-                    dst += 16;
-                }
+        if (std::distance(src, src_last) >= 16) {
+            hilet chunk = from_encoder_type{}.read_ascii_chunk16(src);
+            if (_mm_movemask_epi8(chunk) == 0) {
+                // The complete chunk only contains ASCII characters.
+                to_encoder_type{}.write_ascii_chunk16(chunk, dst);
+                src += 16;
+                dst += 16;
+                return true;
             }
+        }
 #endif
+#if defined(HI_HAS_SSE4_1)
+        if constexpr (_has_bmp_chunk8) {
+            __m128i lo;
+            __m128i hi;
+            if (hilet count = from_encoder_type{}.read_bmp_chunk8(src, src_last, lo, hi)) {
+                to_encoder_type{}.write_bmp_chunk8(lo, hi, count, dst);
+                return true;
+            }
         }
+#endif
+        return false;
     }
 
-    template<typename It, typename EndIt>
-    [[nodiscard]] constexpr std::pair<size_t, bool> _size(It it, EndIt last) const noexcept
+    /** Convert the text in a single pass.
+     *
+     * The output is allocated with about the same number of code-units as the input and
+     * is grown when needed, then it is truncated to the number of code-units written.
+     */
+    template<typename OutRange, typename SrcIt, typename SrcEndIt>
+    [[nodiscard]] constexpr OutRange _convert(SrcIt src, SrcEndIt src_last) const noexcept
     {
-        auto count = 0_uz;
-        auto valid = true;
-        while (true) {
-            // This loop toggles between converting chunks of ASCII characters and converting
-            // a single non-ASCII character.
-            _size_ascii(it, last, count);
-
-            if (it == last) {
-                break;
-            }
-
-            hilet[code_point, read_valid] = from_encoder_type{}.read(it, last);
-            valid &= read_valid;
+        using std::begin;
 
-            hilet[write_count, write_valid] = to_encoder_type{}.size(code_point);
-            count += write_count;
-            valid &= write_valid;
+        auto r = OutRange{};
+        if (src == src_last) {
+            return r;
         }
 
-        return {count, valid};
-    }
+        r.resize(narrow_cast<size_t>(std::distance(src, src_last)) + _max_step_size);
+        auto size = 0_uz;
+        while (src != src_last) {
+            if (r.size() - size < _max_step_size) {
+                r.resize(r.size() * 2);
+            }
 
-    template<typename SrcIt, typename SrcEndIt, typename DstIt>
-    void _convert(SrcIt src, SrcEndIt src_last, DstIt dst) const noexcept
-    {
-        while (true) {
-            // This loop toggles between converting chunks of ASCII characters and converting
-            // a single non-ASCII character.
-            _convert_ascii(src, src_last, dst);
+            auto dst = begin(r) + size;
+            hilet dst_last = begin(r) + (r.size() - _max_step_size);
 
-            if (src == src_last) {
-                break;
+            // This loop toggles between converting chunks of code-points and converting
+            // a single code-point that could not be converted as part of a chunk.
+            if (not std::is_constant_evaluated()) {
+                while (dst <= dst_last and _convert_chunk(src, src_last, dst)) {}
             }
 
-            hilet[code_point, from_valid] = from_encoder_type{}.read(src, src_last);
-            to_encoder_type{}.write(code_point, dst);
+            if (src != src_last and dst <= dst_last) {
+                hilet[code_point, from_valid] = from_encoder_type{}.read(src, src_last);
+                to_encoder_type{}.write(code_point, dst);
+            }
+            size = narrow_cast<size_t>(std::distance(begin(r), dst));
         }
+
+        r.resize(size);
+        return r;
     }
 };
 
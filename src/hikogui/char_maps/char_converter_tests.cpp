@@ -3,7 +3,9 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "utf_8.hpp"
+#include "utf_16.hpp"
 #include "utf_32.hpp"
+#include "random_char.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
 #include <format>
@@ -21,3 +23,122 @@ TEST(char_converter, utf8_to_utf32_large_char_at_end)
 
     ASSERT_EQ(result, expected);
 }
+
+/** Convert one code-point at a time, without chunks.
+ */
+template<fixed_string From, fixed_string To, typename OutRange, typename InRange>
+static OutRange char_converter_tests_reference(InRange const& src)
+{
+    auto r = OutRange{};
+    r.resize(src.size() * 4);
+
+    auto it = src.begin();
+    auto dst = r.begin();
+    while (it != src.end()) {
+        hilet[code_point, valid] = char_map<From>{}.read(it, src.end());
+        char_map<To>{}.write(code_point, dst);
+    }
+    r.resize(std::distance(r.begin(), dst));
+    return r;
+}
+
+TEST(char_converter, long_text)
+{
+    // Long enough to be converted in chunks; mixed with ASCII, 2 and 3 byte code-points.
+    auto expected = std::u32string{};
+    for (auto i = 0; i != 20; ++i) {
+        expected += U"The quick brown fox. ";
+        expected += U"\u0421\u044a\u0435\u0448\u044c \u0436\u0435 \u0435\u0449\u0451 \u044d\u0442\u0438\u0445. ";
+        expected += U"\u65e5\u672c\u8a9e\u306e\u6587\u7ae0\u3067\u3059\u3002";
+        expected += U"\u00e9\u00e8\u00ea\u00eb\U0001f600";
+    }
+
+    hilet utf8 = char_converter<"utf-32", "utf-8">{}.convert<std::string>(expected);
+    ASSERT_EQ(utf8, (char_converter_tests_reference<"utf-32", "utf-8", std::string>(expected)));
+    ASSERT_EQ((char_converter<"utf-8", "utf-32">{}.convert<std::u32string>(utf8)), expected);
+
+    hilet utf16 = char_converter<"utf-8", "utf-16">{}.convert<std::u16string>(utf8);
+    ASSERT_EQ(utf16, (char_converter_tests_reference<"utf-32", "utf-16", std::u16string>(expected)));
+    ASSERT_EQ((char_converter<"utf-16", "utf-8">{}.convert<std::string>(utf16)), utf8);
+    ASSERT_EQ((char_converter<"utf-16", "utf-32">{}.convert<std::u32string>(utf16)), expected);
+    ASSERT_EQ((char_converter<"utf-32", "utf-16">{}.convert<std::u16string>(expected)), utf16);
+}
+
+TEST(char_converter, random_round_trip)
+{
+    for (auto i = 0; i != 100; ++i) {
+        auto utf32 = std::u32string{};
+        for (auto j = 0; j != i * 3; ++j) {
+            utf32 += random_char();
+        }
+
+        hilet utf8 = char_converter<"utf-32", "utf-8">{}.convert<std::string>(utf32);
+        ASSERT_EQ(utf8, (char_converter_tests_reference<"utf-32", "utf-8", std::string>(utf32)));
+        ASSERT_EQ((char_converter<"utf-8", "utf-32">{}.convert<std::u32string>(utf8)), utf32);
+        ASSERT_TRUE(char_map<"utf-8">{}.validate(utf8.begin(), utf8.end()));
+
+        hilet utf16 = char_converter<"utf-8", "utf-16">{}.convert<std::u16string>(utf8);
+        ASSERT_EQ(utf16, (char_converter_tests_reference<"utf-32", "utf-16", std::u16string>(utf32)));
+        ASSERT_EQ((char_converter<"utf-16", "utf-8">{}.convert<std::string>(utf16)), utf8);
+    }
+}
+
+TEST(char_converter, invalid_utf8)
+{
+    auto valid = std::u32string{};
+    for (auto i = 0; i != 10; ++i) {
+        valid += U"abc\u0436\u0435\u65e5\u672c\u8a9e\u00e9";
+    }
+    hilet text = char_converter<"utf-32", "utf-8">{}.convert<std::string>(valid);
+
+    // Invalid sequences must be replaced exactly as the code-point at a time conversion does.
+    for (auto i = 0_uz; i != text.size(); ++i) {
+        for (hilet c : {'\x80', '\xbf', '\xc0', '\xe0', '\xed', '\xf4', '\xf5', '\xff'}) {
+            auto test = text;
+            test[i] = c;
+
+            ASSERT_EQ(
+                (char_converter<"utf-8", "utf-32">{}.convert<std::u32string>(test)),
+                (char_converter_tests_reference<"utf-8", "utf-32", std::u32string>(test)));
+            ASSERT_EQ(
+                (char_converter<"utf-8", "utf-8">{}.convert<std::string>(test)),
+                (char_converter_tests_reference<"utf-8", "utf-8", std::string>(test)));
+        }
+
+        // Truncated text.
+        hilet truncated = text.substr(0, i);
+        ASSERT_EQ(
+            (char_converter<"utf-8", "utf-32">{}.convert<std::u32string>(truncated)),
+            (char_converter_tests_reference<"utf-8", "utf-32", std::u32string>(truncated)));
+    }
+}
+
+TEST(char_converter, utf8_validate)
+{
+    hilet validate = [](std::string const& str) {
+        return char_map<"utf-8">{}.validate(str.begin(), str.end());
+    };
+
+    auto padding = std::string(40, 'a');
+    ASSERT_TRUE(validate(""));
+    ASSERT_TRUE(validate(padding));
+    ASSERT_TRUE(validate(padding + "\xd7\xa9\xe6\x97\xa5\xf0\x9f\x98\x80"));
+
+    for (auto i = 0_uz; i != padding.size(); ++i) {
+        hilet prefix = padding.substr(0, i);
+        // Continuation without a lead byte.
+        ASSERT_FALSE(validate(prefix + "\x80" + padding));
+        // Overlong encoding.
+        ASSERT_FALSE(validate(prefix + "\xc0\x80" + padding));
+        ASSERT_FALSE(validate(prefix + "\xe0\x80\x80" + padding));
+        // Surrogate.
+        ASSERT_FALSE(validate(prefix + "\xed\xa0\x80" + padding));
+        // Beyond U+10FFFF.
+        ASSERT_FALSE(validate(prefix + "\xf4\x90\x80\x80" + padding));
+        // Too short.
+        ASSERT_FALSE(validate(prefix + "\xe6\x97" + padding));
+        // Incomplete at the end of the text.
+        ASSERT_FALSE(validate(prefix + "\xe6\x97"));
+        ASSERT_TRUE(validate(prefix + "\xe6\x97\xa5"));
+    }
+}
@@ -155,6 +155,35 @@ struct char_map<"utf-16"> {
         _mm_storeu_si128(reinterpret_cast<__m128i *>(std::addressof(*dst)), hi);
     }
 #endif
+
+#if defined(HI_HAS_SSE4_1)
+    template<typename It, typename EndIt>
+    hi_force_inline std::size_t read_bmp_chunk8(It& it, EndIt last, __m128i& lo, __m128i& hi) const noexcept
+    {
+        if (std::distance(it, last) < 8) {
+            return 0;
+        }
+
+        hilet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(std::addressof(*it)));
+        hilet surrogates = _mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16(static_cast<short>(0xf800))), _mm_set1_epi16(static_cast<short>(0xd800)));
+        if (not _mm_testz_si128(surrogates, surrogates)) {
+            // Let the scalar read() handle surrogate pairs.
+            return 0;
+        }
+
+        lo = _mm_cvtepu16_epi32(chunk);
+        hi = _mm_cvtepu16_epi32(_mm_srli_si128(chunk, 8));
+        it += 8;
+        return 8;
+    }
+
+    template<typename It>
+    hi_force_inline void write_bmp_chunk8(__m128i lo, __m128i hi, std::size_t count, It& dst) const noexcept
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(std::addressof(*dst)), _mm_packus_epi32(lo, hi));
+        dst += count;
+    }
+#endif
 };
 
 }} // namespace hi::v1
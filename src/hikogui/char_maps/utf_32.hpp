@@ -152,6 +152,46 @@ struct char_map<"utf-32"> {
         _mm_storeu_si128(reinterpret_cast<__m128i *>(std::addressof(*dst)), c3);
     }
 #endif
+
+#if defined(HI_HAS_SSE4_1)
+    template<typename It, typename EndIt>
+    hi_force_inline std::size_t read_bmp_chunk8(It& it, EndIt last, __m128i& lo, __m128i& hi) const noexcept
+    {
+        if (std::distance(it, last) < 8) {
+            return 0;
+        }
+
+        hilet chunk_lo = _mm_loadu_si128(reinterpret_cast<__m128i const *>(std::addressof(*it)));
+        hilet chunk_hi = _mm_loadu_si128(reinterpret_cast<__m128i const *>(std::addressof(*it) + 4));
+
+        // Code-points outside the BMP and surrogates are handled by the scalar read().
+        hilet max_value = _mm_set1_epi32(0xffff);
+        hilet surrogate_mask = _mm_set1_epi32(static_cast<int>(0xffff'f800));
+        hilet surrogate = _mm_set1_epi32(0xd800);
+        hilet outside = _mm_or_si128(
+            _mm_cmpeq_epi32(_mm_and_si128(chunk_lo, surrogate_mask), surrogate),
+            _mm_cmpeq_epi32(_mm_and_si128(chunk_hi, surrogate_mask), surrogate));
+        hilet inside =
+            _mm_and_si128(_mm_cmpeq_epi32(_mm_max_epu32(chunk_lo, max_value), max_value), _mm_cmpeq_epi32(_mm_max_epu32(chunk_hi, max_value), max_value));
+        if (_mm_movemask_epi8(_mm_andnot_si128(outside, inside)) != 0xffff) {
+            return 0;
+        }
+
+        lo = chunk_lo;
+        hi = chunk_hi;
+        it += 8;
+        return 8;
+    }
+
+    template<typename It>
+    hi_force_inline void write_bmp_chunk8(__m128i lo, __m128i hi, std::size_t count, It& dst) const noexcept
+    {
+        auto *ptr = std::addressof(*dst);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr + 4), hi);
+        dst += count;
+    }
+#endif
 };
 
 }} // namespace hi::v1
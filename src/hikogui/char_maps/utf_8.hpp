@@ -10,7 +10,10 @@
 
 #include "char_converter.hpp"
 #include "cp_1252.hpp"
+#include <algorithm>
+#include <array>
 #include <bit>
+#include <cstring>
 
 hi_warning_push();
 // C26490: Don't use reinterpret_cast.
@@ -19,6 +22,377 @@ hi_warning_ignore_msvc(26490);
 
 namespace hi { inline namespace v1 {
 
+#if defined(HI_HAS_SSE4_1)
+namespace detail {
+
+// The error classes of the UTF-8 validation algorithm by John Keiser and Daniel Lemire,
+// "Validating UTF-8 In Less Than One Instruction Per Byte".
+constexpr uint8_t utf8_too_short = 1 << 0;
+constexpr uint8_t utf8_too_long = 1 << 1;
+constexpr uint8_t utf8_overlong_3 = 1 << 2;
+constexpr uint8_t utf8_too_large = 1 << 3;
+constexpr uint8_t utf8_surrogate = 1 << 4;
+constexpr uint8_t utf8_overlong_2 = 1 << 5;
+constexpr uint8_t utf8_too_large_1000 = 1 << 6;
+constexpr uint8_t utf8_overlong_4 = 1 << 6;
+constexpr uint8_t utf8_two_conts = 1 << 7;
+constexpr uint8_t utf8_carry = utf8_too_short | utf8_too_long | utf8_two_conts;
+
+/** Errors indexed by the high nibble of the previous byte.
+ */
+alignas(16) constexpr auto utf8_byte_1_high = std::array<uint8_t, 16>{
+    // 0_______ ASCII.
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    // 10______ Continuation.
+    utf8_two_conts,
+    utf8_two_conts,
+    utf8_two_conts,
+    utf8_two_conts,
+    // 1100____ Two byte lead.
+    utf8_too_short | utf8_overlong_2,
+    // 1101____ Two byte lead.
+    utf8_too_short,
+    // 1110____ Three byte lead.
+    utf8_too_short | utf8_overlong_3 | utf8_surrogate,
+    // 1111____ Four byte lead.
+    utf8_too_short | utf8_too_large | utf8_too_large_1000 | utf8_overlong_4};
+
+/** Errors indexed by the low nibble of the previous byte.
+ */
+alignas(16) constexpr auto utf8_byte_1_low = std::array<uint8_t, 16>{
+    // ____0000
+    utf8_carry | utf8_overlong_3 | utf8_overlong_2 | utf8_overlong_4,
+    // ____0001
+    utf8_carry | utf8_overlong_2,
+    // ____001_
+    utf8_carry,
+    utf8_carry,
+    // ____0100
+    utf8_carry | utf8_too_large,
+    // ____0101 - ____1100
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    // ____1101
+    utf8_carry | utf8_too_large | utf8_too_large_1000 | utf8_surrogate,
+    // ____111_
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000};
+
+/** Errors indexed by the high nibble of the current byte.
+ */
+alignas(16) constexpr auto utf8_byte_2_high = std::array<uint8_t, 16>{
+    // 0_______ ASCII.
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    // 1000____
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large_1000 | utf8_overlong_4,
+    // 1001____
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large,
+    // 101_____
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+    // 11______ Lead.
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short};
+
+/** How to decode the first code-points of a 16 byte chunk of UTF-8.
+ *
+ * Indexed by a 12 bit mask, where a bit is set when the byte is the last byte of a code-point.
+ *  - bit [3:0] The number of bytes of the decoded code-points.
+ *  - bit [5:4] 0: Can not decode, 1: six code-points of at most 2 bytes, 2: four code-points of at most 3 bytes.
+ *  - bit [15:8] The index into `utf8_decode_shuffle_2` or `utf8_decode_shuffle_3`.
+ */
+constexpr auto utf8_decode_index = [] {
+    auto r = std::array<uint16_t, 4096>{};
+    for (auto mask = 0_uz; mask != r.size(); ++mask) {
+        auto lengths = std::array<std::size_t, 12>{};
+        auto num_code_points = 0_uz;
+        auto start = 0_uz;
+        for (auto i = 0_uz; i != 12; ++i) {
+            if ((mask >> i) & 1) {
+                lengths[num_code_points++] = i + 1 - start;
+                start = i + 1;
+            }
+        }
+
+        auto size = 0_uz;
+        auto config = 0_uz;
+        if (num_code_points >= 6 and std::all_of(lengths.begin(), lengths.begin() + 6, [](auto x) {
+                return x <= 2;
+            })) {
+            for (auto i = 0_uz; i != 6; ++i) {
+                size += lengths[i];
+                config |= (lengths[i] - 1) << i;
+            }
+            r[mask] = narrow_cast<uint16_t>(size | 0x10 | (config << 8));
+
+        } else if (
+            num_code_points >= 4 and std::all_of(lengths.begin(), lengths.begin() + 4, [](auto x) {
+                return x <= 3;
+            })) {
+            for (auto i = 0_uz, multiplier = 1_uz; i != 4; ++i, multiplier *= 3) {
+                size += lengths[i];
+                config += (lengths[i] - 1) * multiplier;
+            }
+            r[mask] = narrow_cast<uint16_t>(size | 0x20 | (config << 8));
+        }
+    }
+    return r;
+}();
+
+/** Shuffle six code-points of at most 2 bytes into 16 bit lanes.
+ *
+ * The last byte of the code-point is shuffled into the low byte of the lane,
+ * the lead byte of a 2 byte code-point into the high byte.
+ */
+alignas(16) constexpr auto utf8_decode_shuffle_2 = [] {
+    auto r = std::array<std::array<int8_t, 16>, 64>{};
+    for (auto config = 0_uz; config != r.size(); ++config) {
+        r[config].fill(-128);
+        auto start = 0_uz;
+        for (auto i = 0_uz; i != 6; ++i) {
+            if ((config >> i) & 1) {
+                r[config][i * 2] = narrow_cast<int8_t>(start + 1);
+                r[config][i * 2 + 1] = narrow_cast<int8_t>(start);
+                start += 2;
+            } else {
+                r[config][i * 2] = narrow_cast<int8_t>(start);
+                start += 1;
+            }
+        }
+    }
+    return r;
+}();
+
+/** Shuffle four code-points of at most 3 bytes into 32 bit lanes.
+ *
+ * The bytes of the code-point are shuffled in reverse order; the last byte of the
+ * code-point in the low byte of the lane.
+ */
+alignas(16) constexpr auto utf8_decode_shuffle_3 = [] {
+    auto r = std::array<std::array<int8_t, 16>, 81>{};
+    for (auto config = 0_uz; config != r.size(); ++config) {
+        r[config].fill(-128);
+        auto start = 0_uz;
+        for (auto i = 0_uz, c = config; i != 4; ++i, c /= 3) {
+            hilet length = c % 3 + 1;
+            for (auto j = 0_uz; j != length; ++j) {
+                r[config][i * 4 + j] = narrow_cast<int8_t>(start + length - j - 1);
+            }
+            start += length;
+        }
+    }
+    return r;
+}();
+
+/** Compact eight code-points of 1 or 2 bytes.
+ *
+ * Indexed by an 8 bit mask, where a bit is set when the code-point is a single byte.
+ */
+alignas(16) constexpr auto utf8_encode_shuffle_2 = [] {
+    auto r = std::array<std::array<int8_t, 16>, 256>{};
+    for (auto mask = 0_uz; mask != r.size(); ++mask) {
+        r[mask].fill(-128);
+        auto j = 0_uz;
+        for (auto i = 0_uz; i != 8; ++i) {
+            r[mask][j++] = narrow_cast<int8_t>(i * 2);
+            if (((mask >> i) & 1) == 0) {
+                r[mask][j++] = narrow_cast<int8_t>(i * 2 + 1);
+            }
+        }
+    }
+    return r;
+}();
+
+/** Compact four code-points of 1, 2 or 3 bytes.
+ *
+ * Indexed by two 4 bit masks, bits [3:0] are set when the code-point is a single byte;
+ * bits [7:4] are set when the code-point is at most 2 bytes.
+ */
+alignas(16) constexpr auto utf8_encode_shuffle_3 = [] {
+    auto r = std::array<std::array<int8_t, 16>, 256>{};
+    for (auto mask = 0_uz; mask != r.size(); ++mask) {
+        r[mask].fill(-128);
+        auto j = 0_uz;
+        for (auto i = 0_uz; i != 4; ++i) {
+            hilet length = 3 - ((mask >> i) & 1) - ((mask >> (i + 4)) & 1);
+            for (auto k = 0_uz; k != length; ++k) {
+                r[mask][j++] = narrow_cast<int8_t>(i * 4 + k);
+            }
+        }
+    }
+    return r;
+}();
+
+[[nodiscard]] hi_force_inline __m128i utf8_lookup16(std::array<uint8_t, 16> const& table, __m128i index) noexcept
+{
+    return _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<__m128i const *>(table.data())), index);
+}
+
+/** Find UTF-8 encoding errors in a chunk of 16 bytes.
+ *
+ * A code-point that is incomplete at the end of the chunk is not an error,
+ * it is detected when checking the next chunk.
+ *
+ * @param input The chunk to check.
+ * @param prev_input The previous chunk, or zero at the start of the text.
+ * @return Non-zero if there is an error.
+ */
+[[nodiscard]] hi_force_inline __m128i utf8_check16(__m128i input, __m128i prev_input) noexcept
+{
+    hilet low_nibble = _mm_set1_epi8(0x0f);
+    hilet prev1 = _mm_alignr_epi8(input, prev_input, 15);
+    hilet prev2 = _mm_alignr_epi8(input, prev_input, 14);
+    hilet prev3 = _mm_alignr_epi8(input, prev_input, 13);
+
+    hilet byte_1_high = utf8_lookup16(utf8_byte_1_high, _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble));
+    hilet byte_1_low = utf8_lookup16(utf8_byte_1_low, _mm_and_si128(prev1, low_nibble));
+    hilet byte_2_high = utf8_lookup16(utf8_byte_2_high, _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble));
+    hilet special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+    // The second and third continuation byte of 3 and 4 byte sequences are not checked
+    // by the special cases.
+    hilet is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80));
+    hilet is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80));
+    hilet must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(-128));
+    return _mm_xor_si128(must_be_continuation, special_cases);
+}
+
+/** Check if the last code-point in a chunk of 16 bytes is incomplete.
+ */
+[[nodiscard]] hi_force_inline __m128i utf8_incomplete16(__m128i input) noexcept
+{
+    hilet max_value = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1);
+    return _mm_subs_epu8(input, max_value);
+}
+
+#if defined(HI_HAS_AVX2)
+[[nodiscard]] hi_force_inline __m256i utf8_lookup32(std::array<uint8_t, 16> const& table, __m256i index) noexcept
+{
+    return _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<__m128i const *>(table.data()))), index);
+}
+
+/** Find UTF-8 encoding errors in a chunk of 32 bytes.
+ *
+ * @see utf8_check16()
+ */
+[[nodiscard]] hi_force_inline __m256i utf8_check32(__m256i input, __m256i prev_input) noexcept
+{
+    hilet low_nibble = _mm256_set1_epi8(0x0f);
+    // The previous bytes cross the 128 bit lanes.
+    hilet shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    hilet prev1 = _mm256_alignr_epi8(input, shifted, 15);
+    hilet prev2 = _mm256_alignr_epi8(input, shifted, 14);
+    hilet prev3 = _mm256_alignr_epi8(input, shifted, 13);
+
+    hilet byte_1_high = utf8_lookup32(utf8_byte_1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble));
+    hilet byte_1_low = utf8_lookup32(utf8_byte_1_low, _mm256_and_si256(prev1, low_nibble));
+    hilet byte_2_high = utf8_lookup32(utf8_byte_2_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble));
+    hilet special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+    hilet is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xe0 - 0x80));
+    hilet is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xf0 - 0x80));
+    hilet must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(-128));
+    return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+/** Check if the last code-point in a chunk of 32 bytes is incomplete.
+ */
+[[nodiscard]] hi_force_inline __m256i utf8_incomplete32(__m256i input) noexcept
+{
+    hilet max_value = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1);
+    return _mm256_subs_epu8(input, max_value);
+}
+
+/** Validate UTF-8 text 32 bytes at a time.
+ */
+[[nodiscard]] inline bool utf8_validate(char const *ptr, std::size_t size) noexcept
+{
+    auto error = _mm256_setzero_si256();
+    auto prev = _mm256_setzero_si256();
+    auto prev_incomplete = _mm256_setzero_si256();
+
+    hilet check = [&](__m256i chunk) {
+        if (_mm256_movemask_epi8(chunk) == 0) {
+            // ASCII only needs to check that the previous chunk did not end with an incomplete code-point.
+            error = _mm256_or_si256(error, prev_incomplete);
+        } else {
+            error = _mm256_or_si256(error, utf8_check32(chunk, prev));
+            prev_incomplete = utf8_incomplete32(chunk);
+        }
+        prev = chunk;
+    };
+
+    for (; size >= 32; ptr += 32, size -= 32) {
+        check(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr)));
+    }
+
+    // The tail is padded with zeros, which also detects an incomplete code-point at the end of the text.
+    alignas(32) char tail[32] = {};
+    std::memcpy(tail, ptr, size);
+    check(_mm256_load_si256(reinterpret_cast<__m256i const *>(tail)));
+    return _mm256_testz_si256(error, error);
+}
+
+#else
+/** Validate UTF-8 text 16 bytes at a time.
+ */
+[[nodiscard]] inline bool utf8_validate(char const *ptr, std::size_t size) noexcept
+{
+    auto error = _mm_setzero_si128();
+    auto prev = _mm_setzero_si128();
+    auto prev_incomplete = _mm_setzero_si128();
+
+    hilet check = [&](__m128i chunk) {
+        if (_mm_movemask_epi8(chunk) == 0) {
+            // ASCII only needs to check that the previous chunk did not end with an incomplete code-point.
+            error = _mm_or_si128(error, prev_incomplete);
+        } else {
+            error = _mm_or_si128(error, utf8_check16(chunk, prev));
+            prev_incomplete = utf8_incomplete16(chunk);
+        }
+        prev = chunk;
+    };
+
+    for (; size >= 16; ptr += 16, size -= 16) {
+        check(_mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr)));
+    }
+
+    // The tail is padded with zeros, which also detects an incomplete code-point at the end of the text.
+    alignas(16) char tail[16] = {};
+    std::memcpy(tail, ptr, size);
+    check(_mm_load_si128(reinterpret_cast<__m128i const *>(tail)));
+    return _mm_testz_si128(error, error);
+}
+#endif
+
+} // namespace detail
+#endif
+
 /** Unicode UTF-8 encoding.
  * @ingroup char_maps
  */
@@ -108,6 +482,32 @@ struct char_map<"utf-8"> {
         }
     }
 
+    /** Check if the text is valid UTF-8.
+     *
+     * @param it An iterator to the first code-unit of the text.
+     * @param last An iterator one beyond the last code-unit of the text.
+     * @return True if the text is valid UTF-8.
+     */
+    template<typename It, typename EndIt>
+    [[nodiscard]] constexpr bool validate(It it, EndIt last) const noexcept
+    {
+#if defined(HI_HAS_SSE4_1)
+        if (not std::is_constant_evaluated()) {
+            if (it == last) {
+                return true;
+            }
+            return detail::utf8_validate(std::addressof(*it), narrow_cast<std::size_t>(std::distance(it, last)));
+        }
+#endif
+
+        while (it != last) {
+            if (hilet[code_point, valid] = read(it, last); not valid) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     [[nodiscard]] constexpr std::pair<uint8_t, bool> size(char32_t code_point) const noexcept
     {
         hi_axiom(code_point < 0x11'0000);
@@ -148,6 +548,110 @@ struct char_map<"utf-8"> {
         _mm_storeu_si128(reinterpret_cast<__m128i *>(std::addressof(*dst)), chunk);
     }
 #endif
+
+#if defined(HI_HAS_SSE4_1)
+    template<typename It, typename EndIt>
+    hi_force_inline std::size_t read_bmp_chunk8(It& it, EndIt last, __m128i& lo, __m128i& hi) const noexcept
+    {
+        if (std::distance(it, last) < 16) {
+            return 0;
+        }
+
+        hilet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(std::addressof(*it)));
+        if (hilet error = detail::utf8_check16(chunk, _mm_setzero_si128()); not _mm_testz_si128(error, error)) {
+            // Let the scalar read() handle invalid UTF-8.
+            return 0;
+        }
+
+        // A byte is the last byte of a code-point when the next byte is not a continuation byte.
+        hilet continuation_mask = _mm_movemask_epi8(_mm_cmplt_epi8(chunk, _mm_set1_epi8(-64)));
+        hilet end_mask = (~continuation_mask >> 1) & 0xfff;
+
+        hilet index = detail::utf8_decode_index[end_mask];
+        if ((index & 0x30) == 0x10) {
+            // Six code-points of 1 or 2 bytes.
+            hilet& shuffle = detail::utf8_decode_shuffle_2[index >> 8];
+            hilet perm = _mm_shuffle_epi8(chunk, _mm_load_si128(reinterpret_cast<__m128i const *>(shuffle.data())));
+            hilet ascii = _mm_and_si128(perm, _mm_set1_epi16(0x7f));
+            hilet high = _mm_srli_epi16(_mm_and_si128(perm, _mm_set1_epi16(0x1f00)), 2);
+            hilet code_points = _mm_or_si128(ascii, high);
+
+            lo = _mm_cvtepu16_epi32(code_points);
+            hi = _mm_cvtepu16_epi32(_mm_srli_si128(code_points, 8));
+            it += index & 0xf;
+            return 6;
+
+        } else if ((index & 0x30) == 0x20) {
+            // Four code-points of 1, 2 or 3 bytes.
+            hilet& shuffle = detail::utf8_decode_shuffle_3[index >> 8];
+            hilet perm = _mm_shuffle_epi8(chunk, _mm_load_si128(reinterpret_cast<__m128i const *>(shuffle.data())));
+            hilet ascii = _mm_and_si128(perm, _mm_set1_epi32(0x7f));
+            hilet middle = _mm_srli_epi32(_mm_and_si128(perm, _mm_set1_epi32(0x3f00)), 2);
+            hilet high = _mm_srli_epi32(_mm_and_si128(perm, _mm_set1_epi32(0x0f'0000)), 4);
+
+            lo = _mm_or_si128(_mm_or_si128(ascii, middle), high);
+            hi = _mm_setzero_si128();
+            it += index & 0xf;
+            return 4;
+
+        } else {
+            // 4 byte code-points are handled by the scalar read().
+            return 0;
+        }
+    }
+
+    template<typename It>
+    hi_force_inline void write_bmp_chunk8(__m128i lo, __m128i hi, std::size_t count, It& dst) const noexcept
+    {
+        auto *ptr = reinterpret_cast<char *>(std::addressof(*dst));
+
+        auto size = 0_uz;
+        hilet code_points = _mm_packus_epi32(lo, hi);
+        if (_mm_testz_si128(code_points, _mm_set1_epi16(static_cast<short>(0xf800)))) {
+            // All code-points are encoded in 1 or 2 bytes, in 16 bit lanes.
+            hilet one_byte = _mm_cmplt_epi16(code_points, _mm_set1_epi16(0x80));
+            hilet lead = _mm_or_si128(_mm_srli_epi16(code_points, 6), _mm_set1_epi16(0xc0));
+            hilet continuation =
+                _mm_slli_epi16(_mm_or_si128(_mm_and_si128(code_points, _mm_set1_epi16(0x3f)), _mm_set1_epi16(0x80)), 8);
+            hilet encoded = _mm_blendv_epi8(_mm_or_si128(lead, continuation), code_points, one_byte);
+
+            hilet one_byte_mask = _mm_movemask_epi8(_mm_packs_epi16(one_byte, _mm_setzero_si128()));
+            hilet& shuffle = detail::utf8_encode_shuffle_2[one_byte_mask];
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i *>(ptr),
+                _mm_shuffle_epi8(encoded, _mm_load_si128(reinterpret_cast<__m128i const *>(shuffle.data()))));
+            size = 16 - std::popcount(narrow_cast<unsigned int>(one_byte_mask));
+
+        } else {
+            // Encode 4 code-points at a time of 1, 2 or 3 bytes, in 32 bit lanes.
+            for (hilet half : {lo, hi}) {
+                hilet one_byte = _mm_cmplt_epi32(half, _mm_set1_epi32(0x80));
+                hilet two_bytes = _mm_cmplt_epi32(half, _mm_set1_epi32(0x800));
+
+                hilet low_bits = _mm_or_si128(_mm_and_si128(half, _mm_set1_epi32(0x3f)), _mm_set1_epi32(0x80));
+                hilet middle_bits = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(half, 6), _mm_set1_epi32(0x3f)), _mm_set1_epi32(0x80));
+                hilet encoded3 = _mm_or_si128(
+                    _mm_or_si128(_mm_srli_epi32(half, 12), _mm_set1_epi32(0xe0)),
+                    _mm_or_si128(_mm_slli_epi32(middle_bits, 8), _mm_slli_epi32(low_bits, 16)));
+                hilet encoded2 =
+                    _mm_or_si128(_mm_or_si128(_mm_srli_epi32(half, 6), _mm_set1_epi32(0xc0)), _mm_slli_epi32(low_bits, 8));
+                hilet encoded = _mm_blendv_epi8(_mm_blendv_epi8(encoded3, encoded2, two_bytes), half, one_byte);
+
+                hilet one_byte_mask = _mm_movemask_ps(_mm_castsi128_ps(one_byte));
+                hilet two_bytes_mask = _mm_movemask_ps(_mm_castsi128_ps(two_bytes));
+                hilet& shuffle = detail::utf8_encode_shuffle_3[one_byte_mask | (two_bytes_mask << 4)];
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i *>(ptr + size),
+                    _mm_shuffle_epi8(encoded, _mm_load_si128(reinterpret_cast<__m128i const *>(shuffle.data()))));
+                size += 12 - std::popcount(narrow_cast<unsigned int>(one_byte_mask)) -
+                    std::popcount(narrow_cast<unsigned int>(two_bytes_mask));
+            }
+        }
+
+        // The unused lanes are zero, each encoded as a single byte past the end of the text.
+        dst += size - (8 - count);
+    }
+#endif
 };
 
 }} // namespace hi::v1
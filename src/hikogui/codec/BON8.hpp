@@ -389,18 +389,13 @@ public:
     }
 
     /** Add a map of key/values pairs.
-     * @tparam Key A type convertible to a string_view; a valid UTF-8 string.
-     * @tparam Value The type of the Value.
-     * @param items The map of key/value pairs.
+     * @param items The map of key/value pairs, the keys must be valid UTF-8 strings.
      */
-    template<typename Key, typename Value>
-    void add(std::map<Key, Value> const& items)
+    void add(datum::map_type const& items)
     {
-        using key_type = typename std::remove_cvref_t<decltype(items)>::key_type;
-
         open_string = false;
-        if (size(items) <= 4) {
-            output += static_cast<std::byte>(BON8_code_object_count0 + size(items));
+        if (items.size() <= 4) {
+            output += static_cast<std::byte>(BON8_code_object_count0 + items.size());
         } else {
             output += static_cast<std::byte>(BON8_code_object);
         }
@@ -414,7 +409,7 @@ public:
             add(item.second);
         }
 
-        if (size(items) > 4) {
+        if (items.size() > 4) {
             output += static_cast<std::byte>(BON8_code_eoc);
             open_string = false;
         }
@@ -8,18 +8,25 @@
 #include "../tokenizer.hpp"
 #include "../utility/module.hpp"
 #include "../datum.hpp"
+#include "../jsonpath.hpp"
 #include "../strings.hpp"
 #include "../indent.hpp"
 #include <string>
 #include <string_view>
 #include <vector>
 #include <optional>
+#include <variant>
+#include <memory>
 
 namespace hi::inline v1 {
 
 /** Parse a JSON string.
+ *
+ * Beyond strict JSON, line and block comments and trailing commas are accepted.
+ *
  * @param text The text to parse.
  * @return A datum representing the parsed object.
+ * @throw parse_error When the text is not valid JSON.
  */
 [[nodiscard]] datum parse_JSON(std::string_view text);
 
@@ -42,6 +49,233 @@ namespace hi::inline v1 {
     return parse_JSON(as_string_view(file_view(path)));
 }
 
+/** An event returned by `JSON_reader::next()`.
+ */
+enum class JSON_event : uint8_t {
+    /** The text ended in the middle of the document, call `JSON_reader::feed()` and try again.
+     */
+    need_more,
+
+    /** The complete document was read.
+     */
+    end_of_document,
+
+    start_object,
+    end_object,
+    start_array,
+    end_array,
+
+    /** The key of a member of an object, available through `JSON_reader::string()`.
+     */
+    key,
+
+    string,
+    integer,
+    floating_point,
+    boolean,
+    null
+};
+
+namespace detail {
+class JSON_reader_impl;
+}
+
+/** A pull based JSON reader.
+ *
+ * The reader returns one event at a time without building a `datum` for the whole
+ * document, so that large documents can be processed with little memory. The text
+ * may be passed at once, for example from a `file_view`, or fed incrementally in
+ * chunks of any size; when a chunk ends in the middle of a token `next()` returns
+ * `JSON_event::need_more`.
+ *
+ * Like `parse_JSON()` the reader accepts line and block comments and trailing commas.
+ *
+ * ```
+ * auto reader = JSON_reader{};
+ * while (true) {
+ *     switch (reader.next()) {
+ *     case JSON_event::need_more:
+ *         if (auto chunk = read_chunk(); not chunk.empty()) {
+ *             reader.feed(chunk);
+ *         } else {
+ *             reader.finish();
+ *         }
+ *         break;
+ *     case JSON_event::end_of_document: return;
+ *     case JSON_event::integer: handle(reader.location(), reader.integer()); break;
+ *     default:;
+ *     }
+ * }
+ * ```
+ */
+class JSON_reader {
+public:
+    /** A segment of the location of a value: the index in an array, or the key in an object.
+     */
+    using segment_type = std::variant<std::size_t, std::string>;
+    using location_type = std::vector<segment_type>;
+
+    ~JSON_reader();
+    JSON_reader(JSON_reader&&) noexcept;
+    JSON_reader& operator=(JSON_reader&&) noexcept;
+
+    /** Create a reader which is fed the text incrementally.
+     */
+    JSON_reader();
+
+    /** Create a reader for a complete text.
+     *
+     * @param text The text of the document, it must outlive the reader.
+     */
+    explicit JSON_reader(std::string_view text);
+
+    /** Append a chunk of text.
+     *
+     * Text that was already consumed is discarded, which invalidates the string
+     * returned by `string()`.
+     *
+     * @param chunk The next part of the document, it is copied.
+     */
+    void feed(std::string_view chunk);
+
+    /** Mark the end of the document.
+     *
+     * After this call a document which is incomplete results in a `parse_error`.
+     */
+    void finish() noexcept;
+
+    /** Read the next event.
+     *
+     * @return The next event.
+     * @throw parse_error When the text is not valid JSON.
+     */
+    [[nodiscard]] JSON_event next();
+
+    /** The text of a `key` or `string` event.
+     *
+     * The string is valid until the next call to `next()` or `feed()`.
+     */
+    [[nodiscard]] std::string_view string() const noexcept;
+
+    /** The value of an `integer` event.
+     */
+    [[nodiscard]] long long integer() const noexcept;
+
+    /** The value of a `floating_point` event.
+     */
+    [[nodiscard]] double floating_point() const noexcept;
+
+    /** The value of a `boolean` event.
+     */
+    [[nodiscard]] bool boolean() const noexcept;
+
+    /** The value of a `string`, `integer`, `floating_point`, `boolean` or `null` event.
+     *
+     * @throws std::bad_alloc When the string could not be copied into the datum.
+     */
+    [[nodiscard]] datum value() const;
+
+    /** The number of arrays and objects that enclose the current event.
+     *
+     * The start and end events of an array or object have the depth of the container itself.
+     */
+    [[nodiscard]] std::size_t depth() const noexcept;
+
+    /** The location of the current event.
+     *
+     * For values, start and end events this is the location of the value.
+     * For a `key` event this is the location of the value that follows.
+     */
+    [[nodiscard]] location_type const& location() const noexcept;
+
+private:
+    std::unique_ptr<detail::JSON_reader_impl> _pimpl;
+};
+
+/** Read the values selected by a json-path from a streaming JSON document.
+ *
+ * Only the values that match the path are materialized as a `datum`, the rest of the
+ * document is only scanned. Values are returned in document order as soon as they
+ * are complete.
+ *
+ * Since the size of an array is not known while streaming, negative indices and
+ * slices with negative bounds or step never match. A value nested inside a value
+ * that was already selected is not returned separately.
+ */
+class JSON_path_reader {
+public:
+    /** Create a reader which is fed the text incrementally.
+     *
+     * @param path The path selecting the values to return.
+     */
+    explicit JSON_path_reader(jsonpath path);
+
+    /** Create a reader for a complete text.
+     *
+     * @param text The text of the document, it must outlive the reader.
+     * @param path The path selecting the values to return.
+     */
+    JSON_path_reader(std::string_view text, jsonpath path);
+
+    /** Append a chunk of text.
+     */
+    void feed(std::string_view chunk)
+    {
+        _reader.feed(chunk);
+    }
+
+    /** Mark the end of the document.
+     */
+    void finish() noexcept
+    {
+        _reader.finish();
+    }
+
+    /** Check if the complete document was read.
+     */
+    [[nodiscard]] bool done() const noexcept
+    {
+        return _done;
+    }
+
+    /** Read the next selected value.
+     *
+     * @return The next selected value, or empty when more text is needed or when
+     *         the document was completely read; see `done()`.
+     * @throw parse_error When the text is not valid JSON.
+     */
+    [[nodiscard]] std::optional<datum> next();
+
+private:
+    JSON_reader _reader;
+    jsonpath _path;
+
+    /** The arrays and objects of the selected value that are being built.
+     */
+    std::vector<datum> _stack;
+
+    bool _done = false;
+
+    [[nodiscard]] bool matches() const noexcept;
+
+    /** Add a completed value to the selected value.
+     *
+     * @return The selected value when it is complete.
+     * @throws std::bad_alloc When the value could not be added to its parent.
+     */
+    [[nodiscard]] std::optional<datum> add(datum value);
+};
+
+/** Parse the values selected by a json-path from a JSON string.
+ *
+ * @param text The text to parse.
+ * @param path The path selecting the values to return.
+ * @return The selected values in document order.
+ * @throw parse_error When the text is not valid JSON.
+ * @see JSON_path_reader
+ */
+[[nodiscard]] std::vector<datum> parse_JSON(std::string_view text, jsonpath const& path);
+
 /** Dump an datum object into a JSON string.
  * @param root datum-object to serialize
  * @return The JSON serialized object as a string
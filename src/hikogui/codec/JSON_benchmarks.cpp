@@ -0,0 +1,228 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "JSON.hpp"
+#include "../tokenizer.hpp"
+#include "../utility/module.hpp"
+#include <benchmark/benchmark.h>
+#include <string>
+#include <string_view>
+#include <format>
+
+using namespace hi;
+
+/** Create a JSON document of about @a size bytes, similar to a large preferences or translation file.
+ */
+[[nodiscard]] static std::string make_document(std::size_t size)
+{
+    auto r = std::string{"{\n    \"items\": [\n"};
+    for (auto i = 0_uz; r.size() < size; ++i) {
+        if (i != 0) {
+            r += ",\n";
+        }
+        r += std::format(
+            "        {{\"id\": {}, \"name\": \"item number {}\", \"value\": {}, \"enabled\": {}, "
+            "\"tags\": [\"alpha\", \"beta\", \"gamma\"], \"description\": \"A \\\"quoted\\\" description\\nof the item.\"}}",
+            i,
+            i,
+            static_cast<double>(i) * 0.25,
+            i % 2 == 0 ? "true" : "false");
+    }
+    r += "\n    ]\n}\n";
+    return r;
+}
+
+static void JSON_parse(benchmark::State& state)
+{
+    hilet text = make_document(state.range(0));
+
+    for (auto _ : state) {
+        auto result = parse_JSON(text);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(JSON_parse)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+namespace {
+
+/** The previous JSON parser, a recursive descent over the tokens of the generic tokenizer.
+ *
+ * It is only kept here as a baseline for the single pass parser.
+ */
+class token_JSON_parser {
+public:
+    [[nodiscard]] static datum parse(std::string_view text)
+    {
+        token_vector tokens = parseTokens(text);
+        hi_assert(tokens.back() == tokenizer_name_t::End);
+
+        auto token = tokens.begin();
+        auto root = datum{};
+        if (auto result = parse_value(token)) {
+            root = std::move(*result);
+            token = result.next_token;
+        } else {
+            throw parse_error(std::format("{}: Missing JSON object", token->location));
+        }
+
+        if (*token != tokenizer_name_t::End) {
+            throw parse_error(std::format("{}: Unexpected text after JSON root object", token->location));
+        }
+        return root;
+    }
+
+private:
+    [[nodiscard]] static parse_result<datum> parse_array(token_iterator token)
+    {
+        auto v = datum::make_vector();
+
+        // Required '['
+        if ((*token == tokenizer_name_t::Operator) && (*token == "[")) {
+            token++;
+        } else {
+            return {};
+        }
+
+        bool commaAfterValue = true;
+        while (true) {
+            // A ']' is required at end of configuration-items.
+            if ((*token == tokenizer_name_t::Operator) && (*token == "]")) {
+                token++;
+                break;
+
+                // Required a value.
+            } else if (auto result = parse_value(token)) {
+                if (!commaAfterValue) {
+                    throw parse_error(std::format("{}: Missing expected ','", token->location));
+                }
+
+                v.push_back(*result);
+                token = result.next_token;
+
+                if ((*token == tokenizer_name_t::Operator) && (*token == ",")) {
+                    token++;
+                    commaAfterValue = true;
+                } else {
+                    commaAfterValue = false;
+                }
+
+            } else {
+                throw parse_error(std::format("{}: Expecting a value as the next item in an array.", token->location));
+            }
+        }
+
+        return {std::move(v), token};
+    }
+
+    [[nodiscard]] static parse_result<datum> parse_object(token_iterator token)
+    {
+        auto object = datum::make_map();
+
+        // Required '{'
+        if ((*token == tokenizer_name_t::Operator) && (*token == "{")) {
+            token++;
+        } else {
+            return {};
+        }
+
+        bool commaAfterValue = true;
+        while (true) {
+            // A '}' is required at end of configuration-items.
+            if ((*token == tokenizer_name_t::Operator) && (*token == "}")) {
+                token++;
+                break;
+
+                // Required a string name.
+            } else if (*token == tokenizer_name_t::StringLiteral) {
+                if (!commaAfterValue) {
+                    throw parse_error(std::format("{}: Missing expected ','", token->location));
+                }
+
+                auto name = static_cast<std::string>(*token++);
+
+                if ((*token == tokenizer_name_t::Operator) && (*token == ":")) {
+                    token++;
+                } else {
+                    throw parse_error(std::format("{}: Missing expected ':'", token->location));
+                }
+
+                if (auto result = parse_value(token)) {
+                    object[name] = *result;
+                    token = result.next_token;
+
+                } else {
+                    throw parse_error(std::format("{}: Missing JSON value", token->location));
+                }
+
+                if ((*token == tokenizer_name_t::Operator) && (*token == ",")) {
+                    token++;
+                    commaAfterValue = true;
+                } else {
+                    commaAfterValue = false;
+                }
+
+            } else {
+                throw parse_error(
+                    std::format("{}: Unexpected token {}, expected a key or close-brace.", token->location, *token));
+            }
+        }
+
+        return {std::move(object), token};
+    }
+
+    [[nodiscard]] static parse_result<datum> parse_value(token_iterator token)
+    {
+        switch (token->name) {
+        case tokenizer_name_t::StringLiteral: {
+            auto value = datum{static_cast<std::string>(*token++)};
+            return {std::move(value), token};
+        } break;
+        case tokenizer_name_t::IntegerLiteral: {
+            auto value = datum{static_cast<long long>(*token++)};
+            return {std::move(value), token};
+        } break;
+        case tokenizer_name_t::FloatLiteral: {
+            auto value = datum{static_cast<double>(*token++)};
+            return {std::move(value), token};
+        } break;
+        case tokenizer_name_t::Name: {
+            hilet name = static_cast<std::string>(*token++);
+            if (name == "true") {
+                return {datum{true}, token};
+            } else if (name == "false") {
+                return {datum{false}, token};
+            } else if (name == "null") {
+                return {datum{nullptr}, token};
+            } else {
+                throw parse_error(std::format("{}: Unexpected name '{}'", token->location, name));
+            }
+        } break;
+        default:
+            if (auto result1 = parse_object(token)) {
+                return result1;
+            } else if (auto result2 = parse_array(token)) {
+                return result2;
+            } else {
+                throw parse_error(std::format("{}: Unexpected token '{}'", token->location, token->name));
+            }
+        }
+    }
+};
+
+} // namespace
+
+/** The previous JSON parser: the generic tokenizer followed by a recursive descent over the tokens.
+ */
+static void JSON_parse_tokens(benchmark::State& state)
+{
+    hilet text = make_document(state.range(0));
+
+    for (auto _ : state) {
+        auto result = token_JSON_parser::parse(text);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(JSON_parse_tokens)->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
@@ -4,177 +4,1017 @@
 
 #include "JSON.hpp"
 #include "../file/file_view.hpp"
+#include "../SIMD/module.hpp"
+#include "../parse_location.hpp"
+#include <charconv>
+#include <algorithm>
+#include <bit>
+#include <variant>
 
 namespace hi::inline v1 {
 
-struct parse_context_t {
-    std::string_view::const_iterator text_begin;
-};
+/** Thrown by the scanner when more text is needed to finish a token.
+ */
+struct JSON_incomplete {};
 
-[[nodiscard]] static parse_result<datum> parseValue(parse_context_t &context, token_iterator token);
+/** The lexical part of the JSON parsers.
+ *
+ * The scanner works directly on the text without a separate tokenizer. Strings without
+ * escape sequences are referenced straight from the text, white-space and string characters
+ * are skipped 16 bytes at a time, and numbers are converted using `std::from_chars()`.
+ *
+ * When the text is not final, a token that runs into the end of the text throws
+ * `JSON_incomplete`, so that the caller can retry once more text is available.
+ */
+class JSON_scanner {
+protected:
+    /** The location of `_first` in the document.
+     */
+    parse_location _origin = {1, 1};
 
-[[nodiscard]] static parse_result<datum> parseArray(parse_context_t &context, token_iterator token)
-{
-    auto v = datum::make_vector();
+    char const *_first = nullptr;
+    char const *_ptr = nullptr;
+    char const *_last = nullptr;
 
-    // Required '['
-    if ((*token == tokenizer_name_t::Operator) && (*token == "[")) {
-        token++;
-    } else {
-        return {};
+    /** There is no more text after `_last`.
+     */
+    bool _final = true;
+
+    /** Buffer for strings with escape sequences.
+     */
+    std::string _buffer;
+
+    JSON_scanner() noexcept = default;
+
+    JSON_scanner(std::string_view text) noexcept : _first(text.data()), _ptr(text.data()), _last(text.data() + text.size())
+    {
     }
 
-    bool commaAfterValue = true;
-    while (true) {
-        // A ']' is required at end of configuration-items.
-        if ((*token == tokenizer_name_t::Operator) && (*token == "]")) {
-            token++;
-            break;
+    [[nodiscard]] parse_error error(std::string_view message) const noexcept
+    {
+        // The location is only calculated when there is an error.
+        auto location = _origin;
+        for (auto it = _first; it != _ptr; ++it) {
+            location += *it;
+        }
+        return parse_error(std::format("{}:{}: {}", location.line(), location.column(), message));
+    }
+
+    /** Handle a token that runs into the end of the text.
+     *
+     * @throw JSON_incomplete When more text may follow.
+     * @throw parse_error When this was the end of the document.
+     */
+    [[noreturn]] void incomplete(std::string_view message) const
+    {
+        if (_final) {
+            throw error(message);
+        } else {
+            throw JSON_incomplete{};
+        }
+    }
+
+    [[nodiscard]] constexpr static bool is_white_space(char c) noexcept
+    {
+        return c == ' ' or c == '\n' or c == '\r' or c == '\t';
+    }
+
+    [[nodiscard]] constexpr static bool is_digit(char c) noexcept
+    {
+        return c >= '0' and c <= '9';
+    }
+
+    /** Check if a character ends the fast path of a string.
+     */
+    [[nodiscard]] constexpr static bool is_string_special(char c) noexcept
+    {
+        return c == '"' or c == '\\' or static_cast<uint8_t>(c) < 0x20;
+    }
+
+    void skip_white_space()
+    {
+        while (true) {
+#if defined(HI_HAS_SSE2)
+            using S = native_simd<uint8_t, 16>;
+
+            while (_last - _ptr >= narrow_cast<std::ptrdiff_t>(S::size)) {
+                hilet chunk = S{reinterpret_cast<uint8_t const *>(_ptr)};
+                hilet white_space = (chunk == S::broadcast(' ')) | (chunk == S::broadcast('\n')) |
+                    (chunk == S::broadcast('\r')) | (chunk == S::broadcast('\t'));
 
-            // Required a value.
-        } else if (auto result = parseValue(context, token)) {
-            if (!commaAfterValue) {
-                throw parse_error(std::format("{}: Missing expected ','", token->location));
+                if (hilet mask = ~white_space.mask() & 0xffff) {
+                    _ptr += std::countr_zero(mask);
+                    break;
+                }
+                _ptr += S::size;
             }
+#endif
+            while (_ptr != _last and is_white_space(*_ptr)) {
+                ++_ptr;
+            }
+
+            if (_ptr == _last or _ptr[0] != '/') {
+                return;
+
+            } else if (_last - _ptr < 2) {
+                if (_final) {
+                    return;
+                }
+                throw JSON_incomplete{};
+
+            } else if (_ptr[1] == '/') {
+                _ptr = std::find(_ptr + 2, _last, '\n');
+                if (_ptr == _last and not _final) {
+                    // The comment may continue in the next part of the text.
+                    throw JSON_incomplete{};
+                }
 
-            v.push_back(*result);
-            token = result.next_token;
+            } else if (_ptr[1] == '*') {
+                hilet rest = std::string_view{_ptr + 2, _last};
+                hilet end = rest.find("*/");
+                if (end == std::string_view::npos) {
+                    incomplete("Missing end of block comment");
+                }
+                _ptr += end + 4;
 
-            if ((*token == tokenizer_name_t::Operator) && (*token == ",")) {
-                token++;
-                commaAfterValue = true;
             } else {
-                commaAfterValue = false;
+                return;
             }
+        }
+    }
 
-        } else {
-            throw parse_error(std::format("{}: Expecting a value as the next item in an array.", token->location));
+    /** Skip over the characters of a string that can be copied as is.
+     */
+    void skip_string_characters() noexcept
+    {
+#if defined(HI_HAS_SSE2)
+        using S = native_simd<uint8_t, 16>;
+
+        while (_last - _ptr >= narrow_cast<std::ptrdiff_t>(S::size)) {
+            hilet chunk = S{reinterpret_cast<uint8_t const *>(_ptr)};
+            hilet special = (chunk == S::broadcast('"')) | (chunk == S::broadcast('\\')) | (chunk < S::broadcast(0x20));
+
+            if (hilet mask = special.mask()) {
+                _ptr += std::countr_zero(mask);
+                return;
+            }
+            _ptr += S::size;
+        }
+#endif
+        while (_ptr != _last and not is_string_special(*_ptr)) {
+            ++_ptr;
         }
     }
 
-    return {std::move(v), token};
-}
+    [[nodiscard]] char32_t parse_hex4()
+    {
+        if (_last - _ptr < 4) {
+            incomplete("Incomplete \\u escape sequence");
+        }
 
-[[nodiscard]] static parse_result<datum> parseObject(parse_context_t &context, token_iterator token)
-{
-    auto object = datum::make_map();
+        auto r = char32_t{0};
+        for (auto i = 0; i != 4; ++i) {
+            hilet c = *_ptr++;
 
-    // Required '{'
-    if ((*token == tokenizer_name_t::Operator) && (*token == "{")) {
-        token++;
-    } else {
-        return {};
+            auto digit = 0;
+            if (c >= '0' and c <= '9') {
+                digit = c - '0';
+            } else if (c >= 'a' and c <= 'f') {
+                digit = c - 'a' + 10;
+            } else if (c >= 'A' and c <= 'F') {
+                digit = c - 'A' + 10;
+            } else {
+                --_ptr;
+                throw error("Invalid hexadecimal digit in \\u escape sequence");
+            }
+            r = (r << 4) | narrow_cast<char32_t>(digit);
+        }
+        return r;
     }
 
-    bool commaAfterValue = true;
-    while (true) {
-        // A '}' is required at end of configuration-items.
-        if ((*token == tokenizer_name_t::Operator) && (*token == "}")) {
-            token++;
-            break;
+    void append_utf8(char32_t code_point) noexcept
+    {
+        if (code_point < 0x80) {
+            _buffer += char_cast<char>(code_point);
+        } else if (code_point < 0x800) {
+            _buffer += char_cast<char>(0xc0 | (code_point >> 6));
+            _buffer += char_cast<char>(0x80 | (code_point & 0x3f));
+        } else if (code_point < 0x1'0000) {
+            _buffer += char_cast<char>(0xe0 | (code_point >> 12));
+            _buffer += char_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+            _buffer += char_cast<char>(0x80 | (code_point & 0x3f));
+        } else {
+            _buffer += char_cast<char>(0xf0 | (code_point >> 18));
+            _buffer += char_cast<char>(0x80 | ((code_point >> 12) & 0x3f));
+            _buffer += char_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+            _buffer += char_cast<char>(0x80 | (code_point & 0x3f));
+        }
+    }
+
+    /** Parse an escape sequence, after the backslash, and append it to the buffer.
+     */
+    void parse_escape()
+    {
+        if (_ptr == _last) {
+            incomplete("Incomplete escape sequence");
+        }
 
-            // Required a string name.
-        } else if (*token == tokenizer_name_t::StringLiteral) {
-            if (!commaAfterValue) {
-                throw parse_error(std::format("{}: Missing expected ','", token->location));
+        switch (*_ptr++) {
+        case '"': _buffer += '"'; break;
+        case '\\': _buffer += '\\'; break;
+        case '/': _buffer += '/'; break;
+        case 'b': _buffer += '\b'; break;
+        case 'f': _buffer += '\f'; break;
+        case 'n': _buffer += '\n'; break;
+        case 'r': _buffer += '\r'; break;
+        case 't': _buffer += '\t'; break;
+        case 'u': {
+            auto code_point = parse_hex4();
+            if (code_point >= 0xdc00 and code_point <= 0xdfff) {
+                throw error("Unexpected low surrogate in \\u escape sequence");
+
+            } else if (code_point >= 0xd800 and code_point <= 0xdbff) {
+                if (_last - _ptr < 2) {
+                    incomplete("Missing low surrogate after high surrogate in \\u escape sequence");
+                } else if (_ptr[0] != '\\' or _ptr[1] != 'u') {
+                    throw error("Missing low surrogate after high surrogate in \\u escape sequence");
+                }
+                _ptr += 2;
+
+                hilet low_surrogate = parse_hex4();
+                if (low_surrogate < 0xdc00 or low_surrogate > 0xdfff) {
+                    throw error("Expected a low surrogate in \\u escape sequence");
+                }
+                code_point = 0x1'0000 + ((code_point - 0xd800) << 10) + (low_surrogate - 0xdc00);
             }
+            append_utf8(code_point);
+        } break;
+        default: --_ptr; throw error("Invalid escape sequence");
+        }
+    }
 
-            auto name = static_cast<std::string>(*token++);
+    /** Parse a string.
+     *
+     * @return The string, which references the text or an internal buffer;
+     *         it is valid until the next string is parsed.
+     */
+    [[nodiscard]] std::string_view parse_string()
+    {
+        hi_axiom(*_ptr == '"');
+        hilet first = ++_ptr;
+
+        // Most strings do not have escape sequences, and are returned directly from the text.
+        skip_string_characters();
+        if (_ptr != _last and *_ptr == '"') {
+            return {first, narrow_cast<std::size_t>(_ptr++ - first)};
+        }
+
+        _buffer.assign(first, _ptr);
+        while (true) {
+            if (_ptr == _last) {
+                incomplete("Missing end of string");
+
+            } else if (*_ptr == '"') {
+                ++_ptr;
+                return _buffer;
+
+            } else if (*_ptr == '\\') {
+                ++_ptr;
+                parse_escape();
+
+            } else if (static_cast<uint8_t>(*_ptr) < 0x20) {
+                throw error("Unexpected control character in string");
 
-            if ((*token == tokenizer_name_t::Operator) && (*token == ":")) {
-                token++;
             } else {
-                throw parse_error(std::format("{}: Missing expected ':'", token->location));
+                hilet run = _ptr;
+                skip_string_characters();
+                _buffer.append(run, _ptr);
             }
+        }
+    }
 
-            if (auto result = parseValue(context, token)) {
-                object[name] = *result;
-                token = result.next_token;
+    /** Parse a number.
+     *
+     * @return An integer, or a floating point number when the number has a fraction or
+     *         exponent or when it does not fit in a 64 bit integer.
+     */
+    [[nodiscard]] std::variant<long long, double> parse_number()
+    {
+        hilet first = _ptr;
+        auto is_float = false;
 
-            } else {
-                throw parse_error(std::format("{}: Missing JSON value", token->location));
+        hilet skip_digits = [&] {
+            hilet digits = _ptr;
+            while (_ptr != _last and is_digit(*_ptr)) {
+                ++_ptr;
+            }
+            if (_ptr == digits) {
+                if (_ptr == _last) {
+                    incomplete("Expecting a digit in number");
+                }
+                throw error("Expecting a digit in number");
             }
+        };
 
-            if ((*token == tokenizer_name_t::Operator) && (*token == ",")) {
-                token++;
-                commaAfterValue = true;
-            } else {
-                commaAfterValue = false;
+        if (*_ptr == '-') {
+            ++_ptr;
+        }
+        skip_digits();
+
+        if (_ptr != _last and *_ptr == '.') {
+            is_float = true;
+            ++_ptr;
+            skip_digits();
+        }
+
+        if (_ptr != _last and (*_ptr == 'e' or *_ptr == 'E')) {
+            is_float = true;
+            ++_ptr;
+            if (_ptr != _last and (*_ptr == '+' or *_ptr == '-')) {
+                ++_ptr;
+            }
+            skip_digits();
+        }
+
+        if (_ptr == _last and not _final) {
+            // More digits may follow in the next part of the text.
+            throw JSON_incomplete{};
+        }
+
+        if (not is_float) {
+            auto value = 0LL;
+            if (hilet [ptr, ec] = std::from_chars(first, _ptr, value); ec == std::errc{}) {
+                return value;
             }
+            // Integers that do not fit in 64 bits are converted to floating point.
+        }
 
+        auto value = 0.0;
+        if (hilet [ptr, ec] = std::from_chars(first, _ptr, value); ec != std::errc{}) {
+            _ptr = first;
+            throw error("Number out of range");
+        }
+        return value;
+    }
+
+    void parse_name(std::string_view name)
+    {
+        hilet rest = std::string_view{_ptr, _last};
+        if (rest.starts_with(name)) {
+            _ptr += name.size();
+        } else if (rest.size() < name.size() and name.starts_with(rest)) {
+            incomplete("Unexpected name");
         } else {
-            throw parse_error(std::format("{}: Unexpected token {}, expected a key or close-brace.", token->location, *token));
+            throw error("Unexpected name");
         }
     }
+};
 
-    return {std::move(object), token};
-}
+/** A single pass JSON parser.
+ *
+ * Beyond strict JSON the parser accepts line and block comments and trailing commas,
+ * which are used in the configuration files of hikogui.
+ */
+class JSON_parser : public JSON_scanner {
+public:
+    JSON_parser(std::string_view text) noexcept : JSON_scanner(text) {}
+
+    [[nodiscard]] datum parse()
+    {
+        skip_white_space();
+        auto r = parse_value(0);
+
+        skip_white_space();
+        if (_ptr != _last) {
+            throw error("Unexpected text after JSON root object");
+        }
+        return r;
+    }
+
+private:
+    /** The maximum nesting of arrays and objects, to protect the stack.
+     */
+    constexpr static std::size_t max_depth = 512;
+
+    [[nodiscard]] datum parse_array(std::size_t depth)
+    {
+        hi_axiom(*_ptr == '[');
+        ++_ptr;
+
+        auto r = datum::vector_type{};
+        while (true) {
+            skip_white_space();
+            if (_ptr == _last) {
+                throw error("Missing ']' at end of array");
+            } else if (*_ptr == ']') {
+                ++_ptr;
+                return datum{std::move(r)};
+            }
+
+            r.push_back(parse_value(depth + 1));
+
+            skip_white_space();
+            if (_ptr != _last and *_ptr == ',') {
+                ++_ptr;
+            } else if (_ptr == _last or *_ptr != ']') {
+                throw error("Missing expected ','");
+            }
+        }
+    }
+
+    [[nodiscard]] datum parse_object(std::size_t depth)
+    {
+        hi_axiom(*_ptr == '{');
+        ++_ptr;
+
+        auto r = datum::map_type{};
+        while (true) {
+            skip_white_space();
+            if (_ptr == _last) {
+                throw error("Missing '}' at end of object");
+            } else if (*_ptr == '}') {
+                ++_ptr;
+                return datum{std::move(r)};
+            } else if (*_ptr != '"') {
+                throw error("Expecting a key or '}'");
+            }
+
+            // The key is copied before the value is parsed, which may reuse the string buffer.
+            auto key = datum{parse_string()};
+
+            skip_white_space();
+            if (_ptr == _last or *_ptr != ':') {
+                throw error("Missing expected ':'");
+            }
+            ++_ptr;
+
+            skip_white_space();
+            r.insert_or_assign(std::move(key), parse_value(depth + 1));
+
+            skip_white_space();
+            if (_ptr != _last and *_ptr == ',') {
+                ++_ptr;
+            } else if (_ptr == _last or *_ptr != '}') {
+                throw error("Missing expected ','");
+            }
+        }
+    }
 
-[[nodiscard]] static parse_result<datum> parseValue(parse_context_t &context, token_iterator token)
+    [[nodiscard]] datum parse_value(std::size_t depth)
+    {
+        if (depth >= max_depth) {
+            throw error("Arrays and objects are nested too deep");
+        }
+
+        if (_ptr == _last) {
+            throw error("Missing JSON value");
+        }
+
+        switch (*_ptr) {
+        case '{': return parse_object(depth);
+        case '[': return parse_array(depth);
+        case '"': return datum{parse_string()};
+        case 't': parse_name("true"); return datum{true};
+        case 'f': parse_name("false"); return datum{false};
+        case 'n': parse_name("null"); return datum{nullptr};
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9': {
+            hilet number = parse_number();
+            if (hilet integer = std::get_if<long long>(&number)) {
+                return datum{*integer};
+            }
+            return datum{std::get<double>(number)};
+        }
+        default: throw error("Unexpected character, expecting a JSON value");
+        }
+    }
+};
+
+[[nodiscard]] datum parse_JSON(std::string_view text)
 {
-    switch (token->name) {
-    case tokenizer_name_t::StringLiteral: {
-        auto value = datum{static_cast<std::string>(*token++)};
-        return {std::move(value), token};
-    } break;
-    case tokenizer_name_t::IntegerLiteral: {
-        auto value = datum{static_cast<long long>(*token++)};
-        return {std::move(value), token};
-    } break;
-    case tokenizer_name_t::FloatLiteral: {
-        auto value = datum{static_cast<double>(*token++)};
-        return {std::move(value), token};
-    } break;
-    case tokenizer_name_t::Name: {
-        hilet name = static_cast<std::string>(*token++);
-        if (name == "true") {
-            return {datum{true}, token};
-        } else if (name == "false") {
-            return {datum{false}, token};
-        } else if (name == "null") {
-            return {datum{nullptr}, token};
-        } else {
-            throw parse_error(std::format("{}: Unexpected name '{}'", token->location, name));
-        }
-    } break;
-    default:
-        if (auto result1 = parseObject(context, token)) {
-            return result1;
-        } else if (auto result2 = parseArray(context, token)) {
-            return result2;
+    return JSON_parser{text}.parse();
+}
+
+namespace detail {
+
+class JSON_reader_impl : public JSON_scanner {
+public:
+    JSON_reader_impl() noexcept
+    {
+        _final = false;
+        reset_pointers();
+    }
+
+    JSON_reader_impl(std::string_view text) noexcept : JSON_scanner(text) {}
+
+    void feed(std::string_view chunk)
+    {
+        hi_axiom(not _final);
+
+        // Discard the text that was consumed, while tracking its location for error messages.
+        hilet consumed = narrow_cast<std::size_t>(_ptr - _first);
+        for (auto it = _first; it != _ptr; ++it) {
+            _origin += *it;
+        }
+        _text.erase(0, consumed);
+        _text.append(chunk);
+        reset_pointers();
+    }
+
+    void finish() noexcept
+    {
+        _final = true;
+    }
+
+    [[nodiscard]] JSON_event next()
+    {
+        apply_pending();
+
+        _mark = _ptr;
+        try {
+            return next_event();
+        } catch (JSON_incomplete const&) {
+            // Rewind to the start of the token, it is scanned again after more text is fed.
+            _ptr = _mark;
+            return JSON_event::need_more;
+        }
+    }
+
+    [[nodiscard]] std::string_view string() const noexcept
+    {
+        return _string;
+    }
+
+    [[nodiscard]] long long integer() const noexcept
+    {
+        return _integer;
+    }
+
+    [[nodiscard]] double floating_point() const noexcept
+    {
+        return _floating_point;
+    }
+
+    [[nodiscard]] bool boolean() const noexcept
+    {
+        return _boolean;
+    }
+
+    [[nodiscard]] datum value() const
+    {
+        switch (_event) {
+        case JSON_event::string: return datum{_string};
+        case JSON_event::integer: return datum{_integer};
+        case JSON_event::floating_point: return datum{_floating_point};
+        case JSON_event::boolean: return datum{_boolean};
+        default: return datum{nullptr};
+        }
+    }
+
+    [[nodiscard]] std::size_t depth() const noexcept
+    {
+        return _frames.size();
+    }
+
+    [[nodiscard]] JSON_reader::location_type const& location() const noexcept
+    {
+        return _location;
+    }
+
+private:
+    enum class state_type : uint8_t {
+        /** Expecting a value, key or the end of the container; at the start or after a ','.
+         */
+        value_or_end,
+
+        /** Expecting the value of a member of an object, after the ':'.
+         */
+        value,
+
+        /** Expecting a ',' or the end of the container, after a value.
+         */
+        separator
+    };
+
+    struct frame_type {
+        bool is_object;
+        state_type state;
+        std::size_t size;
+    };
+
+    /** Changes to the frames and location that are applied at the start of the next call.
+     *
+     * This keeps `depth()` and `location()` valid for the event that was returned.
+     */
+    enum class pending_type : uint8_t { none, push_object, push_array, pop_location };
+
+    /** Storage for the text which is fed incrementally.
+     */
+    std::string _text;
+
+    std::vector<frame_type> _frames;
+    JSON_reader::location_type _location;
+    pending_type _pending = pending_type::none;
+
+    /** The position to rewind to when a token is incomplete.
+     *
+     * It is moved forward each time the state changes without returning an event.
+     */
+    char const *_mark = nullptr;
+
+    /** The root value was read.
+     */
+    bool _root_done = false;
+
+    JSON_event _event = JSON_event::need_more;
+    std::string_view _string;
+    long long _integer = 0;
+    double _floating_point = 0.0;
+    bool _boolean = false;
+
+    void reset_pointers() noexcept
+    {
+        _first = _text.data();
+        _ptr = _first;
+        _last = _first + _text.size();
+    }
+
+    void apply_pending() noexcept
+    {
+        switch (_pending) {
+        case pending_type::push_object: _frames.push_back({true, state_type::value_or_end, 0}); break;
+        case pending_type::push_array: _frames.push_back({false, state_type::value_or_end, 0}); break;
+        case pending_type::pop_location: _location.pop_back(); break;
+        case pending_type::none: break;
+        }
+        _pending = pending_type::none;
+    }
+
+    /** Mark the value of the current event as complete.
+     */
+    void complete_value() noexcept
+    {
+        if (_frames.empty()) {
+            _root_done = true;
         } else {
-            throw parse_error(std::format("{}: Unexpected token '{}'", token->location, token->name));
+            auto& frame = _frames.back();
+            frame.state = state_type::separator;
+            ++frame.size;
+            _pending = pending_type::pop_location;
         }
     }
+
+    [[nodiscard]] JSON_event emit(JSON_event event) noexcept
+    {
+        _event = event;
+        return event;
+    }
+
+    /** Read a value and return its event.
+     */
+    [[nodiscard]] JSON_event next_value()
+    {
+        if (_ptr == _last) {
+            incomplete("Missing JSON value");
+        }
+
+        switch (*_ptr) {
+        case '{':
+            ++_ptr;
+            _pending = pending_type::push_object;
+            return emit(JSON_event::start_object);
+
+        case '[':
+            ++_ptr;
+            _pending = pending_type::push_array;
+            return emit(JSON_event::start_array);
+
+        case '"':
+            _string = parse_string();
+            complete_value();
+            return emit(JSON_event::string);
+
+        case 't':
+            parse_name("true");
+            _boolean = true;
+            complete_value();
+            return emit(JSON_event::boolean);
+
+        case 'f':
+            parse_name("false");
+            _boolean = false;
+            complete_value();
+            return emit(JSON_event::boolean);
+
+        case 'n':
+            parse_name("null");
+            complete_value();
+            return emit(JSON_event::null);
+
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9': {
+            hilet number = parse_number();
+            complete_value();
+            if (hilet integer = std::get_if<long long>(&number)) {
+                _integer = *integer;
+                return emit(JSON_event::integer);
+            }
+            _floating_point = std::get<double>(number);
+            return emit(JSON_event::floating_point);
+        }
+
+        default: throw error("Unexpected character, expecting a JSON value");
+        }
+    }
+
+    [[nodiscard]] JSON_event next_event()
+    {
+        while (true) {
+            skip_white_space();
+
+            if (_frames.empty()) {
+                if (not _root_done) {
+                    return next_value();
+                } else if (_ptr != _last) {
+                    throw error("Unexpected text after JSON root object");
+                } else if (_final) {
+                    return emit(JSON_event::end_of_document);
+                } else {
+                    return JSON_event::need_more;
+                }
+            }
+
+            auto& frame = _frames.back();
+            if (_ptr == _last) {
+                incomplete(frame.is_object ? "Missing '}' at end of object" : "Missing ']' at end of array");
+            }
+
+            if (frame.state != state_type::value and *_ptr == (frame.is_object ? '}' : ']')) {
+                ++_ptr;
+                hilet is_object = frame.is_object;
+                _frames.pop_back();
+                complete_value();
+                return emit(is_object ? JSON_event::end_object : JSON_event::end_array);
+
+            } else if (frame.state == state_type::separator) {
+                if (*_ptr != ',') {
+                    throw error("Missing expected ','");
+                }
+                ++_ptr;
+                frame.state = state_type::value_or_end;
+                _mark = _ptr;
+
+            } else if (frame.state == state_type::value) {
+                return next_value();
+
+            } else if (not frame.is_object) {
+                _location.emplace_back(frame.size);
+                try {
+                    return next_value();
+                } catch (...) {
+                    _location.pop_back();
+                    throw;
+                }
+
+            } else if (*_ptr != '"') {
+                throw error("Expecting a key or '}'");
+
+            } else {
+                hilet key = parse_string();
+                skip_white_space();
+                if (_ptr == _last) {
+                    incomplete("Missing expected ':'");
+                } else if (*_ptr != ':') {
+                    throw error("Missing expected ':'");
+                }
+                ++_ptr;
+
+                _location.emplace_back(std::string{key});
+                _string = std::get<std::string>(_location.back());
+                frame.state = state_type::value;
+                return emit(JSON_event::key);
+            }
+        }
+    }
+};
+
+} // namespace detail
+
+JSON_reader::~JSON_reader() = default;
+JSON_reader::JSON_reader(JSON_reader&&) noexcept = default;
+JSON_reader& JSON_reader::operator=(JSON_reader&&) noexcept = default;
+
+JSON_reader::JSON_reader() : _pimpl(std::make_unique<detail::JSON_reader_impl>()) {}
+
+JSON_reader::JSON_reader(std::string_view text) : _pimpl(std::make_unique<detail::JSON_reader_impl>(text)) {}
+
+void JSON_reader::feed(std::string_view chunk)
+{
+    _pimpl->feed(chunk);
 }
 
-[[nodiscard]] datum parse_JSON(std::string_view text)
+void JSON_reader::finish() noexcept
 {
-    token_vector tokens = parseTokens(text);
+    _pimpl->finish();
+}
 
-    datum root;
+[[nodiscard]] JSON_event JSON_reader::next()
+{
+    return _pimpl->next();
+}
 
-    hi_assert(tokens.back() == tokenizer_name_t::End);
-    parse_context_t context;
-    context.text_begin = text.begin();
+[[nodiscard]] std::string_view JSON_reader::string() const noexcept
+{
+    return _pimpl->string();
+}
 
-    auto token = tokens.begin();
+[[nodiscard]] long long JSON_reader::integer() const noexcept
+{
+    return _pimpl->integer();
+}
 
-    if (auto result = parseValue(context, token)) {
-        root = std::move(*result);
-        token = result.next_token;
+[[nodiscard]] double JSON_reader::floating_point() const noexcept
+{
+    return _pimpl->floating_point();
+}
+
+[[nodiscard]] bool JSON_reader::boolean() const noexcept
+{
+    return _pimpl->boolean();
+}
+
+[[nodiscard]] datum JSON_reader::value() const
+{
+    return _pimpl->value();
+}
+
+[[nodiscard]] std::size_t JSON_reader::depth() const noexcept
+{
+    return _pimpl->depth();
+}
+
+[[nodiscard]] JSON_reader::location_type const& JSON_reader::location() const noexcept
+{
+    return _pimpl->location();
+}
+
+/** Check if a json-path matches a location.
+ *
+ * @param it The current node of the path.
+ * @param it_end One beyond the last node of the path.
+ * @param location The location of a value.
+ * @param i The index of the current segment in @a location.
+ */
+[[nodiscard]] static bool JSON_path_matches(
+    jsonpath::const_iterator it,
+    jsonpath::const_iterator it_end,
+    JSON_reader::location_type const& location,
+    std::size_t i) noexcept
+{
+    if (it == it_end) {
+        return i == location.size();
+
+    } else if (std::holds_alternative<jsonpath_root>(*it) or std::holds_alternative<jsonpath_current>(*it)) {
+        return JSON_path_matches(it + 1, it_end, location, i);
+
+    } else if (std::holds_alternative<jsonpath_descend>(*it)) {
+        // Descend matches zero or more segments.
+        for (auto j = i; j <= location.size(); ++j) {
+            if (JSON_path_matches(it + 1, it_end, location, j)) {
+                return true;
+            }
+        }
+        return false;
+
+    } else if (i == location.size()) {
+        return false;
+
+    } else if (std::holds_alternative<jsonpath_wildcard>(*it)) {
+        return JSON_path_matches(it + 1, it_end, location, i + 1);
+
+    } else if (auto names = std::get_if<jsonpath_names>(&*it)) {
+        hilet key = std::get_if<std::string>(&location[i]);
+        return key and std::find(names->begin(), names->end(), *key) != names->end() and
+            JSON_path_matches(it + 1, it_end, location, i + 1);
+
+    } else if (auto indices = std::get_if<jsonpath_indices>(&*it)) {
+        hilet index = std::get_if<std::size_t>(&location[i]);
+        return index and
+            std::find(indices->indices.begin(), indices->indices.end(), narrow_cast<ssize_t>(*index)) !=
+            indices->indices.end() and
+            JSON_path_matches(it + 1, it_end, location, i + 1);
+
+    } else if (auto slice = std::get_if<jsonpath_slice>(&*it)) {
+        hilet index = std::get_if<std::size_t>(&location[i]);
+        if (not index or slice->first < 0 or slice->step <= 0 or (not slice->last_is_empty() and slice->last < 0)) {
+            return false;
+        }
+
+        hilet index_ = narrow_cast<ssize_t>(*index);
+        return index_ >= slice->first and (slice->last_is_empty() or index_ < slice->last) and
+            (index_ - slice->first) % slice->step == 0 and JSON_path_matches(it + 1, it_end, location, i + 1);
 
     } else {
-        throw parse_error(std::format("{}: Missing JSON object", token->location));
+        hi_no_default();
     }
+}
+
+JSON_path_reader::JSON_path_reader(jsonpath path) : _reader(), _path(std::move(path)) {}
+
+JSON_path_reader::JSON_path_reader(std::string_view text, jsonpath path) : _reader(text), _path(std::move(path)) {}
 
-    if (*token != tokenizer_name_t::End) {
-        throw parse_error(std::format("{}: Unexpected text after JSON root object", token->location));
+[[nodiscard]] bool JSON_path_reader::matches() const noexcept
+{
+    return JSON_path_matches(_path.begin(), _path.end(), _reader.location(), 0);
+}
+
+[[nodiscard]] std::optional<datum> JSON_path_reader::add(datum value)
+{
+    if (_stack.empty()) {
+        return value;
     }
 
-    return root;
+    auto& parent = _stack.back();
+    if (auto vector = get_if<datum::vector_type>(parent)) {
+        vector->push_back(std::move(value));
+    } else if (auto map = get_if<datum::map_type>(parent)) {
+        map->insert_or_assign(datum{std::get<std::string>(_reader.location().back())}, std::move(value));
+    } else {
+        hi_no_default();
+    }
+    return std::nullopt;
 }
 
+[[nodiscard]] std::optional<datum> JSON_path_reader::next()
+{
+    while (true) {
+        switch (_reader.next()) {
+        case JSON_event::need_more: return std::nullopt;
+
+        case JSON_event::end_of_document: _done = true; return std::nullopt;
+
+        case JSON_event::key: break;
+
+        case JSON_event::start_object:
+            if (not _stack.empty() or matches()) {
+                _stack.push_back(datum{datum::map_type{}});
+            }
+            break;
+
+        case JSON_event::start_array:
+            if (not _stack.empty() or matches()) {
+                _stack.push_back(datum{datum::vector_type{}});
+            }
+            break;
+
+        case JSON_event::end_object:
+        case JSON_event::end_array:
+            if (not _stack.empty()) {
+                auto value = std::move(_stack.back());
+                _stack.pop_back();
+                if (auto r = add(std::move(value))) {
+                    return r;
+                }
+            }
+            break;
+
+        default:
+            if (not _stack.empty() or matches()) {
+                if (auto r = add(_reader.value())) {
+                    return r;
+                }
+            }
+        }
+    }
+}
+
+[[nodiscard]] std::vector<datum> parse_JSON(std::string_view text, jsonpath const& path)
+{
+    auto r = std::vector<datum>{};
+    auto reader = JSON_path_reader{text, path};
+    while (auto value = reader.next()) {
+        r.push_back(std::move(*value));
+    }
+    return r;
+}
 
 static void format_JSON_impl(datum const &value, std::string &result, hi::indent indent = {})
 {
@@ -104,4 +104,157 @@ TEST(JSON, ParseTwoItemObject)
     expected["foo"]["baz"] = 43;
     ASSERT_EQ(parse_JSON("{\"foo\": {\"bar\": 42, \"baz\": 43}}"), expected);
     ASSERT_EQ(parse_JSON("{\"foo\": {\"bar\": 42, \"baz\": 43,}}"), expected);
-}
\ No newline at end of file
+}
+
+TEST(JSON, ParseNumbers)
+{
+    ASSERT_EQ(parse_JSON("-42"), datum{-42});
+    ASSERT_EQ(parse_JSON("0"), datum{0});
+    ASSERT_EQ(parse_JSON("-0.5"), datum{-0.5});
+    ASSERT_EQ(parse_JSON("1.5e3"), datum{1500.0});
+    ASSERT_EQ(parse_JSON("25E-1"), datum{2.5});
+    ASSERT_TRUE(holds_alternative<double>(parse_JSON("1e2")));
+
+    // Integers that do not fit in 64 bits are parsed as floating point.
+    ASSERT_EQ(parse_JSON("9223372036854775807"), datum{9223372036854775807LL});
+    ASSERT_TRUE(holds_alternative<double>(parse_JSON("9223372036854775808")));
+}
+
+TEST(JSON, ParseStringEscapes)
+{
+    ASSERT_EQ(parse_JSON("\"a\\n\\t\\\"b\\\\\\/\""), datum{"a\n\t\"b\\/"});
+    ASSERT_EQ(parse_JSON("\"\\u0041\\u00e9\\u20ac\\ud83d\\ude00\""), datum{"A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80"});
+
+    // Long strings are scanned 16 characters at a time.
+    ASSERT_EQ(
+        parse_JSON("\"0123456789abcdefghijklmnopqrstuvwxyz\\n0123456789abcdefghijklmnopqrstuvwxyz\""),
+        datum{"0123456789abcdefghijklmnopqrstuvwxyz\n0123456789abcdefghijklmnopqrstuvwxyz"});
+}
+
+TEST(JSON, ParseComments)
+{
+    auto expected = datum::make_vector(1, 2);
+    ASSERT_EQ(parse_JSON("// comment\n[1, /* comment */ 2] // comment"), expected);
+    ASSERT_EQ(parse_JSON("                                [\n                                1,\n2]"), expected);
+}
+
+TEST(JSON, ParseErrors)
+{
+    ASSERT_THROW((void)parse_JSON(""), parse_error);
+    ASSERT_THROW((void)parse_JSON("[1 2]"), parse_error);
+    ASSERT_THROW((void)parse_JSON("{\"a\" 1}"), parse_error);
+    ASSERT_THROW((void)parse_JSON("{1: 2}"), parse_error);
+    ASSERT_THROW((void)parse_JSON("[1"), parse_error);
+    ASSERT_THROW((void)parse_JSON("\"abc"), parse_error);
+    ASSERT_THROW((void)parse_JSON("\"a\nb\""), parse_error);
+    ASSERT_THROW((void)parse_JSON("tru"), parse_error);
+    ASSERT_THROW((void)parse_JSON("[-]"), parse_error);
+    ASSERT_THROW((void)parse_JSON("\"\\x\""), parse_error);
+    ASSERT_THROW((void)parse_JSON("\"\\ud800\""), parse_error);
+    ASSERT_THROW((void)parse_JSON("/* comment"), parse_error);
+    ASSERT_THROW((void)parse_JSON("[1] 2"), parse_error);
+    ASSERT_THROW((void)parse_JSON(std::string(1000, '[')), parse_error);
+}
+
+TEST(JSON, ReaderEvents)
+{
+    auto reader = JSON_reader{"{\"a\": [1, 2.5], \"b\": {\"c\": \"d\"}, \"e\": [true, null,]}"};
+
+    ASSERT_EQ(reader.next(), JSON_event::start_object);
+    ASSERT_EQ(reader.depth(), 0);
+    ASSERT_EQ(reader.next(), JSON_event::key);
+    ASSERT_EQ(reader.string(), "a");
+    ASSERT_EQ(reader.next(), JSON_event::start_array);
+    ASSERT_EQ(reader.depth(), 1);
+    ASSERT_EQ(reader.next(), JSON_event::integer);
+    ASSERT_EQ(reader.integer(), 1);
+    ASSERT_EQ(reader.depth(), 2);
+    ASSERT_EQ(reader.next(), JSON_event::floating_point);
+    ASSERT_EQ(reader.floating_point(), 2.5);
+    ASSERT_EQ(reader.location(), (JSON_reader::location_type{std::string{"a"}, 1_uz}));
+    ASSERT_EQ(reader.next(), JSON_event::end_array);
+    ASSERT_EQ(reader.next(), JSON_event::key);
+    ASSERT_EQ(reader.next(), JSON_event::start_object);
+    ASSERT_EQ(reader.next(), JSON_event::key);
+    ASSERT_EQ(reader.next(), JSON_event::string);
+    ASSERT_EQ(reader.string(), "d");
+    ASSERT_EQ(reader.location(), (JSON_reader::location_type{std::string{"b"}, std::string{"c"}}));
+    ASSERT_EQ(reader.next(), JSON_event::end_object);
+    ASSERT_EQ(reader.next(), JSON_event::key);
+    ASSERT_EQ(reader.next(), JSON_event::start_array);
+    ASSERT_EQ(reader.next(), JSON_event::boolean);
+    ASSERT_TRUE(reader.boolean());
+    ASSERT_EQ(reader.next(), JSON_event::null);
+    ASSERT_EQ(reader.value(), datum{nullptr});
+    ASSERT_EQ(reader.next(), JSON_event::end_array);
+    ASSERT_EQ(reader.next(), JSON_event::end_object);
+    ASSERT_EQ(reader.depth(), 0);
+    ASSERT_EQ(reader.next(), JSON_event::end_of_document);
+}
+
+TEST(JSON, ReaderChunked)
+{
+    auto const text = std::string{"// comment\n{\"foo\": [-12.5e1, \"b\\u00e9r\", false], /* comment */ \"bar\": 1234567}"};
+
+    auto expected = std::vector<datum>{};
+    auto whole = JSON_reader{text};
+    for (auto event = whole.next(); event != JSON_event::end_of_document; event = whole.next()) {
+        expected.push_back(datum{static_cast<int>(event)});
+        expected.push_back(whole.value());
+    }
+
+    // Feed the text one character at a time, so that every token is split.
+    auto result = std::vector<datum>{};
+    auto reader = JSON_reader{};
+    auto i = 0_uz;
+    for (auto event = reader.next(); event != JSON_event::end_of_document; event = reader.next()) {
+        if (event == JSON_event::need_more) {
+            if (i != text.size()) {
+                reader.feed(text.substr(i++, 1));
+            } else {
+                reader.finish();
+            }
+        } else {
+            result.push_back(datum{static_cast<int>(event)});
+            result.push_back(reader.value());
+        }
+    }
+    ASSERT_EQ(result, expected);
+
+    auto incomplete = JSON_reader{};
+    incomplete.feed("[1, 2");
+    ASSERT_EQ(incomplete.next(), JSON_event::start_array);
+    ASSERT_EQ(incomplete.next(), JSON_event::integer);
+    ASSERT_EQ(incomplete.next(), JSON_event::need_more);
+    incomplete.finish();
+    ASSERT_EQ(incomplete.next(), JSON_event::integer);
+    ASSERT_THROW((void)incomplete.next(), parse_error);
+}
+
+TEST(JSON, ParsePath)
+{
+    auto const text = std::string{
+        "{\"store\": {\"book\": [{\"title\": \"a\", \"price\": 8}, {\"title\": \"b\", \"price\": 12}], \"bicycle\": {\"price\": "
+        "19}}}"};
+
+    ASSERT_EQ(parse_JSON(text, jsonpath{"$.store.book[*].title"}), (std::vector<datum>{datum{"a"}, datum{"b"}}));
+    ASSERT_EQ(parse_JSON(text, jsonpath{"$..price"}), (std::vector<datum>{datum{8}, datum{12}, datum{19}}));
+    ASSERT_EQ(parse_JSON(text, jsonpath{"$.store.book[1:].price"}), (std::vector<datum>{datum{12}}));
+
+    auto expected = datum::make_map();
+    expected["title"] = "b";
+    expected["price"] = 12;
+    ASSERT_EQ(parse_JSON(text, jsonpath{"$.store.book[1]"}), (std::vector<datum>{expected}));
+
+    // Values are returned as soon as they are complete.
+    auto reader = JSON_path_reader{jsonpath{"$[*].id"}};
+    reader.feed("[{\"id\": 1}, {\"id\": 2");
+    ASSERT_EQ(reader.next(), datum{1});
+    ASSERT_EQ(reader.next(), std::nullopt);
+    ASSERT_FALSE(reader.done());
+    reader.feed("}]");
+    reader.finish();
+    ASSERT_EQ(reader.next(), datum{2});
+    ASSERT_EQ(reader.next(), std::nullopt);
+    ASSERT_TRUE(reader.done());
+}
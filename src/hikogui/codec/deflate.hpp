@@ -0,0 +1,30 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/module.hpp"
+#include "../byte_string.hpp"
+#include <span>
+
+namespace hi::inline v1 {
+
+/** Compress data using the deflate algorithm.
+ *
+ * Matches are found using hash-chains over a 32 KiB window. Each block is
+ * emitted with the smallest of dynamic huffman codes, the fixed huffman codes
+ * or stored without compression.
+ *
+ * The compression levels have the same meaning as for zlib:
+ *  - 0: No compression, the data is copied in stored blocks.
+ *  - 1 - 3: Fast, the first match found within a short hash-chain is used.
+ *  - 4 - 9: Lazy matching, with longer hash-chains for the higher levels.
+ *
+ * @param bytes The data to compress.
+ * @param level The compression level between 0 and 9.
+ * @return The compressed data.
+ */
+[[nodiscard]] bstring deflate(std::span<std::byte const> bytes, int level = 6);
+
+} // namespace hi::inline v1
@@ -0,0 +1,849 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "deflate.hpp"
+#include "../utility/module.hpp"
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <bit>
+
+namespace hi::inline v1 {
+
+/** The parameters of a compression level.
+ *
+ * These are the same parameters as used by zlib.
+ */
+struct deflate_config {
+    /** Search a quarter of the hash-chain when the previous match is at least this long.
+     */
+    uint16_t good_length;
+
+    /** For lazy matching: do not search for a better match when the previous match is at least this long.
+     * Otherwise: only insert the positions of a match into the hash-table when the match is at most this long.
+     */
+    uint16_t lazy_length;
+
+    /** Stop searching when a match is at least this long.
+     */
+    uint16_t nice_length;
+
+    /** The maximum number of hash-chain entries to search.
+     */
+    uint16_t max_chain;
+
+    /** Use lazy matching; check if the next position has a longer match before emitting a match.
+     */
+    bool lazy;
+};
+
+constexpr auto deflate_configs = std::array<deflate_config, 10>{{
+    {0, 0, 0, 0, false},
+    {4, 4, 8, 4, false},
+    {4, 5, 16, 8, false},
+    {4, 6, 32, 32, false},
+    {4, 4, 16, 16, true},
+    {8, 16, 32, 32, true},
+    {8, 16, 128, 128, true},
+    {8, 32, 128, 256, true},
+    {32, 128, 258, 1024, true},
+    {32, 258, 258, 4096, true}}};
+
+constexpr std::size_t deflate_min_match = 3;
+constexpr std::size_t deflate_max_match = 258;
+constexpr std::size_t deflate_max_distance = 32768;
+constexpr std::size_t deflate_window_mask = deflate_max_distance - 1;
+constexpr std::size_t deflate_hash_bits = 15;
+constexpr std::size_t deflate_hash_size = 1_uz << deflate_hash_bits;
+
+/** A match of the minimum length which is further away than this is larger than three literals.
+ */
+constexpr std::size_t deflate_too_far = 4096;
+
+/** The maximum number of symbols in a block.
+ */
+constexpr std::size_t deflate_block_size = 0x4000;
+
+/** The maximum size of a stored block.
+ */
+constexpr std::size_t deflate_stored_size = 0xffff;
+
+/** The hash-table is reset after this many bytes, so that positions fit in 32 bits.
+ */
+constexpr std::size_t deflate_segment_size = 0x4000'0000;
+
+constexpr std::size_t deflate_nr_literals = 286;
+constexpr std::size_t deflate_nr_distances = 30;
+constexpr std::size_t deflate_nr_code_lengths = 19;
+
+constexpr auto deflate_code_length_order =
+    std::array<uint8_t, deflate_nr_code_lengths>{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+/** A literal or a match.
+ */
+struct deflate_symbol {
+    /** The distance of a match, or zero for a literal.
+     */
+    uint16_t distance;
+
+    /** The literal byte, or the length of the match minus 3.
+     */
+    uint8_t value;
+};
+
+/** Get the length code for a match.
+ *
+ * @param value The length of the match minus 3.
+ * @return The length code, the literal/length symbol minus 257.
+ */
+[[nodiscard]] constexpr std::size_t deflate_length_code(std::size_t value) noexcept
+{
+    hi_axiom(value <= 255);
+
+    if (value < 8) {
+        return value;
+    } else if (value == 255) {
+        return 28;
+    } else {
+        hilet nr_bits = narrow_cast<std::size_t>(std::bit_width(value)) - 1;
+        return 4 * (nr_bits - 1) + ((value >> (nr_bits - 2)) & 3);
+    }
+}
+
+[[nodiscard]] constexpr std::size_t deflate_length_extra(std::size_t code) noexcept
+{
+    return (code < 8 or code == 28) ? 0 : code / 4 - 1;
+}
+
+/** Get the distance code for a match.
+ *
+ * @param value The distance of the match minus 1.
+ * @return The distance code.
+ */
+[[nodiscard]] constexpr std::size_t deflate_distance_code(std::size_t value) noexcept
+{
+    hi_axiom(value < deflate_max_distance);
+
+    if (value < 4) {
+        return value;
+    } else {
+        hilet nr_bits = narrow_cast<std::size_t>(std::bit_width(value)) - 1;
+        return 2 * nr_bits + ((value >> (nr_bits - 1)) & 1);
+    }
+}
+
+[[nodiscard]] constexpr std::size_t deflate_distance_extra(std::size_t code) noexcept
+{
+    return code < 4 ? 0 : code / 2 - 1;
+}
+
+/** Reverse the bits of a huffman code, the bit-stream is written LSB first.
+ */
+[[nodiscard]] constexpr uint16_t deflate_reverse_code(std::size_t code, std::size_t length) noexcept
+{
+    auto r = 0_uz;
+    for (auto i = 0_uz; i != length; ++i) {
+        r = (r << 1) | ((code >> i) & 1);
+    }
+    return narrow_cast<uint16_t>(r);
+}
+
+/** Calculate the canonical huffman codes from the code lengths.
+ */
+template<std::size_t N>
+[[nodiscard]] constexpr std::array<uint16_t, N> deflate_make_codes(std::array<uint8_t, N> const& lengths) noexcept
+{
+    auto count = std::array<std::size_t, 16>{};
+    for (hilet length : lengths) {
+        ++count[length];
+    }
+    count[0] = 0;
+
+    auto next_code = std::array<std::size_t, 16>{};
+    auto code = 0_uz;
+    for (auto length = 1_uz; length != 16; ++length) {
+        code = (code + count[length - 1]) << 1;
+        next_code[length] = code;
+    }
+
+    auto r = std::array<uint16_t, N>{};
+    for (auto symbol = 0_uz; symbol != N; ++symbol) {
+        if (hilet length = lengths[symbol]) {
+            r[symbol] = deflate_reverse_code(next_code[length]++, length);
+        }
+    }
+    return r;
+}
+
+constexpr auto deflate_fixed_literal_lengths = []() {
+    // The fixed code includes two unused symbols, which are needed to build the canonical codes.
+    auto r = std::array<uint8_t, deflate_nr_literals + 2>{};
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        r[i] = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+    }
+    return r;
+}();
+
+constexpr auto deflate_fixed_distance_lengths = []() {
+    auto r = std::array<uint8_t, deflate_nr_distances>{};
+    std::fill(r.begin(), r.end(), uint8_t{5});
+    return r;
+}();
+
+constexpr auto deflate_fixed_literal_codes = deflate_make_codes(deflate_fixed_literal_lengths);
+constexpr auto deflate_fixed_distance_codes = deflate_make_codes(deflate_fixed_distance_lengths);
+
+/** Calculate length-limited huffman code lengths.
+ *
+ * The huffman tree is build using the two-queue method, then code lengths which are
+ * too long are shortened by rebalancing the number of codes of each length.
+ *
+ * At least two symbols are given a code, so that the code is complete.
+ *
+ * @param frequencies The frequency of each symbol.
+ * @param max_length The maximum length of a code.
+ * @return The length of each symbol, zero for symbols that are not used.
+ */
+template<std::size_t N>
+[[nodiscard]] static std::array<uint8_t, N> deflate_code_lengths(std::array<uint32_t, N> const& frequencies, std::size_t max_length) noexcept
+{
+    auto r = std::array<uint8_t, N>{};
+
+    auto symbols = std::array<uint16_t, N>{};
+    auto nr_symbols = 0_uz;
+    for (auto symbol = 0_uz; symbol != N; ++symbol) {
+        if (frequencies[symbol] != 0) {
+            symbols[nr_symbols++] = narrow_cast<uint16_t>(symbol);
+        }
+    }
+
+    if (nr_symbols < 2) {
+        r[0] = 1;
+        r[1] = 1;
+        if (nr_symbols == 1 and symbols[0] > 1) {
+            r[1] = 0;
+            r[symbols[0]] = 1;
+        }
+        return r;
+    }
+
+    std::stable_sort(symbols.begin(), symbols.begin() + nr_symbols, [&](hilet a, hilet b) {
+        return frequencies[a] < frequencies[b];
+    });
+
+    // Leaves are at [0, nr_symbols), internal nodes are created in order of increasing weight.
+    auto weights = std::array<uint64_t, 2 * N>{};
+    auto parents = std::array<uint16_t, 2 * N>{};
+    for (auto i = 0_uz; i != nr_symbols; ++i) {
+        weights[i] = frequencies[symbols[i]];
+    }
+
+    hilet nr_nodes = 2 * nr_symbols - 1;
+    auto next_leaf = 0_uz;
+    auto next_node = nr_symbols;
+    for (auto node = nr_symbols; node != nr_nodes; ++node) {
+        for (auto i = 0; i != 2; ++i) {
+            hilet use_leaf = next_leaf != nr_symbols and (next_node == node or weights[next_leaf] <= weights[next_node]);
+            hilet child = use_leaf ? next_leaf++ : next_node++;
+            weights[node] += weights[child];
+            parents[child] = narrow_cast<uint16_t>(node);
+        }
+    }
+
+    // The depth of each node, the root is the last node.
+    auto depths = std::array<uint8_t, 2 * N>{};
+    auto count = std::array<std::size_t, 33>{};
+    for (auto node = nr_nodes - 1; node-- != 0;) {
+        depths[node] = narrow_cast<uint8_t>(std::min(depths[parents[node]] + 1, 32));
+        if (node < nr_symbols) {
+            ++count[depths[node]];
+        }
+    }
+
+    // Move codes that are too long to the maximum length, then make the code complete
+    // by moving shorter codes one level down.
+    for (auto length = max_length + 1; length != count.size(); ++length) {
+        count[max_length] += std::exchange(count[length], 0);
+    }
+
+    auto total = 0_uz;
+    for (auto length = 1_uz; length <= max_length; ++length) {
+        total += count[length] << (max_length - length);
+    }
+
+    while (total > (1_uz << max_length)) {
+        --count[max_length];
+        for (auto length = max_length - 1; length != 0; --length) {
+            if (count[length] != 0) {
+                --count[length];
+                count[length + 1] += 2;
+                break;
+            }
+        }
+        --total;
+    }
+
+    // The least frequent symbols get the longest codes.
+    auto i = 0_uz;
+    for (auto length = max_length; length != 0; --length) {
+        for (auto j = 0_uz; j != count[length]; ++j) {
+            r[symbols[i++]] = narrow_cast<uint8_t>(length);
+        }
+    }
+    return r;
+}
+
+/** Writes a bit-stream, the first bit is written in the LSB of the first byte.
+ */
+class deflate_bit_writer {
+public:
+    explicit deflate_bit_writer(bstring& out) noexcept : _out(out), _offset(out.size()) {}
+
+    /** Write bits to the stream.
+     *
+     * @param value The value to write.
+     * @param nr_bits The number of bits of the value to write, at most 32.
+     */
+    hi_force_inline void put(std::size_t value, std::size_t nr_bits) noexcept
+    {
+        hi_axiom(nr_bits <= 32);
+        hi_axiom(value < (1_uz << nr_bits));
+
+        _bits |= static_cast<uint64_t>(value) << _nr_bits;
+        _nr_bits += nr_bits;
+        if (_nr_bits >= 32) {
+            reserve(sizeof(uint64_t));
+            store_le(_bits, _out.data() + _offset);
+            _offset += 4;
+            _bits >>= 32;
+            _nr_bits -= 32;
+        }
+    }
+
+    /** Write bits to the stream, up to the next byte boundary.
+     */
+    void align() noexcept
+    {
+        reserve(sizeof(uint64_t));
+        store_le(_bits, _out.data() + _offset);
+        _offset += (_nr_bits + 7) / 8;
+        _bits = 0;
+        _nr_bits = 0;
+    }
+
+    /** Write bytes to the stream, the stream must be aligned.
+     */
+    void put_bytes(std::span<std::byte const> bytes) noexcept
+    {
+        hi_axiom(_nr_bits == 0);
+
+        reserve(bytes.size());
+        std::copy(bytes.begin(), bytes.end(), _out.begin() + _offset);
+        _offset += bytes.size();
+    }
+
+    /** Write the remaining bits and truncate the output.
+     */
+    void finish() noexcept
+    {
+        align();
+        _out.resize(_offset);
+    }
+
+private:
+    bstring& _out;
+    std::size_t _offset = 0;
+    uint64_t _bits = 0;
+    std::size_t _nr_bits = 0;
+
+    void reserve(std::size_t size) noexcept
+    {
+        if (_offset + size > _out.size()) {
+            _out.resize(std::max(_offset + size, _out.size() * 2 + 4096));
+        }
+    }
+};
+
+class deflate_compressor {
+public:
+    deflate_compressor(std::span<std::byte const> bytes, int level, bstring& out) noexcept :
+        _bytes(bytes), _config(deflate_configs[level]), _writer(out)
+    {
+        // Positions in the last 3 bytes can not be hashed.
+        _hash_end = _bytes.size() >= sizeof(uint32_t) ? _bytes.size() - (sizeof(uint32_t) - 1) : 0;
+    }
+
+    void compress() noexcept
+    {
+        if (_config.max_chain == 0) {
+            compress_stored();
+
+        } else {
+            _symbols.reserve(deflate_block_size);
+            _head.resize(deflate_hash_size);
+            _prev.resize(deflate_max_distance);
+
+            if (_config.lazy) {
+                compress_lazy();
+            } else {
+                compress_fast();
+            }
+            flush_block(_bytes.size(), true);
+        }
+
+        _writer.finish();
+    }
+
+private:
+    std::span<std::byte const> _bytes;
+    deflate_config _config;
+    deflate_bit_writer _writer;
+
+    /** The end of the positions which can be inserted in the hash-table.
+     */
+    std::size_t _hash_end = 0;
+
+    /** The position in the input of the first byte of the current segment.
+     */
+    std::size_t _segment = 0;
+
+    /** The most recent position for each hash value.
+     *
+     * Positions are stored as the offset from the start of the segment plus `deflate_max_distance + 1`.
+     * Which means zero is always out of the window.
+     */
+    std::vector<uint32_t> _head;
+
+    /** The previous position with the same hash value, for each position in the window.
+     */
+    std::vector<uint32_t> _prev;
+
+    std::vector<deflate_symbol> _symbols;
+    std::array<uint32_t, deflate_nr_literals> _literal_frequencies = {};
+    std::array<uint32_t, deflate_nr_distances> _distance_frequencies = {};
+
+    /** The position in the input of the first byte of the current block.
+     */
+    std::size_t _block_start = 0;
+
+    [[nodiscard]] uint32_t to_hash_position(std::size_t position) const noexcept
+    {
+        return narrow_cast<uint32_t>(position - _segment + deflate_max_distance + 1);
+    }
+
+    /** Start a new segment when the position does not fit in the hash-table.
+     */
+    void check_segment(std::size_t position) noexcept
+    {
+        if (position - _segment >= deflate_segment_size) {
+            _segment = position;
+            std::fill(_head.begin(), _head.end(), uint32_t{0});
+            std::fill(_prev.begin(), _prev.end(), uint32_t{0});
+        }
+    }
+
+    /** Insert a position into the hash-table.
+     *
+     * @return The previous position with the same hash, in hash-position coordinates.
+     */
+    hi_force_inline uint32_t insert(std::size_t position) noexcept
+    {
+        hi_axiom(position < _hash_end);
+
+        hilet value = load_le<uint32_t>(_bytes.data() + position) & 0xff'ffff;
+        hilet hash = (value * uint32_t{0x9e37'79b1}) >> (32 - deflate_hash_bits);
+
+        hilet hash_position = to_hash_position(position);
+        hilet r = _head[hash];
+        _head[hash] = hash_position;
+        _prev[hash_position & deflate_window_mask] = r;
+        return r;
+    }
+
+    /** Compare two strings and return the length of the common prefix.
+     */
+    [[nodiscard]] hi_force_inline static std::size_t
+    match_length(std::byte const *a, std::byte const *b, std::size_t max_length) noexcept
+    {
+        auto i = 0_uz;
+        for (; i + sizeof(uint64_t) <= max_length; i += sizeof(uint64_t)) {
+            if (hilet diff = load_le<uint64_t>(a + i) ^ load_le<uint64_t>(b + i)) {
+                return i + std::countr_zero(diff) / 8;
+            }
+        }
+        while (i != max_length and a[i] == b[i]) {
+            ++i;
+        }
+        return i;
+    }
+
+    /** Search the hash-chain for the longest match.
+     *
+     * @param position The position to find a match for.
+     * @param candidate The first position on the hash-chain, in hash-position coordinates.
+     * @param min_length Only matches longer than this are returned.
+     * @param max_chain The maximum number of entries on the hash-chain to check.
+     * @return The length and distance of the match, or zero when no longer match was found.
+     */
+    [[nodiscard]] std::pair<std::size_t, std::size_t>
+    longest_match(std::size_t position, uint32_t candidate, std::size_t min_length, std::size_t max_chain) const noexcept
+    {
+        hilet max_length = std::min(deflate_max_match, _bytes.size() - position);
+        if (max_length <= min_length) {
+            return {0, 0};
+        }
+
+        hilet hash_position = to_hash_position(position);
+        hilet src = _bytes.data() + position;
+
+        auto best_length = min_length;
+        auto best_distance = 0_uz;
+        while (max_chain-- != 0) {
+            hilet distance = hash_position - candidate;
+            if (distance > deflate_max_distance) {
+                break;
+            }
+
+            hilet match = src - distance;
+            // Quickly reject matches that are not longer than the best match.
+            if (match[best_length] == src[best_length] and match[0] == src[0]) {
+                hilet length = match_length(src, match, max_length);
+                if (length > best_length) {
+                    best_length = length;
+                    best_distance = distance;
+                    if (length >= _config.nice_length or length == max_length) {
+                        break;
+                    }
+                }
+            }
+
+            hilet next = _prev[candidate & deflate_window_mask];
+            if (next >= candidate) {
+                // The entry was overwritten by a position that was inserted later.
+                break;
+            }
+            candidate = next;
+        }
+
+        if (best_distance == 0 or (best_length == deflate_min_match and best_distance > deflate_too_far)) {
+            return {0, 0};
+        }
+        return {best_length, best_distance};
+    }
+
+    hi_force_inline void emit_literal(std::size_t position) noexcept
+    {
+        hilet value = std::to_integer<uint8_t>(_bytes[position]);
+        _symbols.push_back({0, value});
+        ++_literal_frequencies[value];
+
+        if (_symbols.size() == deflate_block_size) {
+            flush_block(position + 1, false);
+        }
+    }
+
+    hi_force_inline void emit_match(std::size_t position, std::size_t length, std::size_t distance) noexcept
+    {
+        hi_axiom(length >= deflate_min_match and length <= deflate_max_match);
+        hi_axiom(distance >= 1 and distance <= deflate_max_distance);
+
+        hilet value = length - deflate_min_match;
+        _symbols.push_back({narrow_cast<uint16_t>(distance), narrow_cast<uint8_t>(value)});
+        ++_literal_frequencies[257 + deflate_length_code(value)];
+        ++_distance_frequencies[deflate_distance_code(distance - 1)];
+
+        if (_symbols.size() == deflate_block_size) {
+            flush_block(position + length, false);
+        }
+    }
+
+    /** Compress by using the first match that is found.
+     */
+    void compress_fast() noexcept
+    {
+        auto position = 0_uz;
+        while (position != _bytes.size()) {
+            check_segment(position);
+
+            auto [length, distance] = std::pair{0_uz, 0_uz};
+            if (position < _hash_end) {
+                hilet candidate = insert(position);
+                std::tie(length, distance) = longest_match(position, candidate, deflate_min_match - 1, _config.max_chain);
+            }
+
+            if (length != 0) {
+                emit_match(position, length, distance);
+
+                if (length <= _config.lazy_length) {
+                    hilet end = std::min(position + length, _hash_end);
+                    for (auto i = position + 1; i < end; ++i) {
+                        insert(i);
+                    }
+                }
+                position += length;
+
+            } else {
+                emit_literal(position++);
+            }
+        }
+    }
+
+    /** Compress using lazy matching.
+     *
+     * A match is only emitted when the match at the next position is not longer.
+     */
+    void compress_lazy() noexcept
+    {
+        auto prev_length = 0_uz;
+        auto prev_distance = 0_uz;
+        auto match_available = false;
+
+        auto position = 0_uz;
+        while (position != _bytes.size()) {
+            check_segment(position);
+
+            auto [length, distance] = std::pair{0_uz, 0_uz};
+            if (position < _hash_end) {
+                hilet candidate = insert(position);
+                if (prev_length < _config.lazy_length) {
+                    hilet max_chain = prev_length >= _config.good_length ? _config.max_chain / 4 : _config.max_chain;
+                    std::tie(length, distance) =
+                        longest_match(position, candidate, std::max(prev_length, deflate_min_match - 1), max_chain);
+                }
+            }
+
+            if (prev_length != 0 and length <= prev_length) {
+                // The match at the previous position is the better one.
+                hilet start = position - 1;
+                emit_match(start, prev_length, prev_distance);
+
+                hilet end = std::min(start + prev_length, _hash_end);
+                for (auto i = position + 1; i < end; ++i) {
+                    insert(i);
+                }
+
+                position = start + prev_length;
+                prev_length = 0;
+                match_available = false;
+
+            } else {
+                if (match_available) {
+                    emit_literal(position - 1);
+                }
+                match_available = true;
+                prev_length = length;
+                prev_distance = distance;
+                ++position;
+            }
+        }
+
+        if (match_available) {
+            emit_literal(position - 1);
+        }
+    }
+
+    /** Copy the data in stored blocks.
+     */
+    void compress_stored() noexcept
+    {
+        write_stored(_bytes, true);
+    }
+
+    void write_stored(std::span<std::byte const> bytes, bool final) noexcept
+    {
+        do {
+            hilet size = std::min(bytes.size(), deflate_stored_size);
+            hilet last = size == bytes.size();
+
+            _writer.put(final and last ? 1 : 0, 1);
+            _writer.put(0, 2);
+            _writer.align();
+            _writer.put(size, 16);
+            _writer.put(size ^ 0xffff, 16);
+            _writer.put_bytes(bytes.first(size));
+
+            bytes = bytes.subspan(size);
+        } while (not bytes.empty());
+    }
+
+    /** The number of bits needed to write the symbols of the block with the given code lengths.
+     */
+    [[nodiscard]] std::size_t
+    data_size(std::span<uint8_t const> literal_lengths, std::span<uint8_t const> distance_lengths) const noexcept
+    {
+        auto r = 0_uz;
+        for (auto symbol = 0_uz; symbol != deflate_nr_literals; ++symbol) {
+            r += _literal_frequencies[symbol] * literal_lengths[symbol];
+            if (symbol > 256) {
+                r += _literal_frequencies[symbol] * deflate_length_extra(symbol - 257);
+            }
+        }
+        for (auto symbol = 0_uz; symbol != deflate_nr_distances; ++symbol) {
+            r += _distance_frequencies[symbol] * (distance_lengths[symbol] + deflate_distance_extra(symbol));
+        }
+        return r;
+    }
+
+    void write_symbols(
+        std::span<uint8_t const> literal_lengths,
+        std::span<uint16_t const> literal_codes,
+        std::span<uint8_t const> distance_lengths,
+        std::span<uint16_t const> distance_codes) noexcept
+    {
+        for (hilet symbol : _symbols) {
+            if (symbol.distance == 0) {
+                _writer.put(literal_codes[symbol.value], literal_lengths[symbol.value]);
+
+            } else {
+                hilet length_code = deflate_length_code(symbol.value);
+                _writer.put(literal_codes[257 + length_code], literal_lengths[257 + length_code]);
+                if (hilet extra = deflate_length_extra(length_code)) {
+                    _writer.put(symbol.value & ((1_uz << extra) - 1), extra);
+                }
+
+                hilet distance = symbol.distance - 1_uz;
+                hilet distance_code = deflate_distance_code(distance);
+                _writer.put(distance_codes[distance_code], distance_lengths[distance_code]);
+                if (hilet extra = deflate_distance_extra(distance_code)) {
+                    _writer.put(distance & ((1_uz << extra) - 1), extra);
+                }
+            }
+        }
+
+        // End of block.
+        _writer.put(literal_codes[256], literal_lengths[256]);
+    }
+
+    /** Write the symbols collected since the start of the block.
+     *
+     * @param end The position in the input directly after the last symbol.
+     * @param final True if this is the last block.
+     */
+    void flush_block(std::size_t end, bool final) noexcept
+    {
+        _literal_frequencies[256] = 1;
+
+        hilet literal_lengths = deflate_code_lengths(_literal_frequencies, 15);
+        hilet distance_lengths = deflate_code_lengths(_distance_frequencies, 15);
+
+        auto nr_literals = deflate_nr_literals;
+        while (nr_literals > 257 and literal_lengths[nr_literals - 1] == 0) {
+            --nr_literals;
+        }
+        auto nr_distances = deflate_nr_distances;
+        while (nr_distances > 1 and distance_lengths[nr_distances - 1] == 0) {
+            --nr_distances;
+        }
+
+        // Run-length encode the code lengths of both trees as a single sequence.
+        auto lengths = std::array<uint8_t, deflate_nr_literals + deflate_nr_distances>{};
+        std::copy_n(literal_lengths.begin(), nr_literals, lengths.begin());
+        std::copy_n(distance_lengths.begin(), nr_distances, lengths.begin() + nr_literals);
+        hilet nr_lengths = nr_literals + nr_distances;
+
+        auto code_length_symbols = std::vector<std::pair<uint8_t, uint8_t>>{};
+        auto code_length_frequencies = std::array<uint32_t, deflate_nr_code_lengths>{};
+        auto add_code_length_symbol = [&](std::size_t symbol, std::size_t extra) {
+            code_length_symbols.emplace_back(narrow_cast<uint8_t>(symbol), narrow_cast<uint8_t>(extra));
+            ++code_length_frequencies[symbol];
+        };
+
+        for (auto i = 0_uz; i != nr_lengths;) {
+            hilet length = lengths[i];
+            auto run = 1_uz;
+            while (i + run != nr_lengths and lengths[i + run] == length) {
+                ++run;
+            }
+            i += run;
+
+            if (length == 0) {
+                for (; run >= 11; run -= std::min(run, 138_uz)) {
+                    add_code_length_symbol(18, std::min(run, 138_uz) - 11);
+                }
+                if (run >= 3) {
+                    add_code_length_symbol(17, run - 3);
+                    run = 0;
+                }
+
+            } else {
+                add_code_length_symbol(length, 0);
+                --run;
+                for (; run >= 3; run -= std::min(run, 6_uz)) {
+                    add_code_length_symbol(16, std::min(run, 6_uz) - 3);
+                }
+            }
+
+            for (; run != 0; --run) {
+                add_code_length_symbol(length, 0);
+            }
+        }
+
+        hilet code_length_lengths = deflate_code_lengths(code_length_frequencies, 7);
+        auto nr_code_lengths = deflate_nr_code_lengths;
+        while (nr_code_lengths > 4 and code_length_lengths[deflate_code_length_order[nr_code_lengths - 1]] == 0) {
+            --nr_code_lengths;
+        }
+
+        // Calculate the size of each type of block.
+        auto dynamic_size = 5 + 5 + 4 + 3 * nr_code_lengths + data_size(literal_lengths, distance_lengths);
+        for (hilet[symbol, extra] : code_length_symbols) {
+            dynamic_size += code_length_lengths[symbol] + (symbol == 16 ? 2 : symbol == 17 ? 3 : symbol == 18 ? 7 : 0);
+        }
+        hilet fixed_size = data_size(deflate_fixed_literal_lengths, deflate_fixed_distance_lengths);
+        hilet nr_stored_bytes = end - _block_start;
+        hilet stored_size =
+            (nr_stored_bytes + 4 * std::max(1_uz, (nr_stored_bytes + deflate_stored_size - 1) / deflate_stored_size)) * 8 + 7;
+
+        if (stored_size <= dynamic_size and stored_size <= fixed_size) {
+            write_stored(_bytes.subspan(_block_start, nr_stored_bytes), final);
+
+        } else if (fixed_size <= dynamic_size) {
+            _writer.put(final ? 1 : 0, 1);
+            _writer.put(1, 2);
+            write_symbols(
+                deflate_fixed_literal_lengths, deflate_fixed_literal_codes, deflate_fixed_distance_lengths, deflate_fixed_distance_codes);
+
+        } else {
+            _writer.put(final ? 1 : 0, 1);
+            _writer.put(2, 2);
+            _writer.put(nr_literals - 257, 5);
+            _writer.put(nr_distances - 1, 5);
+            _writer.put(nr_code_lengths - 4, 4);
+            for (auto i = 0_uz; i != nr_code_lengths; ++i) {
+                _writer.put(code_length_lengths[deflate_code_length_order[i]], 3);
+            }
+
+            hilet code_length_codes = deflate_make_codes(code_length_lengths);
+            for (hilet[symbol, extra] : code_length_symbols) {
+                _writer.put(code_length_codes[symbol], code_length_lengths[symbol]);
+                switch (symbol) {
+                case 16: _writer.put(extra, 2); break;
+                case 17: _writer.put(extra, 3); break;
+                case 18: _writer.put(extra, 7); break;
+                default:;
+                }
+            }
+
+            write_symbols(literal_lengths, deflate_make_codes(literal_lengths), distance_lengths, deflate_make_codes(distance_lengths));
+        }
+
+        _symbols.clear();
+        _literal_frequencies = {};
+        _distance_frequencies = {};
+        _block_start = end;
+    }
+};
+
+bstring deflate(std::span<std::byte const> bytes, int level)
+{
+    hi_axiom(level >= 0 and level <= 9);
+
+    auto r = bstring{};
+    auto compressor = deflate_compressor{bytes, level, r};
+    compressor.compress();
+    return r;
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,89 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "deflate.hpp"
+#include "inflate.hpp"
+#include "zlib.hpp"
+#include "../file/file_view.hpp"
+#include "../utility/module.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <random>
+
+using namespace hi;
+
+/** Compress and decompress the data at every compression level.
+ */
+static void round_trip(bstring const& original)
+{
+    for (auto level = 0; level <= 9; ++level) {
+        hilet compressed = deflate(original, level);
+
+        auto offset = 0_uz;
+        hilet decompressed = inflate(compressed, offset, original.size() + 1);
+        ASSERT_EQ(decompressed, original) << "level " << level;
+        ASSERT_EQ(offset, compressed.size()) << "level " << level;
+    }
+}
+
+TEST(deflate, empty)
+{
+    round_trip(bstring{});
+}
+
+TEST(deflate, single_byte)
+{
+    round_trip(bstring{std::byte{'a'}});
+}
+
+TEST(deflate, repeated)
+{
+    // A run much longer than the maximum match length and the window size.
+    auto original = bstring(100'000, std::byte{'a'});
+    round_trip(original);
+
+    ASSERT_LT(deflate(original, 6).size(), 1'000);
+}
+
+TEST(deflate, random)
+{
+    auto engine = std::mt19937{42};
+    auto original = bstring{};
+    for (auto i = 0; i != 100'000; ++i) {
+        original += static_cast<std::byte>(engine() & 0xff);
+    }
+    round_trip(original);
+
+    // Random data can not be compressed, so stored blocks should be used.
+    ASSERT_LT(deflate(original, 6).size(), original.size() + 100);
+}
+
+TEST(deflate, low_entropy)
+{
+    // Short random matches over a small alphabet, with distances over the whole window.
+    auto engine = std::mt19937{42};
+    auto original = bstring{};
+    for (auto i = 0; i != 200'000; ++i) {
+        original += static_cast<std::byte>('a' + engine() % 4);
+    }
+    round_trip(original);
+}
+
+TEST(deflate, corpus)
+{
+    for (auto i = 1; i <= 8; ++i) {
+        hilet view = file_view{std::filesystem::path{std::format("gzip_test{}.bin", i)}};
+        round_trip(bstring{as_bstring_view(view)});
+    }
+}
+
+TEST(deflate, zlib)
+{
+    hilet view = file_view{std::filesystem::path{"gzip_test3.bin"}};
+    hilet original = bstring{as_bstring_view(view)};
+
+    for (auto level = 0; level <= 9; ++level) {
+        ASSERT_EQ(zlib_decompress(zlib_compress(original, level), original.size() + 1), original);
+    }
+}
@@ -6,11 +6,19 @@
 
 #include "../byte_string.hpp"
 #include "../file/file_view.hpp"
+#include "../generator.hpp"
 #include <cstddef>
 #include <filesystem>
 
 namespace hi::inline v1 {
 
+/** Decompress a gzip file.
+ *
+ * @param bytes The gzip compressed data, which may consist of multiple members.
+ * @param max_size The maximum size of the decompressed data.
+ * @return The decompressed data.
+ * @throw parse_error When the compressed data is invalid, or the decompressed data is too large.
+ */
 bstring gzip_decompress(std::span<std::byte const> bytes, std::size_t max_size = 0x01000000);
 
 inline bstring gzip_decompress(std::filesystem::path const &path, std::size_t max_size = 0x01000000)
@@ -18,4 +26,27 @@ inline bstring gzip_decompress(std::filesystem::path const &path, std::size_t ma
     return gzip_decompress(as_span<std::byte const>(file_view{path}), max_size);
 }
 
+/** Decompress a gzip file in chunks.
+ *
+ * The decompressed data is produced in chunks of at most 32 KiB, so that
+ * memory use is independent of the size of the decompressed data.
+ *
+ * @param bytes The gzip compressed data, which may consist of multiple members.
+ * @param max_size The maximum size of the decompressed data.
+ * @return A generator yielding the decompressed chunks, a chunk is only valid
+ *         until the generator is resumed.
+ * @throw parse_error When the compressed data is invalid, or the decompressed data is too large.
+ */
+generator<bstring_view> gzip_decompress_chunks(std::span<std::byte const> bytes, std::size_t max_size = 0x01000000);
+
+/** Decompress a gzip file in chunks.
+ *
+ * @param path The path to the gzip file.
+ * @param max_size The maximum size of the decompressed data.
+ * @return A generator yielding the decompressed chunks, a chunk is only valid
+ *         until the generator is resumed.
+ * @throw parse_error When the compressed data is invalid, or the decompressed data is too large.
+ */
+generator<bstring_view> gzip_decompress_chunks(std::filesystem::path const &path, std::size_t max_size = 0x01000000);
+
 } // namespace hi::inline v1
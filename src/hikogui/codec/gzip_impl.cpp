@@ -24,7 +24,7 @@ struct GZIPMemberHeader {
     uint8_t OS;
 };
 
-static bstring gzip_decompress_member(std::span<std::byte const> bytes, std::size_t &offset, std::size_t max_size)
+static void gzip_decompress_member_header(std::span<std::byte const> bytes, std::size_t &offset)
 {
     hilet header = make_placement_ptr<GZIPMemberHeader>(bytes, offset);
 
@@ -63,15 +63,23 @@ static bstring gzip_decompress_member(std::span<std::byte const> bytes, std::siz
     if (FHCRC) {
         [[maybe_unused]] hilet CRC16 = make_placement_ptr<little_uint16_buf_t>(bytes, offset);
     }
+}
 
-    auto r = inflate(bytes, offset, max_size);
-
+static void gzip_decompress_member_trailer(std::span<std::byte const> bytes, std::size_t &offset, std::size_t member_size)
+{
     [[maybe_unused]] auto CRC32 = **make_placement_ptr<little_uint32_buf_t>(bytes, offset);
     [[maybe_unused]] auto ISIZE = **make_placement_ptr<little_uint32_buf_t>(bytes, offset);
 
     hi_check(
-        ISIZE == (size(r) & 0xffffffff),
+        ISIZE == (member_size & 0xffffffff),
         "GZIP Member header ISIZE must be same as the lower 32 bits of the inflated size.");
+}
+
+static bstring gzip_decompress_member(std::span<std::byte const> bytes, std::size_t &offset, std::size_t max_size)
+{
+    gzip_decompress_member_header(bytes, offset);
+    auto r = inflate(bytes, offset, max_size);
+    gzip_decompress_member_trailer(bytes, offset, r.size());
     return r;
 }
 
@@ -89,6 +97,43 @@ bstring gzip_decompress(std::span<std::byte const> bytes, std::size_t max_size)
     return r;
 }
 
+generator<bstring_view> gzip_decompress_chunks(std::span<std::byte const> bytes, std::size_t max_size)
+{
+    auto buffer = bstring(inflate_decoder::history_size, std::byte{0});
+
+    auto offset = 0_uz;
+    while (offset < bytes.size()) {
+        gzip_decompress_member_header(bytes, offset);
+
+        auto decoder = inflate_decoder{};
+        auto member_size = 0_uz;
+        while (not decoder.done()) {
+            hilet[consumed, produced] = decoder.decode(bytes.subspan(offset), buffer);
+            offset += consumed;
+            member_size += produced;
+
+            hi_check(decoder.done() or produced == buffer.size(), "Input buffer overrun");
+            hi_check(produced <= max_size, "Output buffer overrun");
+            max_size -= produced;
+
+            if (produced != 0) {
+                co_yield bstring_view{buffer.data(), produced};
+            }
+        }
+
+        gzip_decompress_member_trailer(bytes, offset, member_size);
+    }
+}
+
+generator<bstring_view> gzip_decompress_chunks(std::filesystem::path const &path, std::size_t max_size)
+{
+    // The file-view must be kept alive inside the coroutine frame.
+    hilet view = file_view{path};
+    for (hilet chunk : gzip_decompress_chunks(as_span<std::byte const>(view), max_size)) {
+        co_yield chunk;
+    }
+}
+
 } // namespace hi::inline v1
 
 hi_warning_pop();
@@ -2,6 +2,7 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 #include "gzip.hpp"
+#include "inflate.hpp"
 #include "../file/file_view.hpp"
 #include "../utility/module.hpp"
 #include <gtest/gtest.h>
@@ -123,3 +124,45 @@ TEST(GZip, UnzipXargs1)
         ASSERT_EQ(decompressed[i], original_bytes[i]);
     }
 }
+
+TEST(GZip, UnzipChunks)
+{
+    hilet original = file_view{"gzip_test4.bin"};
+    hilet original_bytes = as_bstring_view(original);
+
+    auto decompressed = bstring{};
+    for (hilet chunk : gzip_decompress_chunks(std::filesystem::path{"gzip_test4.bin.gz"})) {
+        ASSERT_LE(chunk.size(), inflate_decoder::history_size);
+        decompressed.append(chunk);
+    }
+
+    ASSERT_EQ(decompressed, original_bytes);
+}
+
+TEST(GZip, InflateStreaming)
+{
+    // Feed the compressed data a single byte at a time into a small output buffer,
+    // to test resuming the decoder at any position in the stream.
+    hilet compressed = file_view{"gzip_test4.bin.gz"};
+    hilet compressed_bytes = as_span<std::byte const>(compressed);
+    hilet original = file_view{"gzip_test4.bin"};
+    hilet original_bytes = as_bstring_view(original);
+
+    // gzip_test4.bin.gz has a header with a file name.
+    auto offset = 10_uz;
+    while (compressed_bytes[offset++] != std::byte{0}) {}
+
+    auto decoder = inflate_decoder{};
+    auto buffer = std::array<std::byte, 7>{};
+    auto decompressed = bstring{};
+    while (not decoder.done()) {
+        ASSERT_LT(offset, compressed_bytes.size());
+        hilet[consumed, produced] = decoder.decode(compressed_bytes.subspan(offset, 1), buffer);
+        offset += consumed;
+        decompressed.append(buffer.data(), produced);
+    }
+
+    ASSERT_EQ(decompressed, original_bytes);
+    // The CRC32 and ISIZE of the trailer are not consumed.
+    ASSERT_EQ(offset + 8, compressed_bytes.size());
+}
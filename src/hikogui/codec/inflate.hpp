@@ -6,21 +6,143 @@
 
 #include "../utility/module.hpp"
 #include "../byte_string.hpp"
+#include "../huffman.hpp"
 #include <span>
+#include <array>
+#include <vector>
 
 namespace hi::inline v1 {
 
+/** A streaming decoder for data compressed with the deflate algorithm.
+ *
+ * Compressed data is passed to the decoder in chunks of any size, and decompressed
+ * data is written into an output buffer provided by the caller. The decoder keeps
+ * a sliding window with the last 32 KiB of history, so that memory use is independent
+ * of the size of the compressed and decompressed data.
+ */
+class inflate_decoder {
+public:
+    /** The maximum distance of a match, and therefor the size of the history.
+     */
+    constexpr static std::size_t history_size = 32768;
+
+    struct result_type {
+        /** The number of bytes consumed from the input.
+         */
+        std::size_t consumed = 0;
+
+        /** The number of bytes written to the output.
+         */
+        std::size_t produced = 0;
+    };
+
+    inflate_decoder();
+    inflate_decoder(inflate_decoder const&) = default;
+    inflate_decoder(inflate_decoder&&) noexcept = default;
+    inflate_decoder& operator=(inflate_decoder const&) = default;
+    inflate_decoder& operator=(inflate_decoder&&) noexcept = default;
+
+    /** Check if the last block was decoded and all data was written to the output.
+     */
+    [[nodiscard]] bool done() const noexcept
+    {
+        return _state == state_type::done and _flushed == _write;
+    }
+
+    /** Decode a chunk of compressed data.
+     *
+     * Decoding stops when the output buffer is full, when all input is consumed or
+     * when the end of the deflate stream is reached.
+     *
+     * When the output buffer was not filled and the decoder is not done,
+     * then all input was consumed and the decoder needs more input.
+     * Otherwise the bytes that were not consumed need to be passed again on the next call.
+     *
+     * When the decoder is done, the bytes directly following the deflate stream
+     * were not consumed, such as the trailer of the zlib or gzip format.
+     *
+     * @param input The next chunk of compressed data.
+     * @param output The buffer to write the decompressed data into.
+     * @return The number of bytes consumed from the input and written to the output.
+     * @throw parse_error When the compressed data is invalid.
+     */
+    result_type decode(std::span<std::byte const> input, std::span<std::byte> output);
+
+private:
+    using table_type = huffman_table<uint16_t>;
+
+    enum class state_type : uint8_t {
+        block_header,
+        stored_header,
+        stored_data,
+        dynamic_header,
+        code_lengths,
+        lengths,
+        block_data,
+        done
+    };
+
+    state_type _state = state_type::block_header;
+    bool _final_block = false;
+    bool _fixed_tables = false;
+
+    /** Bit buffer, the first bit of the stream is in the LSB.
+     */
+    uint64_t _bits = 0;
+    std::size_t _nr_bits = 0;
+
+    /** The input of the current call to `decode()`.
+     */
+    std::byte const *_input_first = nullptr;
+    std::byte const *_input_ptr = nullptr;
+    std::byte const *_input_last = nullptr;
+
+    std::size_t _stored_size = 0;
+    std::size_t _nr_literals = 0;
+    std::size_t _nr_distances = 0;
+    std::size_t _nr_code_lengths = 0;
+    std::array<uint8_t, 19> _code_length_lengths = {};
+    std::vector<uint8_t> _lengths = {};
+    table_type _code_length_table = {};
+    table_type _literal_table = {};
+    table_type _distance_table = {};
+
+    /** The sliding window.
+     * The window holds the history followed by data that has not been written to the output yet.
+     */
+    bstring _window = {};
+
+    /** The offset in the window up to where data has been written to the output.
+     */
+    std::size_t _flushed = 0;
+
+    /** The offset in the window where the next decompressed byte is written.
+     */
+    std::size_t _write = 0;
+
+    void pull() noexcept;
+    void unpull() noexcept;
+    [[nodiscard]] bool need_bits(std::size_t nr_bits) noexcept;
+    [[nodiscard]] std::size_t get_bits(std::size_t nr_bits) noexcept;
+    void flush(std::span<std::byte> output, std::size_t& produced) noexcept;
+    void slide() noexcept;
+    [[nodiscard]] bool decode_block_header();
+    [[nodiscard]] bool decode_stored_header();
+    [[nodiscard]] bool decode_stored_data();
+    [[nodiscard]] bool decode_dynamic_header();
+    [[nodiscard]] bool decode_code_lengths();
+    [[nodiscard]] bool decode_lengths();
+    [[nodiscard]] bool decode_block_data(std::size_t room);
+};
+
 /** Inflate compressed data using the deflate algorithm
- * `bytes` should include at least 32 bit of trailer, for the overflow check which
- * will slightly overrun the actual compressed data for performance reasons.
  *
- * - gzip has a CRC32+ISIZE trailer.
- *   Since gzip has no end-of-segment indicator, we need to include the trailer
- *   in the byte array passed to inflate anyway.
- * - zlib has a 32 bit check value.
- *   Since zlib has no end-of-segment indicator, we need to include the trailer
- *   in the byte array passed to inflate anyway.
- * - png IDAT chunks include the full zlib-format, including the 32 bit check value.
+ * @param bytes The compressed data.
+ * @param[in,out] offset The byte offset of the deflate stream in `bytes`, on return
+ *                       the offset of the first byte after the deflate stream.
+ * @param max_size The maximum size of the decompressed data.
+ * @return The decompressed data.
+ * @throw parse_error When the compressed data is invalid, or the decompressed data is too large.
  */
 bstring inflate(std::span<std::byte const> bytes, std::size_t &offset, std::size_t max_size = 0x0100'0000);
 
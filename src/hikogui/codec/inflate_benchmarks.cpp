@@ -0,0 +1,102 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gzip.hpp"
+#include "../huffman.hpp"
+#include "../huffman_tests.hpp"
+#include "../file/file_view.hpp"
+#include "../utility/module.hpp"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <array>
+#include <format>
+
+using namespace hi;
+
+/** The fixed literal/length code lengths of deflate.
+ */
+[[nodiscard]] static std::vector<uint8_t> fixed_literal_lengths()
+{
+    auto r = std::vector<uint8_t>{};
+    r.insert(r.end(), 144, uint8_t{8});
+    r.insert(r.end(), 112, uint8_t{9});
+    r.insert(r.end(), 24, uint8_t{7});
+    r.insert(r.end(), 8, uint8_t{8});
+    return r;
+}
+
+/** Encode a fixed corpus of symbols with the canonical huffman code described by lengths.
+ */
+[[nodiscard]] static std::vector<std::byte> huffman_corpus(std::vector<uint8_t> const& lengths, std::size_t nr_symbols)
+{
+    auto symbols = std::vector<std::size_t>{};
+    symbols.reserve(nr_symbols);
+    for (auto i = 0_uz; i != nr_symbols; ++i) {
+        symbols.push_back((i * 7919) % lengths.size());
+    }
+
+    auto r = huffman_encode(lengths, symbols);
+
+    // Padding for the decoders, which read ahead of the current bit offset.
+    r.insert(r.end(), 8, std::byte{0});
+    return r;
+}
+
+constexpr std::size_t huffman_corpus_size = 100'000;
+
+static void huffman_tree_get_symbol(benchmark::State& state)
+{
+    hilet lengths = fixed_literal_lengths();
+    hilet bytes = huffman_corpus(lengths, huffman_corpus_size);
+    hilet tree = huffman_tree<int16_t>::from_lengths(lengths);
+
+    for (auto _ : state) {
+        auto bit_offset = 0_uz;
+        for (auto i = 0_uz; i != huffman_corpus_size; ++i) {
+            benchmark::DoNotOptimize(tree.get_symbol(bytes, bit_offset));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * huffman_corpus_size);
+}
+BENCHMARK(huffman_tree_get_symbol);
+
+/** Decode symbols with a table lookup on a 64-bit bit-buffer, like `inflate_decoder` does.
+ */
+static void huffman_table_decode(benchmark::State& state)
+{
+    hilet lengths = fixed_literal_lengths();
+    hilet bytes = huffman_corpus(lengths, huffman_corpus_size);
+    hilet table = huffman_table<uint16_t>::from_lengths(lengths);
+
+    for (auto _ : state) {
+        auto bit_offset = 0_uz;
+        for (auto i = 0_uz; i != huffman_corpus_size; ++i) {
+            hilet bits = load_le<uint64_t>(bytes.data() + bit_offset / 8) >> (bit_offset % 8);
+            hilet& entry = table.decode(bits);
+            bit_offset += entry.length;
+            benchmark::DoNotOptimize(entry.value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * huffman_corpus_size);
+}
+BENCHMARK(huffman_table_decode);
+
+/** Decompress the canterbury corpus files from the test data.
+ */
+static void gzip_decompress_corpus(benchmark::State& state)
+{
+    hilet path = std::format("gzip_test{}.bin.gz", state.range(0));
+    hilet view = file_view{std::filesystem::path{path}};
+    hilet bytes = as_span<std::byte const>(view);
+
+    auto size = 0_uz;
+    for (auto _ : state) {
+        hilet decompressed = gzip_decompress(bytes);
+        size = decompressed.size();
+        benchmark::DoNotOptimize(decompressed.data());
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+    state.SetLabel(path);
+}
+BENCHMARK(gzip_decompress_corpus)->DenseRange(4, 8);
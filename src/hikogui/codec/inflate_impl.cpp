@@ -3,151 +3,38 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "inflate.hpp"
-#include "../bits.hpp"
-#include "../placement.hpp"
 #include "../huffman.hpp"
 #include <array>
+#include <cstring>
 
 namespace hi::inline v1 {
 
-static void inflate_copy_block(std::span<std::byte const> bytes, std::size_t &bit_offset, std::size_t max_size, bstring &r)
-{
-    auto offset = (bit_offset + 7) / 8;
-
-    auto LEN = **make_placement_ptr<little_uint16_buf_t>(bytes, offset);
-    [[maybe_unused]] auto NLEN = **make_placement_ptr<little_uint16_buf_t>(bytes, offset);
-
-    hi_check((offset + LEN) <= bytes.size(), "input buffer overrun");
-    hi_check((r.size() + LEN) <= max_size, "output buffer overrun");
-    r.append(&bytes[offset], LEN);
-
-    bit_offset = offset * 8;
-}
+using inflate_table = huffman_table<uint16_t>;
 
-[[nodiscard]] static std::size_t inflate_decode_length(std::span<std::byte const> bytes, std::size_t &bit_offset, std::size_t symbol)
-{
-    switch (symbol) {
-    case 257: return 3;
-    case 258: return 4;
-    case 259: return 5;
-    case 260: return 6;
-    case 261: return 7;
-    case 262: return 8;
-    case 263: return 9;
-    case 264: return 10;
-    case 265: return get_bits(bytes, bit_offset, 1) + 11;
-    case 266: return get_bits(bytes, bit_offset, 1) + 13;
-    case 267: return get_bits(bytes, bit_offset, 1) + 15;
-    case 268: return get_bits(bytes, bit_offset, 1) + 17;
-    case 269: return get_bits(bytes, bit_offset, 2) + 19;
-    case 270: return get_bits(bytes, bit_offset, 2) + 23;
-    case 271: return get_bits(bytes, bit_offset, 2) + 27;
-    case 272: return get_bits(bytes, bit_offset, 2) + 31;
-    case 273: return get_bits(bytes, bit_offset, 3) + 35;
-    case 274: return get_bits(bytes, bit_offset, 3) + 43;
-    case 275: return get_bits(bytes, bit_offset, 3) + 51;
-    case 276: return get_bits(bytes, bit_offset, 3) + 59;
-    case 277: return get_bits(bytes, bit_offset, 4) + 67;
-    case 278: return get_bits(bytes, bit_offset, 4) + 83;
-    case 279: return get_bits(bytes, bit_offset, 4) + 99;
-    case 280: return get_bits(bytes, bit_offset, 4) + 115;
-    case 281: return get_bits(bytes, bit_offset, 5) + 131;
-    case 282: return get_bits(bytes, bit_offset, 5) + 163;
-    case 283: return get_bits(bytes, bit_offset, 5) + 195;
-    case 284: return get_bits(bytes, bit_offset, 5) + 227;
-    case 285: return 258;
-    default: throw parse_error(std::format("Literal/Length symbol out of range {}", symbol));
-    }
-}
+/** The maximum length of a match.
+ */
+constexpr std::size_t inflate_max_match = 258;
 
-[[nodiscard]] static std::size_t inflate_decode_distance(std::span<std::byte const> bytes, std::size_t &bit_offset, std::size_t symbol)
-{
-    switch (symbol) {
-    case 0: return 1;
-    case 1: return 2;
-    case 2: return 3;
-    case 3: return 4;
-    case 4: return get_bits(bytes, bit_offset, 1) + 5;
-    case 5: return get_bits(bytes, bit_offset, 1) + 7;
-    case 6: return get_bits(bytes, bit_offset, 2) + 9;
-    case 7: return get_bits(bytes, bit_offset, 2) + 13;
-    case 8: return get_bits(bytes, bit_offset, 3) + 17;
-    case 9: return get_bits(bytes, bit_offset, 3) + 25;
-    case 10: return get_bits(bytes, bit_offset, 4) + 33;
-    case 11: return get_bits(bytes, bit_offset, 4) + 49;
-    case 12: return get_bits(bytes, bit_offset, 5) + 65;
-    case 13: return get_bits(bytes, bit_offset, 5) + 97;
-    case 14: return get_bits(bytes, bit_offset, 6) + 129;
-    case 15: return get_bits(bytes, bit_offset, 6) + 193;
-    case 16: return get_bits(bytes, bit_offset, 7) + 257;
-    case 17: return get_bits(bytes, bit_offset, 7) + 385;
-    case 18: return get_bits(bytes, bit_offset, 8) + 513;
-    case 19: return get_bits(bytes, bit_offset, 8) + 769;
-    case 20: return get_bits(bytes, bit_offset, 9) + 1025;
-    case 21: return get_bits(bytes, bit_offset, 9) + 1537;
-    case 22: return get_bits(bytes, bit_offset, 10) + 2049;
-    case 23: return get_bits(bytes, bit_offset, 10) + 3073;
-    case 24: return get_bits(bytes, bit_offset, 11) + 4097;
-    case 25: return get_bits(bytes, bit_offset, 11) + 6145;
-    case 26: return get_bits(bytes, bit_offset, 12) + 8193;
-    case 27: return get_bits(bytes, bit_offset, 12) + 12289;
-    case 28: return get_bits(bytes, bit_offset, 13) + 16385;
-    case 29: return get_bits(bytes, bit_offset, 13) + 24577;
-    default: throw parse_error(std::format("Distance symbol out of range {}", symbol));
-    }
-}
+/** The window holds two times the history, so that the window only needs to slide
+ * once every 32 KiB. The extra space at the end of the window allows a match to
+ * be copied a word at a time, and overrun the end of the match.
+ */
+constexpr std::size_t inflate_window_size = 2 * inflate_decoder::history_size + inflate_max_match + sizeof(uint64_t);
 
-static void inflate_block(
-    std::span<std::byte const> bytes,
-    std::size_t &bit_offset,
-    std::size_t max_size,
-    huffman_tree<int16_t> const &literal_tree,
-    huffman_tree<int16_t> const &distance_tree,
-    bstring &r)
-{
-    while (true) {
-        // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-        // - 15 bits maximum huffman code.
-        // -  5 bits extra length.
-        // -  7 bits rounding up to byte.
-        hi_check(((bit_offset + 27) >> 3) <= bytes.size(), "Input buffer overrun");
+constexpr auto inflate_length_base = std::array<uint16_t, 29>{3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                                              31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
 
-        hilet literal_symbol = literal_tree.get_symbol(bytes, bit_offset);
+constexpr auto inflate_length_extra =
+    std::array<uint8_t, 29>{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
 
-        if (literal_symbol <= 255) {
-            hi_check(r.size() < max_size, "Output buffer overrun");
-            r.push_back(static_cast<std::byte>(literal_symbol));
+constexpr auto inflate_distance_base =
+    std::array<uint16_t, 30>{1,   2,   3,   4,   5,   7,    9,    13,   17,   25,   33,   49,   65,    97,    129,
+                             193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
 
-        } else if (literal_symbol == 256) {
-            // End-of-block.
-            return;
+constexpr auto inflate_distance_extra =
+    std::array<uint8_t, 30>{0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
 
-        } else {
-            hilet length = inflate_decode_length(bytes, bit_offset, literal_symbol);
-            hi_check(r.size() + length <= max_size, "Output buffer overrun");
-
-            // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-            // - 15 bits maximum huffman code.
-            // -  7 bits rounding up to byte.
-            hi_check(((bit_offset + 22) >> 3) <= bytes.size(), "Input buffer overrun");
-            hilet distance_symbol = distance_tree.get_symbol(bytes, bit_offset);
-
-            // Test only every inflate_decode_distance, the trailer is at least 32 bits (Checksum)
-            // - 13 bits extra length.
-            // -  7 bits rounding up to byte.
-            hi_check(((bit_offset + 20) >> 3) <= bytes.size(), "Input buffer overrun");
-            hilet distance = inflate_decode_distance(bytes, bit_offset, distance_symbol);
-
-            hi_check(distance <= r.size(), "Distance beyond start of decompressed data");
-            auto src_i = r.size() - distance;
-            for (auto i = 0; i != length; ++i) {
-                r.push_back(r[src_i++]);
-            }
-        }
-    }
-}
-
-huffman_tree<int16_t> deflate_fixed_literal_tree = []() {
+inflate_table deflate_fixed_literal_table = []() {
     std::vector<uint8_t> lengths;
 
     for (int i = 0; i <= 143; ++i) {
@@ -163,134 +50,447 @@ huffman_tree<int16_t> deflate_fixed_literal_tree = []() {
         lengths.push_back(8);
     }
 
-    return huffman_tree<int16_t>::from_lengths(lengths);
+    return inflate_table::from_lengths(lengths);
 }();
 
-huffman_tree<int16_t> deflate_fixed_distance_tree = []() {
+inflate_table deflate_fixed_distance_table = []() {
     std::vector<uint8_t> lengths;
 
     for (int i = 0; i <= 31; ++i) {
         lengths.push_back(5);
     }
 
-    return huffman_tree<int16_t>::from_lengths(lengths);
+    return inflate_table::from_lengths(lengths);
 }();
 
-static void inflate_fixed_block(std::span<std::byte const> bytes, std::size_t &bit_offset, std::size_t max_size, bstring &r)
+/** Copy a match from earlier in the window.
+ *
+ * @param dst The position in the window to copy the match to.
+ * @param distance The distance backward from @a dst to copy from.
+ * @param length The number of bytes to copy.
+ */
+hi_force_inline static void inflate_copy_match(std::byte *dst, std::size_t distance, std::size_t length) noexcept
+{
+    hi_axiom_not_null(dst);
+    auto src = dst - distance;
+
+    if (distance >= sizeof(uint64_t)) {
+        // Each word is read before it is overwritten, since the source is at least a word behind.
+        // This may write up to 7 bytes beyond the match into the slack of the window.
+        hilet end = dst + length;
+        do {
+            std::memcpy(dst, src, sizeof(uint64_t));
+            dst += sizeof(uint64_t);
+            src += sizeof(uint64_t);
+        } while (dst < end);
+
+    } else if (distance == 1) {
+        std::memset(dst, std::to_integer<int>(*src), length);
+
+    } else {
+        // Overlapping short distance, repeat the pattern byte by byte.
+        for (auto i = 0_uz; i != length; ++i) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+/** Check if the entry found in a table is a complete code.
+ *
+ * @param entry The entry found in the table.
+ * @param nr_bits The number of valid bits that where used to find the entry.
+ * @return True if the code is complete, false if more bits are needed.
+ * @throw parse_error When the code is not in the table.
+ */
+[[nodiscard]] hi_force_inline static bool inflate_check_code(inflate_table::entry_type const& entry, std::size_t nr_bits)
+{
+    if (entry.length == 0) [[unlikely]] {
+        // The code may become valid when more bits are available.
+        hi_check(nr_bits < inflate_table::max_code_length, "Code not in huffman table.");
+        return false;
+    }
+    return entry.length <= nr_bits;
+}
+
+inflate_decoder::inflate_decoder() : _window(inflate_window_size, std::byte{0}) {}
+
+/** Fill the bit buffer from the input.
+ */
+hi_force_inline void inflate_decoder::pull() noexcept
+{
+    if (_input_last - _input_ptr >= narrow_cast<ptrdiff_t>(sizeof(uint64_t))) [[likely]] {
+        // The bits of a partially loaded byte are loaded again, with the same value, on the next pull.
+        _bits |= load_le<uint64_t>(_input_ptr) << _nr_bits;
+        hilet nr_bytes = (63 - _nr_bits) >> 3;
+        _input_ptr += nr_bytes;
+        _nr_bits += nr_bytes * CHAR_BIT;
+
+    } else {
+        while (_nr_bits < 56 and _input_ptr != _input_last) {
+            _bits |= std::to_integer<uint64_t>(*_input_ptr++) << _nr_bits;
+            _nr_bits += CHAR_BIT;
+        }
+    }
+}
+
+/** Return the whole bytes in the bit buffer that were pulled from the current input.
+ */
+void inflate_decoder::unpull() noexcept
+{
+    hilet nr_bytes = std::min(_nr_bits / CHAR_BIT, narrow_cast<std::size_t>(_input_ptr - _input_first));
+    _input_ptr -= nr_bytes;
+    _nr_bits -= nr_bytes * CHAR_BIT;
+    _bits &= _nr_bits == 0 ? uint64_t{0} : ~uint64_t{0} >> (64 - _nr_bits);
+}
+
+[[nodiscard]] hi_force_inline bool inflate_decoder::need_bits(std::size_t nr_bits) noexcept
+{
+    if (_nr_bits < nr_bits) {
+        pull();
+    }
+    return _nr_bits >= nr_bits;
+}
+
+[[nodiscard]] hi_force_inline std::size_t inflate_decoder::get_bits(std::size_t nr_bits) noexcept
+{
+    hi_axiom(nr_bits <= _nr_bits);
+
+    hilet r = narrow_cast<std::size_t>(_bits & ((uint64_t{1} << nr_bits) - 1));
+    _bits >>= nr_bits;
+    _nr_bits -= nr_bits;
+    return r;
+}
+
+void inflate_decoder::flush(std::span<std::byte> output, std::size_t& produced) noexcept
+{
+    hilet size = std::min(_write - _flushed, output.size() - produced);
+    std::memcpy(output.data() + produced, _window.data() + _flushed, size);
+    _flushed += size;
+    produced += size;
+}
+
+void inflate_decoder::slide() noexcept
+{
+    hi_axiom(_flushed == _write);
+    hi_axiom(_write >= history_size);
+
+    std::memmove(_window.data(), _window.data() + _write - history_size, history_size);
+    _write = history_size;
+    _flushed = history_size;
+}
+
+bool inflate_decoder::decode_block_header()
+{
+    if (not need_bits(3)) {
+        return false;
+    }
+
+    _final_block = to_bool(get_bits(1));
+    switch (get_bits(2)) {
+    case 0: _state = state_type::stored_header; break;
+    case 1:
+        _fixed_tables = true;
+        _state = state_type::block_data;
+        break;
+    case 2: _state = state_type::dynamic_header; break;
+    default: throw parse_error("Reserved block type");
+    }
+    return true;
+}
+
+bool inflate_decoder::decode_stored_header()
+{
+    // Skip to the next byte boundary.
+    std::ignore = get_bits(_nr_bits % CHAR_BIT);
+
+    if (not need_bits(32)) {
+        return false;
+    }
+
+    hilet LEN = get_bits(16);
+    hilet NLEN = get_bits(16);
+    hi_check(LEN == (~NLEN & 0xffff), "Stored block length does not match its complement");
+
+    _stored_size = LEN;
+    _state = state_type::stored_data;
+    return true;
+}
+
+bool inflate_decoder::decode_stored_data()
 {
-    inflate_block(bytes, bit_offset, max_size, deflate_fixed_literal_tree, deflate_fixed_distance_tree, r);
+    // The bit buffer is byte aligned and may have bytes pulled from the input already.
+    while (_stored_size != 0 and _nr_bits != 0 and _write < 2 * history_size) {
+        _window[_write++] = static_cast<std::byte>(get_bits(CHAR_BIT));
+        --_stored_size;
+    }
+
+    if (_nr_bits == 0) {
+        // The bit buffer may hold bits of a partially pulled byte, which is now copied directly.
+        _bits = 0;
+
+        hilet size = std::min(
+            {_stored_size, narrow_cast<std::size_t>(_input_last - _input_ptr), 2 * history_size - std::min(_write, 2 * history_size)});
+        std::memcpy(_window.data() + _write, _input_ptr, size);
+        _input_ptr += size;
+        _write += size;
+        _stored_size -= size;
+    }
+
+    if (_stored_size == 0) {
+        _state = _final_block ? state_type::done : state_type::block_header;
+        return true;
+    }
+
+    // Return true when the window is full, so that it can be flushed.
+    return _write >= 2 * history_size;
 }
 
-[[nodiscard]] static huffman_tree<int16_t>
-inflate_code_lengths(std::span<std::byte const> bytes, std::size_t &bit_offset, std::size_t nr_symbols)
+bool inflate_decoder::decode_dynamic_header()
+{
+    if (not need_bits(14)) {
+        return false;
+    }
+
+    _nr_literals = get_bits(5) + 257;
+    _nr_distances = get_bits(5) + 1;
+    _nr_code_lengths = get_bits(4) + 4;
+
+    _code_length_lengths = {};
+    _lengths.clear();
+    _state = state_type::code_lengths;
+    return true;
+}
+
+bool inflate_decoder::decode_code_lengths()
 {
     // The symbols are in different order in the table.
-    constexpr auto symbols = std::array<int16_t,19>{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    constexpr auto symbols = std::array<uint8_t, 19>{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
 
-    hi_check(((bit_offset + (3 * static_cast<std::size_t>(nr_symbols)) + 7) >> 3) <= bytes.size(), "Input buffer overrun");
+    // The index of the next code length is stored in the size of _lengths.
+    while (_lengths.size() != _nr_code_lengths) {
+        if (not need_bits(3)) {
+            return false;
+        }
 
-    auto lengths = std::vector<uint8_t>(symbols.size(), 0);
-    for (auto i = 0_uz; i != nr_symbols; ++i) {
-        hilet symbol = symbols[i];
-        lengths[symbol] = narrow_cast<uint8_t>(get_bits(bytes, bit_offset, 3));
+        _code_length_lengths[symbols[_lengths.size()]] = narrow_cast<uint8_t>(get_bits(3));
+        _lengths.push_back(0);
     }
-    return huffman_tree<int16_t>::from_lengths(std::move(lengths));
+
+    _code_length_table = inflate_table::from_lengths(_code_length_lengths.data(), _code_length_lengths.size());
+    _lengths.clear();
+    _state = state_type::lengths;
+    return true;
 }
 
-std::vector<uint8_t> inflate_lengths(
-    std::span<std::byte const> bytes,
-    std::size_t &bit_offset,
-    std::size_t nr_symbols,
-    huffman_tree<int16_t> const &code_length_tree)
+bool inflate_decoder::decode_lengths()
 {
-    auto r = std::vector<uint8_t>{};
-    r.reserve(nr_symbols);
-
-    auto prev_length = 0_uz;
-    while (r.size() < nr_symbols) {
-        // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-        // -  7 bits maximum huffman code.
-        // -  7 bits extra length.
-        // -  7 bits rounding up to byte.
-        hi_check(((bit_offset + 21) >> 3) <= bytes.size(), "Input buffer overrun");
-        hilet symbol = code_length_tree.get_symbol(bytes, bit_offset);
+    hilet nr_symbols = _nr_literals + _nr_distances;
+
+    while (_lengths.size() < nr_symbols) {
+        // At most 7 bits code, followed by 7 bits extra length.
+        pull();
+
+        hilet& entry = _code_length_table.decode(_bits);
+        if (not inflate_check_code(entry, _nr_bits)) {
+            return false;
+        }
+
+        hilet symbol = entry.value;
+        hilet nr_extra_bits = symbol == 16 ? 2_uz : symbol == 17 ? 3_uz : symbol == 18 ? 7_uz : 0_uz;
+        if (entry.length + nr_extra_bits > _nr_bits) {
+            return false;
+        }
+
+        std::ignore = get_bits(entry.length);
+        hilet extra = get_bits(nr_extra_bits);
 
         switch (symbol) {
-        case 16: {
-            auto copy_length = get_bits(bytes, bit_offset, 2) + 3;
-            while (copy_length--) {
-                r.push_back(static_cast<uint8_t>(prev_length));
+        case 16:
+            hi_check(not _lengths.empty(), "Repeat of previous code length without a previous code length");
+            _lengths.insert(_lengths.end(), extra + 3, _lengths.back());
+            break;
+        case 17: _lengths.insert(_lengths.end(), extra + 3, uint8_t{0}); break;
+        case 18: _lengths.insert(_lengths.end(), extra + 11, uint8_t{0}); break;
+        default: _lengths.push_back(narrow_cast<uint8_t>(symbol));
+        }
+    }
+
+    hi_check(_lengths.size() == nr_symbols, "Code lengths repeated beyond the number of symbols");
+    hi_check(_lengths[256] != 0, "The end-of-block symbol must be in the table");
+
+    _literal_table = inflate_table::from_lengths(_lengths.data(), _nr_literals);
+    _distance_table = inflate_table::from_lengths(_lengths.data() + _nr_literals, _nr_distances);
+    _fixed_tables = false;
+    _state = state_type::block_data;
+    return true;
+}
+
+bool inflate_decoder::decode_block_data(std::size_t room)
+{
+    hilet& literal_table = _fixed_tables ? deflate_fixed_literal_table : _literal_table;
+    hilet& distance_table = _fixed_tables ? deflate_fixed_distance_table : _distance_table;
+    hilet window = _window.data();
+
+    // Leave room for a maximum length match at the end of the window.
+    hilet write_last = std::min(_flushed + room, 2 * history_size - inflate_max_match);
+
+    auto write = _write;
+    while (write < write_last) {
+        // A full pull provides enough bits to decode a full match:
+        // - 15 bits literal/length code.
+        // -  5 bits extra length.
+        // - 15 bits distance code.
+        // - 13 bits extra distance.
+        pull();
+
+        // Decode using local copies of the bit buffer, so that the decoder can be
+        // resumed at the start of the symbol when there are not enough bits.
+        auto bits = _bits;
+        auto nr_bits = _nr_bits;
+
+        hilet& literal = literal_table.decode(bits);
+        if (not inflate_check_code(literal, nr_bits)) [[unlikely]] {
+            break;
+        }
+        bits >>= literal.length;
+        nr_bits -= literal.length;
+
+        if (literal.value < 256) {
+            window[write++] = static_cast<std::byte>(literal.value);
+
+        } else if (literal.value == 256) {
+            // End-of-block.
+            _state = _final_block ? state_type::done : state_type::block_header;
+
+        } else {
+            hilet length_symbol = literal.value - 257_uz;
+            hi_check(length_symbol < inflate_length_base.size(), "Literal/Length symbol out of range {}", literal.value);
+            hilet nr_length_bits = inflate_length_extra[length_symbol];
+            if (nr_length_bits > nr_bits) [[unlikely]] {
+                break;
             }
-        } break;
-        case 17: {
-            auto copy_length = get_bits(bytes, bit_offset, 3) + 3;
-            while (copy_length--) {
-                r.push_back(0);
+            hilet length = inflate_length_base[length_symbol] + narrow_cast<std::size_t>(bits & ((1 << nr_length_bits) - 1));
+            bits >>= nr_length_bits;
+            nr_bits -= nr_length_bits;
+
+            hilet& distance_entry = distance_table.decode(bits);
+            if (not inflate_check_code(distance_entry, nr_bits)) [[unlikely]] {
+                break;
             }
-        } break;
-        case 18: {
-            auto copy_length = get_bits(bytes, bit_offset, 7) + 11;
-            while (copy_length--) {
-                r.push_back(0);
+            bits >>= distance_entry.length;
+            nr_bits -= distance_entry.length;
+
+            hilet distance_symbol = distance_entry.value;
+            hi_check(distance_symbol < inflate_distance_base.size(), "Distance symbol out of range {}", distance_symbol);
+            hilet nr_distance_bits = inflate_distance_extra[distance_symbol];
+            if (nr_distance_bits > nr_bits) [[unlikely]] {
+                break;
             }
-        } break;
-        default: r.push_back(static_cast<uint8_t>(prev_length = symbol));
+            hilet distance =
+                inflate_distance_base[distance_symbol] + narrow_cast<std::size_t>(bits & ((1 << nr_distance_bits) - 1));
+            bits >>= nr_distance_bits;
+            nr_bits -= nr_distance_bits;
+
+            // The window always starts with valid history.
+            hi_check(distance <= write, "Distance beyond start of decompressed data");
+
+            inflate_copy_match(window + write, distance, length);
+            write += length;
+        }
+
+        // Commit the symbol.
+        _bits = bits;
+        _nr_bits = nr_bits;
+
+        if (_state != state_type::block_data) {
+            _write = write;
+            return true;
         }
     }
 
-    return r;
+    _write = write;
+    // Return false when more input is needed.
+    return write >= write_last;
 }
 
-void inflate_dynamic_block(std::span<std::byte const> bytes, std::size_t &bit_offset, std::size_t max_size, bstring &r)
+inflate_decoder::result_type inflate_decoder::decode(std::span<std::byte const> input, std::span<std::byte> output)
 {
-    // Test all lengths, the trailer is at least 32 bits (Checksum)
-    // - 14 bits lengths
-    // -  7 bits rounding up to byte.
-    hi_check(((bit_offset + 21) >> 3) <= bytes.size(), "Input buffer overrun");
-    hilet HLIT = get_bits(bytes, bit_offset, 5);
-    hilet HDIST = get_bits(bytes, bit_offset, 5);
-    hilet HCLEN = get_bits(bytes, bit_offset, 4);
+    _input_first = input.data();
+    _input_ptr = input.data();
+    _input_last = input.data() + input.size();
+
+    auto produced = 0_uz;
+    flush(output, produced);
+
+    auto need_input = false;
+    while (_state != state_type::done and not need_input) {
+        // The room in the output buffer for data that was not flushed yet.
+        hilet room = output.size() - produced;
+        if (_write - _flushed >= room) {
+            break;
+        }
 
-    hilet code_length_tree = inflate_code_lengths(bytes, bit_offset, HCLEN + 4);
+        if (_write + inflate_max_match >= 2 * history_size) {
+            flush(output, produced);
+            if (_flushed != _write) {
+                break;
+            }
+            slide();
+            continue;
+        }
 
-    hilet lengths = inflate_lengths(bytes, bit_offset, HLIT + HDIST + 258, code_length_tree);
-    hi_check(lengths[256] != 0, "The end-of-block symbol must be in the table");
+        switch (_state) {
+        case state_type::block_header: need_input = not decode_block_header(); break;
+        case state_type::stored_header: need_input = not decode_stored_header(); break;
+        case state_type::stored_data: need_input = not decode_stored_data(); break;
+        case state_type::dynamic_header: need_input = not decode_dynamic_header(); break;
+        case state_type::code_lengths: need_input = not decode_code_lengths(); break;
+        case state_type::lengths: need_input = not decode_lengths(); break;
+        case state_type::block_data: need_input = not decode_block_data(room); break;
+        default: hi_no_default();
+        }
+    }
+
+    flush(output, produced);
 
-    hilet lengths_ptr = lengths.data();
-    hi_assert_not_null(lengths_ptr);
-    hilet literal_tree = huffman_tree<int16_t>::from_lengths(lengths_ptr, HLIT + 257);
-    hilet distance_tree = huffman_tree<int16_t>::from_lengths(&lengths_ptr[HLIT + 257], HDIST + 1);
+    if (not need_input) {
+        // Bytes that were not needed for decoding are returned to the caller.
+        unpull();
+    }
 
-    inflate_block(bytes, bit_offset, max_size, literal_tree, distance_tree, r);
+    hilet consumed = narrow_cast<std::size_t>(_input_ptr - _input_first);
+    _input_first = nullptr;
+    _input_ptr = nullptr;
+    _input_last = nullptr;
+    return {consumed, produced};
 }
 
-bstring inflate(std::span<std::byte const> bytes, std::size_t &offset, std::size_t max_size)
+bstring inflate(std::span<std::byte const> bytes, std::size_t& offset, std::size_t max_size)
 {
-    std::size_t bit_offset = offset * 8;
+    auto decoder = inflate_decoder{};
 
-    auto r = bstring{};
+    // One byte more than the maximum size, so that the end-of-block can be decoded
+    // when the decompressed data is exactly the maximum size.
+    hilet capacity = max_size + 1;
 
-    auto BFINAL = false;
-    do {
-        // Test all lengths, the trailer is at least 32 bits (Checksum)
-        // - 3 bits header
-        // - 7 bits rounding up to byte.
-        hi_check(((bit_offset + 10) >> 3) <= bytes.size(), "Input buffer overrun");
-
-        BFINAL = get_bit(bytes, bit_offset);
-        hilet BTYPE = get_bits(bytes, bit_offset, 2);
-
-        switch (BTYPE) {
-        case 0: inflate_copy_block(bytes, bit_offset, max_size, r); break;
-        case 1: inflate_fixed_block(bytes, bit_offset, max_size, r); break;
-        case 2: inflate_dynamic_block(bytes, bit_offset, max_size, r); break;
-        default: throw parse_error("Reserved block type");
+    auto r = bstring{};
+    auto r_size = 0_uz;
+    while (not decoder.done()) {
+        if (r_size == r.size()) {
+            hi_check(r_size < capacity, "Output buffer overrun");
+            r.resize(std::min(capacity, std::max(r.size() * 2, inflate_decoder::history_size)));
         }
 
-    } while (!BFINAL);
+        hilet[consumed, produced] = decoder.decode(bytes.subspan(offset), std::span{r}.subspan(r_size));
+        offset += consumed;
+        r_size += produced;
+
+        hi_check(decoder.done() or r_size == r.size(), "Input buffer overrun");
+    }
 
-    offset = (bit_offset + 7) / 8;
+    hi_check(r_size <= max_size, "Output buffer overrun");
+    r.resize(r_size);
     return r;
 }
 
-} // namespace hi::inline v1
\ No newline at end of file
+} // namespace hi::inline v1
@@ -10,6 +10,7 @@
 #include "../geometry/module.hpp"
 #include "../byte_string.hpp"
 #include "../strings.hpp"
+#include "../thread_pool.hpp"
 #include <span>
 #include <vector>
 #include <cstddef>
@@ -19,6 +20,25 @@
 #include <memory>
 
 namespace hi::inline v1 {
+namespace detail {
+
+/** Unfilter a line of a png image in place.
+ *
+ * @param line The filtered bytes of the line, without the filter-type byte.
+ * @param prev_line The unfiltered bytes of the previous line, or zeros for the first line.
+ * @param filter_type The filter type: 0 none, 1 sub, 2 up, 3 average or 4 paeth.
+ * @param bytes_per_pixel The number of bytes of a pixel, rounded up to whole bytes.
+ * @param use_simd Use the SIMD kernels when they exist for this pixel size; the scalar
+ *                 code is used otherwise, which the tests compare the kernels with.
+ */
+void png_unfilter_line(
+    std::span<uint8_t> line,
+    std::span<uint8_t const> prev_line,
+    uint8_t filter_type,
+    std::size_t bytes_per_pixel,
+    bool use_simd = true) noexcept;
+
+} // namespace detail
 
 class png {
 public:
@@ -36,16 +56,108 @@ public:
         return _height;
     }
 
+    /** Decode the image on the current thread.
+     *
+     * @param image The image to write the pixels to, must be the size of the png image.
+     * @throw parse_error When the png file is invalid.
+     */
     void decode_image(pixmap_span<sfloat_rgba16> image) const;
 
+    /** Decode the image using a thread pool.
+     *
+     * Decompression and unfiltering of the lines is sequential. For large images the
+     * lines are converted to pixels in bands of rows on the @a pool, while the next
+     * band is being decompressed.
+     *
+     * @param image The image to write the pixels to, must be the size of the png image.
+     * @param pool The thread pool used to convert the bands of rows in parallel.
+     * @throw parse_error When the png file is invalid.
+     */
+    void decode_image(pixmap_span<sfloat_rgba16> image, thread_pool& pool) const;
+
+    /** Load and decode a png file on the current thread.
+     *
+     * @param path The path to the png file.
+     * @return The image.
+     * @throw io_error When the file could not be read.
+     * @throw parse_error When the png file is invalid.
+     */
     [[nodiscard]] static pixmap<sfloat_rgba16> load(std::filesystem::path const& path);
 
+    /** Load and decode a png file on a thread pool.
+     *
+     * @param path The path to the png file.
+     * @param pool The thread pool to decode the image on.
+     * @return A future with the image; the future may be awaited on from a co-routine.
+     * @throw std::bad_alloc When the job could not be allocated.
+     */
+    [[nodiscard]] static pool_future<pixmap<sfloat_rgba16>>
+    load_async(std::filesystem::path const& path, thread_pool& pool = thread_pool::global());
+
+    /** Load and decode many png files concurrently on a thread pool.
+     *
+     * Each image is decoded by a separate job, so that the images are decoded in parallel.
+     *
+     * @param paths The paths to the png files.
+     * @param pool The thread pool to decode the images on.
+     * @return A future for each image, in the same order as @a paths.
+     * @throw std::bad_alloc When the jobs could not be allocated.
+     */
+    [[nodiscard]] static std::vector<pool_future<pixmap<sfloat_rgba16>>>
+    load_async(std::span<std::filesystem::path const> paths, thread_pool& pool = thread_pool::global());
+
+    /** Encode an image as a png file.
+     *
+     * The pixels are converted from linear, alpha pre-multiplied sRGB to
+     * 8 bits per sample, gamma corrected sRGB with straight alpha.
+     *
+     * Each line is filtered with the filter that yields the lowest sum of the absolute
+     * filtered values, which is a good estimate of how well the line compresses.
+     *
+     * @param image The image to encode.
+     * @param level The deflate compression level between 0 and 9.
+     * @return The data of the png file.
+     */
+    [[nodiscard]] static bstring encode(pixmap_span<sfloat_rgba16 const> image, int level = 6);
+
+    /** Encode a gray-scale image as a png file.
+     *
+     * The samples are stored as is, as 8 bits per sample gray-scale.
+     *
+     * @param image The image to encode.
+     * @param level The deflate compression level between 0 and 9.
+     * @return The data of the png file.
+     */
+    [[nodiscard]] static bstring encode(pixmap_span<uint8_t const> image, int level = 6);
+
+    /** Save an image as a png file.
+     *
+     * @param path The path of the png file to write.
+     * @param image The image to save.
+     * @param level The deflate compression level between 0 and 9.
+     * @throw io_error When the file could not be written.
+     */
+    static void save(std::filesystem::path const& path, pixmap_span<sfloat_rgba16 const> image, int level = 6);
+
+    /** Save a gray-scale image as a png file.
+     *
+     * @param path The path of the png file to write.
+     * @param image The image to save.
+     * @param level The deflate compression level between 0 and 9.
+     * @throw io_error When the file could not be written.
+     */
+    static void save(std::filesystem::path const& path, pixmap_span<uint8_t const> image, int level = 6);
+
 private:
     /** Matrix to convert png color values to sRGB.
      * The default are sRGB color primaries and white-point.
      */
     matrix3 _color_to_sRGB = geo::identity();
 
+    /** The color primaries are sRGB, _color_to_sRGB is the identity matrix.
+     */
+    bool _color_is_sRGB = true;
+
     /** The gamma curve to convert a sample directly to linear float.
      */
     std::vector<float> _transfer_function;
@@ -86,16 +198,20 @@ private:
     void generate_sRGB_transfer_function() noexcept;
     void generate_Rec2100_transfer_function() noexcept;
     void generate_gamma_transfer_function(float gamma) noexcept;
-    [[nodiscard]] bstring decompress_IDATs(std::size_t image_data_size) const;
-    void unfilter_lines(bstring& image_data) const;
     void unfilter_line(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const;
-    void unfilter_line_sub(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept;
-    void unfilter_line_up(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept;
-    void unfilter_line_average(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept;
-    void unfilter_line_paeth(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept;
-    void data_to_image(bstring bytes, pixmap_span<sfloat_rgba16> image) const noexcept;
     void data_to_image_line(std::span<std::byte const> bytes, std::span<sfloat_rgba16> row) const noexcept;
-    u16x4 extract_pixel_from_line(std::span<std::byte const> bytes, int x) const noexcept;
+
+    /** Decode the image.
+     *
+     * @param image The image to write the pixels to.
+     * @param pool The thread pool to convert bands of rows on, or nullptr to decode on the current thread.
+     */
+    void decode_lines(pixmap_span<sfloat_rgba16> image, thread_pool *pool) const;
+
+    /** Convert a line of samples to linear, alpha pre-multiplied, sRGB pixels.
+     */
+    template<int BitDepth, bool IsColor, bool HasAlpha>
+    void data_to_image_line(std::span<std::byte const> bytes, std::span<sfloat_rgba16> row) const noexcept;
 };
 
 } // namespace hi::inline v1
@@ -0,0 +1,160 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "png.hpp"
+#include "deflate.hpp"
+#include "../file/file_view.hpp"
+#include "../color/module.hpp"
+#include "../utility/module.hpp"
+#include "../thread_pool.hpp"
+#include "../file/file.hpp"
+#include <benchmark/benchmark.h>
+#include <format>
+#include <filesystem>
+#include <vector>
+
+using namespace hi;
+
+/** A 4K frame with gradients and a bit of noise, like a screenshot of a user interface.
+ */
+[[nodiscard]] static pixmap<sfloat_rgba16> make_frame()
+{
+    constexpr auto width = 3840_uz;
+    constexpr auto height = 2160_uz;
+
+    auto r = pixmap<sfloat_rgba16>{width, height};
+    for (auto y = 0_uz; y != height; ++y) {
+        for (auto x = 0_uz; x != width; ++x) {
+            hilet red = narrow_cast<float>(x % 256) / 255.0f;
+            hilet green = narrow_cast<float>(y % 256) / 255.0f;
+            hilet blue = narrow_cast<float>((x * 7919 + y * 104729) % 16) / 255.0f;
+            r[y][x] = f32x4{sRGB_gamma_to_linear(red), sRGB_gamma_to_linear(green), sRGB_gamma_to_linear(blue), 1.0f};
+        }
+    }
+    return r;
+}
+
+static void png_encode_4k(benchmark::State& state)
+{
+    hilet level = narrow_cast<int>(state.range(0));
+    auto frame = make_frame();
+
+    auto size = 0_uz;
+    for (auto _ : state) {
+        hilet encoded = png::encode(frame, level);
+        size = encoded.size();
+        benchmark::DoNotOptimize(encoded.data());
+    }
+    state.SetItemsProcessed(state.iterations() * frame.width() * frame.height());
+    state.SetLabel(std::format("level {}, {} bytes", level, size));
+}
+BENCHMARK(png_encode_4k)->Arg(1)->Arg(6)->Unit(benchmark::kMillisecond);
+
+/** Png files written to the temporary directory, to be loaded by the benchmarks.
+ */
+struct png_benchmarks_files {
+    std::filesystem::path frame;
+    std::vector<std::filesystem::path> icons;
+
+    png_benchmarks_files()
+    {
+        hilet directory = std::filesystem::temp_directory_path();
+
+        frame = directory / "hikogui_png_benchmark_frame.png";
+        write(frame, png::encode(make_frame()));
+
+        // A set of icons, like the images loaded when an application starts.
+        auto icon = pixmap<sfloat_rgba16>{256, 256};
+        for (auto i = 0_uz; i != 64; ++i) {
+            for (auto y = 0_uz; y != icon.height(); ++y) {
+                for (auto x = 0_uz; x != icon.width(); ++x) {
+                    hilet value = narrow_cast<float>((x * i + y) % 256) / 255.0f;
+                    icon[y][x] = f32x4{sRGB_gamma_to_linear(value), 0.5f, 0.25f, 1.0f};
+                }
+            }
+
+            icons.push_back(directory / std::format("hikogui_png_benchmark_icon{}.png", i));
+            write(icons.back(), png::encode(icon));
+        }
+    }
+
+    ~png_benchmarks_files()
+    {
+        std::filesystem::remove(frame);
+        for (hilet& path : icons) {
+            std::filesystem::remove(path);
+        }
+    }
+
+    static void write(std::filesystem::path const& path, bstring const& bytes)
+    {
+        auto f = file{path, access_mode::truncate_or_create_for_write};
+        f.write(bytes);
+    }
+
+    [[nodiscard]] static png_benchmarks_files const& global()
+    {
+        static auto r = png_benchmarks_files{};
+        return r;
+    }
+};
+
+/** Decode a 4K frame on the current thread (0), or in bands on a thread pool of the given size.
+ */
+static void png_decode_4k(benchmark::State& state)
+{
+    hilet num_threads = narrow_cast<std::size_t>(state.range(0));
+    hilet png_data = png{png_benchmarks_files::global().frame};
+    auto image = pixmap<sfloat_rgba16>{png_data.width(), png_data.height()};
+    auto pool = thread_pool{std::max(1_uz, num_threads)};
+
+    for (auto _ : state) {
+        if (num_threads == 0) {
+            png_data.decode_image(image);
+        } else {
+            png_data.decode_image(image, pool);
+        }
+        benchmark::DoNotOptimize(image.data());
+    }
+    state.SetItemsProcessed(state.iterations() * image.width() * image.height());
+}
+BENCHMARK(png_decode_4k)->Arg(0)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/** Load the icons of an application at startup, on a thread pool of the given size.
+ */
+static void png_load_icons(benchmark::State& state)
+{
+    hilet& paths = png_benchmarks_files::global().icons;
+    auto pool = thread_pool{narrow_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state) {
+        auto futures = png::load_async(paths, pool);
+        for (auto& future : futures) {
+            auto image = future.get();
+            benchmark::DoNotOptimize(image.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * paths.size());
+}
+BENCHMARK(png_load_icons)->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/** Compress the canterbury corpus files from the test data.
+ */
+static void deflate_corpus(benchmark::State& state)
+{
+    hilet path = std::format("gzip_test{}.bin", state.range(0));
+    hilet level = narrow_cast<int>(state.range(1));
+    hilet view = file_view{std::filesystem::path{path}};
+    hilet bytes = as_span<std::byte const>(view);
+
+    auto size = 0_uz;
+    for (auto _ : state) {
+        hilet compressed = deflate(bytes, level);
+        size = compressed.size();
+        benchmark::DoNotOptimize(compressed.data());
+    }
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+    state.SetLabel(std::format("{} level {}, {} bytes", path, level, size));
+}
+BENCHMARK(deflate_corpus)->ArgsProduct({benchmark::CreateDenseRange(4, 8, 1), {1, 6, 9}});
@@ -8,6 +8,17 @@
 #include "../utility/module.hpp"
 #include "../placement.hpp"
 #include "../color/module.hpp"
+#include "../SIMD/module.hpp"
+#include "../defer.hpp"
+#include "../file/file.hpp"
+#include <array>
+#include <algorithm>
+#if defined(HI_HAS_SSSE3)
+#include <tmmintrin.h>
+#endif
+#if defined(HI_HAS_AVX2)
+#include <immintrin.h>
+#endif
 
 namespace hi::inline v1 {
 
@@ -63,7 +74,7 @@ void png::read_header(std::span<std::byte const> bytes, std::size_t &offset)
 void png::generate_sRGB_transfer_function() noexcept
 {
     hilet value_range = _bit_depth == 8 ? 256 : 65536;
-    hilet value_range_f = narrow_cast<float>(value_range);
+    hilet value_range_f = narrow_cast<float>(value_range - 1);
     for (int i = 0; i != value_range; ++i) {
         auto u = narrow_cast<float>(i) / value_range_f;
         _transfer_function.push_back(sRGB_gamma_to_linear(u));
@@ -76,7 +87,7 @@ void png::generate_Rec2100_transfer_function() noexcept
     constexpr float hdr_multiplier = 10'000.0f / 80.0f;
 
     hilet value_range = _bit_depth == 8 ? 256 : 65536;
-    hilet value_range_f = narrow_cast<float>(value_range);
+    hilet value_range_f = narrow_cast<float>(value_range - 1);
     for (int i = 0; i != value_range; ++i) {
         auto u = narrow_cast<float>(i) / value_range_f;
         _transfer_function.push_back(Rec2100_gamma_to_linear(u) * hdr_multiplier);
@@ -86,7 +97,7 @@ void png::generate_Rec2100_transfer_function() noexcept
 void png::generate_gamma_transfer_function(float gamma) noexcept
 {
     hilet value_range = _bit_depth == 8 ? 256 : 65536;
-    hilet value_range_f = narrow_cast<float>(value_range);
+    hilet value_range_f = narrow_cast<float>(value_range - 1);
     for (int i = 0; i != value_range; ++i) {
         auto u = narrow_cast<float>(i) / value_range_f;
         _transfer_function.push_back(powf(u, gamma));
@@ -148,6 +159,7 @@ void png::read_cHRM(std::span<std::byte const> bytes)
         narrow_cast<float>(*chrm->blue_y) / 100'000.0f);
 
     _color_to_sRGB = XYZ_to_sRGB * color_to_XYZ;
+    _color_is_sRGB = false;
 }
 
 void png::read_gAMA(std::span<std::byte const> bytes)
@@ -166,6 +178,7 @@ void png::read_sRGB(std::span<std::byte const> bytes)
     hi_check(rendering_intent <= 3, "Invalid rendering intent");
 
     _color_to_sRGB = geo::identity();
+    _color_is_sRGB = true;
     generate_sRGB_transfer_function();
 }
 
@@ -193,6 +206,7 @@ void png::read_iCCP(std::span<std::byte const> bytes)
         // create the conversion matrix and transfer function from scratch.
 
         _color_to_sRGB = XYZ_to_sRGB * Rec2100_to_XYZ;
+        _color_is_sRGB = false;
         generate_Rec2100_transfer_function();
         return;
     }
@@ -265,54 +279,184 @@ png::png(file_view view) : _view(std::move(view))
     read_chunks(bytes, offset);
 }
 
-bstring png::decompress_IDATs(std::size_t image_data_size) const
+#if defined(HI_HAS_SSE2)
+#if not defined(HI_HAS_SSSE3)
+/** The paeth predictor of 16 bytes.
+ *
+ * The paeth predictor is calculated with 8 bit unsigned arithmetic:
+ *  - pa = |p - a| = |b - c|
+ *  - pb = |p - b| = |a - c|
+ *  - pc = |p - c| = |(a - c) + (b - c)|, which is pa + pb when (a - c) and (b - c)
+ *    have the same sign, or |pa - pb| otherwise. The saturation of pa + pb does not
+ *    change the result of the comparisons with pa and pb.
+ *
+ * @param a The bytes to the left.
+ * @param b The bytes above.
+ * @param c The bytes above and to the left.
+ */
+[[nodiscard]] hi_force_inline static native_simd<uint8_t, 16>
+paeth_predictor(native_simd<uint8_t, 16> a, native_simd<uint8_t, 16> b, native_simd<uint8_t, 16> c) noexcept
 {
-    if (ssize(_idat_chunk_data) == 1) {
-        return zlib_decompress(_idat_chunk_data[0], image_data_size);
-    } else {
-        // Merge all idat chunks together.
-        hilet compressed_data_size =
-            std::accumulate(_idat_chunk_data.cbegin(), _idat_chunk_data.cend(), ssize_t{0}, [](hilet &a, hilet &b) {
-                return a + ssize(b);
-            });
-
-        bstring compressed_data;
-        compressed_data.reserve(compressed_data_size);
-        for (hilet chunk_data : _idat_chunk_data) {
-            std::copy(chunk_data.begin(), chunk_data.end(), std::back_inserter(compressed_data));
-        }
-
-        return zlib_decompress(compressed_data, image_data_size);
-    }
+    hilet pa = abs_diff(b, c);
+    hilet pb = abs_diff(a, c);
+    hilet same_sign = (b >= c) == (a >= c);
+    hilet pc = blend(abs_diff(pa, pb), add_saturate(pa, pb), same_sign);
+
+    hilet use_a = (pa <= pb) & (pa <= pc);
+    hilet use_b = pb <= pc;
+    return blend(blend(c, b, use_b), a, use_a);
+}
+#endif
+
+/** The average predictor of 16 bytes.
+ *
+ * @param a The bytes to the left.
+ * @param b The bytes above.
+ * @return (a + b) / 2 rounded down.
+ */
+[[nodiscard]] hi_force_inline static native_simd<uint8_t, 16>
+average_predictor(native_simd<uint8_t, 16> a, native_simd<uint8_t, 16> b) noexcept
+{
+    // avg() rounds up, the filter needs (a + b) / 2 rounded down.
+    return avg(a, b) - ((a ^ b) & native_simd<uint8_t, 16>::broadcast(1));
 }
 
-void png::unfilter_line_sub(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+/** Unfilter a line with the sub filter, one pixel at a time.
+ *
+ * Each pixel depends on the unfiltered pixel to the left, so the bytes of
+ * a single pixel are processed in parallel.
+ */
+template<std::size_t BytesPerPixel>
+static void unfilter_line_sub_simd(std::span<uint8_t> line) noexcept
 {
-    for (int i = 0; i != _bytes_per_line; ++i) {
-        hilet j = i - _bytes_per_pixel;
+    using S = native_simd<uint8_t, 16>;
 
-        uint8_t prev_raw = j >= 0 ? line[j] : 0;
-        line[i] += prev_raw;
+    auto left = S{};
+    for (auto i = 0_uz; i != line.size(); i += BytesPerPixel) {
+        left = left + S::load<BytesPerPixel>(line.data() + i);
+        left.store<BytesPerPixel>(line.data() + i);
     }
 }
 
-void png::unfilter_line_up(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+/** Unfilter a line with the up filter, 32 bytes at a time with AVX2, otherwise 16 bytes at a time.
+ */
+static void unfilter_line_up_simd(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
 {
-    for (int i = 0; i != _bytes_per_line; ++i) {
+    using S = native_simd<uint8_t, 16>;
+
+    auto i = 0_uz;
+#if defined(HI_HAS_AVX2)
+    for (; i + 32 <= line.size(); i += 32) {
+        hilet a = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(line.data() + i));
+        hilet b = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(prev_line.data() + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(line.data() + i), _mm256_add_epi8(a, b));
+    }
+#endif
+    for (; i + S::size <= line.size(); i += S::size) {
+        (S{line.data() + i} + S{prev_line.data() + i}).store(line.data() + i);
+    }
+    for (; i != line.size(); ++i) {
         line[i] += prev_line[i];
     }
 }
 
-void png::unfilter_line_average(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+/** Unfilter a line with the average filter, one pixel at a time.
+ */
+template<std::size_t BytesPerPixel>
+static void unfilter_line_average_simd(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
 {
-    for (int i = 0; i != _bytes_per_line; ++i) {
-        hilet j = i - _bytes_per_pixel;
+    using S = native_simd<uint8_t, 16>;
+
+    auto left = S{};
+    for (auto i = 0_uz; i != line.size(); i += BytesPerPixel) {
+        hilet up = S::load<BytesPerPixel>(prev_line.data() + i);
 
-        uint8_t prev_raw = j >= 0 ? line[j] : 0;
-        line[i] += (prev_raw + prev_line[i]) / 2;
+        left = S::load<BytesPerPixel>(line.data() + i) + average_predictor(left, up);
+        left.store<BytesPerPixel>(line.data() + i);
     }
 }
 
+#if defined(HI_HAS_SSSE3)
+/** The paeth predictor of 8 bytes, calculated with 16 bit arithmetic.
+ *
+ * The bytes are zero-extended to 16 bits, so that the absolute values can be
+ * calculated directly with `pabsw`:
+ *  - pa = |b - c|
+ *  - pb = |a - c|
+ *  - pc = |(b - c) + (a - c)|
+ *
+ * @param a The bytes to the left.
+ * @param b The bytes above.
+ * @param c The bytes above and to the left.
+ */
+[[nodiscard]] hi_force_inline static __m128i paeth_predictor_ssse3(__m128i a, __m128i b, __m128i c) noexcept
+{
+    hilet b_c = _mm_sub_epi16(b, c);
+    hilet a_c = _mm_sub_epi16(a, c);
+    hilet pa = _mm_abs_epi16(b_c);
+    hilet pb = _mm_abs_epi16(a_c);
+    hilet pc = _mm_abs_epi16(_mm_add_epi16(b_c, a_c));
+    hilet smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+
+    // Ties are resolved in the order a, b, c.
+    hilet use_a = _mm_cmpeq_epi16(smallest, pa);
+    hilet use_b = _mm_cmpeq_epi16(smallest, pb);
+    hilet b_or_c = _mm_or_si128(_mm_and_si128(use_b, b), _mm_andnot_si128(use_b, c));
+    return _mm_or_si128(_mm_and_si128(use_a, a), _mm_andnot_si128(use_a, b_or_c));
+}
+#endif
+
+/** Unfilter a line with the paeth filter, one pixel at a time.
+ */
+template<std::size_t BytesPerPixel>
+static void unfilter_line_paeth_simd(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
+{
+    using S = native_simd<uint8_t, 16>;
+
+#if defined(HI_HAS_SSSE3)
+    hilet zero = _mm_setzero_si128();
+
+    // The pixels to the left are kept zero-extended to 16 bits.
+    auto left = zero;
+    auto left_up = zero;
+    for (auto i = 0_uz; i != line.size(); i += BytesPerPixel) {
+        hilet up = _mm_unpacklo_epi8(static_cast<__m128i>(S::load<BytesPerPixel>(prev_line.data() + i)), zero);
+        hilet predictor = _mm_packus_epi16(paeth_predictor_ssse3(left, up, left_up), zero);
+
+        hilet current = _mm_add_epi8(static_cast<__m128i>(S::load<BytesPerPixel>(line.data() + i)), predictor);
+        S{current}.store<BytesPerPixel>(line.data() + i);
+        left = _mm_unpacklo_epi8(current, zero);
+        left_up = up;
+    }
+#else
+    auto left = S{};
+    auto left_up = S{};
+    for (auto i = 0_uz; i != line.size(); i += BytesPerPixel) {
+        hilet up = S::load<BytesPerPixel>(prev_line.data() + i);
+
+        left = S::load<BytesPerPixel>(line.data() + i) + paeth_predictor(left, up, left_up);
+        left.store<BytesPerPixel>(line.data() + i);
+        left_up = up;
+    }
+#endif
+}
+
+/** Unfilter a line with the SIMD kernel for a specific pixel size.
+ */
+template<std::size_t BytesPerPixel>
+static void unfilter_line_simd(std::span<uint8_t> line, std::span<uint8_t const> prev_line, uint8_t filter_type) noexcept
+{
+    switch (filter_type) {
+    case 0: return;
+    case 1: return unfilter_line_sub_simd<BytesPerPixel>(line);
+    case 2: return unfilter_line_up_simd(line, prev_line);
+    case 3: return unfilter_line_average_simd<BytesPerPixel>(line, prev_line);
+    case 4: return unfilter_line_paeth_simd<BytesPerPixel>(line, prev_line);
+    default: hi_no_default();
+    }
+}
+#endif
+
 static uint8_t paeth_predictor(uint8_t _a, uint8_t _b, uint8_t _c) noexcept
 {
     hilet a = static_cast<int>(_a);
@@ -333,121 +477,362 @@ static uint8_t paeth_predictor(uint8_t _a, uint8_t _b, uint8_t _c) noexcept
     }
 }
 
-void png::unfilter_line_paeth(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+namespace detail {
+
+void png_unfilter_line(
+    std::span<uint8_t> line,
+    std::span<uint8_t const> prev_line,
+    uint8_t filter_type,
+    std::size_t bytes_per_pixel,
+    bool use_simd) noexcept
 {
-    for (int i = 0; i != _bytes_per_line; ++i) {
-        hilet j = i - _bytes_per_pixel;
+    hi_axiom(filter_type <= 4);
+    hi_axiom(prev_line.size() >= line.size());
+
+#if defined(HI_HAS_SSE2)
+    if (use_simd) {
+        switch (bytes_per_pixel) {
+        case 3: return unfilter_line_simd<3>(line, prev_line, filter_type);
+        case 4: return unfilter_line_simd<4>(line, prev_line, filter_type);
+        case 6: return unfilter_line_simd<6>(line, prev_line, filter_type);
+        case 8: return unfilter_line_simd<8>(line, prev_line, filter_type);
+        default:
+            if (filter_type == 2) {
+                return unfilter_line_up_simd(line, prev_line);
+            }
+        }
+    }
+#endif
 
-        uint8_t const up = prev_line[i];
-        uint8_t const left = j >= 0 ? line[j] : 0;
-        uint8_t const left_up = j >= 0 ? prev_line[j] : 0;
-        line[i] += paeth_predictor(left, up, left_up);
+    switch (filter_type) {
+    case 0: return;
+    case 1:
+        for (auto i = bytes_per_pixel; i < line.size(); ++i) {
+            line[i] += line[i - bytes_per_pixel];
+        }
+        return;
+    case 2:
+        for (auto i = 0_uz; i != line.size(); ++i) {
+            line[i] += prev_line[i];
+        }
+        return;
+    case 3:
+        for (auto i = 0_uz; i != line.size(); ++i) {
+            uint8_t const left = i >= bytes_per_pixel ? line[i - bytes_per_pixel] : 0;
+            line[i] += narrow_cast<uint8_t>((left + prev_line[i]) / 2);
+        }
+        return;
+    case 4:
+        for (auto i = 0_uz; i != line.size(); ++i) {
+            uint8_t const up = prev_line[i];
+            uint8_t const left = i >= bytes_per_pixel ? line[i - bytes_per_pixel] : 0;
+            uint8_t const left_up = i >= bytes_per_pixel ? prev_line[i - bytes_per_pixel] : 0;
+            line[i] += paeth_predictor(left, up, left_up);
+        }
+        return;
+    default: hi_no_default();
     }
 }
 
+} // namespace detail
+
 void png::unfilter_line(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const
 {
-    switch (line[0]) {
-    case 0: return;
-    case 1: return unfilter_line_sub(line.subspan(1, _bytes_per_line), prev_line);
-    case 2: return unfilter_line_up(line.subspan(1, _bytes_per_line), prev_line);
-    case 3: return unfilter_line_average(line.subspan(1, _bytes_per_line), prev_line);
-    case 4: return unfilter_line_paeth(line.subspan(1, _bytes_per_line), prev_line);
-    default: throw parse_error("Unknown line-filter type");
+    if (line[0] > 4) {
+        throw parse_error("Unknown line-filter type");
     }
+    detail::png_unfilter_line(line.subspan(1, _bytes_per_line), prev_line, line[0], narrow_cast<std::size_t>(_bytes_per_pixel));
 }
 
-void png::unfilter_lines(bstring &image_data) const
+#if defined(HI_HAS_AVX2) && defined(HI_HAS_F16C)
+/** The byte shuffle which moves the samples of two pixels into eight 16 bit lanes.
+ *
+ * Each pixel gets the lanes red, green, blue and alpha; gray is copied into the
+ * three color lanes. 16 bit samples are big-endian and are byte swapped, 8 bit
+ * samples are zero-extended. Lanes without a sample are set to zero.
+ */
+template<int BitDepth, bool IsColor, bool HasAlpha>
+[[nodiscard]] consteval std::array<int8_t, 16> png_sample_shuffle() noexcept
 {
-    hilet image_bytes = std::span(reinterpret_cast<uint8_t *>(image_data.data()), image_data.size());
-    auto zero_line = std::vector<uint8_t>(_bytes_per_line, uint8_t{0});
+    constexpr auto sample_size = BitDepth / 8;
+    constexpr auto nr_samples = (IsColor ? 3 : 1) + (HasAlpha ? 1 : 0);
+    constexpr auto pixel_size = sample_size * nr_samples;
+
+    auto r = std::array<int8_t, 16>{};
+    for (auto i = 0; i != 8; ++i) {
+        hilet pixel = i / 4;
+        hilet channel = i % 4;
+
+        auto sample = -1;
+        if (channel < 3) {
+            sample = IsColor ? channel : 0;
+        } else if (HasAlpha) {
+            sample = nr_samples - 1;
+        }
 
-    auto prev_line = std::span(zero_line.data(), zero_line.size());
-    for (auto y = 0_uz; y != _height; ++y) {
-        hilet line = image_bytes.subspan(y * _stride, _stride);
-        unfilter_line(line, prev_line);
-        prev_line = line.subspan(1, _bytes_per_line);
+        hilet offset = pixel * pixel_size + sample * sample_size;
+        if (sample < 0) {
+            r[i * 2] = -128;
+            r[i * 2 + 1] = -128;
+        } else if (BitDepth == 16) {
+            r[i * 2] = static_cast<int8_t>(offset + 1);
+            r[i * 2 + 1] = static_cast<int8_t>(offset);
+        } else {
+            r[i * 2] = static_cast<int8_t>(offset);
+            r[i * 2 + 1] = -128;
+        }
     }
+    return r;
 }
 
-static uint16_t get_sample(std::span<std::byte const> bytes, ssize_t &offset, bool two_bytes)
+/** Convert a line of samples to linear, alpha pre-multiplied, sRGB pixels, two pixels at a time.
+ *
+ * The samples are looked up in the transfer function with a gather, the alpha
+ * pre-multiply, color conversion and conversion to float16 are done on both pixels at once.
+ *
+ * @param bytes The samples of the line.
+ * @param line The pixels to write.
+ * @param width The number of pixels in the line.
+ * @param transfer_function The table to convert a sample to linear.
+ * @param color_to_sRGB The matrix to convert the color to sRGB, or nullptr when the color is already sRGB.
+ * @return The number of pixels that were converted; the rest of the line is converted by the caller.
+ */
+template<int BitDepth, bool IsColor, bool HasAlpha>
+static std::size_t data_to_image_line_avx2(
+    std::span<std::byte const> bytes,
+    std::span<sfloat_rgba16> line,
+    std::size_t width,
+    float const *transfer_function,
+    matrix3 const *color_to_sRGB) noexcept
 {
-    uint16_t value = static_cast<uint8_t>(bytes[offset++]);
-    if (two_bytes) {
-        value <<= 8;
-        value |= static_cast<uint8_t>(bytes[offset++]);
+    constexpr auto nr_samples = (IsColor ? 3_uz : 1_uz) + (HasAlpha ? 1_uz : 0_uz);
+    constexpr auto pixel_size = narrow_cast<std::size_t>(BitDepth / 8) * nr_samples;
+    constexpr auto alpha_mul = BitDepth == 16 ? 1.0f / 65535.0f : 1.0f / 255.0f;
+    static constexpr auto shuffle_bytes = png_sample_shuffle<BitDepth, IsColor, HasAlpha>();
+
+    hilet shuffle = _mm_loadu_si128(reinterpret_cast<__m128i const *>(shuffle_bytes.data()));
+    hilet one = _mm256_set1_ps(1.0f);
+
+    auto col0 = _mm256_setzero_ps();
+    auto col1 = _mm256_setzero_ps();
+    auto col2 = _mm256_setzero_ps();
+    auto col3 = _mm256_setzero_ps();
+    if (color_to_sRGB) {
+        hilet broadcast = [](f32x4 col) {
+            hilet col_ = static_cast<__m128>(col.reg());
+            return _mm256_set_m128(col_, col_);
+        };
+        col0 = broadcast(get<0>(*color_to_sRGB));
+        col1 = broadcast(get<1>(*color_to_sRGB));
+        col2 = broadcast(get<2>(*color_to_sRGB));
+        col3 = broadcast(get<3>(*color_to_sRGB));
     }
-    return value;
-}
 
-u16x4 png::extract_pixel_from_line(std::span<std::byte const> bytes, int x) const noexcept
-{
-    hi_axiom(_bit_depth == 8 or _bit_depth == 16);
-    hi_axiom(not _is_palletted);
+    auto x = 0_uz;
+    // 16 bytes are loaded for each pair of pixels, which may be more than the size of two pixels.
+    for (; x + 2 <= width and x * pixel_size + 16 <= bytes.size(); x += 2) {
+        hilet samples = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(bytes.data() + x * pixel_size)), shuffle);
+        hilet indices = _mm256_cvtepu16_epi32(samples);
+
+        // The alpha lanes are looked up as well, and replaced by one.
+        auto pixels = _mm256_blend_ps(_mm256_i32gather_ps(transfer_function, indices, 4), one, 0b1000'1000);
+
+        if (color_to_sRGB) {
+            pixels = _mm256_add_ps(
+                _mm256_add_ps(
+                    _mm256_mul_ps(col0, _mm256_shuffle_ps(pixels, pixels, 0b00'00'00'00)),
+                    _mm256_mul_ps(col1, _mm256_shuffle_ps(pixels, pixels, 0b01'01'01'01))),
+                _mm256_add_ps(_mm256_mul_ps(col2, _mm256_shuffle_ps(pixels, pixels, 0b10'10'10'10)), col3));
+        }
 
-    uint16_t r = 0;
-    uint16_t g = 0;
-    uint16_t b = 0;
-    uint16_t a = 0;
+        if constexpr (HasAlpha) {
+            // pre-multiply the alpha for use in texture-maps; alpha itself is linear.
+            hilet alpha = _mm256_mul_ps(_mm256_cvtepi32_ps(indices), _mm256_set1_ps(alpha_mul));
+            pixels = _mm256_mul_ps(pixels, _mm256_shuffle_ps(alpha, alpha, 0b11'11'11'11));
+        }
 
-    ssize_t offset = x * _bytes_per_pixel;
-    if (_is_color) {
-        r = get_sample(bytes, offset, _bit_depth == 16);
-        g = get_sample(bytes, offset, _bit_depth == 16);
-        b = get_sample(bytes, offset, _bit_depth == 16);
-    } else {
-        r = g = b = get_sample(bytes, offset, _bit_depth == 16);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(line.data() + x), _mm256_cvtps_ph(pixels, _MM_FROUND_TO_ZERO));
     }
-    if (_has_alpha) {
-        a = get_sample(bytes, offset, _bit_depth == 16);
-    } else {
-        a = (_bit_depth == 16) ? 65535 : 255;
-    }
-
-    return u16x4{r, g, b, a};
+    return x;
 }
+#endif
 
+template<int BitDepth, bool IsColor, bool HasAlpha>
 void png::data_to_image_line(std::span<std::byte const> bytes, std::span<sfloat_rgba16> line) const noexcept
 {
-    hilet alpha_mul = _bit_depth == 16 ? 1.0f / 65535.0f : 1.0f / 255.0f;
-    for (int x = 0; x != _width; ++x) {
-        hilet value = extract_pixel_from_line(bytes, x);
+    constexpr auto sample_size = narrow_cast<std::size_t>(BitDepth / 8);
+    constexpr auto nr_samples = (IsColor ? 3_uz : 1_uz) + (HasAlpha ? 1_uz : 0_uz);
+    constexpr auto pixel_size = sample_size * nr_samples;
+    constexpr auto alpha_mul = BitDepth == 16 ? 1.0f / 65535.0f : 1.0f / 255.0f;
 
-        hilet linear_RGB =
-            f32x4{_transfer_function[value.x()], _transfer_function[value.y()], _transfer_function[value.z()], 1.0f};
+    hilet width = narrow_cast<std::size_t>(_width);
+    hi_axiom(bytes.size() >= width * pixel_size);
+    hi_axiom(line.size() >= width);
 
-        hilet linear_sRGB_color = _color_to_sRGB * linear_RGB;
-        hilet alpha = static_cast<float>(value.w()) * alpha_mul;
+    hilet transfer_function = _transfer_function.data();
 
-        // pre-multiply the alpha for use in texture-maps.
-        line[x] = linear_sRGB_color * alpha;
+    hilet get_sample = [&](std::size_t offset) -> std::size_t {
+        if constexpr (BitDepth == 16) {
+            return load_be<uint16_t>(bytes.data() + offset);
+        } else {
+            return std::to_integer<std::size_t>(bytes[offset]);
+        }
+    };
+
+    hilet get_pixel = [&](std::size_t x) -> f32x4 {
+        hilet offset = x * pixel_size;
+
+        auto r = f32x4{};
+        if constexpr (IsColor) {
+            r = f32x4{
+                transfer_function[get_sample(offset)],
+                transfer_function[get_sample(offset + sample_size)],
+                transfer_function[get_sample(offset + 2 * sample_size)],
+                1.0f};
+        } else {
+            hilet luminance = transfer_function[get_sample(offset)];
+            r = f32x4{luminance, luminance, luminance, 1.0f};
+        }
+
+        if (not _color_is_sRGB) {
+            r = _color_to_sRGB * r;
+        }
+
+        if constexpr (HasAlpha) {
+            // pre-multiply the alpha for use in texture-maps.
+            r *= static_cast<float>(get_sample(offset + (nr_samples - 1) * sample_size)) * alpha_mul;
+        }
+        return r;
+    };
+
+    auto x = 0_uz;
+#if defined(HI_HAS_AVX2) && defined(HI_HAS_F16C)
+    x = data_to_image_line_avx2<BitDepth, IsColor, HasAlpha>(
+        bytes, line, width, transfer_function, _color_is_sRGB ? nullptr : &_color_to_sRGB);
+#endif
+#if defined(HI_HAS_SSE2)
+    // Convert two pixels at a time to float16.
+    for (; x + 2 <= width; x += 2) {
+        native_simd<float16, 8>{get_pixel(x).reg(), get_pixel(x + 1).reg()}.store(line.data() + x);
+    }
+#endif
+    for (; x != width; ++x) {
+        line[x] = get_pixel(x);
     }
 }
 
-void png::data_to_image(bstring bytes, pixmap_span<sfloat_rgba16> image) const noexcept
+void png::data_to_image_line(std::span<std::byte const> bytes, std::span<sfloat_rgba16> line) const noexcept
 {
-    auto bytes_span = std::span(bytes);
-
-    for (int y = 0; y != _height; ++y) {
-        int inv_y = _height - y - 1;
+    hi_axiom(_bit_depth == 8 or _bit_depth == 16);
+    hi_axiom(not _is_palletted);
 
-        auto bytes_line = bytes_span.subspan(inv_y * _stride + 1, _bytes_per_line);
-        auto pixel_line = image[y];
-        data_to_image_line(bytes_line, pixel_line);
+    if (_bit_depth == 16) {
+        if (_is_color) {
+            return _has_alpha ? data_to_image_line<16, true, true>(bytes, line) : data_to_image_line<16, true, false>(bytes, line);
+        } else {
+            return _has_alpha ? data_to_image_line<16, false, true>(bytes, line) :
+                                data_to_image_line<16, false, false>(bytes, line);
+        }
+    } else {
+        if (_is_color) {
+            return _has_alpha ? data_to_image_line<8, true, true>(bytes, line) : data_to_image_line<8, true, false>(bytes, line);
+        } else {
+            return _has_alpha ? data_to_image_line<8, false, true>(bytes, line) : data_to_image_line<8, false, false>(bytes, line);
+        }
     }
 }
 
 void png::decode_image(pixmap_span<sfloat_rgba16> image) const
 {
+    decode_lines(image, nullptr);
+}
+
+void png::decode_image(pixmap_span<sfloat_rgba16> image, thread_pool& pool) const
+{
+    decode_lines(image, std::addressof(pool));
+}
+
+void png::decode_lines(pixmap_span<sfloat_rgba16> image, thread_pool *pool) const
+{
+    hi_axiom(image.width() == width() and image.height() == height());
+
+    // The image data is decompressed and unfiltered one line at a time, directly
+    // from the IDAT chunks in the file. Only the previous line is needed to unfilter
+    // the current line.
+    auto decoder = zlib_decoder{};
+    auto chunk_it = _idat_chunk_data.begin();
+    auto chunk_offset = 0_uz;
+
+    // Decompress and unfilter the next line.
     // There is a filter selection byte in front of every line.
-    hilet image_data_size = _stride * _height;
+    auto read_line = [&](std::span<std::byte> line, std::span<std::byte const> prev_line) {
+        auto line_offset = 0_uz;
+        while (line_offset != line.size()) {
+            hi_check(not decoder.done(), "Uncompressed image data has incorrect size.");
+            hi_check(chunk_it != _idat_chunk_data.end(), "Compressed image data is incomplete.");
+
+            hilet[consumed, produced] = decoder.decode(chunk_it->subspan(chunk_offset), line.subspan(line_offset));
+            chunk_offset += consumed;
+            line_offset += produced;
+
+            if (chunk_offset == chunk_it->size()) {
+                ++chunk_it;
+                chunk_offset = 0;
+            }
+        }
+
+        hilet line_bytes = std::span(reinterpret_cast<uint8_t *>(line.data()), line.size());
+        hilet prev_line_bytes = std::span(reinterpret_cast<uint8_t const *>(prev_line.data()), prev_line.size());
+        unfilter_line(line_bytes, prev_line_bytes.subspan(1, _bytes_per_line));
+    };
+
+    // The number of pixels in a band of rows that is converted by a single job.
+    constexpr auto band_size = 0x1'0000_uz;
+
+    hilet band_height = std::max(1_uz, band_size / width());
+    if (pool == nullptr or pool->size() <= 1 or height() <= band_height) {
+        auto line = bstring(_stride, std::byte{0});
+        auto prev_line = bstring(_stride, std::byte{0});
+
+        for (auto y = 0_uz; y != height(); ++y) {
+            read_line(line, prev_line);
+            data_to_image_line(std::span{line}.subspan(1, _bytes_per_line), image[height() - y - 1]);
+            std::swap(line, prev_line);
+        }
+        return;
+    }
+
+    // Decompress and unfilter a band of lines on this thread, while the previous bands
+    // are converted to pixels on the thread pool.
+    auto jobs = std::vector<pool_future<void>>{};
+    jobs.reserve((height() + band_height - 1) / band_height);
 
-    auto image_data = decompress_IDATs(image_data_size);
-    hi_check(ssize(image_data) == image_data_size, "Uncompressed image data has incorrect size.");
+    // The jobs reference the image and this png object, wait for them to finish
+    // even when decoding fails.
+    hilet wait_for_jobs = defer([&] {
+        for (hilet& job : jobs) {
+            pool->wait(job);
+        }
+    });
 
-    unfilter_lines(image_data);
+    auto prev_line = bstring(_stride, std::byte{0});
+    for (auto y = 0_uz; y < height(); y += band_height) {
+        hilet band_rows = std::min(band_height, height() - y);
 
-    data_to_image(image_data, image);
+        auto band = bstring(band_rows * _stride, std::byte{0});
+        for (auto i = 0_uz; i != band_rows; ++i) {
+            hilet line = std::span{band}.subspan(i * _stride, _stride);
+            read_line(line, i == 0 ? std::span<std::byte const>{prev_line} : std::span{band}.subspan((i - 1) * _stride, _stride));
+        }
+        std::copy_n(band.data() + (band_rows - 1) * _stride, _stride, prev_line.data());
+
+        jobs.push_back(pool->async([this, image, y, band_rows, band = std::move(band)]() mutable {
+            for (auto i = 0_uz; i != band_rows; ++i) {
+                hilet line = std::span{band}.subspan(i * _stride + 1, _bytes_per_line);
+                data_to_image_line(line, image[height() - (y + i) - 1]);
+            }
+        }));
+    }
 }
 
 pixmap<sfloat_rgba16> png::load(std::filesystem::path const &path)
@@ -458,4 +843,336 @@ pixmap<sfloat_rgba16> png::load(std::filesystem::path const &path)
     return image;
 }
 
+pool_future<pixmap<sfloat_rgba16>> png::load_async(std::filesystem::path const& path, thread_pool& pool)
+{
+    return pool.async([path, &pool] {
+        hilet png_data = png(file_view{path});
+        auto image = pixmap<sfloat_rgba16>{png_data.width(), png_data.height()};
+        png_data.decode_image(image, pool);
+        return image;
+    });
+}
+
+std::vector<pool_future<pixmap<sfloat_rgba16>>>
+png::load_async(std::span<std::filesystem::path const> paths, thread_pool& pool)
+{
+    auto r = std::vector<pool_future<pixmap<sfloat_rgba16>>>{};
+    r.reserve(paths.size());
+    for (hilet& path : paths) {
+        r.push_back(load_async(path, pool));
+    }
+    return r;
+}
+
+/** Table for calculating the CRC-32 of png chunks, eight bytes at a time.
+ */
+constexpr auto png_crc32_table = [] {
+    auto r = std::array<std::array<uint32_t, 256>, 8>{};
+    for (auto i = 0_uz; i != 256; ++i) {
+        auto c = static_cast<uint32_t>(i);
+        for (auto j = 0; j != 8; ++j) {
+            c = (c & 1) ? 0xedb8'8320 ^ (c >> 1) : c >> 1;
+        }
+        r[0][i] = c;
+    }
+
+    for (auto i = 0_uz; i != 256; ++i) {
+        for (auto j = 1_uz; j != 8; ++j) {
+            r[j][i] = (r[j - 1][i] >> 8) ^ r[0][r[j - 1][i] & 0xff];
+        }
+    }
+    return r;
+}();
+
+[[nodiscard]] static uint32_t png_crc32(std::span<std::byte const> bytes) noexcept
+{
+    hilet& t = png_crc32_table;
+    auto crc = ~uint32_t{0};
+
+    auto i = 0_uz;
+    for (; i + 8 <= bytes.size(); i += 8) {
+        hilet lo = crc ^ load_le<uint32_t>(bytes.data() + i);
+        hilet hi = load_le<uint32_t>(bytes.data() + i + 4);
+        crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^ t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^ t[3][hi & 0xff] ^
+            t[2][(hi >> 8) & 0xff] ^ t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+    }
+    for (; i != bytes.size(); ++i) {
+        crc = t[0][(crc ^ std::to_integer<uint32_t>(bytes[i])) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void write_png_chunk(bstring& out, char const (&type)[5], std::span<std::byte const> data)
+{
+    hilet offset = out.size();
+    out.resize(offset + 12 + data.size());
+
+    store_be(narrow_cast<uint32_t>(data.size()), out.data() + offset);
+    std::transform(type, type + 4, out.data() + offset + 4, [](char c) {
+        return static_cast<std::byte>(c);
+    });
+    std::copy_n(data.data(), data.size(), out.data() + offset + 8);
+
+    // The CRC is calculated over the type and the data of the chunk.
+    hilet crc = png_crc32(std::span{out}.subspan(offset + 4, data.size() + 4));
+    store_be(crc, out.data() + offset + 8 + data.size());
+}
+
+/** Filter a single byte of a png line.
+ *
+ * @tparam Filter The filter type: 0 = none, 1 = sub, 2 = up, 3 = average, 4 = paeth.
+ * @param x The byte to filter.
+ * @param a The byte to the left.
+ * @param b The byte above.
+ * @param c The byte above and to the left.
+ */
+template<int Filter>
+[[nodiscard]] static uint8_t filter_png_byte(uint8_t x, uint8_t a, uint8_t b, uint8_t c) noexcept
+{
+    if constexpr (Filter == 1) {
+        return static_cast<uint8_t>(x - a);
+    } else if constexpr (Filter == 2) {
+        return static_cast<uint8_t>(x - b);
+    } else if constexpr (Filter == 3) {
+        return static_cast<uint8_t>(x - (a + b) / 2);
+    } else if constexpr (Filter == 4) {
+        return static_cast<uint8_t>(x - paeth_predictor(a, b, c));
+    } else {
+        return x;
+    }
+}
+
+#if defined(HI_HAS_SSE2)
+template<int Filter>
+[[nodiscard]] hi_force_inline static native_simd<uint8_t, 16> filter_png_byte(
+    native_simd<uint8_t, 16> x,
+    native_simd<uint8_t, 16> a,
+    native_simd<uint8_t, 16> b,
+    native_simd<uint8_t, 16> c) noexcept
+{
+    if constexpr (Filter == 1) {
+        return x - a;
+    } else if constexpr (Filter == 2) {
+        return x - b;
+    } else if constexpr (Filter == 3) {
+        return x - average_predictor(a, b);
+    } else if constexpr (Filter == 4) {
+        return x - paeth_predictor(a, b, c);
+    } else {
+        return x;
+    }
+}
+#endif
+
+/** Filter a line of a png image.
+ *
+ * Unlike unfiltering, filtering only depends on the original bytes, so the bytes
+ * of a line can be filtered 16 at a time.
+ *
+ * @tparam Filter The filter type: 0 = none, 1 = sub, 2 = up, 3 = average, 4 = paeth.
+ * @tparam Store When true the filtered line is written to @a out, otherwise only the cost is calculated.
+ * @param line The line to filter, the pixel in front of the line must be zero.
+ * @param prev_line The previous line, the pixel in front of the line must be zero.
+ * @param size The number of bytes in a line.
+ * @param bytes_per_pixel The number of bytes in a pixel.
+ * @param out The filtered line.
+ * @return The sum of the absolute values of the filtered bytes, interpreted as signed values.
+ */
+template<int Filter, bool Store>
+static std::size_t filter_png_line(
+    uint8_t const *line,
+    uint8_t const *prev_line,
+    std::size_t size,
+    std::size_t bytes_per_pixel,
+    uint8_t *out) noexcept
+{
+    // The bytes to the left of the current bytes.
+    hilet left = line - bytes_per_pixel;
+    hilet left_up = prev_line - bytes_per_pixel;
+
+    auto cost = 0_uz;
+    auto i = 0_uz;
+#if defined(HI_HAS_SSE2)
+    using S = native_simd<uint8_t, 16>;
+
+    for (; i + S::size <= size; i += S::size) {
+        hilet filtered = filter_png_byte<Filter>(S{line + i}, S{left + i}, S{prev_line + i}, S{left_up + i});
+        if constexpr (Store) {
+            filtered.store(out + i);
+        } else {
+            cost += horizontal_sum(min(filtered, S{} - filtered));
+        }
+    }
+#endif
+
+    for (; i != size; ++i) {
+        hilet filtered = filter_png_byte<Filter>(line[i], left[i], prev_line[i], left_up[i]);
+        if constexpr (Store) {
+            out[i] = filtered;
+        } else {
+            cost += narrow_cast<std::size_t>(std::abs(static_cast<int8_t>(filtered)));
+        }
+    }
+    return cost;
+}
+
+/** Filter a line of a png image with the filter that is estimated to compress best.
+ *
+ * @param line The line to filter, the pixel in front of the line must be zero.
+ * @param prev_line The previous line, the pixel in front of the line must be zero.
+ * @param size The number of bytes in a line.
+ * @param bytes_per_pixel The number of bytes in a pixel.
+ * @param out The filter type followed by the filtered line.
+ */
+static void filter_png_line(
+    uint8_t const *line,
+    uint8_t const *prev_line,
+    std::size_t size,
+    std::size_t bytes_per_pixel,
+    uint8_t *out) noexcept
+{
+    hilet costs = std::array{
+        filter_png_line<0, false>(line, prev_line, size, bytes_per_pixel, nullptr),
+        filter_png_line<1, false>(line, prev_line, size, bytes_per_pixel, nullptr),
+        filter_png_line<2, false>(line, prev_line, size, bytes_per_pixel, nullptr),
+        filter_png_line<3, false>(line, prev_line, size, bytes_per_pixel, nullptr),
+        filter_png_line<4, false>(line, prev_line, size, bytes_per_pixel, nullptr)};
+
+    out[0] = narrow_cast<uint8_t>(std::distance(costs.begin(), std::ranges::min_element(costs)));
+    switch (out[0]) {
+    case 0: filter_png_line<0, true>(line, prev_line, size, bytes_per_pixel, out + 1); break;
+    case 1: filter_png_line<1, true>(line, prev_line, size, bytes_per_pixel, out + 1); break;
+    case 2: filter_png_line<2, true>(line, prev_line, size, bytes_per_pixel, out + 1); break;
+    case 3: filter_png_line<3, true>(line, prev_line, size, bytes_per_pixel, out + 1); break;
+    case 4: filter_png_line<4, true>(line, prev_line, size, bytes_per_pixel, out + 1); break;
+    default: hi_no_default();
+    }
+}
+
+/** Encode an image with 8 bits per sample as a png file.
+ *
+ * @param width The width of the image in pixels.
+ * @param height The height of the image in pixels.
+ * @param color_type The png color type.
+ * @param bytes_per_pixel The number of bytes of each pixel.
+ * @param level The deflate compression level.
+ * @param get_line A function `void(std::size_t y, std::span<uint8_t> line)` which writes the samples
+ *                 of a line, the lines are requested from top to bottom.
+ * @return The data of the png file.
+ */
+[[nodiscard]] static bstring
+encode_png(std::size_t width, std::size_t height, uint8_t color_type, std::size_t bytes_per_pixel, int level, auto const& get_line)
+{
+    hi_axiom(width > 0 and width <= 0x7fff'ffff);
+    hi_axiom(height > 0 and height <= 0x7fff'ffff);
+    hi_axiom(level >= 0 and level <= 9);
+
+    hilet bytes_per_line = width * bytes_per_pixel;
+    hilet stride = bytes_per_line + 1;
+
+    // Both lines are preceded by a pixel of zeros, which are the neighbours of the first pixel.
+    auto line_buffer = std::vector<uint8_t>(2 * (bytes_per_pixel + bytes_per_line), 0);
+    auto line = std::span{line_buffer}.subspan(bytes_per_pixel, bytes_per_line);
+    auto prev_line = std::span{line_buffer}.subspan(2 * bytes_per_pixel + bytes_per_line, bytes_per_line);
+
+    auto filtered = std::vector<uint8_t>(height * stride);
+    for (auto y = 0_uz; y != height; ++y) {
+        get_line(y, line);
+
+        hilet out = filtered.data() + y * stride;
+        if (level == 0) {
+            // Without compression there is no reason to spend time on filtering.
+            out[0] = 0;
+            std::ranges::copy(line, out + 1);
+        } else {
+            filter_png_line(line.data(), prev_line.data(), bytes_per_line, bytes_per_pixel, out);
+        }
+        std::swap(line, prev_line);
+    }
+
+    auto r = bstring{};
+    for (hilet c : {137, 80, 78, 71, 13, 10, 26, 10}) {
+        r += static_cast<std::byte>(c);
+    }
+
+    auto ihdr = std::array<std::byte, 13>{};
+    store_be(narrow_cast<uint32_t>(width), ihdr.data());
+    store_be(narrow_cast<uint32_t>(height), ihdr.data() + 4);
+    ihdr[8] = std::byte{8};
+    ihdr[9] = static_cast<std::byte>(color_type);
+    // Compression method, filter method and interlace method are all zero.
+    write_png_chunk(r, "IHDR", ihdr);
+
+    if (color_type & 2) {
+        // Perceptual rendering intent.
+        hilet srgb = std::array{std::byte{0}};
+        write_png_chunk(r, "sRGB", srgb);
+    }
+
+    write_png_chunk(r, "IDAT", zlib_compress(as_bytes(std::span{filtered}), level));
+    write_png_chunk(r, "IEND", {});
+    return r;
+}
+
+/** Convert a linear, alpha pre-multiplied pixel to gamma corrected sRGB with straight alpha.
+ */
+hi_force_inline static void sRGBA8_from_pixel(sfloat_rgba16 pixel, uint8_t *out) noexcept
+{
+    hilet v = static_cast<f16x4>(pixel);
+
+    if (v[3].get() == 0x3c00) {
+        // Opaque pixels are most common, and can be directly converted by table lookup.
+        out[0] = sRGB_linear16_to_gamma8(v[0]);
+        out[1] = sRGB_linear16_to_gamma8(v[1]);
+        out[2] = sRGB_linear16_to_gamma8(v[2]);
+        out[3] = 255;
+        return;
+    }
+
+    hilet v_ = static_cast<f32x4>(v);
+    hilet alpha = std::clamp(v_[3], 0.0f, 1.0f);
+    if (alpha == 0.0f) {
+        out[0] = out[1] = out[2] = out[3] = 0;
+        return;
+    }
+
+    out[0] = sRGB_linear16_to_gamma8(static_cast<float16>(v_[0] / alpha));
+    out[1] = sRGB_linear16_to_gamma8(static_cast<float16>(v_[1] / alpha));
+    out[2] = sRGB_linear16_to_gamma8(static_cast<float16>(v_[2] / alpha));
+    out[3] = narrow_cast<uint8_t>(std::round(alpha * 255.0f));
+}
+
+bstring png::encode(pixmap_span<sfloat_rgba16 const> image, int level)
+{
+    return encode_png(image.width(), image.height(), 6, 4, level, [&](std::size_t y, std::span<uint8_t> line) {
+        // The rows of the image are stored bottom to top.
+        hilet row = image[image.height() - y - 1];
+        for (auto x = 0_uz; x != row.size(); ++x) {
+            sRGBA8_from_pixel(row[x], line.data() + x * 4);
+        }
+    });
+}
+
+bstring png::encode(pixmap_span<uint8_t const> image, int level)
+{
+    return encode_png(image.width(), image.height(), 0, 1, level, [&](std::size_t y, std::span<uint8_t> line) {
+        // The rows of the image are stored bottom to top.
+        std::ranges::copy(image[image.height() - y - 1], line.begin());
+    });
+}
+
+void png::save(std::filesystem::path const& path, pixmap_span<sfloat_rgba16 const> image, int level)
+{
+    auto f = file{path, access_mode::truncate_or_create_for_write};
+    f.write(encode(image, level));
+    f.close();
+}
+
+void png::save(std::filesystem::path const& path, pixmap_span<uint8_t const> image, int level)
+{
+    auto f = file{path, access_mode::truncate_or_create_for_write};
+    f.write(encode(image, level));
+    f.close();
+}
+
 } // namespace hi::inline v1
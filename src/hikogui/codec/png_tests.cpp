@@ -0,0 +1,154 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "png.hpp"
+#include "../color/module.hpp"
+#include "../file/file.hpp"
+#include "../utility/module.hpp"
+#include "../thread_pool.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+using namespace hi;
+
+/** Create an image with gradients, noise and flat areas, to exercise every line filter.
+ */
+[[nodiscard]] static pixmap<sfloat_rgba16> make_image(std::size_t width, std::size_t height, bool translucent)
+{
+    auto r = pixmap<sfloat_rgba16>{width, height};
+    for (auto y = 0_uz; y != height; ++y) {
+        for (auto x = 0_uz; x != width; ++x) {
+            hilet red = narrow_cast<float>(x * 255 / width) / 255.0f;
+            hilet green = narrow_cast<float>(y * 255 / height) / 255.0f;
+            hilet blue = narrow_cast<float>((x * 7919 + y * 104729) % 256) / 255.0f;
+            hilet alpha = translucent ? narrow_cast<float>((x + y) % 256) / 255.0f : 1.0f;
+
+            r[y][x] = f32x4{sRGB_gamma_to_linear(red), sRGB_gamma_to_linear(green), sRGB_gamma_to_linear(blue), 1.0f} * alpha;
+        }
+    }
+    return r;
+}
+
+[[nodiscard]] static pixmap<sfloat_rgba16> save_and_load(bstring const& bytes)
+{
+    hilet path = std::filesystem::temp_directory_path() / "hikogui_png_test.png";
+    {
+        auto f = file{path, access_mode::truncate_or_create_for_write};
+        f.write(bytes);
+    }
+    auto r = png::load(path);
+    std::filesystem::remove(path);
+    return r;
+}
+
+TEST(png, encode_opaque)
+{
+    auto image = make_image(301, 203, false);
+
+    for (hilet level : {0, 1, 6, 9}) {
+        hilet decoded = save_and_load(png::encode(image, level));
+        ASSERT_EQ(decoded.width(), image.width());
+        ASSERT_EQ(decoded.height(), image.height());
+
+        // Opaque pixels that originated from 8 bit sRGB values must survive the round trip exactly.
+        ASSERT_TRUE(decoded == image) << "level " << level;
+    }
+}
+
+TEST(png, encode_translucent)
+{
+    auto image = make_image(67, 45, true);
+    hilet decoded = save_and_load(png::encode(image));
+
+    for (auto y = 0_uz; y != image.height(); ++y) {
+        for (auto x = 0_uz; x != image.width(); ++x) {
+            hilet expected = static_cast<f32x4>(static_cast<f16x4>(image[y][x]));
+            hilet result = static_cast<f32x4>(static_cast<f16x4>(decoded[y][x]));
+            for (auto i = 0_uz; i != 4; ++i) {
+                ASSERT_NEAR(result[i], expected[i], 0.01f) << "x=" << x << " y=" << y << " i=" << i;
+            }
+        }
+    }
+}
+
+TEST(png, encode_gray)
+{
+    auto image = pixmap<uint8_t>{100, 50};
+    for (auto y = 0_uz; y != image.height(); ++y) {
+        for (auto x = 0_uz; x != image.width(); ++x) {
+            image[y][x] = narrow_cast<uint8_t>((x * 3 + y * 5) % 256);
+        }
+    }
+
+    hilet decoded = save_and_load(png::encode(image));
+    for (auto y = 0_uz; y != image.height(); ++y) {
+        for (auto x = 0_uz; x != image.width(); ++x) {
+            hilet expected = sRGB_gamma_to_linear(narrow_cast<float>(image[y][x]) / 255.0f);
+            auto expected_pixel = sfloat_rgba16{};
+            expected_pixel = f32x4{expected, expected, expected, 1.0f};
+            ASSERT_EQ(decoded[y][x], expected_pixel) << "x=" << x << " y=" << y;
+        }
+    }
+}
+
+TEST(png, decode_banded)
+{
+    // The width is not a divisor of the band size, so that the bands and the last band are of different heights.
+    auto image = make_image(300, 1000, true);
+
+    hilet path = std::filesystem::temp_directory_path() / "hikogui_png_banded_test.png";
+    {
+        auto f = file{path, access_mode::truncate_or_create_for_write};
+        f.write(png::encode(image));
+    }
+
+    hilet png_data = png{path};
+    auto expected = pixmap<sfloat_rgba16>{png_data.width(), png_data.height()};
+    png_data.decode_image(expected);
+
+    auto pool = thread_pool{4};
+    auto banded = pixmap<sfloat_rgba16>{png_data.width(), png_data.height()};
+    png_data.decode_image(banded, pool);
+    ASSERT_TRUE(banded == expected);
+
+    auto paths = std::vector<std::filesystem::path>{path, path, path};
+    auto futures = png::load_async(paths, pool);
+    for (auto& future : futures) {
+        ASSERT_TRUE(future.get() == expected);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST(png, unfilter_simd)
+{
+    auto engine = std::mt19937{42};
+    auto dist = std::uniform_int_distribution<int>{0, 255};
+
+    // Lines of 1 to 40 pixels, so that every remainder of the 16 byte SIMD registers is used.
+    for (auto bytes_per_pixel : {1_uz, 2_uz, 3_uz, 4_uz, 6_uz, 8_uz}) {
+        for (auto width = 1_uz; width <= 40; ++width) {
+            hilet size = width * bytes_per_pixel;
+
+            auto prev_line = std::vector<uint8_t>(size);
+            auto line = std::vector<uint8_t>(size);
+            for (auto i = 0_uz; i != size; ++i) {
+                prev_line[i] = narrow_cast<uint8_t>(dist(engine));
+                line[i] = narrow_cast<uint8_t>(dist(engine));
+            }
+
+            for (auto filter_type = uint8_t{0}; filter_type <= 4; ++filter_type) {
+                auto expected = line;
+                detail::png_unfilter_line(expected, prev_line, filter_type, bytes_per_pixel, false);
+
+                auto result = line;
+                detail::png_unfilter_line(result, prev_line, filter_type, bytes_per_pixel, true);
+                ASSERT_EQ(result, expected) << "bytes_per_pixel=" << bytes_per_pixel << " width=" << width
+                                            << " filter_type=" << static_cast<int>(filter_type);
+            }
+        }
+    }
+}
@@ -4,13 +4,54 @@
 
 #pragma once
 
+#include "inflate.hpp"
 #include "../file/file_view.hpp"
 #include "../byte_string.hpp"
 #include <cstddef>
+#include <cstdint>
+#include <array>
 #include <filesystem>
 
 namespace hi::inline v1 {
 
+/** A streaming decoder for the zlib format.
+ *
+ * @see inflate_decoder for the semantics of `decode()`.
+ */
+class zlib_decoder {
+public:
+    using result_type = inflate_decoder::result_type;
+
+    /** Check if the stream, including the trailer, was decoded and all data was written to the output.
+     *
+     * The ADLER32 checksum in the trailer has been verified when this returns true.
+     */
+    [[nodiscard]] bool done() const noexcept
+    {
+        return _inflate.done() and _trailer_size == 4;
+    }
+
+    /** Decode a chunk of zlib compressed data.
+     *
+     * @param input The next chunk of compressed data.
+     * @param output The buffer to write the decompressed data into.
+     * @return The number of bytes consumed from the input and written to the output.
+     * @throw parse_error When the compressed data is invalid, or the ADLER32 checksum does not match.
+     */
+    result_type decode(std::span<std::byte const> input, std::span<std::byte> output);
+
+private:
+    inflate_decoder _inflate = {};
+    std::array<uint8_t, 2> _header = {};
+    std::size_t _header_size = 0;
+    std::array<uint8_t, 4> _trailer = {};
+    std::size_t _trailer_size = 0;
+
+    /** The ADLER32 checksum of the data written to the output so far.
+     */
+    uint32_t _adler32 = 1;
+};
+
 bstring zlib_decompress(std::span<std::byte const> bytes, std::size_t max_size = 0x01000000);
 
 inline bstring zlib_decompress(std::filesystem::path const &path, std::size_t max_size = 0x01000000)
@@ -18,4 +59,12 @@ inline bstring zlib_decompress(std::filesystem::path const &path, std::size_t ma
     return zlib_decompress(as_span<std::byte const>(file_view(path)), max_size);
 }
 
+/** Compress data into the zlib format.
+ *
+ * @param bytes The data to compress.
+ * @param level The compression level between 0 and 9, see `deflate()`.
+ * @return The zlib header, the compressed data and the ADLER32 checksum.
+ */
+[[nodiscard]] bstring zlib_compress(std::span<std::byte const> bytes, int level = 6);
+
 } // namespace hi::inline v1
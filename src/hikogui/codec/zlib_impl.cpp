@@ -4,6 +4,7 @@
 
 #include "zlib.hpp"
 #include "inflate.hpp"
+#include "deflate.hpp"
 #include "../utility/module.hpp"
 #include "../placement.hpp"
 
@@ -14,22 +15,93 @@ struct zlib_header {
     uint8_t FLG;
 };
 
-bstring zlib_decompress(std::span<std::byte const> bytes, std::size_t max_size)
+static void zlib_check_header(uint8_t CMF, uint8_t FLG)
 {
-    auto offset = 0_uz;
+    hilet header_chksum = CMF * 256 + FLG;
+    hi_check(header_chksum % 31 == 0, "zlib header checksum failed.");
 
-    hilet header = make_placement_ptr<zlib_header>(bytes, offset);
+    hi_check((CMF & 0xf) == 8, "zlib compression method must be 8");
+    hi_check(((CMF >> 4) & 0xf) <= 7, "zlib LZ77 window too large");
+    hi_check((FLG & 0x20) == 0, "zlib must not use a preset dictionary");
+}
 
-    hilet header_chksum = header->CMF * 256 + header->FLG;
-    hi_check(header_chksum % 31 == 0, "zlib header checksum failed.");
+/** Calculate the ADLER32 checksum.
+ *
+ * @param bytes The data to add to the checksum.
+ * @param checksum The checksum of the data before @a bytes.
+ * @return The checksum including @a bytes.
+ */
+[[nodiscard]] static uint32_t zlib_adler32(std::span<std::byte const> bytes, uint32_t checksum = 1) noexcept
+{
+    // The largest number of bytes that can be summed before the 32 bit sums overflow.
+    constexpr auto max_run = 5552_uz;
+    constexpr auto modulo = uint32_t{65521};
 
-    hi_check((header->CMF & 0xf) == 8, "zlib compression method must be 8");
-    hi_check(((header->CMF >> 4) & 0xf) <= 7, "zlib LZ77 window too large");
-    hi_check((header->FLG & 0x20) == 0, "zlib must not use a preset dictionary");
+    auto a = checksum & 0xffff;
+    auto b = checksum >> 16;
+    while (not bytes.empty()) {
+        hilet run = std::min(bytes.size(), max_run);
 
-    if (header->FLG & 0x20) {
-        [[maybe_unused]] auto FDICT = make_placement_ptr<big_uint32_buf_t>(bytes, offset);
+        // Sum four bytes at a time to shorten the dependency chain on a and b.
+        auto i = 0_uz;
+        for (; i + 4 <= run; i += 4) {
+            hilet c0 = std::to_integer<uint32_t>(bytes[i]);
+            hilet c1 = std::to_integer<uint32_t>(bytes[i + 1]);
+            hilet c2 = std::to_integer<uint32_t>(bytes[i + 2]);
+            hilet c3 = std::to_integer<uint32_t>(bytes[i + 3]);
+            b += 4 * a + 4 * c0 + 3 * c1 + 2 * c2 + c3;
+            a += c0 + c1 + c2 + c3;
+        }
+        for (; i != run; ++i) {
+            a += std::to_integer<uint32_t>(bytes[i]);
+            b += a;
+        }
+        a %= modulo;
+        b %= modulo;
+        bytes = bytes.subspan(run);
     }
+    return (b << 16) | a;
+}
+
+zlib_decoder::result_type zlib_decoder::decode(std::span<std::byte const> input, std::span<std::byte> output)
+{
+    auto r = result_type{};
+
+    while (_header_size != _header.size() and r.consumed != input.size()) {
+        _header[_header_size++] = std::to_integer<uint8_t>(input[r.consumed++]);
+        if (_header_size == _header.size()) {
+            zlib_check_header(_header[0], _header[1]);
+        }
+    }
+
+    if (_header_size == _header.size() and not _inflate.done()) {
+        hilet[consumed, produced] = _inflate.decode(input.subspan(r.consumed), output);
+        _adler32 = zlib_adler32(output.first(produced), _adler32);
+        r.consumed += consumed;
+        r.produced += produced;
+    }
+
+    if (_inflate.done()) {
+        while (_trailer_size != _trailer.size() and r.consumed != input.size()) {
+            _trailer[_trailer_size++] = std::to_integer<uint8_t>(input[r.consumed++]);
+            if (_trailer_size == _trailer.size()) {
+                hilet expected = (uint32_t{_trailer[0]} << 24) | (uint32_t{_trailer[1]} << 16) | (uint32_t{_trailer[2]} << 8) |
+                    uint32_t{_trailer[3]};
+                hi_check(_adler32 == expected, "zlib ADLER32 checksum failed.");
+            }
+        }
+    }
+
+    return r;
+}
+
+bstring zlib_decompress(std::span<std::byte const> bytes, std::size_t max_size)
+{
+    auto offset = 0_uz;
+
+    hilet header = make_placement_ptr<zlib_header>(bytes, offset);
+
+    zlib_check_header(header->CMF, header->FLG);
 
     auto r = inflate(bytes, offset, max_size);
 
@@ -38,4 +110,25 @@ bstring zlib_decompress(std::span<std::byte const> bytes, std::size_t max_size)
     return r;
 }
 
+bstring zlib_compress(std::span<std::byte const> bytes, int level)
+{
+    // 32 KiB window and deflate compression method.
+    constexpr auto CMF = uint8_t{0x78};
+    // The compression level is stored in the upper two bits of FLG.
+    hilet FLEVEL = level <= 1 ? 0 : level <= 5 ? 1 : level == 6 ? 2 : 3;
+    auto FLG = narrow_cast<uint8_t>(FLEVEL << 6);
+    FLG += narrow_cast<uint8_t>((31 - (CMF * 256 + FLG) % 31) % 31);
+
+    auto r = bstring{};
+    r += static_cast<std::byte>(CMF);
+    r += static_cast<std::byte>(FLG);
+    r += deflate(bytes, level);
+
+    hilet checksum = zlib_adler32(bytes);
+    for (auto shift = 24; shift >= 0; shift -= 8) {
+        r += static_cast<std::byte>((checksum >> shift) & 0xff);
+    }
+    return r;
+}
+
 } // namespace hi::inline v1
\ No newline at end of file
@@ -0,0 +1,87 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "zlib.hpp"
+#include "../utility/module.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+using namespace hi;
+
+/** Decode a zlib stream with small input and output buffers.
+ *
+ * @param decoder The decoder to use.
+ * @param compressed The zlib stream.
+ * @return The decompressed data.
+ */
+static bstring zlib_decode(zlib_decoder& decoder, std::span<std::byte const> compressed)
+{
+    auto r = bstring{};
+    auto buffer = std::array<std::byte, 100>{};
+    while (not decoder.done()) {
+        hilet[consumed, produced] = decoder.decode(compressed.first(std::min(compressed.size(), 7_uz)), buffer);
+        r.append(buffer.data(), produced);
+        compressed = compressed.subspan(consumed);
+
+        if (consumed == 0 and produced == 0) {
+            // The decoder needs more input.
+            break;
+        }
+    }
+    return r;
+}
+
+[[nodiscard]] static bstring zlib_tests_original()
+{
+    auto r = bstring{};
+    for (auto i = 0; i != 100; ++i) {
+        for (hilet c : std::string_view{"The quick brown fox jumps over the lazy dog. "}) {
+            r += static_cast<std::byte>(c);
+        }
+        r += static_cast<std::byte>(i);
+    }
+    return r;
+}
+
+TEST(zlib, decode)
+{
+    hilet original = zlib_tests_original();
+    hilet compressed = zlib_compress(original);
+
+    auto decoder = zlib_decoder{};
+    ASSERT_EQ(zlib_decode(decoder, compressed), original);
+    ASSERT_TRUE(decoder.done());
+}
+
+TEST(zlib, bad_header_checksum)
+{
+    auto compressed = zlib_compress(zlib_tests_original());
+    compressed[1] = static_cast<std::byte>(std::to_integer<uint8_t>(compressed[1]) ^ 1);
+
+    auto decoder = zlib_decoder{};
+    ASSERT_THROW(zlib_decode(decoder, compressed), parse_error);
+}
+
+TEST(zlib, bad_adler32)
+{
+    auto compressed = zlib_compress(zlib_tests_original());
+    compressed.back() = static_cast<std::byte>(std::to_integer<uint8_t>(compressed.back()) ^ 1);
+
+    auto decoder = zlib_decoder{};
+    ASSERT_THROW(zlib_decode(decoder, compressed), parse_error);
+}
+
+TEST(zlib, truncated_trailer)
+{
+    hilet original = zlib_tests_original();
+    auto compressed = zlib_compress(original);
+    compressed.resize(compressed.size() - 2);
+
+    // All data is decompressed, but the stream is not complete without the full checksum.
+    auto decoder = zlib_decoder{};
+    ASSERT_EQ(zlib_decode(decoder, compressed), original);
+    ASSERT_FALSE(decoder.done());
+}
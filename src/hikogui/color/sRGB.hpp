@@ -79,7 +79,7 @@ namespace detail {
 
     for (int i = 0; i != 65536; ++i) {
         r[i] = narrow_cast<uint8_t>(
-            std::floor(std::clamp(sRGB_linear_to_gamma(float16::from_uint16_t(narrow_cast<uint16_t>(i))), 0.0f, 1.0f) * 255.0f));
+            std::round(std::clamp(sRGB_linear_to_gamma(float16::from_uint16_t(narrow_cast<uint16_t>(i))), 0.0f, 1.0f) * 255.0f));
     }
 
     return r;
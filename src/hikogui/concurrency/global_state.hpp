@@ -45,6 +45,7 @@ enum class global_state_type : uint64_t {
 
     log_is_running = 0x1'00,
     time_stamp_utc_is_running = 0x2'00,
+    trace_is_running = 0x4'00,
 
     system_is_running = 0x1'000000'00,
     system_is_shutting_down = 0x2'000000'00,
@@ -4,17 +4,232 @@
 
 #pragma once
 
-#include "wfree_idle_count.hpp"
 #include "unfair_mutex.hpp"
+#include "subsystem.hpp"
 #include "../utility/module.hpp"
 #include <vector>
 #include <tuple>
 #include <mutex>
 #include <memory>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
 
 namespace hi::inline v1 {
+namespace detail {
+
+/** The read-side state of a single thread.
+ *
+ * Each thread has its own reader, on its own cache-line, so that
+ * readers on different cores never write to the same cache-line.
+ */
+struct alignas(hi::hardware_destructive_interference_size) rcu_reader {
+    /** The epoch in which the outer critical section was entered, or zero when not reading.
+     */
+    std::atomic<uint64_t> epoch = 0;
+
+    /** The number of nested critical sections, only used by the owning thread.
+     */
+    uint32_t nesting = 0;
+};
+
+/** An object that is retired and waits for a grace period to be destroyed.
+ */
+struct rcu_retired {
+    void *ptr;
+    void (*deleter)(void *) noexcept;
+
+    /** The rcu object that retired the object, only used as an identifier.
+     */
+    void const *owner;
+};
+
+/** Epoch based reclamation shared by all rcu objects.
+ *
+ * A reader announces the global epoch when it enters its outer critical
+ * section. A writer retires the old object into a batch. A background thread
+ * advances the global epoch for each batch and destroys the objects of the batch
+ * after every reader has left the critical section or has announced the new epoch.
+ *
+ * The background thread is started as a subsystem, and is joined when the system
+ * is shut down. When the background thread is not running, for example before
+ * `start_system()` or after `shutdown_system()`, the writer waits for the grace
+ * period itself and destroys the objects synchronously.
+ */
+class rcu_domain {
+public:
+    rcu_domain(rcu_domain const&) = delete;
+    rcu_domain(rcu_domain&&) = delete;
+    rcu_domain& operator=(rcu_domain const&) = delete;
+    rcu_domain& operator=(rcu_domain&&) = delete;
+    rcu_domain() noexcept = default;
+
+    /** Enter a read-side critical section.
+     *
+     * @note lock is allowed to be called reentered, also on different rcu objects.
+     */
+    hi_force_inline void lock() noexcept
+    {
+        auto& reader = this_reader();
+        if (reader.nesting++ == 0) {
+            reader.epoch.store(_epoch.load(std::memory_order::acquire), std::memory_order::relaxed);
+            // The epoch must be visible to the grace period thread before the protected pointer is read.
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+        }
+    }
+
+    /** Leave a read-side critical section.
+     *
+     * @note It is undefined behavior to call unlock() when not holding the lock.
+     */
+    hi_force_inline void unlock() noexcept
+    {
+        auto& reader = this_reader();
+        hi_axiom(reader.nesting != 0);
+        if (--reader.nesting == 0) {
+            reader.epoch.store(0, std::memory_order::release);
+        }
+    }
+
+    /** The current epoch.
+     *
+     * The epoch is incremented by the background thread for each batch of retired objects.
+     */
+    [[nodiscard]] uint64_t epoch() const noexcept
+    {
+        return _epoch.load(std::memory_order::relaxed);
+    }
+
+    /** Retire an object.
+     *
+     * The object is destroyed by a background thread after all readers
+     * that may still be using the object have left their critical section.
+     *
+     * When the background thread is not running the object is destroyed
+     * before this function returns, unless the current thread is itself inside
+     * a critical section; then the object is destroyed on a later call to
+     * `retire()` or `barrier()`.
+     *
+     * @param item The object to destroy and how to destroy it.
+     * @throws std::bad_alloc When the retired object could not be added to the batch.
+     */
+    void retire(rcu_retired item);
+
+    /** The number of retired objects of an owner that are not yet destroyed.
+     */
+    [[nodiscard]] std::size_t num_retired(void const *owner) const noexcept;
+
+    /** Forget about the owner of retired objects.
+     *
+     * Called when the owner is destroyed, so that its address may be reused.
+     */
+    void forget(void const *owner) noexcept;
+
+    /** Wait until all objects that were retired before this call are destroyed.
+     *
+     * @note It is undefined behavior to call this function from inside a critical section.
+     */
+    void barrier() noexcept;
+
+    /** Start the background thread that destroys the retired objects.
+     *
+     * The background thread is joined, and the remaining retired objects
+     * are destroyed, when the system is shut down.
+     *
+     * @return True when the background thread is running.
+     */
+    static bool start_subsystem()
+    {
+        return hi::start_subsystem(global()._started, false, subsystem_init, subsystem_deinit);
+    }
+
+    /** The global rcu domain.
+     *
+     * The domain is never destroyed, so that rcu objects with static storage
+     * duration can still retire objects during destruction.
+     */
+    [[nodiscard]] static rcu_domain& global() noexcept
+    {
+        static auto *domain = new rcu_domain();
+        return *domain;
+    }
+
+private:
+    /** The reader of the current thread.
+     *
+     * There is a single global domain, so the reader does not need to be per domain.
+     */
+    static inline thread_local std::shared_ptr<rcu_reader> _reader;
+
+    /** The current epoch, the first epoch is 1 since 0 means not reading.
+     */
+    alignas(hi::hardware_destructive_interference_size) std::atomic<uint64_t> _epoch = 1;
+
+    mutable unfair_mutex _readers_mutex;
+    std::vector<std::shared_ptr<rcu_reader>> _readers;
+
+    mutable std::mutex _mutex;
+    std::condition_variable_any _condition;
+
+    /** Objects that were retired since the start of the current grace period.
+     */
+    std::vector<rcu_retired> _retired;
+
+    /** Objects that are waiting for the current grace period to end.
+     */
+    std::vector<rcu_retired> _grace_batch;
+
+    /** The number of objects that were retired.
+     */
+    uint64_t _num_retired = 0;
+
+    /** The number of objects that were destroyed.
+     */
+    uint64_t _num_destroyed = 0;
+
+    /** Held during a grace period, so that only a single batch is in flight.
+     */
+    std::mutex _reclaim_mutex;
+
+    /** Set when the background thread is running.
+     */
+    std::atomic<bool> _started = false;
+
+    std::jthread _thread;
+
+    [[nodiscard]] hi_force_inline rcu_reader& this_reader() noexcept
+    {
+        if (not _reader) {
+            [[unlikely]] return make_reader();
+        }
+        return *_reader;
+    }
+
+    hi_no_inline rcu_reader& make_reader() noexcept;
+
+    /** Wait for all readers to leave the critical sections they entered before the epoch was incremented.
+     */
+    void wait_for_readers() noexcept;
+
+    /** Wait for a grace period and destroy the objects that were retired before it.
+     *
+     * @note It is undefined behavior to call this function from inside a critical section.
+     */
+    void reclaim() noexcept;
+
+    void thread_main(std::stop_token stop_token) noexcept;
+
+    static bool subsystem_init() noexcept;
+    static void subsystem_deinit() noexcept;
+};
+
+} // namespace detail
 
 /** Read-copy-update.
+ *
+ * Readers are wait-free and only write to their own thread's cache-line.
+ * Old values are destroyed by a background thread after a grace period,
+ * see `detail::rcu_domain`.
  *
  * @tparam T The type managed by RCU.
  * @tparam Allocator The allocator used to allocate objects of type T.
@@ -25,6 +240,10 @@ public:
     using value_type = T;
     using allocator_type = Allocator;
 
+    // Old values are destroyed by the background thread, possibly after the rcu object itself was destroyed.
+    static_assert(std::allocator_traits<allocator_type>::is_always_equal::value);
+    static_assert(std::is_default_constructible_v<allocator_type>);
+
     /** Construct a new rcu object.
      *
      * @note The initial rcu will be a nullptr.
@@ -32,7 +251,12 @@ public:
      */
     constexpr rcu(allocator_type allocator = allocator_type{}) noexcept : _allocator(allocator) {}
 
-    ~rcu() = default;
+    ~rcu()
+    {
+        reset();
+        detail::rcu_domain::global().forget(this);
+    }
+
     rcu(rcu const&) = delete;
     rcu(rcu&&) = delete;
     rcu& operator=(rcu const&) = delete;
@@ -42,14 +266,14 @@ public:
      */
     void lock() const noexcept
     {
-        _idle_count.lock();
+        detail::rcu_domain::global().lock();
     }
 
     /** Unlock the rcu pointer for reading.
      */
     void unlock() const noexcept
     {
-        _idle_count.unlock();
+        detail::rcu_domain::global().unlock();
     }
 
     /** get the rcu-pointer.
@@ -78,39 +302,27 @@ public:
 #endif
     }
 
-    /** The version of the lock.
-     *
-     * @note This function should be called while holding the lock.
-     * @return a version number used for `add_old_copy()`.
-     */
-    [[nodiscard]] uint64_t version() const noexcept
-    {
-        return *_idle_count;
-    }
-
     /** Number of objects that are currently allocated.
      *
      * This function is useful in tests to determine if the old copies are properly deallocated.
      */
     [[nodiscard]] size_t capacity() const noexcept
     {
-        hilet lock = std::scoped_lock(_old_ptrs_mutex);
-        return _old_ptrs.size() + not empty();
+        return detail::rcu_domain::global().num_retired(this) + not empty();
     }
 
     /** Exchange the rcu-pointers.
      *
-     * @note This function should be called while holding the lock.
      * @param ptr The new pointer value, may be nullptr.
      * @return The old pointer value, may be nullptr.
      */
     [[nodiscard]] value_type *exchange(value_type *ptr) noexcept
     {
-        return _ptr.exchange(ptr, std::memory_order::release);
+        return _ptr.exchange(ptr, std::memory_order::acq_rel);
     }
 
     /** Create a copy of the value at the given pointer.
-     * 
+     *
      * @note This function should be called while holding the lock.
      * @note It is undefined behavior to pass a nullptr as the argument
      * @param ptr The pointer to a value to copy.
@@ -134,7 +346,7 @@ public:
     {
         auto *new_ptr = std::allocator_traits<allocator_type>::allocate(_allocator, 1);
         lock();
-        value_type const * const ptr = get();
+        value_type const *const ptr = get();
         hi_assert_not_null(ptr);
         std::allocator_traits<allocator_type>::construct(_allocator, new_ptr, *ptr);
         unlock();
@@ -155,13 +367,9 @@ public:
      *
      * @param ptr The pointer returned by `copy()`.
      */
-    void commit(value_type *ptr) noexcept
+    void commit(value_type *ptr)
     {
-        lock();
-        auto *old_ptr = exchange(ptr);
-        auto old_version = version();
-        unlock();
-        add_old_copy(old_version, old_ptr);
+        retire(exchange(ptr));
     }
 
     /** Emplace a new value.
@@ -169,22 +377,17 @@ public:
      * This function will allocate and construct a new value, then replace the
      * current value.
      *
-     * This function will also destroy and deallocate old values when no
-     * other threads are reading them.
+     * The old value is destroyed and deallocated by a background thread
+     * when no other threads are reading it.
      *
      * @param args The arguments passed to the constructor of the value.
      */
-    void emplace(auto&&...args) noexcept
+    void emplace(auto&&...args)
     {
         value_type *const new_ptr = std::allocator_traits<allocator_type>::allocate(_allocator, 1);
         std::allocator_traits<allocator_type>::construct(_allocator, new_ptr, hi_forward(args)...);
 
-        lock();
-        auto *const old_ptr = exchange(new_ptr);
-        hilet old_version = version();
-        unlock();
-
-        add_old_copy(old_version, old_ptr);
+        retire(exchange(new_ptr));
     }
 
     [[nodiscard]] bool empty() const noexcept
@@ -197,60 +400,52 @@ public:
         return not empty();
     }
 
-    void reset() noexcept
+    void reset()
     {
-        lock();
-        auto *const old_ptr = _ptr.exchange(nullptr, std::memory_order::release);
-        hilet old_version = *_idle_count;
-        unlock();
-
-        add_old_copy(old_version, old_ptr);
+        retire(exchange(nullptr));
     }
 
-    rcu& operator=(nullptr_t) noexcept
+    rcu& operator=(nullptr_t)
     {
         reset();
         return *this;
     }
 
-    /** Add an old copy.
+    /** Retire an old value.
      *
-     * This function will manage old copies. It will keep a list of
-     * copies that are still being used, and destroy and deallocate old copies
-     * that are no longer being used.
+     * The old value is destroyed and deallocated after all readers
+     * that may still use the value have unlocked.
      *
-     * @param old_version The version when the pointer was exchanged.
      * @param old_ptr The pointer that was exchanged, may be a nullptr.
+     * @throws std::bad_alloc When the old value could not be retired.
      */
-    void add_old_copy(uint64_t old_version, value_type *old_ptr) noexcept
+    void retire(value_type *old_ptr)
     {
-        if (not old_ptr) {
-            return;
-        }
-
-        hilet new_version = version();
-
-        hilet lock = std::scoped_lock(_old_ptrs_mutex);
-        _old_ptrs.emplace_back(old_version, old_ptr);
-
-        // Destroy all objects from previous idle-count versions.
-        auto it = _old_ptrs.begin();
-        while (it != _old_ptrs.end() and it->first < new_version) {
-            std::allocator_traits<allocator_type>::destroy(_allocator, it->second);
-            std::allocator_traits<allocator_type>::deallocate(_allocator, it->second, 1);
-            ++it;
+        if (old_ptr) {
+            detail::rcu_domain::global().retire({old_ptr, destroy, this});
         }
-        _old_ptrs.erase(_old_ptrs.begin(), it);
     }
 
 private:
     std::atomic<value_type *> _ptr = nullptr;
-    mutable wfree_idle_count _idle_count;
-
     mutable allocator_type _allocator;
-    mutable unfair_mutex _old_ptrs_mutex;
-    std::vector<std::pair<uint64_t, value_type *>> _old_ptrs;
+
+    static void destroy(void *ptr) noexcept
+    {
+        auto allocator = allocator_type{};
+        auto *ptr_ = static_cast<value_type *>(ptr);
+        std::allocator_traits<allocator_type>::destroy(allocator, ptr_);
+        std::allocator_traits<allocator_type>::deallocate(allocator, ptr_, 1);
+    }
 };
 
-} // namespace hi::inline v1
+/** Wait until all old values of all rcu objects, that were replaced before this call, are destroyed.
+ *
+ * @note It is undefined behavior to call this function while holding a lock on a rcu object.
+ */
+inline void rcu_barrier() noexcept
+{
+    detail::rcu_domain::global().barrier();
+}
 
+} // namespace hi::inline v1
@@ -0,0 +1,70 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "rcu.hpp"
+#include "wfree_idle_count.hpp"
+#include <benchmark/benchmark.h>
+#include <thread>
+
+using namespace hi;
+
+static auto rcu_benchmarks_object = [] {
+    auto r = std::make_unique<rcu<int>>();
+    r->emplace(42);
+    return r;
+}();
+
+/** Read-side cost of rcu, each reader only writes to its own cache-line.
+ */
+static void rcu_read(benchmark::State& state)
+{
+    for (auto _ : state) {
+        rcu_benchmarks_object->lock();
+        benchmark::DoNotOptimize(*rcu_benchmarks_object->get());
+        rcu_benchmarks_object->unlock();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rcu_read)->ThreadRange(1, static_cast<int>(std::thread::hardware_concurrency()))->UseRealTime();
+
+static wfree_idle_count rcu_benchmarks_idle_count;
+static int rcu_benchmarks_value = 42;
+static std::atomic<int *> rcu_benchmarks_ptr = &rcu_benchmarks_value;
+
+/** Read-side cost of the previous rcu implementation, all readers share a single idle-count.
+ */
+static void rcu_read_idle_count(benchmark::State& state)
+{
+    for (auto _ : state) {
+        rcu_benchmarks_idle_count.lock();
+        benchmark::DoNotOptimize(*rcu_benchmarks_ptr.load(std::memory_order::acquire));
+        rcu_benchmarks_idle_count.unlock();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rcu_read_idle_count)->ThreadRange(1, static_cast<int>(std::thread::hardware_concurrency()))->UseRealTime();
+
+/** Read-side cost while another thread keeps replacing the value.
+ */
+static void rcu_read_while_writing(benchmark::State& state)
+{
+    auto writer = std::jthread{};
+    if (state.thread_index() == 0) {
+        writer = std::jthread([](std::stop_token stop_token) {
+            auto i = 0;
+            while (not stop_token.stop_requested()) {
+                rcu_benchmarks_object->emplace(++i);
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    for (auto _ : state) {
+        rcu_benchmarks_object->lock();
+        benchmark::DoNotOptimize(*rcu_benchmarks_object->get());
+        rcu_benchmarks_object->unlock();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rcu_read_while_writing)->ThreadRange(1, static_cast<int>(std::thread::hardware_concurrency()))->UseRealTime();
@@ -0,0 +1,193 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "rcu.hpp"
+#include "thread.hpp"
+#include "../utility/module.hpp"
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <system_error>
+
+namespace hi::inline v1::detail {
+
+rcu_reader& rcu_domain::make_reader() noexcept
+{
+    _reader = std::make_shared<rcu_reader>();
+
+    hilet lock = std::scoped_lock(_readers_mutex);
+    _readers.push_back(_reader);
+    return *_reader;
+}
+
+void rcu_domain::retire(rcu_retired item)
+{
+    auto lock = std::unique_lock(_mutex);
+    _retired.push_back(item);
+    ++_num_retired;
+    lock.unlock();
+
+    if (_started.load(std::memory_order::acquire) or start_subsystem()) {
+        _condition.notify_one();
+
+    } else if (this_reader().nesting == 0) {
+        // Without the background thread, wait for the grace period here.
+        // From inside a critical section this would wait for ourselves, so leave it for a later call.
+        [[unlikely]] reclaim();
+    }
+}
+
+std::size_t rcu_domain::num_retired(void const *owner) const noexcept
+{
+    hilet is_owner = [owner](hilet& item) {
+        return item.owner == owner;
+    };
+
+    hilet lock = std::scoped_lock(_mutex);
+    return narrow_cast<std::size_t>(std::ranges::count_if(_retired, is_owner) + std::ranges::count_if(_grace_batch, is_owner));
+}
+
+void rcu_domain::forget(void const *owner) noexcept
+{
+    hilet lock = std::scoped_lock(_mutex);
+    for (auto& item : _retired) {
+        if (item.owner == owner) {
+            item.owner = nullptr;
+        }
+    }
+    for (auto& item : _grace_batch) {
+        if (item.owner == owner) {
+            item.owner = nullptr;
+        }
+    }
+}
+
+void rcu_domain::barrier() noexcept
+{
+    if (not _started.load(std::memory_order::acquire)) {
+        reclaim();
+    }
+
+    auto lock = std::unique_lock(_mutex);
+    hilet num_retired = _num_retired;
+    _condition.wait(lock, [&] {
+        return _num_destroyed >= num_retired;
+    });
+}
+
+void rcu_domain::wait_for_readers() noexcept
+{
+    using namespace std::chrono_literals;
+
+    hilet epoch = _epoch.fetch_add(1, std::memory_order::seq_cst) + 1;
+    // Pairs with the fence in lock(); either the reader sees the new pointer, or we see the reader's epoch.
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+
+    auto lock = std::unique_lock(_readers_mutex);
+
+    // Forget the readers of threads that have exited.
+    std::erase_if(_readers, [](hilet& reader) {
+        return reader.use_count() == 1;
+    });
+    hilet readers = _readers;
+    lock.unlock();
+
+    for (hilet& reader : readers) {
+        auto spin_count = 0;
+        while (true) {
+            hilet reader_epoch = reader->epoch.load(std::memory_order::acquire);
+            if (reader_epoch == 0 or reader_epoch >= epoch) {
+                break;
+            }
+
+            // Critical sections are short, so first try spinning.
+            if (++spin_count < 100) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(100us);
+            }
+        }
+    }
+}
+
+void rcu_domain::reclaim() noexcept
+{
+    hilet reclaim_lock = std::scoped_lock(_reclaim_mutex);
+
+    auto lock = std::unique_lock(_mutex);
+    if (_retired.empty()) {
+        return;
+    }
+
+    // Objects that are retired during the grace period are handled in the next batch.
+    std::swap(_retired, _grace_batch);
+    lock.unlock();
+
+    wait_for_readers();
+
+    lock.lock();
+    auto batch = std::exchange(_grace_batch, {});
+    lock.unlock();
+
+    for (hilet& item : batch) {
+        item.deleter(item.ptr);
+    }
+
+    lock.lock();
+    _num_destroyed += batch.size();
+    lock.unlock();
+    _condition.notify_all();
+}
+
+void rcu_domain::thread_main(std::stop_token stop_token) noexcept
+{
+    using namespace std::chrono_literals;
+
+    set_thread_name("rcu");
+
+    while (true) {
+        auto lock = std::unique_lock(_mutex);
+        if (not _condition.wait(lock, stop_token, [this] {
+                return not _retired.empty();
+            })) {
+            // Stop was requested.
+            return;
+        }
+        lock.unlock();
+
+        reclaim();
+
+        // Collect more retired objects in the next batch.
+        std::this_thread::sleep_for(1ms);
+    }
+}
+
+bool rcu_domain::subsystem_init() noexcept
+{
+    auto& domain = global();
+    try {
+        domain._thread = std::jthread([&domain](std::stop_token stop_token) {
+            domain.thread_main(std::move(stop_token));
+        });
+        return true;
+
+    } catch (std::system_error const&) {
+        // Continue in degraded mode, where writers wait for the grace period themselves.
+        return false;
+    }
+}
+
+void rcu_domain::subsystem_deinit() noexcept
+{
+    auto& domain = global();
+    if (domain._started.exchange(false)) {
+        // Retiring after this point is done synchronously; join the thread, then drain what is left.
+        domain._thread.request_stop();
+        domain._thread.join();
+        domain.reclaim();
+    }
+}
+
+} // namespace hi::inline v1::detail
@@ -7,6 +7,9 @@
 #include <iostream>
 #include <string>
 #include <limits>
+#include <thread>
+#include <vector>
+#include <chrono>
 
 using namespace std;
 using namespace hi;
@@ -14,13 +17,11 @@ using namespace hi;
 TEST(rcu, read)
 {
     auto object = rcu<int>{};
-    ASSERT_EQ(object.version(), 0);
     ASSERT_TRUE(object.empty());
     ASSERT_EQ(object.capacity(), 0);
     ASSERT_EQ(object.get(), nullptr);
 
     object.emplace(42);
-    ASSERT_EQ(object.version(), 1);
     ASSERT_FALSE(object.empty());
     ASSERT_EQ(object.capacity(), 1);
 
@@ -28,22 +29,23 @@ TEST(rcu, read)
     auto ptr = object.get();
     ASSERT_NE(ptr, nullptr);
     ASSERT_EQ(*ptr, 42);
-    ASSERT_EQ(object.version(), 1);
-
     object.unlock();
-    ASSERT_EQ(object.version(), 2);
+
+    // Reading does not retire any values.
+    rcu_barrier();
+    ASSERT_EQ(object.capacity(), 1);
 }
 
 TEST(rcu, write_while_read)
 {
+    using namespace std::chrono_literals;
+
     auto object = rcu<int>{};
-    ASSERT_EQ(object.version(), 0);
     ASSERT_TRUE(object.empty());
     ASSERT_EQ(object.get(), nullptr);
     ASSERT_EQ(object.capacity(), 0);
 
     object.emplace(42);
-    ASSERT_EQ(object.version(), 1);
     ASSERT_FALSE(object.empty());
     ASSERT_EQ(object.capacity(), 1);
 
@@ -51,30 +53,62 @@ TEST(rcu, write_while_read)
     auto ptr42 = object.get();
     ASSERT_NE(ptr42, nullptr);
     ASSERT_EQ(*ptr42, 42);
-    ASSERT_EQ(object.version(), 1);
 
     object.emplace(5);
-    ASSERT_EQ(object.version(), 1);
     ASSERT_EQ(object.capacity(), 2);
 
     object.lock();
     auto ptr5 = object.get();
     ASSERT_NE(ptr5, nullptr);
     ASSERT_EQ(*ptr5, 5);
-    ASSERT_EQ(object.version(), 1);
     object.unlock();
-    // The version does not increment while a lock is being held.
-    ASSERT_EQ(object.version(), 1);
+
+    // The old value is not destroyed while a lock is being held.
+    std::this_thread::sleep_for(10ms);
+    ASSERT_EQ(object.capacity(), 2);
+    ASSERT_EQ(*ptr42, 42);
 
     object.unlock();
-    ASSERT_EQ(object.version(), 2);
+    rcu_barrier();
     // The capacity does not change when just reading.
-    ASSERT_EQ(object.capacity(), 2);
+    ASSERT_EQ(object.capacity(), 1);
 
     // Reset will assign nullptr.
     // At this point there is no lock being held, so old allocations are removed.
     object.reset();
-    ASSERT_EQ(object.version(), 3);
+    rcu_barrier();
     ASSERT_EQ(object.capacity(), 0);
     ASSERT_TRUE(object.empty());
 }
+
+TEST(rcu, read_while_writing)
+{
+    auto object = rcu<std::vector<int>>{};
+    object.emplace(100, 0);
+
+    auto stop = std::atomic<bool>{false};
+    auto readers = std::vector<std::jthread>{};
+    for (auto i = 0; i != 4; ++i) {
+        readers.emplace_back([&] {
+            while (not stop.load(std::memory_order::relaxed)) {
+                object.lock();
+                hilet& values = *object.get();
+                // All values of a vector are equal, a destroyed vector would show up here.
+                for (hilet value : values) {
+                    ASSERT_EQ(value, values.front());
+                }
+                object.unlock();
+            }
+        });
+    }
+
+    for (auto i = 1; i != 1000; ++i) {
+        object.emplace(100, i);
+    }
+
+    stop.store(true);
+    readers.clear();
+
+    rcu_barrier();
+    ASSERT_EQ(object.capacity(), 1);
+}
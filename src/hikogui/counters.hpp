@@ -19,10 +19,205 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <algorithm>
 
 namespace hi::inline v1 {
+
+/** A histogram of durations.
+ *
+ * The buckets are log-linear, like a HDR-histogram: each power-of-two range
+ * is split into 16 linear sub-buckets, so that the value reported for
+ * a percentile is within 1/32 (3%) of the actual value.
+ *
+ * Histograms of the same kind of duration may be merged with `operator+=`.
+ */
+class duration_histogram {
+public:
+    constexpr static std::size_t sub_bucket_bits = 4;
+    constexpr static std::size_t sub_bucket_count = 1_uz << sub_bucket_bits;
+
+    /** The number of buckets needed to cover all 64 bit values.
+     */
+    constexpr static std::size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_bucket_count;
+
+    constexpr duration_histogram() noexcept = default;
+    constexpr duration_histogram(duration_histogram const&) noexcept = default;
+    constexpr duration_histogram(duration_histogram&&) noexcept = default;
+    constexpr duration_histogram& operator=(duration_histogram const&) noexcept = default;
+    constexpr duration_histogram& operator=(duration_histogram&&) noexcept = default;
+
+    /** The index of the bucket which holds a duration.
+     */
+    [[nodiscard]] constexpr static std::size_t bucket_index(uint64_t duration) noexcept
+    {
+        // The first two power-of-two ranges are stored without loss.
+        constexpr auto linear_bits = sub_bucket_bits + 1;
+
+        hilet width = std::bit_width(duration);
+        if (width <= linear_bits) {
+            return narrow_cast<std::size_t>(duration);
+        }
+
+        hilet shift = width - linear_bits;
+        return (shift + 1) * sub_bucket_count + narrow_cast<std::size_t>((duration >> shift) & (sub_bucket_count - 1));
+    }
+
+    /** The lowest duration that is stored in a bucket.
+     */
+    [[nodiscard]] constexpr static uint64_t bucket_lower(std::size_t index) noexcept
+    {
+        hi_axiom(index < bucket_count);
+        if (index < 2 * sub_bucket_count) {
+            return index;
+        }
+
+        hilet shift = index / sub_bucket_count - 1;
+        hilet mantissa = uint64_t{sub_bucket_count + index % sub_bucket_count};
+        return mantissa << shift;
+    }
+
+    /** The highest duration that is stored in a bucket.
+     */
+    [[nodiscard]] constexpr static uint64_t bucket_upper(std::size_t index) noexcept
+    {
+        hi_axiom(index < bucket_count);
+        if (index + 1 == bucket_count) {
+            return std::numeric_limits<uint64_t>::max();
+        } else {
+            return bucket_lower(index + 1) - 1;
+        }
+    }
+
+    /** The number of durations in the histogram.
+     */
+    [[nodiscard]] constexpr uint64_t count() const noexcept
+    {
+        return _count;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _count == 0;
+    }
+
+    /** The number of durations in a bucket.
+     */
+    [[nodiscard]] constexpr uint64_t operator[](std::size_t index) const noexcept
+    {
+        hi_axiom(index < bucket_count);
+        return _buckets[index];
+    }
+
+    /** Add a duration to the histogram.
+     *
+     * @param duration The duration to add.
+     * @param count The number of times to add the duration.
+     */
+    constexpr void add(uint64_t duration, uint64_t count = 1) noexcept
+    {
+        _buckets[bucket_index(duration)] += count;
+        _count += count;
+    }
+
+    /** Get the duration at a percentile.
+     *
+     * @param fraction The percentile as a fraction between 0.0 and 1.0, i.e. 0.99 for p99.
+     * @return The middle of the bucket which holds the duration at the percentile, or zero
+     *         if the histogram is empty.
+     */
+    [[nodiscard]] uint64_t percentile(double fraction) const noexcept
+    {
+        if (_count == 0) {
+            return 0;
+        }
+
+        // The rank of the duration, from 1 to count.
+        auto rank = static_cast<uint64_t>(std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(_count)));
+        rank = std::clamp(rank, uint64_t{1}, _count);
+
+        auto seen = uint64_t{0};
+        for (auto i = 0_uz; i != bucket_count; ++i) {
+            seen += _buckets[i];
+            if (seen >= rank) {
+                hilet lower = bucket_lower(i);
+                return lower + (bucket_upper(i) - lower) / 2;
+            }
+        }
+        hi_no_default();
+    }
+
+    constexpr duration_histogram& operator+=(duration_histogram const& rhs) noexcept
+    {
+        for (auto i = 0_uz; i != bucket_count; ++i) {
+            _buckets[i] += rhs._buckets[i];
+        }
+        _count += rhs._count;
+        return *this;
+    }
+
+    [[nodiscard]] constexpr friend duration_histogram operator+(duration_histogram lhs, duration_histogram const& rhs) noexcept
+    {
+        return lhs += rhs;
+    }
+
+private:
+    std::array<uint64_t, bucket_count> _buckets = {};
+    uint64_t _count = 0;
+};
+
 namespace detail {
 
+/** A duration histogram which can be updated concurrently.
+ */
+class atomic_duration_histogram {
+public:
+    atomic_duration_histogram() noexcept = default;
+    atomic_duration_histogram(atomic_duration_histogram const&) = delete;
+    atomic_duration_histogram(atomic_duration_histogram&&) = delete;
+    atomic_duration_histogram& operator=(atomic_duration_histogram const&) = delete;
+    atomic_duration_histogram& operator=(atomic_duration_histogram&&) = delete;
+
+    void add(uint64_t duration) noexcept
+    {
+        _buckets[duration_histogram::bucket_index(duration)].fetch_add(1, std::memory_order::relaxed);
+    }
+
+    /** Get a copy of the histogram.
+     */
+    [[nodiscard]] duration_histogram snapshot() const noexcept
+    {
+        auto r = duration_histogram{};
+        for (auto i = 0_uz; i != duration_histogram::bucket_count; ++i) {
+            if (hilet count = _buckets[i].load(std::memory_order::relaxed)) {
+                r.add(duration_histogram::bucket_lower(i), count);
+            }
+        }
+        return r;
+    }
+
+    /** Get a copy of the histogram and clear it.
+     *
+     * Each bucket is reset atomically, durations added concurrently are
+     * either part of the returned histogram or stay behind for the next call.
+     */
+    [[nodiscard]] duration_histogram reset() noexcept
+    {
+        auto r = duration_histogram{};
+        for (auto i = 0_uz; i != duration_histogram::bucket_count; ++i) {
+            if (_buckets[i].load(std::memory_order::relaxed) != 0) {
+                r.add(duration_histogram::bucket_lower(i), _buckets[i].exchange(0, std::memory_order::relaxed));
+            }
+        }
+        return r;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, duration_histogram::bucket_count> _buckets = {};
+};
+
 class counter {
 public:
     /** Get the named counter.
@@ -93,10 +288,13 @@ public:
     }
 
     /** Add a duration.
+     *
+     * @param duration The duration in time-stamp-counts.
      */
     void add_duration(uint64_t duration) noexcept
     {
         _total_count.fetch_add(1, std::memory_order::relaxed);
+        _histogram.add(duration);
         fetch_max(_duration_max, duration, std::memory_order::relaxed);
         fetch_min(_duration_min, duration, std::memory_order::relaxed);
 
@@ -107,6 +305,24 @@ public:
         _duration_avg.fetch_add(duration, std::memory_order::relaxed);
     }
 
+    /** Get a copy of the histogram of durations.
+     *
+     * @return The histogram of durations in time-stamp-counts.
+     */
+    [[nodiscard]] duration_histogram histogram() const noexcept
+    {
+        return _histogram.snapshot();
+    }
+
+    /** Get a copy of the histogram of durations, and clear it.
+     *
+     * @return The histogram of durations in time-stamp-counts.
+     */
+    [[nodiscard]] duration_histogram reset_histogram() noexcept
+    {
+        return _histogram.reset();
+    }
+
 protected:
     using map_type = std::map<std::string, counter *>;
 
@@ -127,6 +343,12 @@ protected:
      * - [63:10] Sum.
      */
     std::atomic<uint64_t> _duration_avg = 0;
+
+    /** The histogram of durations.
+     *
+     * Part of the counter itself, so that the histogram of a `global_counter` has static storage.
+     */
+    atomic_duration_histogram _histogram;
 };
 
 template<fixed_string Tag>
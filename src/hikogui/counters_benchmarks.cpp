@@ -0,0 +1,36 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "counters.hpp"
+#include "utility/module.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace hi;
+
+/** The hot-path cost of adding a duration to a counter and its histogram.
+ */
+static void counter_add_duration(benchmark::State& state)
+{
+    auto duration = uint64_t{1000};
+    for (auto _ : state) {
+        global_counter<"counter_add_duration">.add_duration(duration);
+        // Spread the durations over a few buckets, like real measurements.
+        duration = (duration * 33) % 100'000;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(counter_add_duration)->Threads(1)->Threads(4);
+
+static void counter_percentile(benchmark::State& state)
+{
+    auto histogram = duration_histogram{};
+    for (auto i = uint64_t{1}; i <= 100'000; ++i) {
+        histogram.add(i);
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(histogram.percentile(0.99));
+    }
+}
+BENCHMARK(counter_percentile);
@@ -10,8 +10,9 @@ namespace hi::inline v1::detail {
 void counter::log_header() noexcept
 {
     hi_log_statistics("");
-    hi_log_statistics("{:>18} {:>9} {:>10} {:>10} {:>10}", "total", "delta", "min", "max", "mean");
-    hi_log_statistics("------------------ --------- ---------- ---------- ----------");
+    hi_log_statistics(
+        "{:>18} {:>9} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}", "total", "delta", "min", "max", "mean", "p50", "p99", "p99.9");
+    hi_log_statistics("------------------ --------- ---------- ---------- ---------- ---------- ---------- ----------");
 }
 
 /** Log the counter.
@@ -27,21 +28,30 @@ void counter::log(std::string const& tag) noexcept
             _duration_min.exchange(std::numeric_limits<uint64_t>::max(), std::memory_order::relaxed));
 
         hilet duration_avg = _duration_avg.exchange(0, std::memory_order::relaxed);
+        hilet histogram = reset_histogram();
         if (duration_avg == 0) {
-            hi_log_statistics("{:>18} {:>+9} {:10} {:10} {:10} {}", total_count, delta_count, "", "", "", tag);
+            hi_log_statistics(
+                "{:>18} {:>+9} {:10} {:10} {:10} {:10} {:10} {:10} {}", total_count, delta_count, "", "", "", "", "", "", tag);
 
         } else {
             hilet avg_count = duration_avg & 0xffff;
             hilet avg_sum = duration_avg >> 16;
             hilet average = time_stamp_count::duration_from_count(avg_sum / avg_count);
 
+            hilet p50 = time_stamp_count::duration_from_count(histogram.percentile(0.5));
+            hilet p99 = time_stamp_count::duration_from_count(histogram.percentile(0.99));
+            hilet p999 = time_stamp_count::duration_from_count(histogram.percentile(0.999));
+
             hi_log_statistics(
-                "{:18d} {:+9d} {:>10} {:>10} {:>10} {}",
+                "{:18d} {:+9d} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10} {}",
                 total_count,
                 delta_count,
                 format_engineering(duration_min),
                 format_engineering(duration_max),
                 format_engineering(average),
+                format_engineering(p50),
+                format_engineering(p99),
+                format_engineering(p999),
                 tag);
         }
     }
@@ -32,3 +32,69 @@ TEST(Counters, RunTimeRead)
     ASSERT_EQ(*get_global_counter_if("foo_b"), 1);
     ASSERT_EQ(*get_global_counter_if("bar_b"), 2);
 }
+
+TEST(Counters, HistogramBuckets)
+{
+    // Each duration lands in a bucket that contains it, and the buckets are contiguous.
+    for (auto i = 0_uz; i != duration_histogram::bucket_count; ++i) {
+        hilet lower = duration_histogram::bucket_lower(i);
+        hilet upper = duration_histogram::bucket_upper(i);
+        ASSERT_LE(lower, upper);
+        ASSERT_EQ(duration_histogram::bucket_index(lower), i);
+        ASSERT_EQ(duration_histogram::bucket_index(upper), i);
+        if (i != 0) {
+            ASSERT_EQ(duration_histogram::bucket_upper(i - 1) + 1, lower);
+        }
+    }
+    ASSERT_EQ(duration_histogram::bucket_index(std::numeric_limits<uint64_t>::max()), duration_histogram::bucket_count - 1);
+}
+
+TEST(Counters, HistogramPercentile)
+{
+    auto histogram = duration_histogram{};
+    ASSERT_EQ(histogram.percentile(0.5), 0);
+
+    for (auto i = uint64_t{1}; i <= 100'000; ++i) {
+        histogram.add(i);
+    }
+    ASSERT_EQ(histogram.count(), 100'000);
+
+    // Within the resolution of the histogram.
+    ASSERT_NEAR(static_cast<double>(histogram.percentile(0.5)), 50'000.0, 50'000.0 / 32.0);
+    ASSERT_NEAR(static_cast<double>(histogram.percentile(0.99)), 99'000.0, 99'000.0 / 32.0);
+    ASSERT_NEAR(static_cast<double>(histogram.percentile(0.999)), 99'900.0, 99'900.0 / 32.0);
+    ASSERT_EQ(histogram.percentile(0.0), 1);
+}
+
+TEST(Counters, HistogramMerge)
+{
+    auto a = duration_histogram{};
+    auto b = duration_histogram{};
+    for (auto i = 0; i != 99; ++i) {
+        a.add(10);
+    }
+    b.add(1'000'000);
+
+    hilet c = a + b;
+    ASSERT_EQ(c.count(), 100);
+    ASSERT_EQ(c.percentile(0.5), 10);
+    ASSERT_NEAR(static_cast<double>(c.percentile(1.0)), 1'000'000.0, 1'000'000.0 / 32.0);
+}
+
+TEST(Counters, HistogramSnapshot)
+{
+    ASSERT_TRUE(global_counter<"histogram_a">.histogram().empty());
+
+    global_counter<"histogram_a">.add_duration(20);
+    global_counter<"histogram_a">.add_duration(20);
+    global_counter<"histogram_a">.add_duration(3000);
+
+    hilet snapshot = global_counter<"histogram_a">.histogram();
+    ASSERT_EQ(snapshot.count(), 3);
+    ASSERT_EQ(snapshot.percentile(0.5), 20);
+
+    hilet reset = global_counter<"histogram_a">.reset_histogram();
+    ASSERT_EQ(reset.count(), 3);
+    ASSERT_TRUE(global_counter<"histogram_a">.histogram().empty());
+    ASSERT_EQ(global_counter<"histogram_a">, 3);
+}
@@ -9,12 +9,14 @@
 #include "byte_string.hpp"
 #include "codec/base_n.hpp"
 #include "jsonpath.hpp"
+#include "ordered_hash_map.hpp"
 #include <cstdint>
 #include <concepts>
 #include <bit>
 #include <exception>
 #include <chrono>
 #include <limits>
+#include <cmath>
 #include <vector>
 #include <map>
 
@@ -219,7 +221,7 @@ constexpr bool is_datum_type_v = is_datum_type<T>::value;
 class datum {
 public:
     using vector_type = std::vector<datum>;
-    using map_type = std::map<datum, datum>;
+    using map_type = ordered_hash_map<datum, datum>;
     struct break_type {
     };
     struct continue_type {
@@ -709,13 +711,13 @@ public:
     {
         switch (_tag) {
         case tag_type::floating_point:
-            return std::hash<double>{}(_value._double);
+            return hash_number(_value._double);
         case tag_type::decimal:
-            return std::hash<decimal>{}(_value._decimal);
+            return hash_number(static_cast<double>(_value._decimal));
         case tag_type::integral:
-            return std::hash<long long>{}(_value._long_long);
+            return hash_number(static_cast<double>(_value._long_long));
         case tag_type::boolean:
-            return std::hash<bool>{}(_value._bool);
+            return hash_number(_value._bool ? 1.0 : 0.0);
         case tag_type::year_month_day:
             {
                 uint32_t r = 0;
@@ -736,9 +738,10 @@ public:
             }
         case tag_type::map:
             {
+                // The items are combined independent of their order, as equality of maps is.
                 std::size_t r = 0;
                 for (hilet& kv : *_value._map) {
-                    r = hash_mix(r, kv.first.hash(), kv.second.hash());
+                    r += hash_mix(kv.first.hash(), kv.second.hash());
                 }
                 return r;
             }
@@ -871,7 +874,7 @@ public:
         }
     }
 
-    /** Get the sorted list of keys of a map.
+    /** Get the list of keys of a map, in insertion order.
      */
     [[nodiscard]] vector_type keys() const
     {
@@ -887,7 +890,7 @@ public:
         }
     }
 
-    /** Get the list of values of a map.
+    /** Get the list of values of a map, in insertion order.
      */
     [[nodiscard]] vector_type values() const
     {
@@ -903,7 +906,7 @@ public:
         }
     }
 
-    /** Get key value pairs of items of a map sorted by the key.
+    /** Get key value pairs of items of a map, in insertion order.
      */
     [[nodiscard]] vector_type items() const
     {
@@ -1222,8 +1225,9 @@ public:
      *    + flow_continue = 7,
      *    + flow_break = 8,
      *
+     * @throws std::bad_alloc When comparing maps, which allocates the items sorted by key.
      */
-    [[nodiscard]] friend constexpr std::partial_ordering operator<=>(datum const& lhs, datum const& rhs) noexcept
+    [[nodiscard]] friend constexpr std::partial_ordering operator<=>(datum const& lhs, datum const& rhs)
     {
         if (hilet doubles = promote_if<double>(lhs, rhs)) {
             return doubles.lhs() <=> doubles.rhs();
@@ -1998,6 +2002,19 @@ private:
         }
     }
 
+    /** Hash a number.
+     *
+     * Numbers of different types that compare equal after promotion must have the same hash,
+     * so that they can be used interchangeably as the key of a map.
+     */
+    [[nodiscard]] static std::size_t hash_number(double value) noexcept
+    {
+        if (value >= -0x1p63 and value < 0x1p63 and value == std::trunc(value)) {
+            return std::hash<long long>{}(static_cast<long long>(value));
+        }
+        return std::hash<double>{}(value);
+    }
+
     constexpr void delete_pointer() noexcept
     {
         if (is_pointer()) {
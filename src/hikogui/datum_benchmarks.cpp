@@ -0,0 +1,179 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "datum.hpp"
+#include "jsonpath.hpp"
+#include "codec/JSON.hpp"
+#include "utility/module.hpp"
+#include <benchmark/benchmark.h>
+#include <map>
+#include <string>
+#include <vector>
+#include <format>
+
+using namespace hi;
+
+[[nodiscard]] static std::vector<datum> make_keys(std::size_t size)
+{
+    auto r = std::vector<datum>{};
+    for (auto i = 0_uz; i != size; ++i) {
+        r.emplace_back(std::format("member_{}", i));
+    }
+    return r;
+}
+
+/** Build an object through `datum::map_type`.
+ */
+static void datum_map_build(benchmark::State& state)
+{
+    hilet keys = make_keys(state.range(0));
+
+    for (auto _ : state) {
+        auto map = datum::map_type{};
+        for (hilet& key : keys) {
+            map.insert_or_assign(key, datum{1});
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(datum_map_build)->Arg(8)->Arg(64)->Arg(1024);
+
+/** Build an object through `std::map`, the previous representation of `datum::map_type`.
+ */
+static void datum_std_map_build(benchmark::State& state)
+{
+    hilet keys = make_keys(state.range(0));
+
+    for (auto _ : state) {
+        auto map = std::map<datum, datum>{};
+        for (hilet& key : keys) {
+            map.insert_or_assign(key, datum{1});
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(datum_std_map_build)->Arg(8)->Arg(64)->Arg(1024);
+
+/** Look up members with `datum::operator[]`.
+ */
+static void datum_map_lookup(benchmark::State& state)
+{
+    hilet keys = make_keys(state.range(0));
+    auto object = datum::make_map();
+    for (hilet& key : keys) {
+        object[key] = 1;
+    }
+    hilet& object_ = object;
+
+    for (auto _ : state) {
+        for (hilet& key : keys) {
+            benchmark::DoNotOptimize(object_[key]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(datum_map_lookup)->Arg(8)->Arg(64)->Arg(1024);
+
+static void datum_std_map_lookup(benchmark::State& state)
+{
+    hilet keys = make_keys(state.range(0));
+    auto map = std::map<datum, datum>{};
+    for (hilet& key : keys) {
+        map[key] = datum{1};
+    }
+
+    for (auto _ : state) {
+        for (hilet& key : keys) {
+            benchmark::DoNotOptimize(map.find(key)->second);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(datum_std_map_lookup)->Arg(8)->Arg(64)->Arg(1024);
+
+/** Evaluate a json-path on a parsed document with many small objects.
+ */
+static void datum_jsonpath_find(benchmark::State& state)
+{
+    auto text = std::string{"{\"store\": {\"book\": ["};
+    for (auto i = 0; i != 10'000; ++i) {
+        if (i != 0) {
+            text += ',';
+        }
+        text += std::format(
+            "{{\"category\": \"fiction\", \"author\": \"author {}\", \"title\": \"title {}\", \"isbn\": \"{}\", \"price\": {}.99}}",
+            i,
+            i,
+            i,
+            i % 50);
+    }
+    text += "]}}";
+
+    hilet document = parse_JSON(text);
+    hilet path = jsonpath{"$.store.book[*].price"};
+
+    for (auto _ : state) {
+        auto prices = document.find(path);
+        benchmark::DoNotOptimize(prices.data());
+    }
+}
+BENCHMARK(datum_jsonpath_find)->Unit(benchmark::kMicrosecond);
+
+/** The members of the books in the json-path document.
+ */
+[[nodiscard]] static std::vector<std::pair<datum, datum>> make_book(int i)
+{
+    return {
+        {datum{"category"}, datum{"fiction"}},
+        {datum{"author"}, datum{std::format("author {}", i)}},
+        {datum{"title"}, datum{std::format("title {}", i)}},
+        {datum{"isbn"}, datum{std::format("{}", i)}},
+        {datum{"price"}, datum{i % 50 + 0.99}}};
+}
+
+/** Find the price of each book, the object lookups done by `datum_jsonpath_find`.
+ */
+static void datum_map_find_prices(benchmark::State& state)
+{
+    auto books = std::vector<datum::map_type>{};
+    for (auto i = 0; i != 10'000; ++i) {
+        auto& book = books.emplace_back();
+        for (auto& [key, value] : make_book(i)) {
+            book.insert_or_assign(key, value);
+        }
+    }
+    hilet key = datum{"price"};
+
+    for (auto _ : state) {
+        for (hilet& book : books) {
+            benchmark::DoNotOptimize(book.find(key)->second);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * books.size());
+}
+BENCHMARK(datum_map_find_prices)->Unit(benchmark::kMicrosecond);
+
+/** Find the price of each book in `std::map` objects, the previous representation of `datum::map_type`.
+ */
+static void datum_std_map_find_prices(benchmark::State& state)
+{
+    auto books = std::vector<std::map<datum, datum>>{};
+    for (auto i = 0; i != 10'000; ++i) {
+        auto& book = books.emplace_back();
+        for (auto& [key, value] : make_book(i)) {
+            book.insert_or_assign(key, value);
+        }
+    }
+    hilet key = datum{"price"};
+
+    for (auto _ : state) {
+        for (hilet& book : books) {
+            benchmark::DoNotOptimize(book.find(key)->second);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * books.size());
+}
+BENCHMARK(datum_std_map_find_prices)->Unit(benchmark::kMicrosecond);
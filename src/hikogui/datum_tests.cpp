@@ -169,6 +169,23 @@ static datum bookstore = parse_JSON(
     "    }\n"
     "}\n");
 
+TEST(datum, MapOperations)
+{
+    auto v = datum::make_map("foo", 1, "bar", 2);
+    v["baz"] = 3;
+    v["foo"] = 4;
+
+    ASSERT_EQ(v.keys(), datum::make_vector("foo", "bar", "baz"));
+    ASSERT_EQ(v.values(), datum::make_vector(4, 2, 3));
+    ASSERT_EQ(v, datum::make_map("baz", 3, "bar", 2, "foo", 4));
+    ASSERT_EQ(v.hash(), datum::make_map("baz", 3, "bar", 2, "foo", 4).hash());
+
+    // Numbers that compare equal are the same key.
+    auto m = datum::make_map(1, "one");
+    ASSERT_TRUE(m.contains(datum{1.0}));
+    ASSERT_EQ(m[datum{1.0}], "one");
+}
+
 TEST(datum, find)
 {
     auto authors1 = bookstore.find(jsonpath("$.store.book[*].author"));
@@ -187,16 +204,16 @@ TEST(datum, find)
 
     auto things = bookstore.find(jsonpath("$.store.*"));
     ASSERT_EQ(size(things), 2);
-    ASSERT_EQ(size(*(things[0])), 2); // attributes of bicycle
-    ASSERT_EQ(size(*(things[1])), 4); // list of books
+    ASSERT_EQ(size(*(things[0])), 4); // list of books
+    ASSERT_EQ(size(*(things[1])), 2); // attributes of bicycle
 
     auto prices = bookstore.find(jsonpath("$.store..price"));
     ASSERT_EQ(size(prices), 5);
-    ASSERT_EQ(*(prices[0]), 19.95); // bicycle first
-    ASSERT_EQ(*(prices[1]), 8.95);
-    ASSERT_EQ(*(prices[2]), 12.99);
-    ASSERT_EQ(*(prices[3]), 8.99);
-    ASSERT_EQ(*(prices[4]), 22.99);
+    ASSERT_EQ(*(prices[0]), 8.95);
+    ASSERT_EQ(*(prices[1]), 12.99);
+    ASSERT_EQ(*(prices[2]), 8.99);
+    ASSERT_EQ(*(prices[3]), 22.99);
+    ASSERT_EQ(*(prices[4]), 19.95); // bicycle last, in document order
 
     auto book3 = bookstore.find(jsonpath("$..book[2]"));
     ASSERT_EQ(size(book3), 1);
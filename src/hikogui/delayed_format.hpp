@@ -60,6 +60,13 @@ public:
         return std::apply(format_locale_wrapper<Values const &...>, _values);
     }
 
+    /** The captured arguments.
+     */
+    [[nodiscard]] std::tuple<Values...> const &values() const noexcept
+    {
+        return _values;
+    }
+
 private:
     std::tuple<Values...> _values;
 
@@ -14,6 +14,11 @@ struct formula_add_node final : formula_binary_operator_node {
     {
     }
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_binary(*this, formula_opcode::add, *lhs, *rhs);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         auto lhs_ = lhs->evaluate(context);
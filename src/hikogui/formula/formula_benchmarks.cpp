@@ -0,0 +1,65 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "formula.hpp"
+#include "formula_program.hpp"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string_view>
+
+using namespace hi;
+
+/** The expressions to evaluate, selected by the argument of the benchmark.
+ *
+ * - Names that are used several times, which are looked up once per evaluation by the program.
+ * - Indexing and member selection.
+ * - An expression that is folded into a constant by the compiler.
+ */
+constexpr auto formula_benchmarks_expressions = std::array<std::string_view, 3>{
+    "(a + 1) * (a - 1) + a * a - b",
+    "v[2] + m.level * a",
+    "1 + 2 * 3 - 4 / 2"};
+
+static formula_evaluation_context formula_benchmarks_context()
+{
+    auto context = formula_evaluation_context{};
+    context.set_global("a", datum{5});
+    context.set_global("b", datum{2.5});
+    context.set_global("v", datum::make_vector(1, 2, 42, 3));
+    context.set_global("m", datum::make_map("level", 3));
+    return context;
+}
+
+/** Evaluate an expression with the tree walker.
+ */
+static void formula_tree_evaluate(benchmark::State& state)
+{
+    hilet text = formula_benchmarks_expressions[state.range(0)];
+    hilet expression = parse_formula(text);
+    auto context = formula_benchmarks_context();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(expression->evaluate(context));
+    }
+    state.SetLabel(std::string{text});
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(formula_tree_evaluate)->DenseRange(0, formula_benchmarks_expressions.size() - 1);
+
+/** Evaluate an expression compiled into a formula_program.
+ */
+static void formula_program_evaluate(benchmark::State& state)
+{
+    hilet text = formula_benchmarks_expressions[state.range(0)];
+    hilet expression = parse_formula(text);
+    hilet program = formula_program{*expression};
+    auto context = formula_benchmarks_context();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(program.evaluate(context));
+    }
+    state.SetLabel(std::string{text});
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(formula_program_evaluate)->DenseRange(0, formula_benchmarks_expressions.size() - 1);
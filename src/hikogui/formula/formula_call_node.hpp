@@ -27,6 +27,11 @@ struct formula_call_node final : formula_node {
         }
     }
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_call(*this, *lhs, args);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         hilet args_ = transform<datum::vector_type>(args, [&](hilet &x) {
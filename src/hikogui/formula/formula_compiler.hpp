@@ -0,0 +1,150 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "formula_program.hpp"
+#include "formula_post_process_context.hpp"
+#include "../utility/module.hpp"
+#include "../parse_location.hpp"
+#include "../datum.hpp"
+#include <vector>
+#include <string>
+#include <memory>
+
+namespace hi::inline v1 {
+struct formula_node;
+
+/** Compiles a formula into a formula_program.
+ *
+ * Each node compiles itself through `formula_node::compile()`, using the functions
+ * of the compiler to emit instructions. Each function returns the operand holding the
+ * result of the expression.
+ *
+ * A name operand is read when the instruction that uses it is executed. When an operand
+ * must be read before the instructions of a sibling expression are executed, and those
+ * instructions may change a name, the name is first moved into a register.
+ */
+class formula_compiler {
+public:
+    using formula_vector = std::vector<std::unique_ptr<formula_node>>;
+
+    /** Compile a formula into a program.
+     *
+     * @param program The program to emit the instructions into.
+     */
+    formula_compiler(formula_program& program) noexcept : _program(program) {}
+
+    /** Compile the top of the formula.
+     */
+    void compile_program(formula_node const& expression);
+
+    /** Compile a sub-expression.
+     */
+    [[nodiscard]] formula_operand compile(formula_node const& expression);
+
+    /** Evaluate an expression with the tree walker.
+     *
+     * This is used for expressions that do not have their own instructions.
+     */
+    [[nodiscard]] formula_operand compile_evaluate(formula_node const& node);
+
+    [[nodiscard]] formula_operand compile_literal(datum const& value);
+    [[nodiscard]] formula_operand compile_name(formula_node const& node, std::string const& name);
+
+    /** Compile an operator with a single operand.
+     *
+     * The operator is folded when its operand is a constant.
+     */
+    [[nodiscard]] formula_operand compile_unary(formula_node const& node, formula_opcode opcode, formula_node const& rhs);
+
+    /** Compile an operator with two operands.
+     *
+     * The operator is folded when both operands are constants.
+     */
+    [[nodiscard]] formula_operand
+    compile_binary(formula_node const& node, formula_opcode opcode, formula_node const& lhs, formula_node const& rhs);
+
+    [[nodiscard]] formula_operand compile_member(formula_node const& node, formula_node const& lhs, std::string const& name);
+
+    [[nodiscard]] formula_operand compile_filter(
+        formula_node const& node,
+        formula_node const& lhs,
+        formula_post_process_context::filter_type const& filter);
+
+    /** Compile the short-circuit `&&` and `||` operators.
+     *
+     * @param opcode `formula_opcode::jump_if_false` for `&&`, `formula_opcode::jump_if_true` for `||`.
+     */
+    [[nodiscard]] formula_operand
+    compile_logical(formula_node const& node, formula_opcode opcode, formula_node const& lhs, formula_node const& rhs);
+
+    [[nodiscard]] formula_operand compile_ternary(
+        formula_node const& node,
+        formula_node const& condition,
+        formula_node const& rhs_true,
+        formula_node const& rhs_false);
+
+    [[nodiscard]] formula_operand compile_vector_literal(formula_node const& node, formula_vector const& values);
+    [[nodiscard]] formula_operand
+    compile_map_literal(formula_node const& node, formula_vector const& keys, formula_vector const& values);
+    [[nodiscard]] formula_operand compile_call(formula_node const& node, formula_node const& lhs, formula_vector const& args);
+
+    /** Compile an assignment.
+     * Only an assignment to a name is compiled, other assignments are evaluated with the tree walker.
+     */
+    [[nodiscard]] formula_operand compile_assign(formula_node const& node, formula_node const& lhs, formula_node const& rhs);
+
+    /** Compile an inplace operator.
+     * Only an inplace operator on a name is compiled, others are evaluated with the tree walker.
+     */
+    [[nodiscard]] formula_operand
+    compile_inplace(formula_node const& node, formula_opcode opcode, formula_node const& lhs, formula_node const& rhs);
+
+    /** Compile an increment or decrement.
+     * Only an increment or decrement of a name is compiled, others are evaluated with the tree walker.
+     */
+    [[nodiscard]] formula_operand compile_increment(formula_node const& node, formula_opcode opcode, formula_node const& rhs);
+
+private:
+    formula_program& _program;
+
+    /** Incremented for each instruction that may change a named value.
+     */
+    std::size_t _num_side_effects = 0;
+
+    [[nodiscard]] formula_operand allocate_register();
+    [[nodiscard]] formula_operand add_constant(datum value);
+    [[nodiscard]] std::size_t add_name(std::string const& name, parse_location const& location);
+
+    std::size_t emit(formula_opcode opcode, parse_location const& location, uint16_t a = 0, uint16_t b = 0, uint16_t c = 0);
+
+    /** Set the target of a jump instruction to the next instruction.
+     */
+    void patch_jump(std::size_t jump);
+
+    /** Move an operand into a register.
+     *
+     * @param operand The operand to move.
+     * @param location The location of the expression.
+     * @return A register operand, or @a operand if it is already a register.
+     */
+    [[nodiscard]] formula_operand materialize(formula_operand operand, parse_location const& location);
+
+    /** Make sure a name operand is read before the instructions that followed it.
+     *
+     * When instructions that may change a named value were emitted after @a position, a move
+     * of the name into a register is inserted at @a position.
+     *
+     * @param operand The operand that was the result of an expression.
+     * @param position The number of instructions when the expression was compiled.
+     * @param num_side_effects The number of side effects when the expression was compiled.
+     * @param location The location of the expression.
+     * @return The operand to use.
+     */
+    [[nodiscard]] formula_operand
+    read_before(formula_operand operand, std::size_t position, std::size_t num_side_effects, parse_location const& location);
+};
+
+} // namespace hi::inline v1
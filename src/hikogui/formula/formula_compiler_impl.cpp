@@ -0,0 +1,405 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "formula_compiler.hpp"
+#include "formula_node.hpp"
+#include "formula_name_node.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace hi::inline v1 {
+
+formula_program::formula_program(formula_node const& expression)
+{
+    auto compiler = formula_compiler{*this};
+    compiler.compile_program(expression);
+}
+
+void formula_compiler::compile_program(formula_node const& expression)
+{
+    _program._result = compile(expression);
+}
+
+formula_operand formula_compiler::compile(formula_node const& expression)
+{
+    return expression.compile(*this);
+}
+
+formula_operand formula_compiler::allocate_register()
+{
+    if (_program._num_registers > formula_operand::max_index) {
+        throw parse_error("Formula is too large to compile, too many registers.");
+    }
+    return {formula_operand::kind_type::reg, _program._num_registers++};
+}
+
+formula_operand formula_compiler::add_constant(datum value)
+{
+    if (_program._constants.size() > formula_operand::max_index) {
+        throw parse_error("Formula is too large to compile, too many constants.");
+    }
+    _program._constants.push_back(std::move(value));
+    return {formula_operand::kind_type::constant, _program._constants.size() - 1};
+}
+
+std::size_t formula_compiler::add_name(std::string const& name, parse_location const& location)
+{
+    hilet it = std::find(_program._names.begin(), _program._names.end(), name);
+    if (it != _program._names.end()) {
+        return narrow_cast<std::size_t>(std::distance(_program._names.begin(), it));
+    }
+
+    if (_program._names.size() > formula_operand::max_index) {
+        throw parse_error("Formula is too large to compile, too many names.");
+    }
+    _program._names.push_back(name);
+    _program._name_locations.push_back(location);
+    return _program._names.size() - 1;
+}
+
+std::size_t formula_compiler::emit(formula_opcode opcode, parse_location const& location, uint16_t a, uint16_t b, uint16_t c)
+{
+    if (_program._instructions.size() >= std::numeric_limits<uint16_t>::max()) {
+        throw parse_error("Formula is too large to compile, too many instructions.");
+    }
+
+    switch (opcode) {
+    case formula_opcode::evaluate:
+    case formula_opcode::call:
+    case formula_opcode::store:
+    case formula_opcode::inplace_add:
+    case formula_opcode::inplace_sub:
+    case formula_opcode::inplace_mul:
+    case formula_opcode::inplace_div:
+    case formula_opcode::inplace_mod:
+    case formula_opcode::inplace_shl:
+    case formula_opcode::inplace_shr:
+    case formula_opcode::inplace_and:
+    case formula_opcode::inplace_or:
+    case formula_opcode::inplace_xor:
+    case formula_opcode::increment:
+    case formula_opcode::decrement:
+        ++_num_side_effects;
+        break;
+    default:;
+    }
+
+    _program._instructions.push_back({opcode, a, b, c});
+    _program._locations.push_back(location);
+    return _program._instructions.size() - 1;
+}
+
+void formula_compiler::patch_jump(std::size_t jump)
+{
+    auto& instruction = _program._instructions[jump];
+    hilet target = narrow_cast<uint16_t>(_program._instructions.size());
+    if (instruction.opcode == formula_opcode::jump) {
+        instruction.a = target;
+    } else {
+        instruction.b = target;
+    }
+}
+
+formula_operand formula_compiler::materialize(formula_operand operand, parse_location const& location)
+{
+    if (operand.is_register()) {
+        return operand;
+    }
+
+    hilet r = allocate_register();
+    emit(formula_opcode::move, location, r.value, operand.value);
+    return r;
+}
+
+formula_operand formula_compiler::read_before(
+    formula_operand operand,
+    std::size_t position,
+    std::size_t num_side_effects,
+    parse_location const& location)
+{
+    if (not operand.is_name() or num_side_effects == _num_side_effects) {
+        return operand;
+    }
+
+    hilet r = allocate_register();
+    auto& instructions = _program._instructions;
+    auto& locations = _program._locations;
+    instructions.insert(instructions.begin() + position, formula_instruction{formula_opcode::move, r.value, operand.value});
+    locations.insert(locations.begin() + position, location);
+
+    // All jumps after the inserted instruction are forward jumps, which need to be moved as well.
+    // Jumps before the inserted instruction target at most the inserted instruction.
+    for (auto i = position + 1; i != instructions.size(); ++i) {
+        auto& instruction = instructions[i];
+        if (instruction.opcode == formula_opcode::jump) {
+            ++instruction.a;
+        } else if (instruction.opcode == formula_opcode::jump_if_false or instruction.opcode == formula_opcode::jump_if_true) {
+            ++instruction.b;
+        }
+    }
+    return r;
+}
+
+formula_operand formula_compiler::compile_evaluate(formula_node const& node)
+{
+    hilet r = allocate_register();
+    _program._nodes.push_back(&node);
+    emit(formula_opcode::evaluate, node.location, r.value, narrow_cast<uint16_t>(_program._nodes.size() - 1));
+    return r;
+}
+
+formula_operand formula_compiler::compile_literal(datum const& value)
+{
+    return add_constant(value);
+}
+
+formula_operand formula_compiler::compile_name(formula_node const& node, std::string const& name)
+{
+    return {formula_operand::kind_type::name, add_name(name, node.location)};
+}
+
+formula_operand formula_compiler::compile_unary(formula_node const& node, formula_opcode opcode, formula_node const& rhs)
+{
+    hilet rhs_ = compile(rhs);
+
+    if (rhs_.is_constant()) {
+        hilet& value = _program._constants[rhs_.index()];
+        try {
+            return add_constant(formula_program::evaluate_operator(opcode, value, value));
+        } catch (parse_error const&) {
+            throw;
+        } catch (...) {
+            // Leave the error to be reported during evaluation.
+        }
+    }
+
+    hilet r = allocate_register();
+    emit(opcode, node.location, r.value, rhs_.value);
+    return r;
+}
+
+formula_operand
+formula_compiler::compile_binary(formula_node const& node, formula_opcode opcode, formula_node const& lhs, formula_node const& rhs)
+{
+    auto lhs_ = compile(lhs);
+    hilet position = _program._instructions.size();
+    hilet num_side_effects = _num_side_effects;
+    hilet rhs_ = compile(rhs);
+    lhs_ = read_before(lhs_, position, num_side_effects, lhs.location);
+
+    if (lhs_.is_constant() and rhs_.is_constant()) {
+        try {
+            return add_constant(formula_program::evaluate_operator(
+                opcode, _program._constants[lhs_.index()], _program._constants[rhs_.index()]));
+        } catch (parse_error const&) {
+            throw;
+        } catch (...) {
+            // Leave the error to be reported during evaluation.
+        }
+    }
+
+    hilet r = allocate_register();
+    emit(opcode, node.location, r.value, lhs_.value, rhs_.value);
+    return r;
+}
+
+formula_operand formula_compiler::compile_member(formula_node const& node, formula_node const& lhs, std::string const& name)
+{
+    hilet lhs_ = compile(lhs);
+    hilet name_ = add_constant(datum{name});
+
+    if (lhs_.is_constant()) {
+        try {
+            return add_constant(formula_program::evaluate_operator(
+                formula_opcode::member, _program._constants[lhs_.index()], _program._constants[name_.index()]));
+        } catch (parse_error const&) {
+            throw;
+        } catch (...) {
+            // Leave the error to be reported during evaluation.
+        }
+    }
+
+    hilet r = allocate_register();
+    emit(formula_opcode::member, node.location, r.value, lhs_.value, name_.value);
+    return r;
+}
+
+formula_operand formula_compiler::compile_filter(
+    formula_node const& node,
+    formula_node const& lhs,
+    formula_post_process_context::filter_type const& filter)
+{
+    hilet lhs_ = compile(lhs);
+
+    hilet r = allocate_register();
+    _program._filters.push_back(&filter);
+    emit(formula_opcode::filter, node.location, r.value, narrow_cast<uint16_t>(_program._filters.size() - 1), lhs_.value);
+    return r;
+}
+
+formula_operand
+formula_compiler::compile_logical(formula_node const& node, formula_opcode opcode, formula_node const& lhs, formula_node const& rhs)
+{
+    hi_axiom(opcode == formula_opcode::jump_if_false or opcode == formula_opcode::jump_if_true);
+
+    hilet lhs_ = compile(lhs);
+    if (lhs_.is_constant()) {
+        hilet condition = static_cast<bool>(_program._constants[lhs_.index()]);
+        if (condition == (opcode == formula_opcode::jump_if_false)) {
+            return compile(rhs);
+        } else {
+            return lhs_;
+        }
+    }
+
+    // The result of the left hand side is the result of the expression when short-circuiting.
+    hilet r = materialize(lhs_, lhs.location);
+    hilet jump = emit(opcode, node.location, r.value);
+    hilet rhs_ = compile(rhs);
+    emit(formula_opcode::move, rhs.location, r.value, rhs_.value);
+    patch_jump(jump);
+    return r;
+}
+
+formula_operand formula_compiler::compile_ternary(
+    formula_node const& node,
+    formula_node const& condition,
+    formula_node const& rhs_true,
+    formula_node const& rhs_false)
+{
+    hilet condition_ = compile(condition);
+    if (condition_.is_constant()) {
+        if (static_cast<bool>(_program._constants[condition_.index()])) {
+            return compile(rhs_true);
+        } else {
+            return compile(rhs_false);
+        }
+    }
+
+    hilet r = allocate_register();
+    hilet jump_false = emit(formula_opcode::jump_if_false, node.location, condition_.value);
+    emit(formula_opcode::move, rhs_true.location, r.value, compile(rhs_true).value);
+    hilet jump_end = emit(formula_opcode::jump, node.location);
+    patch_jump(jump_false);
+    emit(formula_opcode::move, rhs_false.location, r.value, compile(rhs_false).value);
+    patch_jump(jump_end);
+    return r;
+}
+
+formula_operand formula_compiler::compile_vector_literal(formula_node const& node, formula_vector const& values)
+{
+    hilet position = _program._instructions.size();
+    hilet r = allocate_register();
+    emit(formula_opcode::vector_new, node.location, r.value);
+
+    auto is_constant = true;
+    for (hilet& value : values) {
+        hilet value_ = compile(*value);
+        is_constant &= value_.is_constant();
+        emit(formula_opcode::vector_push, value->location, r.value, value_.value);
+    }
+
+    if (is_constant) {
+        // Fold the vector into a single constant.
+        auto constant = datum::make_vector();
+        for (auto i = position + 1; i != _program._instructions.size(); ++i) {
+            constant.push_back(_program._constants[formula_operand{_program._instructions[i].b}.index()]);
+        }
+        _program._instructions.resize(position);
+        _program._locations.resize(position);
+        return add_constant(std::move(constant));
+    }
+    return r;
+}
+
+formula_operand formula_compiler::compile_map_literal(formula_node const& node, formula_vector const& keys, formula_vector const& values)
+{
+    hi_axiom(keys.size() == values.size());
+
+    hilet position = _program._instructions.size();
+    hilet r = allocate_register();
+    emit(formula_opcode::map_new, node.location, r.value);
+
+    auto is_constant = true;
+    for (auto i = 0_uz; i != keys.size(); ++i) {
+        // Like the tree walker, the value is evaluated before the key.
+        auto value_ = compile(*values[i]);
+        hilet key_position = _program._instructions.size();
+        hilet num_side_effects = _num_side_effects;
+        hilet key_ = compile(*keys[i]);
+        value_ = read_before(value_, key_position, num_side_effects, values[i]->location);
+
+        is_constant &= key_.is_constant() and value_.is_constant();
+        emit(formula_opcode::map_insert, node.location, r.value, key_.value, value_.value);
+    }
+
+    if (is_constant) {
+        // Fold the map into a single constant.
+        auto constant = datum::make_map();
+        for (auto i = position + 1; i != _program._instructions.size(); ++i) {
+            hilet& instruction = _program._instructions[i];
+            constant[_program._constants[formula_operand{instruction.b}.index()]] =
+                _program._constants[formula_operand{instruction.c}.index()];
+        }
+        _program._instructions.resize(position);
+        _program._locations.resize(position);
+        return add_constant(std::move(constant));
+    }
+    return r;
+}
+
+formula_operand formula_compiler::compile_call(formula_node const& node, formula_node const& lhs, formula_vector const& args)
+{
+    hilet arguments = allocate_register();
+    emit(formula_opcode::vector_new, node.location, arguments.value);
+    for (hilet& arg : args) {
+        emit(formula_opcode::vector_push, arg->location, arguments.value, compile(*arg).value);
+    }
+
+    hilet r = allocate_register();
+    _program._nodes.push_back(&lhs);
+    emit(formula_opcode::call, node.location, r.value, narrow_cast<uint16_t>(_program._nodes.size() - 1), arguments.value);
+    return r;
+}
+
+formula_operand formula_compiler::compile_assign(formula_node const& node, formula_node const& lhs, formula_node const& rhs)
+{
+    hilet name_node = dynamic_cast<formula_name_node const *>(&lhs);
+    if (name_node == nullptr) {
+        return compile_evaluate(node);
+    }
+
+    hilet rhs_ = compile(rhs);
+    hilet slot = add_name(name_node->name, lhs.location);
+    emit(formula_opcode::store, node.location, narrow_cast<uint16_t>(slot), rhs_.value);
+    return {formula_operand::kind_type::name, slot};
+}
+
+formula_operand
+formula_compiler::compile_inplace(formula_node const& node, formula_opcode opcode, formula_node const& lhs, formula_node const& rhs)
+{
+    hilet name_node = dynamic_cast<formula_name_node const *>(&lhs);
+    if (name_node == nullptr) {
+        return compile_evaluate(node);
+    }
+
+    hilet rhs_ = compile(rhs);
+    hilet slot = add_name(name_node->name, lhs.location);
+    emit(opcode, node.location, narrow_cast<uint16_t>(slot), rhs_.value);
+    return {formula_operand::kind_type::name, slot};
+}
+
+formula_operand formula_compiler::compile_increment(formula_node const& node, formula_opcode opcode, formula_node const& rhs)
+{
+    hilet name_node = dynamic_cast<formula_name_node const *>(&rhs);
+    if (name_node == nullptr) {
+        return compile_evaluate(node);
+    }
+
+    hilet slot = add_name(name_node->name, rhs.location);
+    emit(opcode, node.location, narrow_cast<uint16_t>(slot));
+    return {formula_operand::kind_type::name, slot};
+}
+
+} // namespace hi::inline v1
@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include "formula_output_sink.hpp"
 #include "../utility/module.hpp"
 #include "../datum.hpp"
 #include <unordered_map>
 #include <vector>
 #include <string_view>
+#include <algorithm>
 
 namespace hi::inline v1 {
 
@@ -17,8 +19,24 @@ struct formula_evaluation_context {
     using stack = std::vector<scope>;
 
     ssize_t output_disable_count = 0;
+
+    /** The output which has not been written to the output sink yet.
+     */
     std::string output;
 
+    /** When set, the output is written to the sink in pieces of about `output_flush_size` characters.
+     */
+    formula_output_sink *output_sink = nullptr;
+    std::size_t output_flush_size = 16384;
+
+    /** The number of characters already written to the output sink.
+     */
+    std::size_t output_flushed = 0;
+
+    /** While the output is held it is not written to the output sink.
+     */
+    std::size_t output_hold_count = 0;
+
     stack local_stack;
 
     struct loop_info {
@@ -42,33 +60,74 @@ struct formula_evaluation_context {
     std::vector<loop_info> loop_stack;
     scope globals;
 
+    /** The registers of the formula programs being evaluated.
+     * A program uses the registers above the registers of the program that called it.
+     */
+    std::vector<datum> program_registers;
+
+    /** Cached pointers to the named values used by the formula programs being evaluated.
+     * A program uses the slots above the slots of the program that called it.
+     */
+    std::vector<datum const *> program_slots;
+
     formula_evaluation_context() noexcept = default;
 
     /** Write data to the output.
      */
-    void write(std::string_view text) noexcept
+    void write(std::string_view text)
     {
         if (output_disable_count == 0) {
             output += text;
+
+            if (output_sink != nullptr and output_hold_count == 0 and output.size() >= output_flush_size) {
+                flush_output();
+            }
         }
     }
 
-    /** Get the size of the output.
+    /** Write the output to the output sink.
+     */
+    void flush_output()
+    {
+        if (output_sink != nullptr and not output.empty()) {
+            output_sink->write(output);
+            output_flushed += output.size();
+            output.clear();
+        }
+    }
+
+    /** Hold the output while it may need to be reset to a previous position.
+     */
+    void hold_output() noexcept
+    {
+        ++output_hold_count;
+    }
+
+    void release_output() noexcept
+    {
+        hi_assert(output_hold_count > 0);
+        --output_hold_count;
+    }
+
+    /** Get the size of the output, including the output written to the output sink.
      * Used if you need to reset the output to a previous position.
      */
     ssize_t output_size() const noexcept
     {
-        return ssize(output);
+        return narrow_cast<ssize_t>(output_flushed + output.size());
     }
 
     /** Set the size of the output.
      * Used if you need to reset the output to a previous position.
+     *
+     * Output that was already written to the output sink can not be reset, this only
+     * happens for a \#return outside of a function, which is reported as an error.
      */
     void set_output_size(ssize_t new_size) noexcept
     {
-        hi_assert(new_size > 0);
+        hi_assert(new_size >= 0);
         hi_assert(new_size <= output_size());
-        output.resize(new_size);
+        output.resize(narrow_cast<std::size_t>(std::max(new_size, narrow_cast<ssize_t>(output_flushed))) - output_flushed);
     }
 
     void enable_output() noexcept
@@ -33,6 +33,11 @@ struct formula_filter_node final : formula_binary_operator_node {
         }
     }
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_filter(*this, *lhs, filter);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         auto lhs_ = lhs->evaluate(context);
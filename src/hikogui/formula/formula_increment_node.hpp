@@ -14,6 +14,11 @@ struct formula_increment_node final : formula_unary_operator_node {
     {
     }
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_increment(*this, formula_opcode::increment, *rhs);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         auto &rhs_ = rhs->evaluate_lvalue(context);
@@ -14,6 +14,11 @@ struct formula_inplace_and_node final : formula_binary_operator_node {
     {
     }
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_inplace(*this, formula_opcode::inplace_and, *lhs, *rhs);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         auto rhs_ = rhs->evaluate(context);
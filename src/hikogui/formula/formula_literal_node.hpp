@@ -13,6 +13,11 @@ struct formula_literal_node final : formula_node {
 
     formula_literal_node(parse_location location, datum const &value) : formula_node(std::move(location)), value(value) {}
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_literal(value);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         return value;
@@ -28,6 +28,11 @@ struct formula_map_literal_node final : formula_node {
         }
     }
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_map_literal(*this, keys, values);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         hi_assert(keys.size() == values.size());
@@ -29,6 +29,11 @@ struct formula_member_node final : formula_binary_operator_node {
         }
     }
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_member(*this, *lhs, rhs_name->name);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         if (lhs->has_evaluate_xvalue()) {
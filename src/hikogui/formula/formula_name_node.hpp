@@ -22,6 +22,11 @@ struct formula_name_node final : formula_node {
         }
     }
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_name(*this, name);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         hilet &const_context = context;
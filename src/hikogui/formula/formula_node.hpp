@@ -6,6 +6,7 @@
 
 #include "formula_post_process_context.hpp"
 #include "formula_evaluation_context.hpp"
+#include "formula_compiler.hpp"
 #include "../utility/module.hpp"
 #include "../parse_location.hpp"
 #include "../datum.hpp"
@@ -49,6 +50,16 @@ struct formula_node {
      */
     virtual void resolve_function_pointer(formula_post_process_context& context) {}
 
+    /** Compile the expression into instructions of a formula_program.
+     * Expressions that do not override this function are evaluated with the tree walker.
+     *
+     * @return The operand holding the result of the expression.
+     */
+    virtual formula_operand compile(formula_compiler& compiler) const
+    {
+        return compiler.compile_evaluate(*this);
+    }
+
     /** Evaluate an rvalue.
      */
     virtual datum evaluate(formula_evaluation_context& context) const = 0;
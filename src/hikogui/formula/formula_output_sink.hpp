@@ -0,0 +1,171 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../file/file.hpp"
+#include "../utility/module.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <utility>
+
+namespace hi::inline v1 {
+
+/** The destination of the output of a template.
+ *
+ * The evaluation context sends its output to the sink in pieces, so that
+ * a template does not need to be rendered in memory completely.
+ */
+class formula_output_sink {
+public:
+    virtual ~formula_output_sink() = default;
+
+    /** Write a piece of output.
+     *
+     * @param text The text to write.
+     */
+    virtual void write(std::string_view text) = 0;
+
+    /** Called after the last piece of output was written.
+     */
+    virtual void flush() {}
+};
+
+/** Write the output to a file.
+ */
+class formula_file_sink final : public formula_output_sink {
+public:
+    /** Write the output to a file.
+     *
+     * @param file The file to write to, it must be opened for writing.
+     */
+    formula_file_sink(file& file) noexcept : _file(file) {}
+
+    /** @throws io_error
+     */
+    void write(std::string_view text) override
+    {
+        _file.write(text);
+    }
+
+    /** @throws io_error
+     */
+    void flush() override
+    {
+        _file.flush();
+    }
+
+private:
+    file& _file;
+};
+
+/** Collect the output in a list of chunks.
+ *
+ * Unlike a single string, the chunks are never reallocated when the output grows.
+ */
+class formula_chunked_sink final : public formula_output_sink {
+public:
+    /** Collect the output in chunks.
+     *
+     * @param chunk_size The size of each chunk, except for the last one.
+     */
+    formula_chunked_sink(std::size_t chunk_size = 65536) noexcept : _chunk_size(chunk_size)
+    {
+        hi_assert(chunk_size > 0);
+    }
+
+    void write(std::string_view text) override
+    {
+        while (not text.empty()) {
+            if (_chunks.empty() or _chunks.back().size() == _chunk_size) {
+                _chunks.emplace_back().reserve(_chunk_size);
+            }
+
+            auto& chunk = _chunks.back();
+            hilet n = std::min(text.size(), _chunk_size - chunk.size());
+            chunk += text.substr(0, n);
+            text.remove_prefix(n);
+            _size += n;
+        }
+    }
+
+    /** The chunks that were written.
+     */
+    [[nodiscard]] std::vector<std::string> const& chunks() const noexcept
+    {
+        return _chunks;
+    }
+
+    /** The total number of characters that were written.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    /** Remove the chunks from the sink.
+     *
+     * This allows a consumer to take the output while a template is being rendered.
+     */
+    [[nodiscard]] std::vector<std::string> take() noexcept
+    {
+        _size = 0;
+        return std::exchange(_chunks, {});
+    }
+
+    /** Join the chunks into a single string.
+     */
+    [[nodiscard]] std::string string() const noexcept
+    {
+        auto r = std::string{};
+        r.reserve(_size);
+        for (hilet& chunk : _chunks) {
+            r += chunk;
+        }
+        return r;
+    }
+
+private:
+    std::size_t _chunk_size;
+    std::size_t _size = 0;
+    std::vector<std::string> _chunks;
+};
+
+/** Pass the output to a callback.
+ *
+ * The callback is called on the thread that renders the template. It may apply
+ * backpressure by blocking until the consumer is ready to accept more output, or
+ * stop the rendering by returning false.
+ */
+class formula_callback_sink final : public formula_output_sink {
+public:
+    /** The callback.
+     *
+     * @param text The piece of output.
+     * @return true to continue rendering, false to cancel.
+     */
+    using callback_type = std::function<bool(std::string_view)>;
+
+    template<typename Func>
+    formula_callback_sink(Func&& func) noexcept : _callback(std::forward<Func>(func))
+    {
+    }
+
+    /** @throws cancel_error When the callback returned false.
+     */
+    void write(std::string_view text) override
+    {
+        if (not _callback(text)) {
+            throw cancel_error("Output was cancelled by the consumer.");
+        }
+    }
+
+private:
+    callback_type _callback;
+};
+
+} // namespace hi::inline v1
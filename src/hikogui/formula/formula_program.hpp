@@ -0,0 +1,247 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "formula_evaluation_context.hpp"
+#include "formula_post_process_context.hpp"
+#include "../utility/module.hpp"
+#include "../parse_location.hpp"
+#include "../datum.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace hi::inline v1 {
+struct formula_node;
+
+/** The operation of a formula instruction.
+ *
+ * In the comments `a`, `b` and `c` are the fields of the instruction, `r[x]` is a register,
+ * `op(x)` is a register, constant or name operand and `name(x)` is a name slot.
+ */
+enum class formula_opcode : uint8_t {
+    move, ///< r[a] = op(b), a register operand is moved.
+    evaluate, ///< r[a] = nodes[b]->evaluate(); fallback to the tree walker.
+    jump, ///< goto a.
+    jump_if_false, ///< if (not op(a)) goto b.
+    jump_if_true, ///< if (op(a)) goto b.
+
+    add, ///< r[a] = op(b) + op(c).
+    sub, ///< r[a] = op(b) - op(c).
+    mul, ///< r[a] = op(b) * op(c).
+    div, ///< r[a] = op(b) / op(c).
+    mod, ///< r[a] = op(b) % op(c).
+    pow, ///< r[a] = pow(op(b), op(c)).
+    shl, ///< r[a] = op(b) << op(c).
+    shr, ///< r[a] = op(b) >> op(c).
+    bit_and, ///< r[a] = op(b) & op(c).
+    bit_or, ///< r[a] = op(b) | op(c).
+    bit_xor, ///< r[a] = op(b) ^ op(c).
+    eq, ///< r[a] = op(b) == op(c).
+    ne, ///< r[a] = op(b) != op(c).
+    lt, ///< r[a] = op(b) < op(c).
+    gt, ///< r[a] = op(b) > op(c).
+    le, ///< r[a] = op(b) <= op(c).
+    ge, ///< r[a] = op(b) >= op(c).
+    minus, ///< r[a] = -op(b).
+    plus, ///< r[a] = +op(b).
+    invert, ///< r[a] = ~op(b).
+    logical_not, ///< r[a] = not op(b).
+    index, ///< r[a] = op(b)[op(c)].
+    member, ///< r[a] = op(b).op(c), where op(c) is the name of the attribute.
+
+    filter, ///< r[a] = filters[b](op(c)).
+    vector_new, ///< r[a] = [].
+    vector_push, ///< r[a].push_back(op(b)).
+    map_new, ///< r[a] = {}.
+    map_insert, ///< r[a][op(b)] = op(c).
+    call, ///< r[a] = nodes[b]->call(r[c]), where r[c] is the vector of arguments.
+
+    store, ///< name(a) = op(b).
+    inplace_add, ///< name(a) += op(b).
+    inplace_sub, ///< name(a) -= op(b).
+    inplace_mul, ///< name(a) *= op(b).
+    inplace_div, ///< name(a) /= op(b).
+    inplace_mod, ///< name(a) %= op(b).
+    inplace_shl, ///< name(a) <<= op(b).
+    inplace_shr, ///< name(a) >>= op(b).
+    inplace_and, ///< name(a) &= op(b).
+    inplace_or, ///< name(a) |= op(b).
+    inplace_xor, ///< name(a) ^= op(b).
+    increment, ///< ++name(a).
+    decrement, ///< --name(a).
+};
+
+/** An operand of a formula instruction.
+ *
+ * The two most significant bits select a register, a constant or a name; the other
+ * bits are the index in the register file, the constant pool or the name table.
+ */
+struct formula_operand {
+    enum class kind_type : uint16_t { reg = 0, constant = 1, name = 2 };
+
+    constexpr static std::size_t max_index = 0x3fff;
+
+    uint16_t value = 0;
+
+    constexpr formula_operand() noexcept = default;
+
+    constexpr explicit formula_operand(uint16_t value) noexcept : value(value) {}
+
+    constexpr formula_operand(kind_type kind, std::size_t index) noexcept :
+        value(narrow_cast<uint16_t>((to_underlying(kind) << 14) | index))
+    {
+        hi_axiom(index <= max_index);
+    }
+
+    [[nodiscard]] constexpr kind_type kind() const noexcept
+    {
+        return static_cast<kind_type>(value >> 14);
+    }
+
+    [[nodiscard]] constexpr std::size_t index() const noexcept
+    {
+        return value & max_index;
+    }
+
+    [[nodiscard]] constexpr bool is_register() const noexcept
+    {
+        return kind() == kind_type::reg;
+    }
+
+    [[nodiscard]] constexpr bool is_constant() const noexcept
+    {
+        return kind() == kind_type::constant;
+    }
+
+    [[nodiscard]] constexpr bool is_name() const noexcept
+    {
+        return kind() == kind_type::name;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(formula_operand const&, formula_operand const&) noexcept = default;
+};
+
+/** A single instruction of a formula program.
+ *
+ * The meaning of the fields `a`, `b` and `c` depend on the opcode.
+ */
+struct formula_instruction {
+    formula_opcode opcode;
+    uint16_t a = 0;
+    uint16_t b = 0;
+    uint16_t c = 0;
+};
+
+static_assert(sizeof(formula_instruction) == 8);
+
+/** A formula compiled into bytecode.
+ *
+ * The program is compiled from a formula after `post_process()`. Names are resolved
+ * to slots, constant sub-expressions are folded and the instructions operate on the registers
+ * of a register-based interpreter.
+ *
+ * A name slot is an index into the table of names used by the program. The value of a name can
+ * not be resolved at compile time, because locals are pushed and popped by function calls and
+ * globals may be added or removed between evaluations. Instead, during evaluation, a name slot
+ * caches a pointer to the value found in the local or global scope, so that each name is only
+ * looked up by string once per evaluation. The cache is cleared after a call to a function,
+ * since a function may change the scope.
+ *
+ * A program refers to the nodes of the formula it was compiled from, for calls and for
+ * the rare expressions that are not compiled, so the formula must outlive the program.
+ * The tree walking `formula_node::evaluate()` remains the reference implementation.
+ */
+class formula_program {
+public:
+    constexpr formula_program() noexcept = default;
+    formula_program(formula_program const&) = default;
+    formula_program(formula_program&&) noexcept = default;
+    formula_program& operator=(formula_program const&) = default;
+    formula_program& operator=(formula_program&&) noexcept = default;
+
+    /** Compile a formula.
+     *
+     * @param expression A formula that has been post-processed.
+     * @throws parse_error When the formula is too large to compile.
+     */
+    explicit formula_program(formula_node const& expression);
+
+    /** Evaluate the program.
+     *
+     * @param context The context with the local and global scope.
+     * @return The result of the formula.
+     * @throws operation_error When the formula could not be evaluated.
+     */
+    [[nodiscard]] datum evaluate(formula_evaluation_context& context) const;
+
+    [[nodiscard]] datum evaluate_without_output(formula_evaluation_context& context) const
+    {
+        context.disable_output();
+        auto r = evaluate(context);
+        context.enable_output();
+        return r;
+    }
+
+    /** The number of instructions.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _instructions.size();
+    }
+
+    /** Check if the result of the program is a constant.
+     *
+     * All sub-expressions of a constant program were folded during compilation.
+     */
+    [[nodiscard]] bool is_constant() const noexcept
+    {
+        return _instructions.empty() and _result.is_constant();
+    }
+
+    /** The number of registers used by the program.
+     */
+    [[nodiscard]] std::size_t num_registers() const noexcept
+    {
+        return _num_registers;
+    }
+
+    /** Execute a unary or binary operator on two values.
+     *
+     * This is used by the interpreter and by the compiler for constant folding.
+     *
+     * @param opcode An opcode between `formula_opcode::add` and `formula_opcode::member`.
+     * @param lhs The left hand side operand, or the only operand of an unary operator.
+     * @param rhs The right hand side operand, ignored by unary operators.
+     * @return The result of the operation.
+     */
+    [[nodiscard]] static datum evaluate_operator(formula_opcode opcode, datum const& lhs, datum const& rhs);
+
+    /** The name of an operation, as it is used in error messages.
+     */
+    [[nodiscard]] static char const *operator_name(formula_opcode opcode) noexcept;
+
+private:
+    std::vector<formula_instruction> _instructions;
+
+    /** The location in the source of each instruction, for error messages.
+     */
+    std::vector<parse_location> _locations;
+
+    std::vector<datum> _constants;
+    std::vector<std::string> _names;
+    std::vector<parse_location> _name_locations;
+    std::vector<formula_node const *> _nodes;
+    std::vector<formula_post_process_context::filter_type const *> _filters;
+
+    std::size_t _num_registers = 0;
+    formula_operand _result = {};
+
+    [[nodiscard]] datum execute(formula_evaluation_context& context, std::size_t register_base, std::size_t slot_base) const;
+
+    friend class formula_compiler;
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,416 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "formula_program.hpp"
+#include "formula_node.hpp"
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+namespace hi::inline v1 {
+
+datum formula_program::evaluate_operator(formula_opcode opcode, datum const& lhs, datum const& rhs)
+{
+    switch (opcode) {
+    case formula_opcode::add:
+        return lhs + rhs;
+    case formula_opcode::sub:
+        return lhs - rhs;
+    case formula_opcode::mul:
+        return lhs * rhs;
+    case formula_opcode::div:
+        return lhs / rhs;
+    case formula_opcode::mod:
+        return lhs % rhs;
+    case formula_opcode::pow:
+        return pow(lhs, rhs);
+    case formula_opcode::shl:
+        return lhs << rhs;
+    case formula_opcode::shr:
+        return lhs >> rhs;
+    case formula_opcode::bit_and:
+        return lhs & rhs;
+    case formula_opcode::bit_or:
+        return lhs | rhs;
+    case formula_opcode::bit_xor:
+        return lhs ^ rhs;
+    case formula_opcode::eq:
+        return datum{lhs == rhs};
+    case formula_opcode::ne:
+        return datum{lhs != rhs};
+    case formula_opcode::lt:
+        return datum{lhs < rhs};
+    case formula_opcode::gt:
+        return datum{lhs > rhs};
+    case formula_opcode::le:
+        return datum{lhs <= rhs};
+    case formula_opcode::ge:
+        return datum{lhs >= rhs};
+    case formula_opcode::minus:
+        return -lhs;
+    case formula_opcode::plus:
+        return lhs;
+    case formula_opcode::invert:
+        return ~lhs;
+    case formula_opcode::logical_not:
+        return datum{!lhs};
+    case formula_opcode::index:
+        if (holds_alternative<datum::map_type>(lhs) and not lhs.contains(rhs)) {
+            throw std::out_of_range(std::format("Unknown key '{}'.", rhs));
+        }
+        return lhs[rhs];
+    case formula_opcode::member:
+        if (not lhs.contains(rhs)) {
+            throw std::out_of_range(std::format("Unknown attribute .{}", static_cast<std::string>(rhs)));
+        }
+        return lhs[rhs];
+    default:
+        hi_no_default();
+    }
+}
+
+char const *formula_program::operator_name(formula_opcode opcode) noexcept
+{
+    switch (opcode) {
+    case formula_opcode::add:
+        return "add";
+    case formula_opcode::sub:
+        return "subtract";
+    case formula_opcode::mul:
+        return "multiply";
+    case formula_opcode::div:
+        return "division";
+    case formula_opcode::mod:
+        return "modulo";
+    case formula_opcode::pow:
+        return "power-operator";
+    case formula_opcode::shl:
+        return "shift-left";
+    case formula_opcode::shr:
+        return "shift-right";
+    case formula_opcode::bit_and:
+        return "binary-and";
+    case formula_opcode::bit_or:
+        return "binary-or";
+    case formula_opcode::bit_xor:
+        return "binary-xor";
+    case formula_opcode::minus:
+        return "unary-minus";
+    case formula_opcode::plus:
+        return "unary-plus";
+    case formula_opcode::invert:
+        return "binary-not";
+    case formula_opcode::logical_not:
+        return "logical not";
+    case formula_opcode::index:
+        return "indexing operation";
+    case formula_opcode::member:
+        return "member selection";
+    case formula_opcode::filter:
+        return "filter";
+    case formula_opcode::inplace_add:
+        return "inplace-add";
+    case formula_opcode::inplace_sub:
+        return "inplace-subtract";
+    case formula_opcode::inplace_mul:
+        return "inplace-multiply";
+    case formula_opcode::inplace_div:
+        return "inplace-divide";
+    case formula_opcode::inplace_mod:
+        return "inplace_modulo";
+    case formula_opcode::inplace_shl:
+        return "inplace-shift-left";
+    case formula_opcode::inplace_shr:
+        return "inplace-shift-right";
+    case formula_opcode::inplace_and:
+        return "inplace-and";
+    case formula_opcode::inplace_or:
+        return "inplace-or";
+    case formula_opcode::inplace_xor:
+        return "inplace-xor";
+    case formula_opcode::increment:
+        return "increment";
+    case formula_opcode::decrement:
+        return "decrement";
+    default:
+        return "operation";
+    }
+}
+
+datum formula_program::evaluate(formula_evaluation_context& context) const
+{
+    if (_num_registers == 0 and _result.is_register()) {
+        // A default constructed program.
+        return datum{};
+    }
+
+    // The registers and name slots are allocated on stacks in the context, so that a function
+    // called by this program may evaluate other programs, or this program recursively.
+    hilet register_base = context.program_registers.size();
+    hilet slot_base = context.program_slots.size();
+    context.program_registers.resize(register_base + _num_registers);
+    context.program_slots.resize(slot_base + _names.size(), nullptr);
+
+    try {
+        auto r = execute(context, register_base, slot_base);
+        context.program_registers.resize(register_base);
+        context.program_slots.resize(slot_base);
+        return r;
+
+    } catch (...) {
+        context.program_registers.resize(register_base);
+        context.program_slots.resize(slot_base);
+        throw;
+    }
+}
+
+datum formula_program::execute(formula_evaluation_context& context, std::size_t register_base, std::size_t slot_base) const
+{
+    // The register file may be reallocated when a function evaluates another program,
+    // therefor registers are always accessed through the context.
+    hilet reg = [&](std::size_t i) -> datum& {
+        return context.program_registers[register_base + i];
+    };
+
+    hilet name = [&](std::size_t i) -> datum const& {
+        auto& slot = context.program_slots[slot_base + i];
+        if (slot == nullptr) {
+            try {
+                slot = &std::as_const(context).get(_names[i]);
+            } catch (std::exception const& e) {
+                throw operation_error(std::format("{}: Can not evaluate function.\n{}", _name_locations[i], e.what()));
+            }
+        }
+        return *slot;
+    };
+
+    hilet name_lvalue = [&](std::size_t i) -> datum& {
+        try {
+            auto& r = context.get(_names[i]);
+            context.program_slots[slot_base + i] = &r;
+            return r;
+        } catch (std::exception const& e) {
+            throw operation_error(std::format("{}: Can not evaluate function.\n{}", _name_locations[i], e.what()));
+        }
+    };
+
+    hilet operand = [&](uint16_t x) -> datum const& {
+        hilet op = formula_operand{x};
+        switch (op.kind()) {
+        case formula_operand::kind_type::reg:
+            return reg(op.index());
+        case formula_operand::kind_type::constant:
+            return _constants[op.index()];
+        case formula_operand::kind_type::name:
+            return name(op.index());
+        default:
+            hi_no_default();
+        }
+    };
+
+    hilet invalidate_slots = [&] {
+        std::fill(context.program_slots.begin() + slot_base, context.program_slots.end(), nullptr);
+    };
+
+    hilet size = _instructions.size();
+    auto ip = 0_uz;
+    while (ip != size) {
+        hilet& instruction = _instructions[ip];
+
+        try {
+            switch (instruction.opcode) {
+            case formula_opcode::move:
+                if (hilet op = formula_operand{instruction.b}; op.is_register()) {
+                    // A register is only read once, so its value can be moved.
+                    reg(instruction.a) = std::move(reg(op.index()));
+                } else {
+                    reg(instruction.a) = operand(instruction.b);
+                }
+                break;
+
+            case formula_opcode::evaluate:
+                {
+                    auto r = _nodes[instruction.b]->evaluate(context);
+                    reg(instruction.a) = std::move(r);
+                    invalidate_slots();
+                }
+                break;
+
+            case formula_opcode::jump:
+                ip = instruction.a;
+                continue;
+
+            case formula_opcode::jump_if_false:
+                if (not operand(instruction.a)) {
+                    ip = instruction.b;
+                    continue;
+                }
+                break;
+
+            case formula_opcode::jump_if_true:
+                if (operand(instruction.a)) {
+                    ip = instruction.b;
+                    continue;
+                }
+                break;
+
+            case formula_opcode::add:
+            case formula_opcode::sub:
+            case formula_opcode::mul:
+            case formula_opcode::div:
+            case formula_opcode::mod:
+            case formula_opcode::pow:
+            case formula_opcode::shl:
+            case formula_opcode::shr:
+            case formula_opcode::bit_and:
+            case formula_opcode::bit_or:
+            case formula_opcode::bit_xor:
+            case formula_opcode::eq:
+            case formula_opcode::ne:
+            case formula_opcode::lt:
+            case formula_opcode::gt:
+            case formula_opcode::le:
+            case formula_opcode::ge:
+            case formula_opcode::index:
+            case formula_opcode::member:
+                reg(instruction.a) = evaluate_operator(instruction.opcode, operand(instruction.b), operand(instruction.c));
+                break;
+
+            case formula_opcode::minus:
+            case formula_opcode::plus:
+            case formula_opcode::invert:
+            case formula_opcode::logical_not:
+                {
+                    hilet& rhs = operand(instruction.b);
+                    reg(instruction.a) = evaluate_operator(instruction.opcode, rhs, rhs);
+                }
+                break;
+
+            case formula_opcode::filter:
+                reg(instruction.a) = datum{(*_filters[instruction.b])(static_cast<std::string>(operand(instruction.c)))};
+                break;
+
+            case formula_opcode::vector_new:
+                reg(instruction.a) = datum::make_vector();
+                break;
+
+            case formula_opcode::vector_push:
+                if (hilet op = formula_operand{instruction.b}; op.is_register()) {
+                    reg(instruction.a).push_back(std::move(reg(op.index())));
+                } else {
+                    reg(instruction.a).push_back(operand(instruction.b));
+                }
+                break;
+
+            case formula_opcode::map_new:
+                reg(instruction.a) = datum::make_map();
+                break;
+
+            case formula_opcode::map_insert:
+                {
+                    auto value = operand(instruction.c);
+                    get<datum::map_type>(reg(instruction.a))[operand(instruction.b)] = std::move(value);
+                }
+                break;
+
+            case formula_opcode::call:
+                {
+                    // The arguments are moved out of the register file, which may be reallocated during the call.
+                    hilet arguments = std::move(get<datum::vector_type>(reg(instruction.c)));
+                    auto r = _nodes[instruction.b]->call(context, arguments);
+                    reg(instruction.a) = std::move(r);
+                    invalidate_slots();
+                }
+                break;
+
+            case formula_opcode::store:
+                {
+                    // Copy the value first, as the value may alias the target.
+                    auto value = datum{operand(instruction.b)};
+                    context.program_slots[slot_base + instruction.a] = &context.set(_names[instruction.a], value);
+                }
+                break;
+
+            case formula_opcode::inplace_add:
+            case formula_opcode::inplace_sub:
+            case formula_opcode::inplace_mul:
+            case formula_opcode::inplace_div:
+            case formula_opcode::inplace_mod:
+            case formula_opcode::inplace_shl:
+            case formula_opcode::inplace_shr:
+            case formula_opcode::inplace_and:
+            case formula_opcode::inplace_or:
+            case formula_opcode::inplace_xor:
+                {
+                    hilet op = formula_operand{instruction.b};
+                    auto rhs = op.is_register() ? std::move(reg(op.index())) : datum{operand(instruction.b)};
+                    auto& lhs = name_lvalue(instruction.a);
+                    switch (instruction.opcode) {
+                    case formula_opcode::inplace_add:
+                        lhs += rhs;
+                        break;
+                    case formula_opcode::inplace_sub:
+                        lhs -= rhs;
+                        break;
+                    case formula_opcode::inplace_mul:
+                        lhs *= rhs;
+                        break;
+                    case formula_opcode::inplace_div:
+                        lhs /= rhs;
+                        break;
+                    case formula_opcode::inplace_mod:
+                        lhs %= rhs;
+                        break;
+                    case formula_opcode::inplace_shl:
+                        lhs <<= rhs;
+                        break;
+                    case formula_opcode::inplace_shr:
+                        lhs >>= rhs;
+                        break;
+                    case formula_opcode::inplace_and:
+                        lhs &= rhs;
+                        break;
+                    case formula_opcode::inplace_or:
+                        lhs |= rhs;
+                        break;
+                    case formula_opcode::inplace_xor:
+                        lhs ^= rhs;
+                        break;
+                    default:
+                        hi_no_default();
+                    }
+                }
+                break;
+
+            case formula_opcode::increment:
+                ++name_lvalue(instruction.a);
+                break;
+
+            case formula_opcode::decrement:
+                --name_lvalue(instruction.a);
+                break;
+
+            default:
+                hi_no_default();
+            }
+
+        } catch (operation_error const&) {
+            // Errors of name lookups, calls and the tree walker already include the location.
+            throw;
+        } catch (std::exception const& e) {
+            throw operation_error(
+                std::format("{}: Can not evaluate {}.\n{}", _locations[ip], operator_name(instruction.opcode), e.what()));
+        }
+
+        ++ip;
+    }
+
+    if (_result.is_register()) {
+        return std::move(reg(_result.index()));
+    } else {
+        return operand(_result.value);
+    }
+}
+
+} // namespace hi::inline v1
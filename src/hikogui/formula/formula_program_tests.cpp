@@ -0,0 +1,252 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "formula.hpp"
+#include "formula_program.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+
+using namespace hi;
+
+namespace {
+
+/** The global scope before each differential test.
+ */
+formula_evaluation_context formula_program_tests_context()
+{
+    auto context = formula_evaluation_context{};
+    context.set_global("a", datum{5});
+    context.set_global("b", datum{2.5});
+    context.set_global("s", datum{"hello"});
+    context.set_global("v", datum::make_vector(1, 2, 42, 3));
+    auto m = datum::make_map();
+    m["level"] = 3;
+    m["name"] = "world";
+    context.set_global("m", m);
+    context.set_global("t", datum{true});
+    context.set_global("f", datum{false});
+    return context;
+}
+
+/** Evaluate a formula with both the tree walker and the compiled program.
+ *
+ * The results, any thrown error and the changes to the global scope must be the same.
+ */
+testing::AssertionResult formula_program_tests_differential(std::string_view text)
+{
+    auto expression = parse_formula(text);
+    auto program = formula_program{*expression};
+
+    auto tree_context = formula_program_tests_context();
+    auto program_context = formula_program_tests_context();
+
+    datum tree_result;
+    datum program_result;
+    auto tree_error = false;
+    auto program_error = false;
+    try {
+        tree_result = expression->evaluate(tree_context);
+    } catch (operation_error const&) {
+        tree_error = true;
+    }
+    try {
+        program_result = program.evaluate(program_context);
+    } catch (operation_error const&) {
+        program_error = true;
+    }
+
+    if (tree_error != program_error) {
+        return testing::AssertionFailure() << text << ": tree walker error " << tree_error << ", program error " << program_error;
+    }
+    if (repr(tree_result) != repr(program_result)) {
+        return testing::AssertionFailure() << text << ": tree walker " << repr(tree_result) << ", program " << repr(program_result);
+    }
+    for (hilet& [name, value] : tree_context.globals) {
+        if (not program_context.globals.contains(name) or repr(program_context.globals.at(name)) != repr(value)) {
+            return testing::AssertionFailure() << text << ": global " << name << " differs.";
+        }
+    }
+    if (tree_context.globals.size() != program_context.globals.size()) {
+        return testing::AssertionFailure() << text << ": number of globals differs.";
+    }
+    if (not program_context.program_registers.empty() or not program_context.program_slots.empty()) {
+        return testing::AssertionFailure() << text << ": the registers and slots where not released.";
+    }
+    return testing::AssertionSuccess();
+}
+
+} // namespace
+
+TEST(formula_program, constant_folding)
+{
+    auto context = formula_evaluation_context{};
+
+    auto e = parse_formula("1 + 2 * 3 - (4 ** 2) / 2");
+    auto p = formula_program{*e};
+    ASSERT_EQ(p.size(), 0);
+    ASSERT_EQ(p.evaluate(context), e->evaluate(context));
+
+    e = parse_formula("[1, 2 + 3, {\"x\": -4}][2].x");
+    p = formula_program{*e};
+    ASSERT_EQ(p.size(), 0);
+    ASSERT_EQ(p.evaluate(context), -4);
+
+    e = parse_formula("true ? \"yes\" : foo");
+    p = formula_program{*e};
+    ASSERT_EQ(p.size(), 0);
+    ASSERT_EQ(p.evaluate(context), "yes");
+
+    e = parse_formula("false && foo");
+    p = formula_program{*e};
+    ASSERT_EQ(p.size(), 0);
+    ASSERT_EQ(p.evaluate(context), false);
+
+    // Constant expressions that throw are evaluated at run time, so that the error is reported.
+    e = parse_formula("1 / 0");
+    p = formula_program{*e};
+    ASSERT_EQ(p.size(), 1);
+    ASSERT_THROW((void)p.evaluate(context), operation_error);
+}
+
+TEST(formula_program, names)
+{
+    auto context = formula_evaluation_context{};
+    context.set_global("x", 3);
+
+    // Both reads of x use the same slot.
+    auto e = parse_formula("x * x + x");
+    auto p = formula_program{*e};
+    ASSERT_EQ(p.size(), 2);
+    ASSERT_EQ(p.evaluate(context), 12);
+
+    // A program may be evaluated many times with different values.
+    context.set_global("x", 4);
+    ASSERT_EQ(p.evaluate(context), 20);
+
+    // Locals shadow globals.
+    context.push();
+    context.set_local("x", 5);
+    ASSERT_EQ(p.evaluate(context), 30);
+    context.pop();
+
+    context.globals.clear();
+    ASSERT_THROW((void)p.evaluate(context), operation_error);
+    ASSERT_TRUE(context.program_registers.empty());
+    ASSERT_TRUE(context.program_slots.empty());
+}
+
+TEST(formula_program, side_effects)
+{
+    // A name must be read before the assignment on the right hand side of an operator.
+    auto context = formula_evaluation_context{};
+    context.set_global("x", 1);
+    auto e = parse_formula("x + (x = 10) + x");
+    auto p = formula_program{*e};
+    ASSERT_EQ(p.evaluate(context), 21);
+    ASSERT_EQ(context.get("x"), 10);
+
+    context.set_global("x", 1);
+    e = parse_formula("x - (t ? (x += 5) : 0)");
+    p = formula_program{*e};
+    context.set_global("t", true);
+    ASSERT_EQ(p.evaluate(context), -5);
+    context.set_global("x", 1);
+    context.set_global("t", false);
+    ASSERT_EQ(p.evaluate(context), 1);
+}
+
+TEST(formula_program, loop_variables)
+{
+    auto context = formula_evaluation_context{};
+    auto e = parse_formula("$i * 10 + $$i");
+    auto p = formula_program{*e};
+
+    ASSERT_THROW((void)p.evaluate(context), operation_error);
+
+    context.loop_push(2, 5);
+    context.loop_push(3, 5);
+    ASSERT_EQ(p.evaluate(context), 32);
+    ASSERT_EQ(p.evaluate(context), e->evaluate(context));
+}
+
+TEST(formula_program, differential)
+{
+    constexpr std::string_view formulas[] = {
+        "42",
+        "a",
+        "-a + +b",
+        "~a",
+        "not_found",
+        "a + b * 2 - 1",
+        "a / 2 + a % 3 - a ** 2",
+        "a << 2 | a >> 1 & 3 ^ 7",
+        "a == 5 && b != 2.5",
+        "a < b || a >= b",
+        "a <= 5 && a > 4",
+        "t && a",
+        "f && a",
+        "f || s",
+        "t || not_found",
+        "!t",
+        "a > 3 ? s : v",
+        "a < 3 ? s : v",
+        "s + \" \" + m.name",
+        "v[2]",
+        "v[-1]",
+        "v[10]",
+        "m[\"level\"]",
+        "m[\"nope\"]",
+        "m.level",
+        "m.nope",
+        "s.nope",
+        "[a, b, [s, a + 1]]",
+        "{\"k\": a, a: s}",
+        "x = a + 1",
+        "x = y = a",
+        "a = a + 1",
+        "a += 3",
+        "a -= 3",
+        "a *= b",
+        "a /= 2",
+        "a %= 3",
+        "a <<= 1",
+        "a >>= 1",
+        "a &= 3",
+        "a |= 8",
+        "a ^= 1",
+        "v += 4",
+        "v += v",
+        "s += \"!\"",
+        "++a",
+        "--a",
+        "++nope",
+        "a + (a = 1)",
+        "(a = 1) + a",
+        "a + (a += 1) * a",
+        "[a, a = 7, a]",
+        "{a: (a = 1), a: 2}",
+        "t ? a : (a = 3)",
+        "v[1] = 33",
+        "v[1] += 33",
+        "m.level = 4",
+        "[x, y] = [a, b]",
+        "float(a)",
+        "integer(b)",
+        "size(v) + size(s)",
+        "float(a = 3) + a",
+        "v.append(4.2)",
+        "v.pop() + v[0]",
+        "s ! id",
+        "(s + \" world\") ! url",
+        "1 / 0",
+        "s - 1",
+        "4 -= 2",
+        "(!float)(2)",
+    };
+
+    for (hilet formula : formulas) {
+        EXPECT_TRUE(formula_program_tests_differential(formula));
+    }
+}
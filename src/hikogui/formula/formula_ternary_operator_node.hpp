@@ -34,6 +34,11 @@ struct formula_ternary_operator_node final : formula_node {
         rhs_false->post_process(context);
     }
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_ternary(*this, *lhs, *rhs_true, *rhs_false);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         hilet lhs_ = lhs->evaluate(context);
@@ -23,6 +23,11 @@ struct formula_vector_literal_node final : formula_node {
         }
     }
 
+    formula_operand compile(formula_compiler &compiler) const override
+    {
+        return compiler.compile_vector_literal(*this, values);
+    }
+
     datum evaluate(formula_evaluation_context &context) const override
     {
         datum::vector_type r;
@@ -195,6 +195,10 @@ public:
      */
     const_iterator begin() const
     {
+        // The generator-function may have thrown before the first co_yield.
+        if (_coroutine) {
+            _coroutine.promise().rethrow();
+        }
         return const_iterator{_coroutine};
     }
 
@@ -202,6 +206,10 @@ public:
      */
     const_iterator cbegin() const
     {
+        // The generator-function may have thrown before the first co_yield.
+        if (_coroutine) {
+            _coroutine.promise().rethrow();
+        }
         return const_iterator{_coroutine};
     }
 
@@ -385,6 +393,10 @@ public:
      */
     const_iterator begin() const
     {
+        // The generator-function may have thrown before the first co_yield.
+        if (_coroutine) {
+            _coroutine.promise().rethrow();
+        }
         return const_iterator{_coroutine};
     }
 
@@ -392,6 +404,10 @@ public:
      */
     const_iterator cbegin() const
     {
+        // The generator-function may have thrown before the first co_yield.
+        if (_coroutine) {
+            _coroutine.promise().rethrow();
+        }
         return const_iterator{_coroutine};
     }
 
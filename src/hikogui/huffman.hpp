@@ -2,10 +2,14 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
+#pragma once
+
 #include "utility/module.hpp"
 #include "bits.hpp"
 #include <span>
 #include <vector>
+#include <array>
+#include <concepts>
 
 namespace hi::inline v1 {
 
@@ -166,4 +170,172 @@ public:
     }
 };
 
+/** A table driven canonical-huffman decoder.
+ *
+ * The next `PrimaryBits` bits of the stream are used as an index in the primary table.
+ * Codes that are longer than `PrimaryBits` are stored in a sub-table, which is linked
+ * from the primary table entry of the first `PrimaryBits` bits of those codes.
+ * This is the same layout as used by zlib, which means most symbols are decoded
+ * with a single table lookup.
+ *
+ * @tparam T The unsigned integer type of the symbols.
+ * @tparam PrimaryBits The number of bits used to index the primary table.
+ */
+template<std::unsigned_integral T, std::size_t PrimaryBits = 9>
+class huffman_table {
+public:
+    using value_type = T;
+
+    constexpr static std::size_t primary_bits = PrimaryBits;
+    constexpr static std::size_t max_code_length = 15;
+
+    struct entry_type {
+        /** The symbol, or the offset of the sub-table when `sub_bits` is non-zero.
+         */
+        value_type value = 0;
+
+        /** The length of the code in bits, zero when the code is not in the table.
+         */
+        uint8_t length = 0;
+
+        /** The number of index bits of the linked sub-table, zero for a symbol.
+         */
+        uint8_t sub_bits = 0;
+    };
+
+    constexpr huffman_table() noexcept = default;
+    huffman_table(huffman_table const&) = default;
+    huffman_table(huffman_table&&) noexcept = default;
+    huffman_table& operator=(huffman_table const&) = default;
+    huffman_table& operator=(huffman_table&&) noexcept = default;
+
+    /** Find the table entry for the next code in the stream.
+     *
+     * @param bits The next bits of the stream, with the first bit in the LSB.
+     *             There must be at least `max_code_length` valid bits.
+     * @return The table entry, with a zero length if the code is not in the table.
+     */
+    [[nodiscard]] hi_force_inline entry_type const& decode(uint64_t bits) const noexcept
+    {
+        hi_axiom(not _table.empty());
+
+        auto entry = &_table[bits & primary_mask];
+        if (entry->sub_bits != 0) [[unlikely]] {
+            hilet sub_index = (bits >> primary_bits) & ((uint64_t{1} << entry->sub_bits) - 1);
+            entry = &_table[entry->value + sub_index];
+        }
+        return *entry;
+    }
+
+    /** Build a canonical-huffman table from a set of lengths.
+     *
+     * Incomplete codes are allowed, the missing codes are marked invalid in the table.
+     *
+     * @param lengths The code length of each symbol, zero if a symbol is unused.
+     * @param nr_symbols The number of symbols.
+     * @throw parse_error when the lengths are too long or over-subscribed.
+     */
+    [[nodiscard]] static huffman_table from_lengths(uint8_t const *lengths, std::size_t nr_symbols)
+    {
+        hi_assert_not_null(lengths);
+        hi_axiom(nr_symbols <= std::numeric_limits<value_type>::max());
+
+        auto count = std::array<std::size_t, max_code_length + 1>{};
+        for (auto symbol = 0_uz; symbol != nr_symbols; ++symbol) {
+            hi_check(lengths[symbol] <= max_code_length, "Huffman code length too long");
+            ++count[lengths[symbol]];
+        }
+        count[0] = 0;
+
+        // The first canonical code of each length.
+        auto next_code = std::array<std::size_t, max_code_length + 1>{};
+        auto code = 0_uz;
+        for (auto length = 1_uz; length <= max_code_length; ++length) {
+            code = (code + count[length - 1]) << 1;
+            next_code[length] = code;
+            hi_check(code + count[length] <= (1_uz << length), "Huffman code lengths are over-subscribed");
+        }
+
+        // The codes are reversed, so that they can be used as an index with the LSB first bit-stream.
+        // At the same time determine the size of each sub-table.
+        auto codes = std::vector<uint16_t>(nr_symbols, 0);
+        auto sub_bits = std::array<uint8_t, primary_size>{};
+        for (auto symbol = 0_uz; symbol != nr_symbols; ++symbol) {
+            hilet length = lengths[symbol];
+            if (length != 0) {
+                hilet reversed = reverse_code(next_code[length]++, length);
+                codes[symbol] = narrow_cast<uint16_t>(reversed);
+
+                if (length > primary_bits) {
+                    auto& bits = sub_bits[reversed & primary_mask];
+                    bits = std::max(bits, narrow_cast<uint8_t>(length - primary_bits));
+                }
+            }
+        }
+
+        auto r = huffman_table{};
+        r._table.resize(primary_size);
+
+        // Allocate the sub-tables behind the primary table.
+        for (auto i = 0_uz; i != primary_size; ++i) {
+            if (sub_bits[i] != 0) {
+                hilet offset = r._table.size();
+                hi_axiom(offset <= std::numeric_limits<value_type>::max());
+
+                r._table[i] = entry_type{narrow_cast<value_type>(offset), 0, sub_bits[i]};
+                r._table.resize(offset + (1_uz << sub_bits[i]));
+            }
+        }
+
+        // Fill in every entry where the code is a prefix of the index.
+        for (auto symbol = 0_uz; symbol != nr_symbols; ++symbol) {
+            hilet length = lengths[symbol];
+            if (length == 0) {
+                continue;
+            }
+
+            hilet entry = entry_type{narrow_cast<value_type>(symbol), length, 0};
+            hilet reversed = static_cast<std::size_t>(codes[symbol]);
+            if (length <= primary_bits) {
+                for (auto i = reversed; i < primary_size; i += 1_uz << length) {
+                    r._table[i] = entry;
+                }
+
+            } else {
+                hilet& link = r._table[reversed & primary_mask];
+                hilet offset = static_cast<std::size_t>(link.value);
+                hilet sub_size = 1_uz << link.sub_bits;
+                for (auto i = reversed >> primary_bits; i < sub_size; i += 1_uz << (length - primary_bits)) {
+                    r._table[offset + i] = entry;
+                }
+            }
+        }
+
+        return r;
+    }
+
+    [[nodiscard]] static huffman_table from_lengths(std::vector<uint8_t> const& lengths)
+    {
+        return from_lengths(lengths.data(), lengths.size());
+    }
+
+private:
+    constexpr static std::size_t primary_size = 1_uz << primary_bits;
+    constexpr static std::size_t primary_mask = primary_size - 1;
+
+    /** The primary table followed by the sub-tables.
+     */
+    std::vector<entry_type> _table = {};
+
+    [[nodiscard]] constexpr static std::size_t reverse_code(std::size_t code, std::size_t length) noexcept
+    {
+        auto r = 0_uz;
+        for (auto i = 0_uz; i != length; ++i) {
+            r = (r << 1) | (code & 1);
+            code >>= 1;
+        }
+        return r;
+    }
+};
+
 } // namespace hi::inline v1
@@ -0,0 +1,95 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "huffman_tests.hpp"
+#include "huffman.hpp"
+#include "utility/module.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+
+using namespace std;
+using namespace hi;
+
+/** The 57 or more bits starting at the bit offset, as used by the table decoder.
+ *
+ * @param bytes The bit-stream, with at least 8 bytes of padding at the end.
+ */
+[[nodiscard]] static uint64_t huffman_peek(std::vector<std::byte> const& bytes, std::size_t bit_offset)
+{
+    return load_le<uint64_t>(bytes.data() + bit_offset / 8) >> (bit_offset % 8);
+}
+
+static void huffman_check_decode(std::vector<uint8_t> const& lengths, std::vector<std::size_t> const& symbols)
+{
+    auto bytes = huffman_encode(lengths, symbols);
+    bytes.insert(bytes.end(), 8, std::byte{0});
+
+    hilet tree = huffman_tree<int16_t>::from_lengths(lengths);
+    hilet table = huffman_table<uint16_t>::from_lengths(lengths);
+
+    auto tree_offset = 0_uz;
+    auto table_offset = 0_uz;
+    for (hilet expected : symbols) {
+        ASSERT_EQ(tree.get_symbol(bytes, tree_offset), expected);
+
+        hilet& entry = table.decode(huffman_peek(bytes, table_offset));
+        ASSERT_NE(entry.length, 0);
+        ASSERT_EQ(entry.value, expected);
+        table_offset += entry.length;
+        ASSERT_EQ(table_offset, tree_offset);
+    }
+}
+
+TEST(huffman, fixed_literal_lengths)
+{
+    auto lengths = std::vector<uint8_t>{};
+    lengths.insert(lengths.end(), 144, uint8_t{8});
+    lengths.insert(lengths.end(), 112, uint8_t{9});
+    lengths.insert(lengths.end(), 24, uint8_t{7});
+    lengths.insert(lengths.end(), 8, uint8_t{8});
+
+    auto symbols = std::vector<std::size_t>{};
+    for (auto i = 0_uz; i != 1000; ++i) {
+        symbols.push_back((i * 7919) % lengths.size());
+    }
+
+    huffman_check_decode(lengths, symbols);
+}
+
+TEST(huffman, long_codes)
+{
+    // Lengths 1 to 14 followed by two 15 bit codes form a complete code,
+    // with codes longer than the primary table.
+    auto lengths = std::vector<uint8_t>{};
+    for (auto length = 1; length != 15; ++length) {
+        lengths.push_back(narrow_cast<uint8_t>(length));
+    }
+    lengths.push_back(15);
+    lengths.push_back(15);
+
+    auto symbols = std::vector<std::size_t>{};
+    for (auto i = 0_uz; i != 1000; ++i) {
+        symbols.push_back((i * 31) % lengths.size());
+    }
+
+    huffman_check_decode(lengths, symbols);
+}
+
+TEST(huffman, incomplete_code)
+{
+    // A single code of one bit is allowed in the distance table of deflate.
+    auto lengths = std::vector<uint8_t>{0, 1, 0};
+    huffman_check_decode(lengths, std::vector<std::size_t>{1, 1, 1});
+
+    // The other code is not in the table.
+    hilet table = huffman_table<uint16_t>::from_lengths(lengths);
+    ASSERT_EQ(table.decode(0xff).length, 0);
+}
+
+TEST(huffman, over_subscribed)
+{
+    auto lengths = std::vector<uint8_t>{1, 1, 1};
+    ASSERT_THROW(std::ignore = huffman_table<uint16_t>::from_lengths(lengths), parse_error);
+}
@@ -0,0 +1,58 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "utility/module.hpp"
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hi { inline namespace v1 {
+
+/** Encode symbols with the canonical huffman code described by lengths.
+ * The codes are written MSB first into a LSB first bit-stream, as done by deflate.
+ */
+[[nodiscard]] inline std::vector<std::byte>
+huffman_encode(std::vector<uint8_t> const& lengths, std::vector<std::size_t> const& symbols)
+{
+    auto count = std::array<std::size_t, 16>{};
+    for (hilet length : lengths) {
+        ++count[length];
+    }
+    count[0] = 0;
+
+    auto next_code = std::array<std::size_t, 16>{};
+    auto code = std::size_t{0};
+    for (auto length = std::size_t{1}; length != 16; ++length) {
+        code = (code + count[length - 1]) << 1;
+        next_code[length] = code;
+    }
+
+    auto codes = std::vector<std::size_t>(lengths.size(), 0);
+    for (auto symbol = std::size_t{0}; symbol != lengths.size(); ++symbol) {
+        if (lengths[symbol] != 0) {
+            codes[symbol] = next_code[lengths[symbol]]++;
+        }
+    }
+
+    auto r = std::vector<std::byte>{};
+    auto bit_offset = std::size_t{0};
+    for (hilet symbol : symbols) {
+        hilet length = lengths[symbol];
+        for (auto i = length; i != 0; --i) {
+            if (bit_offset % 8 == 0) {
+                r.push_back(std::byte{0});
+            }
+            if ((codes[symbol] >> (i - 1)) & 1) {
+                r.back() |= static_cast<std::byte>(1 << (bit_offset % 8));
+            }
+            ++bit_offset;
+        }
+    }
+    return r;
+}
+
+}} // namespace hi::inline v1
@@ -92,6 +92,13 @@ public:
     {
     }
 
+    template<std::same_as<std::remove_const_t<value_type>> O>
+    [[nodiscard]] constexpr pixmap_span(pixmap_span<O> const& other) noexcept
+        requires(std::is_const_v<value_type>)
+        : pixmap_span(other.data(), other.width(), other.height(), other.stride())
+    {
+    }
+
     template<std::same_as<std::remove_const_t<value_type>> O, typename Allocator>
     [[nodiscard]] constexpr pixmap_span(pixmap<O, Allocator> const& other) noexcept :
         pixmap_span(other.data(), other.width(), other.height())
@@ -0,0 +1,171 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/module.hpp"
+#include <vector>
+#include <bit>
+#include <concepts>
+
+namespace hi { inline namespace v1 {
+
+/** A list of extents with fast lookup of offsets.
+ *
+ * This is used by virtualized containers with a large number of rows, of which
+ * only a few have been measured and the rest use an estimated extent.
+ *
+ * The extents are stored in a Fenwick tree, so that changing an extent, finding the
+ * offset of a row and finding the row at an offset are all O(log n).
+ */
+class extent_index {
+public:
+    extent_index() noexcept = default;
+    extent_index(extent_index const&) = default;
+    extent_index(extent_index&&) noexcept = default;
+    extent_index& operator=(extent_index const&) = default;
+    extent_index& operator=(extent_index&&) noexcept = default;
+
+    /** Create an index where every row has the same extent.
+     */
+    extent_index(std::size_t size, int extent) noexcept
+    {
+        assign(size, extent);
+    }
+
+    /** Replace all extents.
+     *
+     * @param size The number of rows.
+     * @param func A function `int(std::size_t index)` returning the extent of each row.
+     */
+    template<std::invocable<std::size_t> Func>
+    void assign(std::size_t size, Func const& func) noexcept
+    {
+        _extents.resize(size);
+        _tree.assign(size + 1, 0);
+        _total = 0;
+
+        for (auto i = 0_uz; i != size; ++i) {
+            hilet extent = narrow_cast<int>(func(i));
+            hi_axiom(extent >= 0);
+            _extents[i] = extent;
+            _total += extent;
+
+            // Build the tree in O(n) by propagating each node to its parent.
+            hilet node = i + 1;
+            _tree[node] += extent;
+            if (hilet parent = node + (node & (~node + 1)); parent <= size) {
+                _tree[parent] += _tree[node];
+            }
+        }
+    }
+
+    /** Replace all extents with the same extent.
+     */
+    void assign(std::size_t size, int extent) noexcept
+    {
+        assign(size, [extent](std::size_t) {
+            return extent;
+        });
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _extents.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _extents.empty();
+    }
+
+    /** The extent of a row.
+     */
+    [[nodiscard]] int operator[](std::size_t index) const noexcept
+    {
+        hi_axiom(index < size());
+        return _extents[index];
+    }
+
+    /** The sum of all extents.
+     */
+    [[nodiscard]] int total() const noexcept
+    {
+        return _total;
+    }
+
+    /** Change the extent of a row.
+     *
+     * @param index The index of the row.
+     * @param extent The new extent of the row.
+     * @return True if the extent was changed.
+     */
+    bool set(std::size_t index, int extent) noexcept
+    {
+        hi_axiom(index < size());
+        hi_axiom(extent >= 0);
+
+        hilet delta = extent - _extents[index];
+        if (delta == 0) {
+            return false;
+        }
+
+        _extents[index] = extent;
+        _total += delta;
+        for (auto node = index + 1; node < _tree.size(); node += node & (~node + 1)) {
+            _tree[node] += delta;
+        }
+        return true;
+    }
+
+    /** The offset of a row.
+     *
+     * @param index The index of the row, or `size()` for the offset beyond the last row.
+     * @return The sum of the extents of the rows before @a index.
+     */
+    [[nodiscard]] int offset(std::size_t index) const noexcept
+    {
+        hi_axiom(index <= size());
+
+        auto r = 0;
+        for (auto node = index; node != 0; node -= node & (~node + 1)) {
+            r += _tree[node];
+        }
+        return r;
+    }
+
+    /** Find the row at an offset.
+     *
+     * @param offset The offset to search for.
+     * @return The index of the row where `offset(index) <= offset < offset(index + 1)`, or
+     *         `size()` when the offset is beyond the last row.
+     */
+    [[nodiscard]] std::size_t find(int offset) const noexcept
+    {
+        if (offset < 0) {
+            return 0;
+        }
+
+        // Descend the tree, skipping each sub-tree that ends at or before the offset.
+        auto node = 0_uz;
+        for (auto step = std::bit_floor(size()); step != 0; step >>= 1) {
+            if (hilet next = node + step; next <= size() and _tree[next] <= offset) {
+                node = next;
+                offset -= _tree[node];
+            }
+        }
+        return node;
+    }
+
+private:
+    std::vector<int> _extents;
+
+    /** The Fenwick tree, index 0 is unused.
+     */
+    std::vector<int> _tree = {0};
+
+    int _total = 0;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,91 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "extent_index.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <random>
+
+using namespace hi;
+
+TEST(extent_index, empty)
+{
+    auto index = extent_index{};
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(index.total(), 0);
+    ASSERT_EQ(index.offset(0), 0);
+    ASSERT_EQ(index.find(0), 0);
+    ASSERT_EQ(index.find(100), 0);
+}
+
+TEST(extent_index, uniform)
+{
+    auto index = extent_index{100'000, 20};
+    ASSERT_EQ(index.size(), 100'000);
+    ASSERT_EQ(index.total(), 2'000'000);
+    ASSERT_EQ(index.offset(0), 0);
+    ASSERT_EQ(index.offset(1), 20);
+    ASSERT_EQ(index.offset(50'000), 1'000'000);
+    ASSERT_EQ(index.offset(100'000), 2'000'000);
+
+    ASSERT_EQ(index.find(-1), 0);
+    ASSERT_EQ(index.find(0), 0);
+    ASSERT_EQ(index.find(19), 0);
+    ASSERT_EQ(index.find(20), 1);
+    ASSERT_EQ(index.find(1'000'019), 50'000);
+    ASSERT_EQ(index.find(1'999'999), 99'999);
+    ASSERT_EQ(index.find(2'000'000), 100'000);
+}
+
+TEST(extent_index, set)
+{
+    auto index = extent_index{10, 10};
+    ASSERT_TRUE(index.set(3, 25));
+    ASSERT_FALSE(index.set(3, 25));
+    ASSERT_EQ(index[3], 25);
+    ASSERT_EQ(index.total(), 115);
+    ASSERT_EQ(index.offset(3), 30);
+    ASSERT_EQ(index.offset(4), 55);
+    ASSERT_EQ(index.find(54), 3);
+    ASSERT_EQ(index.find(55), 4);
+
+    // A row without extent is never found.
+    index.set(4, 0);
+    ASSERT_EQ(index.find(55), 5);
+}
+
+TEST(extent_index, random)
+{
+    auto engine = std::mt19937{42};
+    auto extent_dist = std::uniform_int_distribution<int>{0, 50};
+
+    auto extents = std::vector<int>(1000);
+    for (auto& extent : extents) {
+        extent = extent_dist(engine);
+    }
+
+    auto index = extent_index{};
+    index.assign(extents.size(), [&](std::size_t i) {
+        return extents[i];
+    });
+
+    auto row_dist = std::uniform_int_distribution<std::size_t>{0, extents.size() - 1};
+    for (auto i = 0; i != 1000; ++i) {
+        hilet row = row_dist(engine);
+        extents[row] = extent_dist(engine);
+        index.set(row, extents[row]);
+    }
+
+    auto offset = 0;
+    for (auto i = 0_uz; i != extents.size(); ++i) {
+        ASSERT_EQ(index.offset(i), offset);
+        if (extents[i] != 0) {
+            ASSERT_EQ(index.find(offset), i);
+            ASSERT_EQ(index.find(offset + extents[i] - 1), i);
+        }
+        offset += extents[i];
+    }
+    ASSERT_EQ(index.total(), offset);
+    ASSERT_EQ(index.find(offset), extents.size());
+}
@@ -6,10 +6,12 @@
 
 #include "time_stamp_count.hpp"
 #include "time_stamp_utc.hpp"
-#include "wfree_fifo.hpp"
+#include "polymorphic_optional.hpp"
+#include "counters.hpp"
 #include "atomic.hpp"
 #include "meta.hpp"
 #include "delayed_format.hpp"
+#include "log_binary.hpp"
 #include "format_check.hpp"
 #include "utility/module.hpp"
 #include "concurrency/module.hpp"
@@ -23,10 +25,32 @@
 #include <memory>
 #include <thread>
 #include <filesystem>
+#include <vector>
 
 namespace hi { inline namespace v1 {
+
+/** What to do when a thread logs a message while its log queue is full.
+ */
+enum class log_overflow_policy : uint8_t {
+    /** Wait until the logger thread has made room in the queue.
+     */
+    block,
+
+    /** Drop the message that is being logged.
+     */
+    drop_newest,
+
+    /** Drop the oldest message in the queue to make room.
+     */
+    overwrite_oldest
+};
+
 namespace detail {
 
+/** Wake up the logger thread to flush the log queues.
+ */
+hi_no_inline void log_wake() noexcept;
+
 class log_message_base {
 public:
     hi_force_inline log_message_base() noexcept = default;
@@ -35,6 +59,14 @@ public:
     [[nodiscard]] virtual std::string format() const noexcept = 0;
     [[nodiscard]] virtual std::unique_ptr<log_message_base> make_unique_copy() const noexcept = 0;
 
+    /** The time when the message was logged.
+     */
+    [[nodiscard]] virtual time_stamp_count const& time_stamp() const noexcept = 0;
+
+    /** Write the message as a binary record, without formatting.
+     */
+    virtual void write(log_binary_file& file) const noexcept = 0;
+
 public:
     static inline std::chrono::time_zone const *zone = nullptr;
 };
@@ -97,11 +129,158 @@ public:
         return std::make_unique<log_message>(*this);
     }
 
+    [[nodiscard]] time_stamp_count const& time_stamp() const noexcept override
+    {
+        return _time_stamp;
+    }
+
+    void write(log_binary_file& file) const noexcept override
+    {
+        static constexpr auto format = log_binary_format{
+            Level, static_cast<std::string_view>(SourcePath), SourceLine, static_cast<std::string_view>(Fmt)};
+
+        file.write(format, _time_stamp, _what.values());
+    }
+
 private:
     time_stamp_count _time_stamp;
     delayed_format<Fmt, Values...> _what;
 };
 
+/** The queue of log messages of a single thread.
+ *
+ * There is a single producer, the thread that owns the queue. The logger
+ * thread takes messages from the queue. Only when the overflow policy is
+ * `log_overflow_policy::overwrite_oldest` will the producer also take
+ * messages, to make room for a new message.
+ *
+ * The producer checks the state of the slot to see if there is room, so it
+ * only has to read the tail index when the queue is full.
+ */
+class log_queue {
+public:
+    constexpr static std::size_t slot_size = 64;
+    constexpr static std::size_t num_slots = 256;
+
+    using slot_type = polymorphic_optional<log_message_base, slot_size, slot_size>;
+
+    log_queue(log_queue const&) = delete;
+    log_queue(log_queue&&) = delete;
+    log_queue& operator=(log_queue const&) = delete;
+    log_queue& operator=(log_queue&&) = delete;
+    log_queue() noexcept = default;
+
+    /** The overflow policy, may only be changed by the thread that owns the queue.
+     */
+    log_overflow_policy overflow_policy = log_overflow_policy::block;
+
+    /** Create a message in-place on the queue.
+     *
+     * @note May only be called from the thread that owns the queue.
+     * @tparam Message The message type derived from log_message_base.
+     * @param args The arguments passed to the constructor of Message.
+     */
+    template<typename Message, typename... Args>
+    hi_force_inline void emplace(Args&&...args) noexcept
+    {
+        hilet head = _head.load(std::memory_order::relaxed);
+        auto& slot = _slots[head % num_slots];
+        if (not slot.empty(std::memory_order::acquire)) {
+            if (not make_room(head)) {
+                [[unlikely]] return;
+            }
+        }
+
+        // The slot is empty, so this does not wait.
+        slot.template wait_emplace_and_invoke<Message>([](Message&) -> void {}, std::forward<Args>(args)...);
+        _head.store(head + 1, std::memory_order::release);
+
+        if ((head + 1) % (num_slots / 4) == 0 and head + 1 - _tail.load(std::memory_order::relaxed) >= num_slots / 2) {
+            // Wake the logger thread before the queue fills up.
+            [[unlikely]] log_wake();
+        }
+    }
+
+    /** Check if the queue is empty.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _tail.load(std::memory_order::relaxed) == _head.load(std::memory_order::relaxed);
+    }
+
+    /** Take one message from the queue.
+     *
+     * @param func A function called with the `log_message_base&` that is taken.
+     * @return true if a message was taken.
+     */
+    template<typename Func>
+    bool take_one(Func&& func) noexcept
+    {
+        auto tail = _tail.load(std::memory_order::acquire);
+
+        // The slot itself can not be used to check if there is a message, since it may
+        // still contain the message of the previous round that the producer is overwriting.
+        while (tail != _head.load(std::memory_order::acquire)) {
+            // Claim the slot, the producer may have claimed it first to overwrite the oldest message.
+            if (_tail.compare_exchange_weak(tail, tail + 1, std::memory_order::acq_rel, std::memory_order::acquire)) {
+                return _slots[tail % num_slots].invoke_and_reset(std::forward<Func>(func));
+            }
+        }
+        return false;
+    }
+
+private:
+    std::array<slot_type, num_slots> _slots = {};
+
+    /** The index of the slot to write next, only written by the producer.
+     */
+    alignas(hi::hardware_destructive_interference_size) std::atomic<std::size_t> _head = 0;
+
+    /** The index of the oldest message.
+     */
+    alignas(hi::hardware_destructive_interference_size) std::atomic<std::size_t> _tail = 0;
+
+    /** Make room for a message when the queue is full.
+     *
+     * @return false if the message should be dropped.
+     */
+    hi_no_inline bool make_room(std::size_t head) noexcept
+    {
+        using namespace std::chrono_literals;
+
+        auto& slot = _slots[head % num_slots];
+
+        switch (overflow_policy) {
+        case log_overflow_policy::block:
+            ++global_counter<"log:blocked">;
+            do {
+                log_wake();
+                std::this_thread::sleep_for(1ms);
+            } while (not slot.empty(std::memory_order::acquire));
+            return true;
+
+        case log_overflow_policy::drop_newest:
+            ++global_counter<"log:dropped">;
+            return false;
+
+        case log_overflow_policy::overwrite_oldest:
+            if (auto tail = _tail.load(std::memory_order::acquire); head - tail == num_slots) {
+                if (_tail.compare_exchange_strong(tail, tail + 1, std::memory_order::acq_rel)) {
+                    // The oldest message is in the slot that we are about to write.
+                    slot.reset();
+                    ++global_counter<"log:overwritten">;
+                    return true;
+                }
+            }
+
+            // The logger thread is reading the oldest message right now.
+            ++global_counter<"log:dropped">;
+            return false;
+        }
+        hi_no_default();
+    }
+};
+
 } // namespace detail
 
 class log {
@@ -123,14 +302,14 @@ public:
             return;
         }
 
-        // Add messages in the queue, block when full.
+        // Add messages in the queue of the current thread, what happens when the queue
+        // is full depends on the overflow policy of the thread.
         // * This reduces amount of instructions needed to be executed during logging.
         // * Simplifies logged_fatal_message logic.
-        // * Will make sure everything gets logged.
-        // * Blocking is bad in a real time thread, so maybe count the number of times it is blocked.
+        // * Threads do not contend with each other when logging.
 
         // Emplace a message directly on the queue.
-        _fifo.emplace<detail::log_message<Level, SourcePath, SourceLine, Fmt, forward_value_t<Args>...>>(
+        thread_queue().emplace<detail::log_message<Level, SourcePath, SourceLine, Fmt, forward_value_t<Args>...>>(
             std::forward<Args>(args)...);
 
         if (to_bool(Level & global_state_type::log_fatal) or not to_bool(state & global_state_type::log_is_running)) {
@@ -140,12 +319,39 @@ public:
         }
     }
 
+    /** Set what happens when the current thread logs while its queue is full.
+     *
+     * The default policy is `log_overflow_policy::block`. Real-time threads
+     * should select one of the other policies, so that logging never blocks.
+     *
+     * @param policy The overflow policy for the current thread.
+     */
+    void set_overflow_policy(log_overflow_policy policy) noexcept
+    {
+        thread_queue().overflow_policy = policy;
+    }
+
     /** Flush all messages from the log_queue directly from this thread.
      * Flushing includes writing the message to a log file or displaying
      * them on the console.
      */
     hi_no_inline void flush() noexcept;
 
+    /** Write the log to a binary file instead of to the console.
+     *
+     * Binary records are written by the logger thread without formatting them,
+     * into a memory-mapped ring file, where the oldest messages are overwritten.
+     * Use `decode_binary_log()` to reconstruct the text.
+     *
+     * @param path The path of the binary log file.
+     * @param size The size of the ring file in bytes.
+     */
+    void open_binary_file(std::filesystem::path const& path, std::size_t size = 16 * 1024 * 1024);
+
+    /** Write the log to the console again.
+     */
+    void close_binary_file() noexcept;
+
     /** Start the logger system.
      *
      * Initialize the logger system if it is not already initialized and while the system is not in shutdown-mode.
@@ -168,11 +374,35 @@ public:
     }
 
 private:
-    /** The global log queue contains messages to be displayed by the logger thread.
+    /** The log queue of the current thread.
+     *
+     * The queue is shared with `_queues`, so that messages are still
+     * flushed after the thread has exited.
+     */
+    static inline thread_local std::shared_ptr<detail::log_queue> _thread_queue;
+
+    /** The log queues of all threads that have logged a message.
      */
-    wfree_fifo<detail::log_message_base, 64> _fifo;
+    std::vector<std::shared_ptr<detail::log_queue>> _queues;
     mutable unfair_mutex _mutex;
 
+    /** When the binary file is open, messages are written to it instead of to the console.
+     */
+    std::unique_ptr<log_binary_file> _binary_file;
+
+    [[nodiscard]] hi_force_inline detail::log_queue& thread_queue() noexcept
+    {
+        if (auto *ptr = _thread_queue.get()) {
+            [[likely]] return *ptr;
+        } else {
+            return make_thread_queue();
+        }
+    }
+
+    /** Create and register the log queue of the current thread.
+     */
+    hi_no_inline detail::log_queue& make_thread_queue() noexcept;
+
     /** Write to a log file and console.
      * This will write to the console if one is open.
      * It will also create a log file in the application-data directory.
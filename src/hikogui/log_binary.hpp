@@ -0,0 +1,311 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file log_binary.hpp Binary log records in a memory-mapped ring file.
+ */
+
+#pragma once
+
+#include "time_stamp_count.hpp"
+#include "utility/module.hpp"
+#include "concurrency/module.hpp"
+#include <cstring>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <filesystem>
+#include <type_traits>
+#include <memory>
+
+namespace hi::inline v1 {
+class file_view;
+
+/** The description of a log statement.
+ *
+ * A binary log record refers to the description of its log statement
+ * by a format-id. The description itself is written only once into the log.
+ */
+struct log_binary_format {
+    global_state_type level;
+    std::string_view source_path;
+    int source_line;
+    std::string_view fmt;
+};
+
+namespace detail {
+
+enum class log_binary_argument : uint8_t { boolean, character, signed_integer, unsigned_integer, floating_point, string };
+
+enum class log_binary_definition : uint32_t { format = 1, thread = 2 };
+
+constexpr auto log_binary_magic = std::array<char, 8>{'h', 'i', 'l', 'o', 'g', 'b', 'i', 'n'};
+
+/** The header at the start of a binary log.
+ *
+ * The file is split in three parts:
+ *  - The header.
+ *  - The definitions of formats and thread names, which are appended to.
+ *  - A ring of blocks with log records, where the oldest block is overwritten.
+ */
+struct log_binary_header {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t block_size;
+    uint64_t definitions_offset;
+    uint64_t definitions_size;
+    uint64_t definitions_used;
+    uint64_t blocks_offset;
+    uint64_t num_blocks;
+};
+
+/** The header at the start of each block of records.
+ *
+ * Each block contains the time reference needed to convert the
+ * time-stamp-count of its records to UTC.
+ */
+struct log_binary_block_header {
+    /** Blocks are written in order of sequence, zero for an unused block.
+     */
+    uint64_t sequence;
+    uint64_t time_stamp_count;
+    int64_t utc_nanoseconds;
+
+    /** Nanoseconds per 2^32 counts.
+     */
+    uint64_t period;
+};
+
+struct log_binary_definition_header {
+    uint32_t size;
+    log_binary_definition kind;
+    uint64_t id;
+};
+
+struct log_binary_format_definition {
+    uint32_t level;
+    uint32_t source_line;
+    uint32_t source_path_size;
+    uint32_t fmt_size;
+};
+
+struct log_binary_thread_definition {
+    uint32_t name_size;
+    uint32_t reserved;
+};
+
+/** The header of a record, followed by its arguments.
+ *
+ * A record of size zero marks the end of the records in a block.
+ */
+struct log_binary_record_header {
+    uint32_t size;
+    uint32_t format_id;
+    uint64_t time_stamp_count;
+    uint64_t thread_id;
+    uint32_t cpu_id;
+    uint32_t num_arguments;
+};
+
+} // namespace detail
+
+/** Write binary log records into a ring of blocks in memory.
+ *
+ * Instead of formatting a message, the writer stores the format-id, the
+ * time-stamp-count, the thread-id and the raw arguments of a message. The text
+ * is reconstructed later by `decode_binary_log()`.
+ *
+ * Arguments of arithmetic and string types are stored as-is, arguments of other
+ * types are formatted to a string when the record is written.
+ *
+ * Like the `log_queue` with `log_overflow_policy::drop_newest`, writing a record never
+ * throws or blocks: the storage for a record is allocated up front and a record that can
+ * not be written is dropped and counted.
+ */
+class log_binary_writer {
+public:
+    constexpr static std::size_t header_size = 4096;
+    constexpr static std::size_t block_size = 65536;
+
+    log_binary_writer(log_binary_writer const&) = delete;
+    log_binary_writer(log_binary_writer&&) = delete;
+    log_binary_writer& operator=(log_binary_writer const&) = delete;
+    log_binary_writer& operator=(log_binary_writer&&) = delete;
+
+    /** Initialize a binary log in a buffer.
+     *
+     * @param buffer The memory to write the log into; it must fit the header, the definitions and at least two blocks.
+     * @param definitions_size The number of bytes reserved for the definitions of formats and thread names.
+     * @throws std::bad_alloc When the storage for a record can not be allocated.
+     */
+    log_binary_writer(std::span<std::byte> buffer, std::size_t definitions_size = 1024 * 1024);
+
+    /** The number of records that were dropped.
+     *
+     * Records are dropped when they are larger than a block, when there is no
+     * room left for the definition of a new format, or when the definition of a
+     * new format or the formatting of an argument failed.
+     */
+    [[nodiscard]] std::size_t num_dropped() const noexcept
+    {
+        return _num_dropped;
+    }
+
+    /** Write a record.
+     *
+     * Memory is only allocated for the first record of a format or thread, and for
+     * arguments that need to be formatted; when this fails the record is dropped.
+     *
+     * @param format The description of the log statement, must have static storage duration.
+     * @param time_stamp The time stamp of the message, including the thread-id.
+     * @param values The arguments of the message.
+     */
+    template<typename... Values>
+    void write(log_binary_format const& format, time_stamp_count const& time_stamp, std::tuple<Values...> const& values) noexcept
+    {
+        begin_record(format, time_stamp, sizeof...(Values));
+        std::apply(
+            [this](auto const&...args) {
+                (add_argument(args), ...);
+            },
+            values);
+        end_record();
+    }
+
+private:
+    std::span<std::byte> _buffer;
+    std::span<std::byte> _definitions;
+    std::size_t _definitions_used = 0;
+
+    std::span<std::byte> _blocks;
+    std::size_t _num_blocks = 0;
+    std::size_t _block_index = 0;
+    std::size_t _block_offset = 0;
+    uint64_t _sequence = 0;
+
+    /** The record being written, its capacity is reserved for the largest record.
+     */
+    std::vector<std::byte> _record;
+    std::unordered_map<log_binary_format const *, uint32_t> _format_ids;
+    std::unordered_set<uint64_t> _thread_ids;
+    std::size_t _num_dropped = 0;
+
+    /** Set when the current record could not be completely written.
+     */
+    bool _drop_record = false;
+
+    void append(void const *data, std::size_t size) noexcept
+    {
+        if (_record.size() + size > _record.capacity()) {
+            // The record is larger than a block, don't let the vector reallocate.
+            _drop_record = true;
+            return;
+        }
+
+        hilet *first = static_cast<std::byte const *>(data);
+        _record.insert(_record.end(), first, first + size);
+    }
+
+    template<typename T>
+    void append(T const& value) noexcept
+        requires std::is_trivially_copyable_v<T>
+    {
+        append(&value, sizeof(T));
+    }
+
+    void add_argument(std::string_view str) noexcept
+    {
+        append(detail::log_binary_argument::string);
+        append(narrow_cast<uint32_t>(str.size()));
+        append(str.data(), str.size());
+    }
+
+    template<typename T>
+    void add_argument(T const& arg) noexcept
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            append(detail::log_binary_argument::boolean);
+            append(uint8_t{arg});
+        } else if constexpr (std::is_same_v<T, char>) {
+            append(detail::log_binary_argument::character);
+            append(arg);
+        } else if constexpr (std::is_integral_v<T> and std::is_signed_v<T>) {
+            append(detail::log_binary_argument::signed_integer);
+            append(static_cast<int64_t>(arg));
+        } else if constexpr (std::is_integral_v<T>) {
+            append(detail::log_binary_argument::unsigned_integer);
+            append(static_cast<uint64_t>(arg));
+        } else if constexpr (std::is_floating_point_v<T>) {
+            append(detail::log_binary_argument::floating_point);
+            append(static_cast<double>(arg));
+        } else if constexpr (std::is_convertible_v<T const&, std::string_view>) {
+            add_argument(static_cast<std::string_view>(arg));
+        } else {
+            try {
+                add_argument(std::string_view{std::format("{}", arg)});
+            } catch (...) {
+                _drop_record = true;
+            }
+        }
+    }
+
+    void begin_record(log_binary_format const& format, time_stamp_count const& time_stamp, std::size_t num_arguments) noexcept;
+    void end_record() noexcept;
+
+    /** Get the format-id, defining the format if needed.
+     *
+     * @return The format-id, or zero if there is no room for the definition.
+     * @throws std::bad_alloc When the format could not be defined.
+     */
+    [[nodiscard]] uint32_t format_id(log_binary_format const& format);
+
+    /** Define the name of a thread if needed.
+     *
+     * @throws std::bad_alloc When the thread could not be defined.
+     */
+    void define_thread(uint64_t thread_id);
+    [[nodiscard]] bool add_definition(std::span<std::byte const> definition) noexcept;
+    void start_block() noexcept;
+};
+
+/** A binary log in a memory-mapped ring file.
+ *
+ * Because the file is memory-mapped, records that were written before the
+ * application crashed are still available to the decoder.
+ */
+class log_binary_file {
+public:
+    /** Create a binary log file.
+     *
+     * @param path The path of the file, an existing file is overwritten.
+     * @param size The size of the file in bytes.
+     */
+    log_binary_file(std::filesystem::path const& path, std::size_t size);
+
+    ~log_binary_file();
+
+    template<typename... Values>
+    void write(log_binary_format const& format, time_stamp_count const& time_stamp, std::tuple<Values...> const& values) noexcept
+    {
+        _writer.write(format, time_stamp, values);
+    }
+
+private:
+    std::unique_ptr<file_view> _view;
+    log_binary_writer _writer;
+};
+
+/** Reconstruct the text of a binary log.
+ *
+ * @param bytes The binary log.
+ * @return The messages from oldest to newest, formatted like the text log with the time in UTC.
+ * @throws parse_error When the binary log is corrupt.
+ */
+[[nodiscard]] std::vector<std::string> decode_binary_log(std::span<std::byte const> bytes);
+
+} // namespace hi::inline v1
@@ -0,0 +1,520 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "log_binary.hpp"
+#include "time_stamp_utc.hpp"
+#include "defer.hpp"
+#include "file/file_view.hpp"
+#include <algorithm>
+#include <chrono>
+#include <variant>
+#include <map>
+
+namespace hi::inline v1 {
+namespace detail {
+
+template<typename T>
+[[nodiscard]] static T log_binary_load(std::span<std::byte const> bytes, std::size_t offset)
+{
+    hi_check(offset + sizeof(T) <= bytes.size(), "Binary log is truncated.");
+
+    auto r = T{};
+    std::memcpy(&r, bytes.data() + offset, sizeof(T));
+    return r;
+}
+
+template<typename T>
+static void log_binary_store(std::span<std::byte> bytes, std::size_t offset, T const& value) noexcept
+{
+    hi_axiom(offset + sizeof(T) <= bytes.size());
+    std::memcpy(bytes.data() + offset, &value, sizeof(T));
+}
+
+[[nodiscard]] static std::string_view log_binary_string(std::span<std::byte const> bytes, std::size_t offset, std::size_t size)
+{
+    hi_check(offset + size <= bytes.size(), "Binary log is truncated.");
+    return {reinterpret_cast<char const *>(bytes.data() + offset), size};
+}
+
+[[nodiscard]] constexpr static std::size_t log_binary_align(std::size_t size) noexcept
+{
+    return (size + 7) & ~std::size_t{7};
+}
+
+} // namespace detail
+
+log_binary_writer::log_binary_writer(std::span<std::byte> buffer, std::size_t definitions_size) : _buffer(buffer)
+{
+    // A record never grows beyond a block, so that writing a record does not allocate.
+    _record.reserve(block_size);
+
+    definitions_size = detail::log_binary_align(definitions_size);
+    hi_assert(buffer.size() >= header_size + definitions_size + 2 * block_size);
+
+    _definitions = buffer.subspan(header_size, definitions_size);
+    _num_blocks = (buffer.size() - header_size - definitions_size) / block_size;
+    _blocks = buffer.subspan(header_size + definitions_size, _num_blocks * block_size);
+
+    std::fill(buffer.begin(), buffer.begin() + header_size, std::byte{0});
+    for (auto i = 0_uz; i != _num_blocks; ++i) {
+        detail::log_binary_store(_blocks, i * block_size, detail::log_binary_block_header{});
+    }
+
+    hilet header = detail::log_binary_header{
+        detail::log_binary_magic,
+        1,
+        narrow_cast<uint32_t>(block_size),
+        header_size,
+        definitions_size,
+        0,
+        header_size + definitions_size,
+        _num_blocks};
+    detail::log_binary_store(_buffer, 0, header);
+
+    _block_index = _num_blocks - 1;
+    start_block();
+}
+
+void log_binary_writer::start_block() noexcept
+{
+    _block_index = (_block_index + 1) % _num_blocks;
+    _block_offset = sizeof(detail::log_binary_block_header);
+
+    auto block = _blocks.subspan(_block_index * block_size, block_size);
+
+    // Invalidate the block before it is overwritten, and clear the old records.
+    detail::log_binary_store(block, 0, detail::log_binary_block_header{});
+    std::fill(block.begin() + _block_offset, block.end(), std::byte{0});
+
+    hilet now = time_stamp_count{time_stamp_count::inplace{}};
+    hilet utc_now = time_stamp_utc::make(now);
+
+    hilet block_header = detail::log_binary_block_header{
+        ++_sequence,
+        now.count(),
+        utc_now.time_since_epoch().count(),
+        narrow_cast<uint64_t>(time_stamp_count::duration_from_count(uint64_t{1} << 32).count())};
+    detail::log_binary_store(block, 0, block_header);
+}
+
+bool log_binary_writer::add_definition(std::span<std::byte const> definition) noexcept
+{
+    hilet size = detail::log_binary_align(definition.size());
+    if (_definitions_used + size > _definitions.size()) {
+        return false;
+    }
+
+    std::copy(definition.begin(), definition.end(), _definitions.begin() + _definitions_used);
+    _definitions_used += size;
+
+    // Only publish the definition after it was completely written.
+    detail::log_binary_store(_buffer, offsetof(detail::log_binary_header, definitions_used), uint64_t{_definitions_used});
+    return true;
+}
+
+uint32_t log_binary_writer::format_id(log_binary_format const& format)
+{
+    hilet id = narrow_cast<uint32_t>(_format_ids.size() + 1);
+
+    // Insert before defining, so that a definition is never written without its id.
+    hilet [it, inserted] = _format_ids.try_emplace(&format, id);
+    if (not inserted) {
+        return it->second;
+    }
+    auto erase_id = defer{[&] {
+        _format_ids.erase(it);
+    }};
+
+    auto definition = std::vector<std::byte>{};
+    auto append = [&definition](void const *data, std::size_t size) {
+        hilet *first = static_cast<std::byte const *>(data);
+        definition.insert(definition.end(), first, first + size);
+    };
+
+    hilet size = sizeof(detail::log_binary_definition_header) + sizeof(detail::log_binary_format_definition) +
+        format.source_path.size() + format.fmt.size();
+    hilet header = detail::log_binary_definition_header{narrow_cast<uint32_t>(size), detail::log_binary_definition::format, id};
+    hilet format_definition = detail::log_binary_format_definition{
+        narrow_cast<uint32_t>(to_underlying(format.level)),
+        narrow_cast<uint32_t>(format.source_line),
+        narrow_cast<uint32_t>(format.source_path.size()),
+        narrow_cast<uint32_t>(format.fmt.size())};
+    append(&header, sizeof(header));
+    append(&format_definition, sizeof(format_definition));
+    append(format.source_path.data(), format.source_path.size());
+    append(format.fmt.data(), format.fmt.size());
+
+    if (not add_definition(definition)) {
+        return 0;
+    }
+
+    erase_id.cancel();
+    return id;
+}
+
+void log_binary_writer::define_thread(uint64_t thread_id)
+{
+    hilet [it, inserted] = _thread_ids.insert(thread_id);
+    if (not inserted) {
+        return;
+    }
+    auto erase_id = defer{[&] {
+        _thread_ids.erase(it);
+    }};
+
+    hilet name = get_thread_name(narrow_cast<hi::thread_id>(thread_id));
+
+    auto definition = std::vector<std::byte>{};
+    auto append = [&definition](void const *data, std::size_t size) {
+        hilet *first = static_cast<std::byte const *>(data);
+        definition.insert(definition.end(), first, first + size);
+    };
+
+    hilet size = sizeof(detail::log_binary_definition_header) + sizeof(detail::log_binary_thread_definition) + name.size();
+    hilet header = detail::log_binary_definition_header{narrow_cast<uint32_t>(size), detail::log_binary_definition::thread, thread_id};
+    hilet thread_definition = detail::log_binary_thread_definition{narrow_cast<uint32_t>(name.size()), 0};
+    append(&header, sizeof(header));
+    append(&thread_definition, sizeof(thread_definition));
+    append(name.data(), name.size());
+
+    if (add_definition(definition)) {
+        erase_id.cancel();
+    }
+}
+
+void log_binary_writer::begin_record(
+    log_binary_format const& format,
+    time_stamp_count const& time_stamp,
+    std::size_t num_arguments) noexcept
+{
+    auto id = uint32_t{0};
+    try {
+        id = format_id(format);
+        define_thread(time_stamp.thread_id());
+    } catch (std::bad_alloc const&) {
+        // A record without a format-id is dropped; an undefined thread is decoded by its thread-id.
+    }
+    _drop_record = id == 0;
+
+    _record.clear();
+    hilet header = detail::log_binary_record_header{
+        0,
+        id,
+        time_stamp.count(),
+        time_stamp.thread_id(),
+        narrow_cast<uint32_t>(std::max(time_stamp.cpu_id(), ssize_t{0})),
+        narrow_cast<uint32_t>(num_arguments)};
+    append(header);
+}
+
+void log_binary_writer::end_record() noexcept
+{
+    _record.resize(detail::log_binary_align(_record.size()));
+
+    // Leave room for the end-of-block marker.
+    constexpr auto max_record_size = block_size - sizeof(detail::log_binary_block_header) - sizeof(uint32_t);
+
+    if (_drop_record or _record.size() > max_record_size) {
+        ++_num_dropped;
+        return;
+    }
+
+    if (_block_offset + _record.size() + sizeof(uint32_t) > block_size) {
+        start_block();
+    }
+
+    // The size is written last, so that a partially written record is never decoded.
+    auto block = _blocks.subspan(_block_index * block_size, block_size);
+    std::copy(_record.begin() + sizeof(uint32_t), _record.end(), block.begin() + _block_offset + sizeof(uint32_t));
+    detail::log_binary_store(block, _block_offset, narrow_cast<uint32_t>(_record.size()));
+    _block_offset += _record.size();
+}
+
+log_binary_file::log_binary_file(std::filesystem::path const& path, std::size_t size) :
+    _view(
+        [&] {
+            auto f = file{path, access_mode::truncate_or_create_for_write | access_mode::read};
+
+            // Grow the file to its full size, so that it can be mapped.
+            f.seek(narrow_cast<std::ptrdiff_t>(size) - 1);
+            f.write(std::string_view{"\0", 1});
+            return std::make_unique<file_view>(f, 0, size);
+        }()),
+    _writer(as_span<std::byte>(*_view))
+{
+}
+
+log_binary_file::~log_binary_file()
+{
+    _view->flush(_view->void_span());
+}
+
+namespace detail {
+
+using log_binary_value = std::variant<bool, char, int64_t, uint64_t, double, std::string>;
+
+struct log_binary_format_info {
+    global_state_type level;
+    int source_line;
+    std::string source_path;
+    std::string fmt;
+};
+
+struct log_binary_block_info {
+    log_binary_block_header header;
+    std::size_t offset;
+};
+
+[[nodiscard]] constexpr static std::string_view log_binary_level_name(global_state_type level) noexcept
+{
+    // clang-format off
+    return
+        level == global_state_type::log_fatal ? "fatal" :
+        level == global_state_type::log_error ? "error" :
+        level == global_state_type::log_warning ? "warning" :
+        level == global_state_type::log_info ? "info" :
+        level == global_state_type::log_debug ? "debug" :
+        level == global_state_type::log_trace ? "trace" :
+        level == global_state_type::log_audit ? "audit" :
+        level == global_state_type::log_statistics ? "stats" :
+        "<unknown log level>";
+    // clang-format on
+}
+
+/** Format a single replacement field.
+ *
+ * @param spec The format-spec of the field, without the colon.
+ * @param value The value to format.
+ */
+[[nodiscard]] static std::string log_binary_format_field(std::string_view spec, log_binary_value const& value) noexcept
+{
+    return std::visit(
+        [&](auto const& arg) -> std::string {
+            try {
+                auto field = std::string{"{:"};
+                field += spec;
+                field += '}';
+                return std::vformat(field, std::make_format_args(arg));
+            } catch (std::format_error const&) {
+                // The spec may have been written for the original type, before it was converted to a string.
+                return std::format("{}", arg);
+            }
+        },
+        value);
+}
+
+/** Format a message from its format string and decoded arguments.
+ *
+ * std::format requires the types of the arguments at compile time, so
+ * each replacement field is formatted separately.
+ */
+[[nodiscard]] static std::string log_binary_format_message(std::string_view fmt, std::vector<log_binary_value> const& args) noexcept
+{
+    auto r = std::string{};
+    auto next_index = 0_uz;
+
+    for (auto i = 0_uz; i != fmt.size(); ++i) {
+        hilet c = fmt[i];
+        if (c == '{' and i + 1 != fmt.size() and fmt[i + 1] == '{') {
+            r += '{';
+            ++i;
+
+        } else if (c == '}' and i + 1 != fmt.size() and fmt[i + 1] == '}') {
+            r += '}';
+            ++i;
+
+        } else if (c == '{') {
+            // Find the matching close brace, the spec may contain nested replacement fields.
+            auto depth = 1;
+            auto j = i + 1;
+            for (; j != fmt.size() and depth != 0; ++j) {
+                if (fmt[j] == '{') {
+                    ++depth;
+                } else if (fmt[j] == '}') {
+                    --depth;
+                }
+            }
+            hilet field = fmt.substr(i + 1, j - i - 2);
+            i = j - 1;
+
+            hilet colon = field.find(':');
+            hilet index_str = field.substr(0, colon);
+            hilet spec = colon == std::string_view::npos ? std::string_view{} : field.substr(colon + 1);
+
+            auto index = next_index++;
+            if (not index_str.empty()) {
+                index = 0;
+                for (hilet d : index_str) {
+                    index = index * 10 + narrow_cast<std::size_t>(d - '0');
+                }
+            }
+
+            if (index < args.size()) {
+                r += log_binary_format_field(spec, args[index]);
+            } else {
+                r += "{?}";
+            }
+
+        } else {
+            r += c;
+        }
+    }
+    return r;
+}
+
+} // namespace detail
+
+std::vector<std::string> decode_binary_log(std::span<std::byte const> bytes)
+{
+    using namespace detail;
+
+    hilet header = log_binary_load<log_binary_header>(bytes, 0);
+    hi_check(header.magic == log_binary_magic, "Not a binary log.");
+    hi_check(header.version == 1, "Unsupported binary log version {}.", header.version);
+    hi_check(header.definitions_used <= header.definitions_size, "Binary log definitions are corrupt.");
+    hi_check(header.definitions_offset + header.definitions_size <= bytes.size(), "Binary log is truncated.");
+    hi_check(
+        header.blocks_offset + header.num_blocks * header.block_size <= bytes.size(), "Binary log is truncated.");
+
+    // Read the definitions.
+    auto formats = std::map<uint64_t, log_binary_format_info>{};
+    auto thread_names = std::map<uint64_t, std::string>{};
+
+    hilet definitions = bytes.subspan(header.definitions_offset, header.definitions_used);
+    for (auto offset = 0_uz; offset < definitions.size();) {
+        hilet definition = log_binary_load<log_binary_definition_header>(definitions, offset);
+        hi_check(definition.size >= sizeof(log_binary_definition_header), "Binary log definition is corrupt.");
+        hi_check(offset + definition.size <= definitions.size(), "Binary log definition is corrupt.");
+
+        auto ptr = offset + sizeof(log_binary_definition_header);
+        if (definition.kind == log_binary_definition::format) {
+            hilet format = log_binary_load<log_binary_format_definition>(definitions, ptr);
+            ptr += sizeof(log_binary_format_definition);
+            hi_check(
+                ptr + format.source_path_size + format.fmt_size <= offset + definition.size,
+                "Binary log format definition is corrupt.");
+
+            auto& info = formats[definition.id];
+            info.level = static_cast<global_state_type>(format.level);
+            info.source_line = narrow_cast<int>(format.source_line);
+            info.source_path = log_binary_string(definitions, ptr, format.source_path_size);
+            info.fmt = log_binary_string(definitions, ptr + format.source_path_size, format.fmt_size);
+
+        } else if (definition.kind == log_binary_definition::thread) {
+            hilet thread = log_binary_load<log_binary_thread_definition>(definitions, ptr);
+            ptr += sizeof(log_binary_thread_definition);
+            hi_check(ptr + thread.name_size <= offset + definition.size, "Binary log thread definition is corrupt.");
+
+            thread_names[definition.id] = log_binary_string(definitions, ptr, thread.name_size);
+        }
+
+        offset += log_binary_align(definition.size);
+    }
+
+    // The blocks form a ring, order them from oldest to newest.
+    auto blocks = std::vector<log_binary_block_info>{};
+    for (auto i = 0_uz; i != header.num_blocks; ++i) {
+        hilet offset = header.blocks_offset + i * header.block_size;
+        hilet block_header = log_binary_load<log_binary_block_header>(bytes, offset);
+        if (block_header.sequence != 0) {
+            blocks.emplace_back(block_header, offset);
+        }
+    }
+    std::ranges::sort(blocks, [](hilet& a, hilet& b) {
+        return a.header.sequence < b.header.sequence;
+    });
+
+    auto r = std::vector<std::string>{};
+    auto args = std::vector<log_binary_value>{};
+    for (hilet& block : blocks) {
+        hilet block_bytes = bytes.subspan(block.offset, header.block_size);
+
+        auto offset = sizeof(log_binary_block_header);
+        while (offset + sizeof(log_binary_record_header) <= block_bytes.size()) {
+            hilet record = log_binary_load<log_binary_record_header>(block_bytes, offset);
+            if (record.size == 0) {
+                break;
+            }
+            hi_check(record.size >= sizeof(log_binary_record_header), "Binary log record is corrupt.");
+            hi_check(offset + record.size <= block_bytes.size(), "Binary log record is corrupt.");
+
+            hilet record_bytes = block_bytes.subspan(offset, record.size);
+            offset += record.size;
+
+            args.clear();
+            auto ptr = sizeof(log_binary_record_header);
+            for (auto i = 0_uz; i != record.num_arguments; ++i) {
+                hilet kind = log_binary_load<log_binary_argument>(record_bytes, ptr++);
+                switch (kind) {
+                case log_binary_argument::boolean:
+                    args.emplace_back(log_binary_load<uint8_t>(record_bytes, ptr) != 0);
+                    ptr += sizeof(uint8_t);
+                    break;
+                case log_binary_argument::character:
+                    args.emplace_back(log_binary_load<char>(record_bytes, ptr));
+                    ptr += sizeof(char);
+                    break;
+                case log_binary_argument::signed_integer:
+                    args.emplace_back(log_binary_load<int64_t>(record_bytes, ptr));
+                    ptr += sizeof(int64_t);
+                    break;
+                case log_binary_argument::unsigned_integer:
+                    args.emplace_back(log_binary_load<uint64_t>(record_bytes, ptr));
+                    ptr += sizeof(uint64_t);
+                    break;
+                case log_binary_argument::floating_point:
+                    args.emplace_back(log_binary_load<double>(record_bytes, ptr));
+                    ptr += sizeof(double);
+                    break;
+                case log_binary_argument::string:
+                    {
+                        hilet size = log_binary_load<uint32_t>(record_bytes, ptr);
+                        ptr += sizeof(uint32_t);
+                        hi_check(ptr + size <= record_bytes.size(), "Binary log string argument is corrupt.");
+                        args.emplace_back(std::string{log_binary_string(record_bytes, ptr, size)});
+                        ptr += size;
+                    }
+                    break;
+                default:
+                    throw parse_error(std::format("Binary log argument has unknown type {}.", to_underlying(kind)));
+                }
+            }
+
+            hilet format_it = formats.find(record.format_id);
+            hi_check(format_it != formats.end(), "Binary log record has unknown format-id {}.", record.format_id);
+            hilet& format = format_it->second;
+
+            // Convert the time-stamp-count to UTC using the reference of the block.
+            hilet delta_count = static_cast<double>(static_cast<int64_t>(record.time_stamp_count - block.header.time_stamp_count));
+            hilet delta_ns = delta_count * static_cast<double>(block.header.period) / 4294967296.0;
+            hilet utc_time_point = utc_nanoseconds{std::chrono::nanoseconds{block.header.utc_nanoseconds}} +
+                std::chrono::nanoseconds{static_cast<int64_t>(delta_ns)};
+            hilet sys_time_point = std::chrono::clock_cast<std::chrono::system_clock>(utc_time_point);
+
+            hilet thread_it = thread_names.find(record.thread_id);
+            hilet thread_name = thread_it != thread_names.end() ? thread_it->second : std::format("{}", record.thread_id);
+
+            hilet level_name = log_binary_level_name(format.level);
+            hilet text = log_binary_format_message(format.fmt, args);
+
+            if (to_bool(format.level & global_state_type::log_statistics)) {
+                r.push_back(std::format("{} {}({}) {:5} {}\n", sys_time_point, thread_name, record.cpu_id, level_name, text));
+            } else {
+                hilet source_filename = std::filesystem::path{format.source_path}.filename().generic_string();
+                r.push_back(std::format(
+                    "{} {}({}) {:5} {} ({}:{})\n",
+                    sys_time_point,
+                    thread_name,
+                    record.cpu_id,
+                    level_name,
+                    text,
+                    source_filename,
+                    format.source_line));
+            }
+        }
+    }
+    return r;
+}
+
+} // namespace hi::inline v1
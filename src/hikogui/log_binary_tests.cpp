@@ -0,0 +1,103 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "log_binary.hpp"
+#include "utility/module.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace hi;
+
+namespace {
+
+struct log_binary_tests_point {
+    int x;
+    int y;
+};
+
+} // namespace
+
+template<>
+struct std::formatter<log_binary_tests_point, char> : std::formatter<std::string, char> {
+    auto format(log_binary_tests_point const& t, auto& fc)
+    {
+        return std::formatter<std::string, char>::format(std::format("({}, {})", t.x, t.y), fc);
+    }
+};
+
+constexpr auto log_binary_tests_info =
+    log_binary_format{global_state_type::log_info, "src/foo.cpp", 12, "hello {} {:>6} {:.2f} {} {} {{{}}}"};
+constexpr auto log_binary_tests_stats = log_binary_format{global_state_type::log_statistics, "src/bar.cpp", 5, "{1}-{0}"};
+
+TEST(log_binary, round_trip)
+{
+    auto buffer = std::vector<std::byte>(log_binary_writer::header_size + 4096 + 4 * log_binary_writer::block_size);
+    auto writer = log_binary_writer(buffer, 4096);
+
+    hilet time_stamp = time_stamp_count{time_stamp_count::inplace_with_thread_id{}};
+    writer.write(
+        log_binary_tests_info,
+        time_stamp,
+        std::tuple{42, std::string{"world"}, 1.5, 'x', true, log_binary_tests_point{1, 2}});
+    writer.write(log_binary_tests_stats, time_stamp, std::tuple{uint64_t{1}, "two"});
+    ASSERT_EQ(writer.num_dropped(), 0);
+
+    hilet lines = decode_binary_log(buffer);
+    ASSERT_EQ(lines.size(), 2);
+    ASSERT_NE(lines[0].find(" info  hello 42  world 1.50 x true {(1, 2)} (foo.cpp:12)\n"), std::string::npos);
+    ASSERT_TRUE(lines[1].ends_with(" stats two-1\n"));
+}
+
+TEST(log_binary, ring)
+{
+    auto buffer = std::vector<std::byte>(log_binary_writer::header_size + 4096 + 3 * log_binary_writer::block_size);
+    auto writer = log_binary_writer(buffer, 4096);
+
+    // Write enough records to wrap around the ring several times.
+    hilet time_stamp = time_stamp_count{time_stamp_count::inplace_with_thread_id{}};
+    for (auto i = 0; i != 20'000; ++i) {
+        writer.write(log_binary_tests_stats, time_stamp, std::tuple{i, "a"});
+    }
+
+    hilet lines = decode_binary_log(buffer);
+    ASSERT_GT(lines.size(), 1000);
+    ASSERT_LT(lines.size(), 20'000);
+
+    // The oldest records are overwritten, the remaining records are in order.
+    auto expected = 20'000 - std::ssize(lines);
+    for (hilet& line : lines) {
+        ASSERT_TRUE(line.ends_with(std::format(" a-{}\n", expected++)));
+    }
+}
+
+TEST(log_binary, record_too_large)
+{
+    auto buffer = std::vector<std::byte>(log_binary_writer::header_size + 4096 + 2 * log_binary_writer::block_size);
+    auto writer = log_binary_writer(buffer, 4096);
+
+    // The record is dropped, without growing the storage for a record.
+    hilet time_stamp = time_stamp_count{time_stamp_count::inplace_with_thread_id{}};
+    writer.write(log_binary_tests_stats, time_stamp, std::tuple{1, std::string(log_binary_writer::block_size, 'a')});
+    ASSERT_EQ(writer.num_dropped(), 1);
+
+    writer.write(log_binary_tests_stats, time_stamp, std::tuple{2, "b"});
+    ASSERT_EQ(writer.num_dropped(), 1);
+
+    hilet lines = decode_binary_log(buffer);
+    ASSERT_EQ(lines.size(), 1);
+    ASSERT_TRUE(lines[0].ends_with(" stats b-2\n"));
+}
+
+TEST(log_binary, corrupt)
+{
+    auto buffer = std::vector<std::byte>(log_binary_writer::header_size + 4096 + 2 * log_binary_writer::block_size);
+    ASSERT_THROW(std::ignore = decode_binary_log(buffer), parse_error);
+
+    auto writer = log_binary_writer(buffer, 4096);
+    ASSERT_TRUE(decode_binary_log(buffer).empty());
+    ASSERT_THROW(std::ignore = decode_binary_log(std::span{buffer}.first(100)), parse_error);
+}
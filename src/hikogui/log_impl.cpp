@@ -14,9 +14,38 @@
 #include <ostream>
 #include <chrono>
 #include <thread>
+#include <condition_variable>
 
 namespace hi::inline v1 {
 
+/** The condition on which the logger thread waits for messages.
+ *
+ * Kept out of the `log` class so that `log_global` can be constant-initialized.
+ */
+[[nodiscard]] static std::condition_variable_any& log_wake_condition() noexcept
+{
+    static auto r = std::condition_variable_any{};
+    return r;
+}
+
+[[nodiscard]] static std::mutex& log_wake_mutex() noexcept
+{
+    static auto r = std::mutex{};
+    return r;
+}
+
+/** Set when a thread wants the logger thread to flush the log queues.
+ */
+constinit static std::atomic<bool> log_wake_requested = false;
+
+void detail::log_wake() noexcept
+{
+    // The logger thread may miss this notification when it is just about to wait,
+    // in that case the messages are flushed by the periodic flush.
+    log_wake_requested.store(true, std::memory_order::relaxed);
+    log_wake_condition().notify_one();
+}
+
 void log::log_thread_main(std::stop_token stop_token) noexcept
 {
     using namespace std::chrono_literals;
@@ -35,7 +64,11 @@ void log::log_thread_main(std::stop_token stop_token) noexcept
             detail::counter::log();
         }
 
-        std::this_thread::sleep_for(100ms);
+        // Wait until a log queue fills up or for the next periodic flush.
+        auto lock = std::unique_lock(log_wake_mutex());
+        log_wake_condition().wait_for(lock, stop_token, 100ms, [] {
+            return log_wake_requested.exchange(false, std::memory_order::relaxed);
+        });
     }
 
     hi_log_info("log thread finished");
@@ -73,27 +106,77 @@ void log::write(std::string const &str) const noexcept
     console_output(str);
 }
 
+detail::log_queue& log::make_thread_queue() noexcept
+{
+    _thread_queue = std::make_shared<detail::log_queue>();
+
+    hilet lock = std::scoped_lock(_mutex);
+    _queues.push_back(_thread_queue);
+    return *_thread_queue;
+}
+
+void log::open_binary_file(std::filesystem::path const& path, std::size_t size)
+{
+    auto binary_file = std::make_unique<log_binary_file>(path, size);
+
+    flush();
+    hilet lock = std::scoped_lock(_mutex);
+    _binary_file = std::move(binary_file);
+}
+
+void log::close_binary_file() noexcept
+{
+    flush();
+    hilet lock = std::scoped_lock(_mutex);
+    _binary_file = nullptr;
+}
+
 void log::flush() noexcept
 {
     hilet t = trace<"log_flush">{};
 
-    bool wrote_message;
-    do {
-        std::unique_ptr<detail::log_message_base> copy_of_message;
+    auto messages = std::vector<std::unique_ptr<detail::log_message_base>>{};
+
+    auto lock = std::unique_lock(_mutex);
+
+    // Take the messages from each queue in turn, so that a thread that logs
+    // a lot can not starve the other threads.
+    auto taken = true;
+    while (taken) {
+        taken = false;
+        for (hilet& queue : _queues) {
+            for (auto i = 0_uz; i != detail::log_queue::num_slots / 4; ++i) {
+                if (not queue->take_one([&messages](auto const& message) {
+                        messages.push_back(message.make_unique_copy());
+                    })) {
+                    break;
+                }
+                taken = true;
+            }
+        }
+    }
+
+    // Forget the queues of threads that have exited, after they have been emptied.
+    std::erase_if(_queues, [](hilet& queue) {
+        return queue.use_count() == 1 and queue->empty();
+    });
 
-        {
-            hilet lock = std::scoped_lock(_mutex);
+    // Merge the messages of the threads.
+    std::ranges::stable_sort(messages, [](hilet& a, hilet& b) {
+        return a->time_stamp().count() < b->time_stamp().count();
+    });
 
-            wrote_message = _fifo.take_one([&copy_of_message](auto &message) {
-                copy_of_message = message.make_unique_copy();
-            });
+    if (_binary_file) {
+        for (hilet& message : messages) {
+            message->write(*_binary_file);
         }
 
-        if (wrote_message) {
-            hi_assert_not_null(copy_of_message);
-            write(copy_of_message->format());
+    } else {
+        lock.unlock();
+        for (hilet& message : messages) {
+            write(message->format());
         }
-    } while (wrote_message);
+    }
 }
 
 } // namespace hi::inline v1
@@ -0,0 +1,118 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "log.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace hi;
+
+namespace {
+
+class log_tests_message : public detail::log_message_base {
+public:
+    int value;
+
+    log_tests_message(int value) noexcept : value(value) {}
+
+    std::string format() const noexcept override
+    {
+        return std::to_string(value);
+    }
+
+    std::unique_ptr<detail::log_message_base> make_unique_copy() const noexcept override
+    {
+        return std::make_unique<log_tests_message>(*this);
+    }
+
+    time_stamp_count const& time_stamp() const noexcept override
+    {
+        return _time_stamp;
+    }
+
+    void write(log_binary_file& file) const noexcept override {}
+
+private:
+    time_stamp_count _time_stamp = {};
+};
+
+[[nodiscard]] std::vector<int> take_all(detail::log_queue& queue) noexcept
+{
+    auto r = std::vector<int>{};
+    while (queue.take_one([&](detail::log_message_base& message) {
+        r.push_back(dynamic_cast<log_tests_message&>(message).value);
+    })) {}
+    return r;
+}
+
+} // namespace
+
+TEST(log, queue_drop_newest)
+{
+    auto queue = std::make_unique<detail::log_queue>();
+    queue->overflow_policy = log_overflow_policy::drop_newest;
+
+    hilet num_dropped = static_cast<uint64_t>(global_counter<"log:dropped">);
+    for (auto i = 0; i != 300; ++i) {
+        queue->emplace<log_tests_message>(i);
+    }
+    ASSERT_EQ(static_cast<uint64_t>(global_counter<"log:dropped">) - num_dropped, 300 - detail::log_queue::num_slots);
+
+    hilet values = take_all(*queue);
+    ASSERT_EQ(values.size(), detail::log_queue::num_slots);
+    ASSERT_EQ(values.front(), 0);
+    ASSERT_EQ(values.back(), 255);
+    ASSERT_TRUE(queue->empty());
+}
+
+TEST(log, queue_overwrite_oldest)
+{
+    auto queue = std::make_unique<detail::log_queue>();
+    queue->overflow_policy = log_overflow_policy::overwrite_oldest;
+
+    hilet num_overwritten = static_cast<uint64_t>(global_counter<"log:overwritten">);
+    for (auto i = 0; i != 300; ++i) {
+        queue->emplace<log_tests_message>(i);
+    }
+    ASSERT_EQ(static_cast<uint64_t>(global_counter<"log:overwritten">) - num_overwritten, 300 - detail::log_queue::num_slots);
+
+    hilet values = take_all(*queue);
+    ASSERT_EQ(values.size(), detail::log_queue::num_slots);
+    ASSERT_EQ(values.front(), 44);
+    ASSERT_EQ(values.back(), 299);
+    ASSERT_TRUE(queue->empty());
+}
+
+TEST(log, queue_overwrite_oldest_concurrent)
+{
+    auto queue = std::make_unique<detail::log_queue>();
+    queue->overflow_policy = log_overflow_policy::overwrite_oldest;
+
+    auto done = std::atomic<bool>{false};
+    auto producer = std::jthread([&] {
+        for (auto i = 0; i != 200'000; ++i) {
+            queue->emplace<log_tests_message>(i);
+        }
+        done.store(true);
+    });
+
+    // Messages may be overwritten or dropped, but the ones that are taken must be in order.
+    auto values = std::vector<int>{};
+    while (not done.load() or not queue->empty()) {
+        queue->take_one([&](detail::log_message_base& message) {
+            values.push_back(dynamic_cast<log_tests_message&>(message).value);
+        });
+    }
+    producer.join();
+
+    ASSERT_FALSE(values.empty());
+    for (auto i = 1_uz; i != values.size(); ++i) {
+        ASSERT_LT(values[i - 1], values[i]);
+    }
+    ASSERT_TRUE(queue->empty());
+}
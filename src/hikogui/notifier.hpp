@@ -8,11 +8,17 @@
 #include "generator.hpp"
 #include "loop.hpp"
 #include "callback_flags.hpp"
+#include "concurrency/module.hpp"
+#include "small_vector.hpp"
+#include "lean_vector.hpp"
 #include <vector>
 #include <tuple>
 #include <functional>
 #include <coroutine>
 #include <mutex>
+#include <memory>
+#include <optional>
+#include <atomic>
 
 namespace hi::inline v1 {
 
@@ -124,105 +130,225 @@ public:
     subscribe(forward_of<callback_proto> auto&& callback, callback_flags flags = callback_flags::synchronous) noexcept
     {
         auto token = std::make_shared<function_type>(hi_forward(callback));
+        auto subscriber = std::make_shared<subscriber_type>(token, flags);
 
         hilet lock = std::scoped_lock(_mutex);
-        _callbacks.emplace_back(token, flags);
+        update_callbacks([&](auto& callbacks) {
+            callbacks.push_back(std::move(subscriber));
+        });
         return token;
     }
 
     /** Call the subscribed callbacks with the given arguments.
      *
-     * @note This function is not reentrant.
+     * The list of callbacks is read without taking a lock, and no lock is held while a
+     * callback is called. Asynchronous callbacks are posted as a single function for
+     * each loop, which copies the arguments once.
+     *
+     * The batches are kept in inline storage, so that notifying a few subscribers
+     * does not allocate.
+     *
      * @param args The arguments to pass with the invocation of the callback
      */
     void operator()(Args const&...args) const noexcept
     {
-        hilet lock = std::scoped_lock(_mutex);
+        auto needs_clean_up = false;
+        auto synchronous_batch = small_vector<weak_callback_token, 8>{};
+        auto synchronous_overflow = std::vector<weak_callback_token>{};
+        auto local_batch = batch_type{};
+        auto main_batch = batch_type{};
+        auto timer_batch = batch_type{};
+
+        _callbacks.lock();
+        if (hilet *callbacks = _callbacks.get()) {
+            for (hilet& subscriber : *callbacks) {
+                if (is_once(subscriber->flags)) {
+                    // If the callback should only be triggered once, like inside an awaitable.
+                    // Then it will be removed from _callbacks during clean-up.
+                    if (subscriber->done.exchange(true, std::memory_order::relaxed)) {
+                        continue;
+                    }
+                    needs_clean_up = true;
+                }
 
-        for (auto& callback : _callbacks) {
-            if (is_synchronous(callback.flags)) {
-                if (auto func = callback.lock()) {
-                    (*func)(args...);
+                if (subscriber->token.expired()) {
+                    needs_clean_up = true;
+                    continue;
                 }
 
-            } else if (is_local(callback.flags)) {
-                loop::local().post_function([=] {
-                    if (auto func = callback.lock()) {
-                        (*func)(args...);
+                if (is_synchronous(subscriber->flags)) {
+                    if (not synchronous_batch.push_back(subscriber->token)) {
+                        [[unlikely]] synchronous_overflow.push_back(subscriber->token);
                     }
-                });
+                    continue;
+                }
 
-            } else if (is_main(callback.flags)) {
-                loop::main().post_function([=] {
-                    if (auto func = callback.lock()) {
-                        (*func)(args...);
-                    }
-                });
+                if (is_coalesce(subscriber->flags) and not subscriber->coalesce(args...)) {
+                    // A call is already waiting in the loop, it will use the new arguments.
+                    continue;
+                }
 
-            } else if (is_timer(callback.flags)) {
-                loop::timer().post_function([=] {
-                    if (auto func = callback.lock()) {
-                        (*func)(args...);
-                    }
-                });
+                if (is_local(subscriber->flags)) {
+                    local_batch.push_back(subscriber);
+                } else if (is_main(subscriber->flags)) {
+                    main_batch.push_back(subscriber);
+                } else if (is_timer(subscriber->flags)) {
+                    timer_batch.push_back(subscriber);
+                } else {
+                    hi_no_default();
+                }
+            }
+        }
+        _callbacks.unlock();
 
+        // The synchronous callbacks are called outside of the rcu read-side critical section,
+        // so that a slow callback does not delay the reclamation of every rcu object.
+        hilet call_synchronous = [&](weak_callback_token const& token) {
+            if (auto func = token.lock()) {
+                (*func)(args...);
             } else {
-                hi_no_default();
+                needs_clean_up = true;
             }
+        };
+        for (hilet& token : synchronous_batch) {
+            call_synchronous(token);
+        }
+        for (hilet& token : synchronous_overflow) {
+            call_synchronous(token);
+        }
 
-            // If the callback should only be triggered once, like inside an awaitable.
-            // Then reset the weak_ptr in _callbacks so that it will be cleaned up.
-            // In the lambda above the weak_ptr is copied first so that it callback will get executed
-            // as long as the shared_ptr's use count does not go to zero.
-            if (is_once(callback.flags)) {
-                callback.reset();
-            }
+        // The weak_ptr is copied into the batch so that the callback will get executed
+        // as long as the shared_ptr's use count does not go to zero.
+        if (not local_batch.empty()) {
+            post_batch(loop::local(), std::move(local_batch), args...);
+        }
+        if (not main_batch.empty()) {
+            post_batch(loop::main(), std::move(main_batch), args...);
+        }
+        if (not timer_batch.empty()) {
+            post_batch(loop::timer(), std::move(timer_batch), args...);
+        }
+
+        if (needs_clean_up) {
+            clean_up();
         }
-        clean_up();
     }
 
 private:
-    struct callback_type {
+    /** The copy of the arguments that is passed to an asynchronous callback.
+     */
+    using arguments_type = std::tuple<std::decay_t<Args>...>;
+
+    struct subscriber_type {
         weak_callback_token token;
         callback_flags flags;
 
+        /** Set when a `callback_flags::once` callback was triggered.
+         */
+        std::atomic<bool> done = false;
+
+        /** The arguments of the last notification, while a coalesced call is waiting in the loop.
+         */
+        std::optional<arguments_type> coalesced_args;
+        unfair_mutex coalesced_args_mutex;
+
+        subscriber_type(weak_callback_token token, callback_flags flags) noexcept : token(std::move(token)), flags(flags) {}
+
         [[nodiscard]] bool expired() const noexcept
         {
-            return token.expired();
+            return token.expired() or (is_once(flags) and done.load(std::memory_order::relaxed));
         }
 
-        void reset() noexcept
+        /** Store the arguments of a coalesced call.
+         *
+         * @return true if the call needs to be posted, false if a call is already waiting in the loop.
+         */
+        [[nodiscard]] bool coalesce(Args const&...args) noexcept
         {
-            token.reset();
+            hilet lock = std::scoped_lock(coalesced_args_mutex);
+            hilet is_waiting = coalesced_args.has_value();
+            coalesced_args = arguments_type{args...};
+            return not is_waiting;
         }
 
-        [[nodiscard]] callback_token lock() const noexcept
+        void invoke(arguments_type const& args) noexcept
         {
-            return token.lock();
+            auto func = token.lock();
+            if (not func) {
+                return;
+            }
+
+            if (is_coalesce(flags)) {
+                auto lock = std::unique_lock(coalesced_args_mutex);
+                if (not coalesced_args) {
+                    return;
+                }
+                auto args_ = *std::move(coalesced_args);
+                coalesced_args.reset();
+                lock.unlock();
+
+                std::apply(*func, args_);
+
+            } else {
+                std::apply(*func, args);
+            }
         }
     };
 
+    using callbacks_type = std::vector<std::shared_ptr<subscriber_type>>;
+    /** The subscribers to call from a single loop.
+     *
+     * A single subscriber is stored inline, so that it can be moved into the posted function without allocating.
+     */
+    using batch_type = lean_vector<std::shared_ptr<subscriber_type>>;
+
+    /** Serializes the changes to _callbacks.
+     */
     mutable unfair_mutex _mutex;
 
     /** A list of callbacks and it's associated token.
+     *
+     * The list is copied on each change, so that it can be read without a lock.
      */
-    mutable std::vector<callback_type> _callbacks;
+    mutable rcu<callbacks_type> _callbacks;
 
-    void clean_up() const noexcept
+    static void post_batch(loop& target, batch_type batch, Args const&...args) noexcept
+    {
+        target.post_function([batch = std::move(batch), arguments = arguments_type{args...}] {
+            for (hilet& subscriber : batch) {
+                subscriber->invoke(arguments);
+            }
+        });
+    }
+
+    /** Replace the list of callbacks with a modified copy.
+     *
+     * @param func A function that modifies the copy of the list of callbacks.
+     */
+    void update_callbacks(auto const& func) const noexcept
     {
         hi_axiom(_mutex.is_locked());
 
+        // Only the holder of _mutex replaces the list, so it can be read without locking the rcu.
+        auto callbacks = callbacks_type{};
+        if (hilet *ptr = _callbacks.get()) {
+            callbacks = *ptr;
+        }
+        func(callbacks);
+        _callbacks.emplace(std::move(callbacks));
+    }
+
+    void clean_up() const noexcept
+    {
+        hilet lock = std::scoped_lock(_mutex);
+
         // Cleanup all callbacks that have expired, or when they may only be triggered once.
-        std::erase_if(_callbacks, [](hilet& item) {
-            return item.expired();
+        update_callbacks([](auto& callbacks) {
+            std::erase_if(callbacks, [](hilet& item) {
+                return item->expired();
+            });
         });
     }
-
-#ifndef NDEBUG
-    /** The notifier is currently calling all the callbacks.
-     */
-    mutable bool _notifying = false;
-#endif
 };
 
 } // namespace hi::inline v1
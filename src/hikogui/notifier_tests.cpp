@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <vector>
 
 using namespace std;
 using namespace hi;
@@ -109,4 +110,86 @@ TEST(notifier, local_coroutine)
     ASSERT_EQ(a, 1);
     ASSERT_EQ(b, 1);
     ASSERT_TRUE(cr.done());
-}
\ No newline at end of file
+}
+
+TEST(notifier, local_coalesce)
+{
+    auto values = std::vector<int>{};
+    auto coalesced_values = std::vector<int>{};
+
+    auto n = notifier<void(int)>{};
+
+    auto a_cbt = n.subscribe(
+        [&](int value) {
+            values.push_back(value);
+        },
+        callback_flags::local);
+
+    auto b_cbt = n.subscribe(
+        [&](int value) {
+            coalesced_values.push_back(value);
+        },
+        callback_flags::local | callback_flags::coalesce);
+
+    // Each notification is posted to the event-loop, but the coalesced callback
+    // is only posted once while it is waiting.
+    n(1);
+    n(2);
+    n(3);
+    ASSERT_TRUE(values.empty());
+    ASSERT_TRUE(coalesced_values.empty());
+
+    loop::local().resume_once();
+    ASSERT_EQ(values, (std::vector<int>{1, 2, 3}));
+    ASSERT_EQ(coalesced_values, (std::vector<int>{3}));
+
+    // After the coalesced callback was called, a new notification is posted again.
+    n(4);
+    loop::local().resume_once();
+    ASSERT_EQ(values, (std::vector<int>{1, 2, 3, 4}));
+    ASSERT_EQ(coalesced_values, (std::vector<int>{3, 4}));
+}
+
+TEST(notifier, subscribe_from_callback)
+{
+    auto a = 0;
+    auto b = 0;
+
+    auto n = notifier{};
+
+    auto b_cbt = notifier<>::callback_token{};
+    auto a_cbt = n.subscribe([&] {
+        ++a;
+        // The list of callbacks can be changed while notifying.
+        if (not b_cbt) {
+            b_cbt = n.subscribe([&] {
+                ++b;
+            });
+        }
+    });
+
+    n();
+    ASSERT_EQ(a, 1);
+    ASSERT_EQ(b, 0);
+
+    n();
+    ASSERT_EQ(a, 2);
+    ASSERT_EQ(b, 1);
+}
+
+TEST(notifier, callback_outside_rcu)
+{
+    auto a = 0;
+
+    auto n = notifier{};
+
+    auto a_cbt = n.subscribe([&] {
+        // The callback is not called inside a read-side critical section, otherwise
+        // waiting for the rcu objects to be reclaimed would dead-lock.
+        rcu_barrier();
+        ++a;
+    });
+
+    n();
+    ASSERT_EQ(a, 1);
+}
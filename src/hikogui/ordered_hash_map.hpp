@@ -0,0 +1,462 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "utility/module.hpp"
+#include <vector>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <compare>
+#include <stdexcept>
+#include <initializer_list>
+#include <bit>
+
+namespace hi::inline v1 {
+
+/** A hash map which iterates over its items in insertion order.
+ *
+ * The key/value pairs are stored contiguously in a single vector, in the order in which
+ * they were inserted. Small maps are searched linearly, larger maps use a separate
+ * open-addressing index with linear probing. Each slot of the index holds the position
+ * of an item and part of the hash of its key, so that most mismatches are rejected
+ * without comparing keys.
+ *
+ * Compared to `std::map` there is no allocation per item, and lookup does not need
+ * a comparison for each level of a tree. Like `std::vector`, inserting or erasing an
+ * item invalidates iterators and references. Erasing an item is O(n), as the items
+ * after it are moved to keep the insertion order.
+ *
+ * Equality does not depend on the insertion order. The three-way comparison compares
+ * the items sorted by key, like `std::map` would.
+ *
+ * @tparam Key The type of the key.
+ * @tparam T The type of the value.
+ * @tparam Hash The hash function of the key.
+ * @tparam KeyEqual The equality function of the key.
+ */
+template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class ordered_hash_map {
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = value_type const&;
+    using container_type = std::vector<value_type>;
+    using iterator = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    /** Maps up to this number of items are searched linearly without an index.
+     */
+    constexpr static std::size_t linear_search_size = 8;
+
+    ~ordered_hash_map() = default;
+    ordered_hash_map(ordered_hash_map const&) = default;
+    ordered_hash_map(ordered_hash_map&&) noexcept = default;
+    ordered_hash_map& operator=(ordered_hash_map const&) = default;
+    ordered_hash_map& operator=(ordered_hash_map&&) noexcept = default;
+    ordered_hash_map() noexcept = default;
+
+    ordered_hash_map(std::initializer_list<value_type> items) : ordered_hash_map()
+    {
+        reserve(items.size());
+        for (hilet& item : items) {
+            insert(item);
+        }
+    }
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return _items.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _items.empty();
+    }
+
+    [[nodiscard]] iterator begin() noexcept
+    {
+        return _items.begin();
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return _items.begin();
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept
+    {
+        return _items.cbegin();
+    }
+
+    [[nodiscard]] iterator end() noexcept
+    {
+        return _items.end();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+        return _items.end();
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept
+    {
+        return _items.cend();
+    }
+
+    void clear() noexcept
+    {
+        _items.clear();
+        _slots.clear();
+    }
+
+    /** Reserve space for items.
+     *
+     * @param new_capacity The number of items that can be inserted without reallocating.
+     */
+    void reserve(size_type new_capacity)
+    {
+        _items.reserve(new_capacity);
+        if (new_capacity > linear_search_size and slot_capacity_for(new_capacity) > _slots.size()) {
+            rehash(slot_capacity_for(new_capacity));
+        }
+    }
+
+    [[nodiscard]] iterator find(key_type const& key) noexcept
+    {
+        return begin() + find_index(key, hash_fragment(key));
+    }
+
+    [[nodiscard]] const_iterator find(key_type const& key) const noexcept
+    {
+        return begin() + find_index(key, hash_fragment(key));
+    }
+
+    [[nodiscard]] bool contains(key_type const& key) const noexcept
+    {
+        return find(key) != end();
+    }
+
+    [[nodiscard]] size_type count(key_type const& key) const noexcept
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    /** Get a reference to the value of a key.
+     *
+     * @throw std::out_of_range When the key is not in the map.
+     */
+    [[nodiscard]] mapped_type& at(key_type const& key)
+    {
+        hilet it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("Key not found in ordered_hash_map");
+        }
+        return it->second;
+    }
+
+    /** Get a reference to the value of a key.
+     *
+     * @throw std::out_of_range When the key is not in the map.
+     */
+    [[nodiscard]] mapped_type const& at(key_type const& key) const
+    {
+        hilet it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("Key not found in ordered_hash_map");
+        }
+        return it->second;
+    }
+
+    /** Insert a value constructed from the arguments, if the key is not in the map.
+     *
+     * @return An iterator to the item with the key, and true if it was inserted.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type const& key, Args&&...args)
+    {
+        return try_emplace_impl(key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type&& key, Args&&...args)
+    {
+        return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename V>
+    std::pair<iterator, bool> emplace(key_type const& key, V&& value)
+    {
+        return try_emplace_impl(key, std::forward<V>(value));
+    }
+
+    template<typename V>
+    std::pair<iterator, bool> emplace(key_type&& key, V&& value)
+    {
+        return try_emplace_impl(std::move(key), std::forward<V>(value));
+    }
+
+    std::pair<iterator, bool> insert(value_type const& item)
+    {
+        return try_emplace_impl(item.first, item.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& item)
+    {
+        return try_emplace_impl(std::move(item.first), std::move(item.second));
+    }
+
+    /** Insert a value, or assign it when the key is already in the map.
+     *
+     * @return An iterator to the item with the key, and true if it was inserted.
+     */
+    template<typename V>
+    std::pair<iterator, bool> insert_or_assign(key_type const& key, V&& value)
+    {
+        return insert_or_assign_impl(key, std::forward<V>(value));
+    }
+
+    template<typename V>
+    std::pair<iterator, bool> insert_or_assign(key_type&& key, V&& value)
+    {
+        return insert_or_assign_impl(std::move(key), std::forward<V>(value));
+    }
+
+    [[nodiscard]] mapped_type& operator[](key_type const& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    [[nodiscard]] mapped_type& operator[](key_type&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /** Erase an item.
+     *
+     * @return An iterator to the item after the erased item.
+     */
+    iterator erase(const_iterator it)
+    {
+        auto r = _items.erase(it);
+        if (not _slots.empty()) {
+            rehash(_slots.size());
+        }
+        return r;
+    }
+
+    /** Erase the item with a key.
+     *
+     * @return The number of items erased.
+     */
+    size_type erase(key_type const& key)
+    {
+        hilet it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    /** Compare the items of the maps, independent of the order of insertion.
+     */
+    [[nodiscard]] friend bool operator==(ordered_hash_map const& lhs, ordered_hash_map const& rhs) noexcept
+    {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        for (hilet& item : lhs) {
+            hilet it = rhs.find(item.first);
+            if (it == rhs.end() or not(it->second == item.second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Compare the items of the maps sorted by key.
+     *
+     * @throws std::bad_alloc When the sorted order of the items could not be allocated.
+     */
+    [[nodiscard]] friend auto operator<=>(ordered_hash_map const& lhs, ordered_hash_map const& rhs)
+    {
+        hilet lhs_ = lhs.sorted();
+        hilet rhs_ = rhs.sorted();
+        return std::lexicographical_compare_three_way(
+            lhs_.begin(), lhs_.end(), rhs_.begin(), rhs_.end(), [](value_type const *a, value_type const *b) {
+                return *a <=> *b;
+            });
+    }
+
+private:
+    /** A slot in the index.
+     *
+     * The position is stored plus one, so that an empty slot is zero.
+     */
+    struct slot_type {
+        uint32_t position_plus_one = 0;
+        uint32_t fragment = 0;
+    };
+
+    container_type _items = {};
+
+    /** The open addressing index, empty while the map is searched linearly.
+     *
+     * The number of slots is a power of two and at least twice the number of items.
+     */
+    std::vector<slot_type> _slots = {};
+
+    [[no_unique_address]] hasher _hash = {};
+    [[no_unique_address]] key_equal _equal = {};
+
+    [[nodiscard]] constexpr static std::size_t slot_capacity_for(std::size_t num_items) noexcept
+    {
+        return std::bit_ceil(num_items * 2);
+    }
+
+    /** Get a well distributed 32-bit fragment of the hash of a key.
+     *
+     * Many hash functions, like `std::hash<long long>`, return the value itself,
+     * the multiplication distributes those bits to the upper half of the result.
+     */
+    [[nodiscard]] uint32_t hash_fragment(key_type const& key) const noexcept
+    {
+        hilet hash = static_cast<uint64_t>(_hash(key));
+        return truncate<uint32_t>((hash * 0x9e37'79b9'7f4a'7c15ULL) >> 32);
+    }
+
+    /** The first slot to probe for a hash fragment.
+     *
+     * The upper bits of the fragment are used, these are the best distributed.
+     */
+    [[nodiscard]] std::size_t first_slot(uint32_t fragment) const noexcept
+    {
+        hi_axiom(std::has_single_bit(_slots.size()) and _slots.size() > 1);
+        return fragment >> (32 - std::countr_zero(_slots.size()));
+    }
+
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace_impl(K&& key, Args&&...args)
+    {
+        hilet fragment = hash_fragment(key);
+        if (hilet index = find_index(key, fragment); index != size()) {
+            return {begin() + index, false};
+        }
+
+        // Grow the index first; when this throws the map is unchanged.
+        reserve_index(size() + 1);
+
+        _items.emplace_back(
+            std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+        if (not _slots.empty()) {
+            insert_slot(narrow_cast<uint32_t>(size() - 1), fragment);
+        }
+        return {end() - 1, true};
+    }
+
+    template<typename K, typename V>
+    std::pair<iterator, bool> insert_or_assign_impl(K&& key, V&& value)
+    {
+        auto r = try_emplace_impl(std::forward<K>(key), std::forward<V>(value));
+        if (not r.second) {
+            // The value was not consumed by try_emplace_impl() when the key already existed.
+            r.first->second = std::forward<V>(value);
+        }
+        return r;
+    }
+
+    /** Find the position of an item.
+     *
+     * @return The position of the item, or `size()` when the key was not found.
+     */
+    [[nodiscard]] std::size_t find_index(key_type const& key, uint32_t fragment) const noexcept
+    {
+        if (_slots.empty()) {
+            for (auto i = 0_uz; i != _items.size(); ++i) {
+                if (_equal(_items[i].first, key)) {
+                    return i;
+                }
+            }
+            return _items.size();
+        }
+
+        hilet mask = _slots.size() - 1;
+        for (auto i = first_slot(fragment);; i = (i + 1) & mask) {
+            hilet slot = _slots[i];
+            if (slot.position_plus_one == 0) {
+                return _items.size();
+            } else if (slot.fragment == fragment and _equal(_items[slot.position_plus_one - 1].first, key)) {
+                return slot.position_plus_one - 1;
+            }
+        }
+    }
+
+    void insert_slot(uint32_t position, uint32_t fragment) noexcept
+    {
+        hilet mask = _slots.size() - 1;
+        for (auto i = first_slot(fragment);; i = (i + 1) & mask) {
+            if (_slots[i].position_plus_one == 0) {
+                _slots[i] = slot_type{position + 1, fragment};
+                return;
+            }
+        }
+    }
+
+    /** Make sure the index has room for a number of items, before they are appended.
+     *
+     * @param num_items The number of items after appending.
+     */
+    void reserve_index(std::size_t num_items)
+    {
+        if (_slots.empty() and num_items <= linear_search_size) {
+            return;
+        } else if (slot_capacity_for(num_items) > _slots.size()) {
+            rehash(slot_capacity_for(num_items));
+        }
+    }
+
+    /** Rebuild the index from the items.
+     *
+     * Only a change in capacity allocates; the index is unchanged when that allocation fails.
+     *
+     * @param capacity The number of slots, a power of two.
+     */
+    void rehash(std::size_t capacity)
+    {
+        hi_axiom(std::has_single_bit(capacity));
+
+        if (capacity == _slots.size()) {
+            std::ranges::fill(_slots, slot_type{});
+        } else {
+            _slots = std::vector<slot_type>(capacity);
+        }
+        for (auto i = 0_uz; i != _items.size(); ++i) {
+            insert_slot(narrow_cast<uint32_t>(i), hash_fragment(_items[i].first));
+        }
+    }
+
+    [[nodiscard]] std::vector<value_type const *> sorted() const
+    {
+        auto r = std::vector<value_type const *>{};
+        r.reserve(size());
+        for (hilet& item : _items) {
+            r.push_back(std::addressof(item));
+        }
+        std::sort(r.begin(), r.end(), [](value_type const *a, value_type const *b) {
+            return a->first < b->first;
+        });
+        return r;
+    }
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,113 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ordered_hash_map.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <stdexcept>
+
+using namespace hi;
+
+TEST(ordered_hash_map, insertion_order)
+{
+    auto map = ordered_hash_map<std::string, int>{};
+    ASSERT_TRUE(map.empty());
+
+    ASSERT_TRUE(map.insert_or_assign("foo", 1).second);
+    ASSERT_TRUE(map.insert_or_assign("bar", 2).second);
+    ASSERT_TRUE(map.insert_or_assign("baz", 3).second);
+    ASSERT_FALSE(map.insert_or_assign("foo", 4).second);
+    ASSERT_FALSE(map.emplace("bar", 5).second);
+    map["qux"] = 6;
+
+    auto keys = std::vector<std::string>{};
+    auto values = std::vector<int>{};
+    for (auto const& [key, value] : map) {
+        keys.push_back(key);
+        values.push_back(value);
+    }
+    ASSERT_EQ(keys, (std::vector<std::string>{"foo", "bar", "baz", "qux"}));
+    ASSERT_EQ(values, (std::vector<int>{4, 2, 3, 6}));
+
+    ASSERT_EQ(map.erase("bar"), 1);
+    ASSERT_EQ(map.erase("bar"), 0);
+    ASSERT_EQ(map.size(), 3);
+    ASSERT_EQ(map.begin()[1].first, "baz");
+    ASSERT_FALSE(map.contains("bar"));
+    ASSERT_EQ(map.at("qux"), 6);
+    ASSERT_THROW((void)map.at("bar"), std::out_of_range);
+}
+
+TEST(ordered_hash_map, large)
+{
+    // Beyond linear_search_size the map uses an index, which is grown and rebuilt on erase.
+    auto map = ordered_hash_map<long long, long long>{};
+    auto reference = std::map<long long, long long>{};
+    for (auto i = 0LL; i != 1000; ++i) {
+        // Multiples of a power of two are a bad case for a hash table with a power of two size.
+        map[i * 1024] = i;
+        reference[i * 1024] = i;
+    }
+
+    for (auto i = 0LL; i < 1000; i += 3) {
+        ASSERT_EQ(map.erase(i * 1024), 1);
+        reference.erase(i * 1024);
+    }
+
+    ASSERT_EQ(map.size(), reference.size());
+    for (auto i = 0LL; i != 1000; ++i) {
+        ASSERT_EQ(map.contains(i * 1024), reference.contains(i * 1024));
+    }
+
+    auto previous = -1LL;
+    for (auto const& [key, value] : map) {
+        ASSERT_EQ(reference.at(key), value);
+        ASSERT_LT(previous, value);
+        previous = value;
+    }
+}
+
+TEST(ordered_hash_map, throwing_insert)
+{
+    struct value_type {
+        int value;
+
+        value_type(int value) : value(value)
+        {
+            if (value < 0) {
+                throw std::invalid_argument("negative");
+            }
+        }
+    };
+
+    // Each insert that fails, crosses from linear search to the index, or grows the index.
+    auto map = ordered_hash_map<int, value_type>{};
+    for (auto i = 0; i != 100; ++i) {
+        ASSERT_THROW(map.try_emplace(1000 + i, -1), std::invalid_argument);
+        ASSERT_EQ(map.size(), i);
+        ASSERT_FALSE(map.contains(1000 + i));
+
+        ASSERT_TRUE(map.try_emplace(i, i).second);
+    }
+
+    for (auto i = 0; i != 100; ++i) {
+        ASSERT_EQ(map.at(i).value, i);
+        ASSERT_FALSE(map.contains(1000 + i));
+    }
+}
+
+TEST(ordered_hash_map, compare)
+{
+    auto a = ordered_hash_map<std::string, int>{{"a", 1}, {"b", 2}};
+    auto b = ordered_hash_map<std::string, int>{{"b", 2}, {"a", 1}};
+    auto c = ordered_hash_map<std::string, int>{{"a", 1}, {"c", 0}};
+
+    // Equality and ordering do not depend on the insertion order.
+    ASSERT_EQ(a, b);
+    ASSERT_TRUE((a <=> b) == 0);
+    ASSERT_NE(a, c);
+    ASSERT_TRUE(a < c);
+}
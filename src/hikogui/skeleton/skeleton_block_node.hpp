@@ -53,12 +53,21 @@ struct skeleton_block_node final : skeleton_node {
         context.pop_super();
     }
 
+    void compile() override
+    {
+        compile_children(children);
+    }
+
     datum evaluate(formula_evaluation_context &context) override
     {
         datum tmp;
         try {
             tmp = function(context, datum::vector_type{});
 
+        } catch (cancel_error const &) {
+            // The output sink stopped the evaluation.
+            throw;
+
         } catch (std::exception const &e) {
             throw operation_error(std::format("{}: Could not evaluate block.\n{}", location, e.what()));
         }
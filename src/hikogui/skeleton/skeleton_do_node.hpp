@@ -11,6 +11,7 @@ namespace hi::inline v1 {
 struct skeleton_do_node final : skeleton_node {
     statement_vector children;
     std::unique_ptr<formula_node> expression;
+    std::optional<formula_program> program;
     parse_location formula_location;
 
     skeleton_do_node(parse_location location) noexcept : skeleton_node(std::move(location)) {}
@@ -51,6 +52,12 @@ struct skeleton_do_node final : skeleton_node {
         }
     }
 
+    void compile() override
+    {
+        program = compile_expression(*expression);
+        compile_children(children);
+    }
+
     datum evaluate(formula_evaluation_context &context) override
     {
         hilet output_size = context.output_size();
@@ -70,7 +77,7 @@ struct skeleton_do_node final : skeleton_node {
                 return tmp;
             }
 
-        } while (evaluate_formula_without_output(context, *expression, formula_location));
+        } while (evaluate_formula_without_output(context, *expression, program, formula_location));
         return {};
     }
 
@@ -10,6 +10,7 @@ namespace hi::inline v1 {
 
 struct skeleton_expression_node final : skeleton_node {
     std::unique_ptr<formula_node> expression;
+    std::optional<formula_program> program;
 
     skeleton_expression_node(parse_location location, std::unique_ptr<formula_node> expression) :
         skeleton_node(std::move(location)), expression(std::move(expression))
@@ -21,6 +22,11 @@ struct skeleton_expression_node final : skeleton_node {
         post_process_expression(context, *expression, location);
     }
 
+    void compile() override
+    {
+        program = compile_expression(*expression);
+    }
+
     std::string string() const noexcept override
     {
         return std::format("<expression {}>", *expression);
@@ -28,7 +34,7 @@ struct skeleton_expression_node final : skeleton_node {
 
     datum evaluate(formula_evaluation_context &context) override
     {
-        hilet tmp = evaluate_formula_without_output(context, *expression, location);
+        hilet tmp = evaluate_formula_without_output(context, *expression, program, location);
         if (tmp.is_break()) {
             throw operation_error(std::format("{}: Found #break not inside a loop statement.", location));
 
@@ -11,6 +11,7 @@ namespace hi::inline v1 {
 struct skeleton_for_node final : skeleton_node {
     std::unique_ptr<formula_node> name_expression;
     std::unique_ptr<formula_node> list_expression;
+    std::optional<formula_program> list_program;
     bool has_else = false;
     statement_vector children;
     statement_vector else_children;
@@ -67,9 +68,16 @@ struct skeleton_for_node final : skeleton_node {
         }
     }
 
+    void compile() override
+    {
+        list_program = compile_expression(*list_expression);
+        compile_children(children);
+        compile_children(else_children);
+    }
+
     datum evaluate(formula_evaluation_context &context) override
     {
-        auto list_data = evaluate_formula_without_output(context, *list_expression, location);
+        auto list_data = evaluate_formula_without_output(context, *list_expression, list_program, location);
 
         if (!holds_alternative<datum::vector_type>(list_data)) {
             throw operation_error(std::format("{}: Expecting expression returns a vector, got {}", location, list_data));
@@ -60,6 +60,11 @@ struct skeleton_function_node final : skeleton_node {
         context.pop_super();
     }
 
+    void compile() override
+    {
+        compile_children(children);
+    }
+
     datum evaluate(formula_evaluation_context &context) override
     {
         return {};
@@ -81,8 +86,11 @@ struct skeleton_function_node final : skeleton_node {
             context.set(argument_names[i], arguments[i]);
         }
 
+        // The output of the function is discarded when it returns a value.
         hilet output_size = context.output_size();
+        context.hold_output();
         auto tmp = evaluate_children(context, children);
+        context.release_output();
         context.pop();
 
         if (tmp.is_break()) {
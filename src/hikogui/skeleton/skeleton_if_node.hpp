@@ -11,11 +11,13 @@ namespace hi::inline v1 {
 struct skeleton_if_node final : skeleton_node {
     std::vector<statement_vector> children_groups;
     std::vector<std::unique_ptr<formula_node>> expressions;
+    std::vector<std::optional<formula_program>> programs;
     std::vector<parse_location> formula_locations;
 
     skeleton_if_node(parse_location location, std::unique_ptr<formula_node> expression) noexcept : skeleton_node(location)
     {
         expressions.push_back(std::move(expression));
+        programs.emplace_back();
         formula_locations.push_back(location);
         children_groups.emplace_back();
     }
@@ -27,6 +29,7 @@ struct skeleton_if_node final : skeleton_node {
         }
 
         expressions.push_back(std::move(expression));
+        programs.emplace_back();
         formula_locations.push_back(std::move(_location));
         children_groups.emplace_back();
         return true;
@@ -68,11 +71,24 @@ struct skeleton_if_node final : skeleton_node {
         }
     }
 
+    void compile() override
+    {
+        hi_assert(ssize(expressions) == ssize(programs));
+        for (ssize_t i = 0; i != ssize(expressions); ++i) {
+            programs[i] = compile_expression(*expressions[i]);
+        }
+
+        for (auto &children : children_groups) {
+            compile_children(children);
+        }
+    }
+
     datum evaluate(formula_evaluation_context &context) override
     {
         hi_assert(ssize(expressions) == ssize(formula_locations));
+        hi_assert(ssize(expressions) == ssize(programs));
         for (ssize_t i = 0; i != ssize(expressions); ++i) {
-            if (evaluate_formula_without_output(context, *expressions[i], formula_locations[i])) {
+            if (evaluate_formula_without_output(context, *expressions[i], programs[i], formula_locations[i])) {
                 return evaluate_children(context, children_groups[i]);
             }
         }
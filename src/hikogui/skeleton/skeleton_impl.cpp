@@ -20,6 +20,7 @@
 #include "../formula/formula.hpp"
 #include "../strings.hpp"
 #include "../algorithm.hpp"
+#include <algorithm>
 
 namespace hi::inline v1 {
 
@@ -179,6 +180,42 @@ static void parse_skeleton_escape(skeleton_parse_context &context)
     throw parse_error(std::format("{}: Unexpected end-of-file after escape '\' character.", context.location));
 }
 
+void skeleton_node::compile_children(statement_vector &children)
+{
+    for (hilet &child : children) {
+        child->compile();
+    }
+
+    // A function definition does not write output, move it out of the way so that the text
+    // around it can be merged. The node must be kept since it implements the function.
+    std::stable_partition(children.begin(), children.end(), [](hilet &child) {
+        return dynamic_cast<skeleton_function_node const *>(child.get()) == nullptr;
+    });
+
+    auto r = statement_vector{};
+    r.reserve(children.size());
+    for (auto &child : children) {
+        if (auto text = child->literal_text()) {
+            if (text->empty()) {
+                continue;
+            }
+
+            if (not r.empty()) {
+                if (auto string_node = dynamic_cast<skeleton_string_node *>(r.back().get())) {
+                    string_node->text += *text;
+                    continue;
+                }
+            }
+
+            r.push_back(std::make_unique<skeleton_string_node>(child->location, std::move(*text)));
+
+        } else {
+            r.push_back(std::move(child));
+        }
+    }
+    children = std::move(r);
+}
+
 [[nodiscard]] std::unique_ptr<skeleton_node> parse_skeleton(skeleton_parse_context &context)
 {
     context.start_of_text_segment();
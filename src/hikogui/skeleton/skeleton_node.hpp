@@ -55,6 +55,18 @@ struct skeleton_node {
 
     virtual void post_process(formula_post_process_context &context) {}
 
+    /** Compile the template after post-processing.
+     * Expressions are compiled into formula programs and the literal text of children is merged.
+     */
+    virtual void compile() {}
+
+    /** The text written by this node, when it is known before evaluation.
+     */
+    [[nodiscard]] virtual std::optional<std::string> literal_text() const noexcept
+    {
+        return std::nullopt;
+    }
+
     /** Evaluate the template.
      * Text in the template is added to the context.output_text.
      * @param context Data used by expressions inside the template statements. .output_text will
@@ -91,6 +103,31 @@ struct skeleton_node {
         return evaluate_output(context);
     }
 
+    /** Evaluate the template and write the output to a sink.
+     *
+     * The output is written in pieces while the template is evaluated. Output that may still be
+     * discarded, such as the output of a function that may \#return, is held in memory until it is known.
+     *
+     * @param context Data used by expressions inside the template statements.
+     * @param sink The sink to write the output to.
+     */
+    void evaluate_output(formula_evaluation_context &context, formula_output_sink &sink)
+    {
+        hi_assert(context.output_sink == nullptr);
+        context.output_sink = &sink;
+        try {
+            auto tmp = evaluate_output(context);
+            context.output = std::move(tmp);
+            context.flush_output();
+            sink.flush();
+
+        } catch (...) {
+            context.output_sink = nullptr;
+            throw;
+        }
+        context.output_sink = nullptr;
+    }
+
     [[nodiscard]] virtual std::string string() const noexcept
     {
         return "<skeleton_node>";
@@ -127,6 +164,24 @@ struct skeleton_node {
         }
     }
 
+    [[nodiscard]] static datum evaluate_formula_without_output(
+        formula_evaluation_context &context,
+        formula_node const &expression,
+        std::optional<formula_program> const &program,
+        parse_location const &location)
+    {
+        try {
+            if (program) {
+                return program->evaluate_without_output(context);
+            } else {
+                return expression.evaluate_without_output(context);
+            }
+
+        } catch (std::exception const &e) {
+            throw operation_error(std::format("{}: Could not evaluate.\n{}", location, e.what()));
+        }
+    }
+
     [[nodiscard]] static datum
     evaluate_expression(formula_evaluation_context &context, formula_node const &expression, parse_location const &location)
     {
@@ -138,6 +193,39 @@ struct skeleton_node {
         }
     }
 
+    [[nodiscard]] static datum evaluate_expression(
+        formula_evaluation_context &context,
+        formula_node const &expression,
+        std::optional<formula_program> const &program,
+        parse_location const &location)
+    {
+        try {
+            if (program) {
+                return program->evaluate(context);
+            } else {
+                return expression.evaluate(context);
+            }
+
+        } catch (std::exception const &e) {
+            throw operation_error(std::format("{}: Could not evaluate expression.\n{}", location, e.what()));
+        }
+    }
+
+    /** Compile an expression into a formula program.
+     *
+     * @return The program, or empty when the expression is too large to compile.
+     */
+    [[nodiscard]] static std::optional<formula_program> compile_expression(formula_node const &expression)
+    {
+        try {
+            return formula_program{expression};
+
+        } catch (parse_error const &) {
+            // Fallback to the tree walker.
+            return std::nullopt;
+        }
+    }
+
     static void
     post_process_expression(formula_post_process_context &context, formula_node &expression, parse_location const &location)
     {
@@ -149,6 +237,10 @@ struct skeleton_node {
         }
     }
 
+    /** Compile the children and merge their literal text.
+     */
+    static void compile_children(statement_vector &children);
+
     [[nodiscard]] static datum evaluate_children(formula_evaluation_context &context, statement_vector const &children)
     {
         for (hilet &child : children) {
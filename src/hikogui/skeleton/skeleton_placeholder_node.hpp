@@ -10,6 +10,8 @@ namespace hi::inline v1 {
 
 struct skeleton_placeholder_node final : skeleton_node {
     std::unique_ptr<formula_node> expression;
+    std::optional<formula_program> program;
+    std::optional<std::string> constant_text;
 
     skeleton_placeholder_node(parse_location location, std::unique_ptr<formula_node> expression) :
         skeleton_node(std::move(location)), expression(std::move(expression))
@@ -31,6 +33,29 @@ struct skeleton_placeholder_node final : skeleton_node {
         }
     }
 
+    void compile() override
+    {
+        program = compile_expression(*expression);
+
+        if (program and program->is_constant()) {
+            try {
+                auto tmp_context = formula_evaluation_context{};
+                hilet tmp = program->evaluate(tmp_context);
+                if (not tmp.is_break() and not tmp.is_continue() and not tmp.is_undefined()) {
+                    constant_text = static_cast<std::string>(tmp);
+                }
+
+            } catch (...) {
+                // Leave the error to be reported during evaluation.
+            }
+        }
+    }
+
+    [[nodiscard]] std::optional<std::string> literal_text() const noexcept override
+    {
+        return constant_text;
+    }
+
     std::string string() const noexcept override
     {
         return std::format("<placeholder {}>", *expression);
@@ -40,7 +65,11 @@ struct skeleton_placeholder_node final : skeleton_node {
     {
         hilet output_size = context.output_size();
 
-        hilet tmp = evaluate_expression(context, *expression, location);
+        // A function called by the expression may write output that needs to be discarded.
+        context.hold_output();
+        hilet tmp = evaluate_expression(context, *expression, program, location);
+        context.release_output();
+
         if (tmp.is_break()) {
             throw operation_error(std::format("{}: Found #break not inside a loop statement.", location));
 
@@ -10,6 +10,7 @@ namespace hi::inline v1 {
 
 struct skeleton_return_node final : skeleton_node {
     std::unique_ptr<formula_node> expression;
+    std::optional<formula_program> program;
 
     skeleton_return_node(parse_location location, std::unique_ptr<formula_node> expression) noexcept :
         skeleton_node(std::move(location)), expression(std::move(expression))
@@ -21,9 +22,14 @@ struct skeleton_return_node final : skeleton_node {
         post_process_expression(context, *expression, location);
     }
 
+    void compile() override
+    {
+        program = compile_expression(*expression);
+    }
+
     datum evaluate(formula_evaluation_context &context) override
     {
-        return evaluate_formula_without_output(context, *expression, location);
+        return evaluate_formula_without_output(context, *expression, program, location);
     }
 
     std::string string() const noexcept override
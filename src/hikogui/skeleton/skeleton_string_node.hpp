@@ -37,6 +37,11 @@ struct skeleton_string_node final : skeleton_node {
         text.resize(new_text_length);
     }
 
+    [[nodiscard]] std::optional<std::string> literal_text() const noexcept override
+    {
+        return text;
+    }
+
     std::string string() const noexcept override
     {
         return std::format("<text {}>", text);
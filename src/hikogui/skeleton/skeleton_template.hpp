@@ -0,0 +1,113 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "skeleton.hpp"
+#include "skeleton_node.hpp"
+#include "../formula/formula_output_sink.hpp"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <filesystem>
+
+namespace hi::inline v1 {
+
+/** A compiled skeleton template.
+ *
+ * After parsing, the expressions in the template are compiled into formula programs and
+ * adjacent literal text, including placeholders with a constant value, is merged into a
+ * single segment.
+ *
+ * A template can be rendered into a string, or streamed into a formula_output_sink so
+ * that large output is generated with bounded memory. Output that may still be discarded,
+ * such as the output of a function that may \#return, is held in memory until it is known.
+ *
+ * The parsed template remains the reference, its tree walker is used for expressions
+ * that could not be compiled.
+ */
+class skeleton_template {
+public:
+    skeleton_template(skeleton_template const&) = delete;
+    skeleton_template(skeleton_template&&) noexcept = default;
+    skeleton_template& operator=(skeleton_template const&) = delete;
+    skeleton_template& operator=(skeleton_template&&) noexcept = default;
+
+    /** Compile a parsed template.
+     *
+     * @param top The template returned by `parse_skeleton()`.
+     */
+    explicit skeleton_template(std::unique_ptr<skeleton_node> top) : _top(std::move(top))
+    {
+        hi_assert_not_null(_top);
+        _top->compile();
+    }
+
+    /** Parse and compile a template.
+     *
+     * @param path The path of the template, used for error messages and includes.
+     * @param text The text of the template.
+     * @throws parse_error When the template could not be parsed.
+     */
+    skeleton_template(std::filesystem::path path, std::string_view text) :
+        skeleton_template(parse_skeleton(std::move(path), text))
+    {
+    }
+
+    /** Parse and compile a template from a file.
+     *
+     * @param path The path of the template.
+     * @throws parse_error When the template could not be parsed.
+     */
+    explicit skeleton_template(std::filesystem::path path) : skeleton_template(parse_skeleton(std::move(path))) {}
+
+    /** Render the template into a string.
+     *
+     * @param context Data used by expressions inside the template statements.
+     * @throws operation_error When the template could not be evaluated.
+     */
+    [[nodiscard]] std::string render(formula_evaluation_context& context) const
+    {
+        return _top->evaluate_output(context);
+    }
+
+    [[nodiscard]] std::string render() const
+    {
+        auto context = formula_evaluation_context{};
+        return render(context);
+    }
+
+    /** Render the template into a sink.
+     *
+     * @param context Data used by expressions inside the template statements.
+     * @param sink The sink to write the output to.
+     * @throws operation_error When the template could not be evaluated.
+     * @throws cancel_error When the sink cancelled the output.
+     */
+    void render(formula_evaluation_context& context, formula_output_sink& sink) const
+    {
+        _top->evaluate_output(context, sink);
+    }
+
+    void render(formula_output_sink& sink) const
+    {
+        auto context = formula_evaluation_context{};
+        render(context, sink);
+    }
+
+    [[nodiscard]] std::string string() const noexcept
+    {
+        return _top->string();
+    }
+
+    [[nodiscard]] friend std::string to_string(skeleton_template const& rhs) noexcept
+    {
+        return rhs.string();
+    }
+
+private:
+    std::unique_ptr<skeleton_node> _top;
+};
+
+} // namespace hi::inline v1
@@ -3,9 +3,11 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "hikogui/skeleton/skeleton.hpp"
+#include "hikogui/skeleton/skeleton_template.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <format>
 
 using namespace std;
 using namespace hi;
@@ -470,3 +472,133 @@ TEST(skeleton, Include)
         "<text bar\n>"
         ">");
 }
+
+TEST(skeleton, TemplateMergeLiterals)
+{
+    auto t = skeleton_template(
+        std::filesystem::path{},
+        "foo\n"
+        "#function f()\n"
+        "in f\n"
+        "#end\n"
+        "bar ${1 + 2} baz\n");
+    ASSERT_EQ(
+        to_string(t),
+        "<top "
+        "<text foo\nbar 3 baz\n>"
+        "<function f()<text in f\n>>"
+        ">");
+    ASSERT_EQ(t.render(), "foo\nbar 3 baz\n");
+}
+
+TEST(skeleton, TemplateEqualsTreeWalker)
+{
+    constexpr std::string_view templates[] = {
+        "foo\n"
+        "# a = 38\n"
+        "#while a < 42\n"
+        "    #if a == 40\n"
+        "        #continue\n"
+        "    #elif a == 41\n"
+        "        #break\n"
+        "    #end\n"
+        "    value is ${a}\n"
+        "    # ++a\n"
+        "#end\n"
+        "bar\n",
+
+        "#for a: [42, 43, 44]\n"
+        "${$i}: ${a * 2}${$last ? \"\" : \",\"}\n"
+        "#else\n"
+        "No values\n"
+        "#end\n",
+
+        "# a = 0\n"
+        "#do\n"
+        "${a}\n"
+        "# a += 1\n"
+        "#while a < 3\n",
+
+        "#function foo(bar, baz)\n"
+        "    This text is ignored\n"
+        "    #return bar + baz\n"
+        "#end\n"
+        "#function bar(x)\n"
+        "value ${x}\n"
+        "#end\n"
+        "${foo(12, 3)} ${bar(foo(1, 2))}\n",
+    };
+
+    for (hilet text : templates) {
+        auto tree = parse_skeleton(std::filesystem::path{}, text);
+        auto compiled = skeleton_template(std::filesystem::path{}, text);
+        ASSERT_EQ(compiled.render(), tree->evaluate_output()) << text;
+    }
+}
+
+TEST(skeleton, TemplateStreaming)
+{
+    auto t = skeleton_template(
+        std::filesystem::path{},
+        "#function twice(x)\n"
+        "This text is discarded\n"
+        "#return x * 2\n"
+        "#end\n"
+        "# i = 0\n"
+        "#while i < 1000\n"
+        "line ${i} ${twice(i)}\n"
+        "# ++i\n"
+        "#end\n");
+
+    auto expected = std::string{};
+    for (auto i = 0; i != 1000; ++i) {
+        expected += std::format("line {} {}\n", i, i * 2);
+    }
+
+    auto context = formula_evaluation_context{};
+    context.output_flush_size = 64;
+
+    auto sink = formula_chunked_sink{100};
+    t.render(context, sink);
+    ASSERT_EQ(sink.string(), expected);
+    ASSERT_EQ(sink.size(), expected.size());
+    ASSERT_GT(sink.chunks().size(), 1);
+    ASSERT_TRUE(context.output.empty());
+
+    // The output is written in small pieces while rendering.
+    auto num_writes = 0_uz;
+    auto max_write = 0_uz;
+    auto result = std::string{};
+    auto callback_sink = formula_callback_sink{[&](std::string_view text) {
+        ++num_writes;
+        max_write = std::max(max_write, text.size());
+        result += text;
+        return true;
+    }};
+    context = formula_evaluation_context{};
+    context.output_flush_size = 64;
+    t.render(context, callback_sink);
+    ASSERT_EQ(result, expected);
+    ASSERT_GT(num_writes, 100);
+    ASSERT_LT(max_write, 128);
+}
+
+TEST(skeleton, TemplateStreamingCancel)
+{
+    auto t = skeleton_template(
+        std::filesystem::path{},
+        "#for a: [1, 2, 3, 4]\n"
+        "line ${a}\n"
+        "#end\n");
+
+    auto result = std::string{};
+    auto sink = formula_callback_sink{[&](std::string_view text) {
+        result += text;
+        return result.size() < 7;
+    }};
+
+    auto context = formula_evaluation_context{};
+    context.output_flush_size = 1;
+    ASSERT_THROW(t.render(context, sink), cancel_error);
+    ASSERT_EQ(result, "line 1\n");
+}
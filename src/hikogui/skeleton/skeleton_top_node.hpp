@@ -32,11 +32,20 @@ struct skeleton_top_node final : skeleton_node {
         }
     }
 
+    void compile() override
+    {
+        compile_children(children);
+    }
+
     datum evaluate(formula_evaluation_context &context) override
     {
         try {
             return evaluate_children(context, children);
 
+        } catch (cancel_error const &) {
+            // The output sink stopped the evaluation.
+            throw;
+
         } catch (std::exception const &e) {
             throw operation_error(std::format("{}: Could not evaluate.\n{}", location, e.what()));
         }
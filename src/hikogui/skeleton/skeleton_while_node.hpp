@@ -11,6 +11,7 @@ namespace hi::inline v1 {
 struct skeleton_while_node final : skeleton_node {
     statement_vector children;
     std::unique_ptr<formula_node> expression;
+    std::optional<formula_program> program;
 
     skeleton_while_node(parse_location location, std::unique_ptr<formula_node> expression) noexcept :
         skeleton_node(std::move(location)), expression(std::move(expression))
@@ -37,12 +38,18 @@ struct skeleton_while_node final : skeleton_node {
         }
     }
 
+    void compile() override
+    {
+        program = compile_expression(*expression);
+        compile_children(children);
+    }
+
     datum evaluate(formula_evaluation_context &context) override
     {
         hilet output_size = context.output_size();
 
         ssize_t loop_count = 0;
-        while (evaluate_formula_without_output(context, *expression, location)) {
+        while (evaluate_formula_without_output(context, *expression, program, location)) {
             context.loop_push(loop_count++);
             auto tmp = evaluate_children(context, children);
             context.loop_pop();
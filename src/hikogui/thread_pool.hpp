@@ -0,0 +1,326 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "utility/module.hpp"
+#include <coroutine>
+#include <type_traits>
+#include <concepts>
+#include <functional>
+#include <exception>
+#include <optional>
+#include <variant>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+namespace hi::inline v1 {
+class loop;
+class thread_pool;
+
+namespace detail {
+
+/** The part of the shared state of a `pool_future` that does not depend on the value type.
+ */
+class pool_future_state_base {
+public:
+    [[nodiscard]] bool ready() const noexcept
+    {
+        return _ready.load(std::memory_order::acquire);
+    }
+
+    void wait() const noexcept
+    {
+        while (not ready()) {
+            _ready.wait(false, std::memory_order::acquire);
+        }
+    }
+
+    /** Register a co-routine to be resumed when the job completes.
+     *
+     * The co-routine is resumed from the event loop of the thread that calls this function.
+     *
+     * @param handle The handle of the co-routine to resume.
+     * @return false if the job was already completed and the co-routine should not be suspended.
+     */
+    [[nodiscard]] bool suspend(std::coroutine_handle<> handle) noexcept;
+
+protected:
+    /** Mark the job as completed and wake up any waiters.
+     */
+    void complete() noexcept;
+
+private:
+    std::atomic<bool> _ready = false;
+    std::mutex _mutex;
+    std::coroutine_handle<> _handle = {};
+    loop *_loop = nullptr;
+};
+
+template<typename T>
+class pool_future_state : public pool_future_state_base {
+public:
+    using value_type = T;
+
+    void set_value(auto&&...args) noexcept
+    {
+        _value.emplace(hi_forward(args)...);
+        complete();
+    }
+
+    void set_exception(std::exception_ptr exception) noexcept
+    {
+        _exception = std::move(exception);
+        complete();
+    }
+
+    [[nodiscard]] value_type get()
+    {
+        hi_axiom(ready());
+
+        if (_exception) {
+            std::rethrow_exception(_exception);
+        }
+
+        hi_axiom(_value.has_value());
+        if constexpr (not std::is_same_v<value_type, void>) {
+            return std::move(*_value);
+        }
+    }
+
+private:
+    using storage_type = std::conditional_t<std::is_same_v<value_type, void>, std::monostate, value_type>;
+
+    std::optional<storage_type> _value = {};
+    std::exception_ptr _exception = nullptr;
+};
+
+} // namespace detail
+
+/** The result of a job executed on a `thread_pool`.
+ *
+ * The value can be retrieved by blocking with `get()`, or by a co-routine
+ * using `co_await`. When awaited on, the co-routine is resumed from the event
+ * loop of the thread that was awaiting.
+ *
+ * Like `std::future` the value can only be retrieved once.
+ *
+ * @tparam T The type returned by the job.
+ */
+template<typename T>
+class pool_future {
+public:
+    using value_type = T;
+    using state_type = detail::pool_future_state<value_type>;
+
+    pool_future() noexcept = default;
+    pool_future(pool_future const&) = delete;
+    pool_future(pool_future&&) noexcept = default;
+    pool_future& operator=(pool_future const&) = delete;
+    pool_future& operator=(pool_future&&) noexcept = default;
+
+    explicit pool_future(std::shared_ptr<state_type> state) noexcept : _state(std::move(state)) {}
+
+    /** Check if this future is associated with a job.
+     */
+    [[nodiscard]] bool valid() const noexcept
+    {
+        return to_bool(_state);
+    }
+
+    /** Check if the job has completed.
+     */
+    [[nodiscard]] bool ready() const noexcept
+    {
+        hi_axiom(valid());
+        return _state->ready();
+    }
+
+    /** Block until the job has completed.
+     *
+     * @note When called from a job on the same thread pool use `thread_pool::wait()` instead,
+     *       which executes other jobs while waiting.
+     */
+    void wait() const noexcept
+    {
+        hi_axiom(valid());
+        _state->wait();
+    }
+
+    /** Wait for the job to complete and retrieve its value.
+     *
+     * @return The value returned by the job.
+     * @throws The exception thrown by the job.
+     */
+    value_type get()
+    {
+        wait();
+        auto state = std::exchange(_state, nullptr);
+        return state->get();
+    }
+
+    [[nodiscard]] bool await_ready() const noexcept
+    {
+        return ready();
+    }
+
+    [[nodiscard]] bool await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        hi_axiom(valid());
+        return _state->suspend(handle);
+    }
+
+    value_type await_resume()
+    {
+        return get();
+    }
+
+private:
+    std::shared_ptr<state_type> _state;
+};
+
+/** A pool of worker threads.
+ *
+ * Jobs posted to the thread pool are executed in first-in-first-out order by the
+ * first worker thread that becomes available.
+ *
+ * Jobs may post other jobs to the same pool, when a job needs to wait for the
+ * result of another job it should use `thread_pool::wait()`. On a worker thread
+ * this will execute other jobs while waiting, so that the pool can not dead-lock
+ * when all workers are waiting.
+ */
+class thread_pool {
+public:
+    ~thread_pool();
+    thread_pool(thread_pool const&) = delete;
+    thread_pool(thread_pool&&) = delete;
+    thread_pool& operator=(thread_pool const&) = delete;
+    thread_pool& operator=(thread_pool&&) = delete;
+
+    /** Create a thread pool.
+     *
+     * @param num_threads The number of worker threads, or zero to start a worker for each cpu.
+     */
+    explicit thread_pool(std::size_t num_threads = 0);
+
+    /** The global thread pool.
+     *
+     * The global thread pool has a worker thread for each cpu, and is started the first time
+     * this function is called.
+     */
+    [[nodiscard]] static thread_pool& global() noexcept;
+
+    /** The number of worker threads.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _threads.size();
+    }
+
+    /** Execute a function on one of the worker threads.
+     *
+     * @param func A function object that takes no arguments, the function may return a value or throw.
+     * @return A future with the return value of the function.
+     * @throws std::bad_alloc When the job could not be allocated.
+     */
+    template<std::invocable<> Func>
+    [[nodiscard]] auto async(Func&& func)
+    {
+        using result_type = std::invoke_result_t<std::decay_t<Func>>;
+
+        auto state = std::make_shared<detail::pool_future_state<result_type>>();
+        push(std::make_unique<job_type<std::decay_t<Func>, result_type>>(std::forward<Func>(func), state));
+        return pool_future<result_type>{std::move(state)};
+    }
+
+    /** Wait for a job to complete.
+     *
+     * When called from one of the worker threads of this pool, other jobs are executed
+     * while waiting. Any other thread, such as the GUI thread, blocks instead, so that it
+     * never executes unrelated jobs with unbounded latency.
+     *
+     * @param future The future to wait for.
+     */
+    template<typename T>
+    void wait(pool_future<T> const& future) noexcept
+    {
+        if (not is_worker()) {
+            return future.wait();
+        }
+
+        while (not future.ready()) {
+            if (not run_one()) {
+                // The queue is empty, so the job is being executed by another thread.
+                future.wait();
+            }
+        }
+    }
+
+    /** Check if the current thread is one of the worker threads of this pool.
+     */
+    [[nodiscard]] bool is_worker() const noexcept
+    {
+        return _current == this;
+    }
+
+    /** Execute one job from the queue on the current thread.
+     *
+     * @return true if a job was executed, false if the queue was empty.
+     */
+    bool run_one() noexcept;
+
+private:
+    struct job_base_type {
+        virtual ~job_base_type() = default;
+        virtual void operator()() noexcept = 0;
+    };
+
+    template<typename Func, typename T>
+    struct job_type final : job_base_type {
+        Func func;
+        std::shared_ptr<detail::pool_future_state<T>> state;
+
+        job_type(auto&& func, std::shared_ptr<detail::pool_future_state<T>> state) noexcept :
+            func(hi_forward(func)), state(std::move(state))
+        {
+        }
+
+        void operator()() noexcept override
+        {
+            try {
+                if constexpr (std::is_same_v<T, void>) {
+                    func();
+                    state->set_value();
+                } else {
+                    state->set_value(func());
+                }
+            } catch (...) {
+                state->set_exception(std::current_exception());
+            }
+        }
+    };
+
+    /** The thread pool of the current worker thread.
+     */
+    inline static thread_local thread_pool const *_current = nullptr;
+
+    mutable std::mutex _mutex;
+    std::condition_variable_any _condition;
+    std::deque<std::unique_ptr<job_base_type>> _jobs;
+    std::vector<std::jthread> _threads;
+
+    /** Add a job to the queue and wake up a worker.
+     *
+     * @throws std::bad_alloc When the queue could not grow; the job is destroyed without being run.
+     */
+    void push(std::unique_ptr<job_base_type> job);
+    void worker(std::stop_token stop_token) noexcept;
+};
+
+} // namespace hi::inline v1
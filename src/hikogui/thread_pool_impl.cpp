@@ -0,0 +1,121 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "thread_pool.hpp"
+#include "loop.hpp"
+#include "concurrency/module.hpp"
+#include "utility/module.hpp"
+#include <format>
+
+namespace hi::inline v1 {
+namespace detail {
+
+bool pool_future_state_base::suspend(std::coroutine_handle<> handle) noexcept
+{
+    hilet lock = std::scoped_lock(_mutex);
+    if (ready()) {
+        return false;
+    }
+
+    _handle = handle;
+    _loop = std::addressof(loop::local());
+    return true;
+}
+
+void pool_future_state_base::complete() noexcept
+{
+    _ready.store(true, std::memory_order::release);
+    _ready.notify_all();
+
+    hilet lock = std::scoped_lock(_mutex);
+    if (_handle) {
+        hi_axiom_not_null(_loop);
+        _loop->post_function([handle = _handle]() {
+            handle.resume();
+        });
+    }
+}
+
+} // namespace detail
+
+thread_pool::thread_pool(std::size_t num_threads)
+{
+    if (num_threads == 0) {
+        num_threads = std::max(1_uz, narrow_cast<std::size_t>(std::thread::hardware_concurrency()));
+    }
+
+    _threads.reserve(num_threads);
+    for (auto i = 0_uz; i != num_threads; ++i) {
+        _threads.emplace_back([this, i](std::stop_token stop_token) {
+            set_thread_name(std::format("pool {}", i));
+            worker(stop_token);
+        });
+    }
+}
+
+thread_pool::~thread_pool()
+{
+    for (auto& thread : _threads) {
+        thread.request_stop();
+    }
+    // The std::jthread destructors join the worker threads, after they finish the jobs on the queue.
+    _threads.clear();
+}
+
+thread_pool& thread_pool::global() noexcept
+{
+    static auto r = thread_pool{};
+    return r;
+}
+
+void thread_pool::push(std::unique_ptr<job_base_type> job)
+{
+    {
+        hilet lock = std::scoped_lock(_mutex);
+        _jobs.push_back(std::move(job));
+    }
+    _condition.notify_one();
+}
+
+bool thread_pool::run_one() noexcept
+{
+    auto job = std::unique_ptr<job_base_type>{};
+    {
+        hilet lock = std::scoped_lock(_mutex);
+        if (_jobs.empty()) {
+            return false;
+        }
+        job = std::move(_jobs.front());
+        _jobs.pop_front();
+    }
+
+    (*job)();
+    return true;
+}
+
+void thread_pool::worker(std::stop_token stop_token) noexcept
+{
+    _current = this;
+
+    while (true) {
+        auto job = std::unique_ptr<job_base_type>{};
+        {
+            auto lock = std::unique_lock(_mutex);
+            if (not _condition.wait(lock, stop_token, [this] {
+                    return not _jobs.empty();
+                })) {
+                // Stop was requested, but finish the jobs that are still on the queue.
+                if (_jobs.empty()) {
+                    return;
+                }
+            }
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+        }
+
+        (*job)();
+    }
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,136 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "thread_pool.hpp"
+#include "scoped_task.hpp"
+#include "loop.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <stdexcept>
+#include <vector>
+
+using namespace hi;
+
+TEST(thread_pool, async)
+{
+    auto pool = thread_pool{4};
+    ASSERT_EQ(pool.size(), 4);
+
+    auto futures = std::vector<pool_future<int>>{};
+    for (auto i = 0; i != 100; ++i) {
+        futures.push_back(pool.async([i] {
+            return i * 2;
+        }));
+    }
+
+    for (auto i = 0; i != 100; ++i) {
+        ASSERT_EQ(futures[i].get(), i * 2);
+    }
+}
+
+TEST(thread_pool, async_void)
+{
+    auto pool = thread_pool{2};
+
+    auto count = std::atomic<int>{0};
+    auto futures = std::vector<pool_future<void>>{};
+    for (auto i = 0; i != 100; ++i) {
+        futures.push_back(pool.async([&count] {
+            ++count;
+        }));
+    }
+
+    for (auto& future : futures) {
+        future.get();
+    }
+    ASSERT_EQ(count.load(), 100);
+}
+
+TEST(thread_pool, exception)
+{
+    auto pool = thread_pool{2};
+
+    auto future = pool.async([]() -> int {
+        throw std::runtime_error("job failed");
+    });
+    ASSERT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(thread_pool, nested_wait)
+{
+    // A single worker which waits on jobs posted to its own pool must not dead-lock.
+    auto pool = thread_pool{1};
+
+    auto future = pool.async([&pool] {
+        auto inner = std::vector<pool_future<int>>{};
+        for (auto i = 0; i != 10; ++i) {
+            inner.push_back(pool.async([i] {
+                return i;
+            }));
+        }
+
+        auto sum = 0;
+        for (auto& f : inner) {
+            pool.wait(f);
+            sum += f.get();
+        }
+        return sum;
+    });
+
+    pool.wait(future);
+    ASSERT_EQ(future.get(), 45);
+}
+
+TEST(thread_pool, wait_outside_pool)
+{
+    // A thread that is not a worker blocks, instead of executing unrelated jobs.
+    auto pool = thread_pool{1};
+    auto go = std::atomic<bool>{false};
+
+    auto blocker = pool.async([&go] {
+        while (not go.load()) {
+            std::this_thread::yield();
+        }
+    });
+    auto future = pool.async([] {
+        return std::this_thread::get_id();
+    });
+
+    auto releaser = std::jthread{[&go] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        go.store(true);
+    }};
+
+    pool.wait(future);
+    ASSERT_TRUE(blocker.ready());
+    ASSERT_NE(future.get(), std::this_thread::get_id());
+}
+
+scoped_task<int> await_pool_future(thread_pool& pool, std::atomic<bool>& go)
+{
+    co_return co_await pool.async([&go] {
+        while (not go.load()) {
+            std::this_thread::yield();
+        }
+        return 42;
+    });
+}
+
+TEST(thread_pool, coroutine)
+{
+    auto pool = thread_pool{1};
+    auto go = std::atomic<bool>{false};
+
+    auto task = await_pool_future(pool, go);
+    ASSERT_FALSE(task.done());
+
+    go.store(true);
+    // The co-routine is resumed from the local event loop, after the job was completed.
+    while (not task.done()) {
+        loop::local().resume_once();
+    }
+    ASSERT_EQ(task.value(), 42);
+}
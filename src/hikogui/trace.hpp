@@ -8,10 +8,168 @@
 #include "time_stamp_count.hpp"
 #include "counters.hpp"
 #include "datum.hpp"
+#include "concurrency/module.hpp"
 #include <array>
 #include <tuple>
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <filesystem>
+#include <thread>
 
 namespace hi::inline v1 {
+namespace detail {
+
+/** A completed trace span.
+ *
+ * The begin and end of a trace are recorded together when the trace is
+ * destroyed, so that the timeline can be exported as complete events.
+ */
+struct trace_span {
+    char const *name;
+    uint32_t name_size;
+    uint32_t depth;
+    uint64_t begin;
+    uint64_t end;
+};
+
+/** A single-producer single-consumer ring buffer of trace spans.
+ *
+ * Each thread owns one ring to which it pushes spans, the background
+ * trace thread drains the rings of all threads.
+ */
+class trace_ring {
+public:
+    constexpr static std::size_t capacity = 4096;
+
+    trace_ring(trace_ring const&) = delete;
+    trace_ring(trace_ring&&) = delete;
+    trace_ring& operator=(trace_ring const&) = delete;
+    trace_ring& operator=(trace_ring&&) = delete;
+
+    explicit trace_ring(hi::thread_id thread_id) noexcept : _thread_id(thread_id) {}
+
+    [[nodiscard]] hi::thread_id thread_id() const noexcept
+    {
+        return _thread_id;
+    }
+
+    /** Add a span to the ring.
+     *
+     * @return false when the ring is full and the span was dropped.
+     */
+    bool push(trace_span const& span) noexcept
+    {
+        hilet head = _head.load(std::memory_order::relaxed);
+        hilet tail = _tail.load(std::memory_order::acquire);
+        if (head - tail >= capacity) {
+            _dropped.fetch_add(1, std::memory_order::relaxed);
+            return false;
+        }
+
+        _spans[head % capacity] = span;
+        _head.store(head + 1, std::memory_order::release);
+        return true;
+    }
+
+    /** Remove all spans from the ring.
+     *
+     * @param func A function called with each `trace_span const&`, in the order they were pushed.
+     * @return The number of spans that were dropped since the previous call.
+     */
+    template<typename Func>
+    std::size_t drain(Func&& func) noexcept
+    {
+        hilet tail = _tail.load(std::memory_order::relaxed);
+        hilet head = _head.load(std::memory_order::acquire);
+        for (auto i = tail; i != head; ++i) {
+            func(_spans[i % capacity]);
+        }
+        _tail.store(head, std::memory_order::release);
+        return _dropped.exchange(0, std::memory_order::relaxed);
+    }
+
+private:
+    std::array<trace_span, capacity> _spans;
+    hi::thread_id _thread_id;
+
+    alignas(hi::hardware_destructive_interference_size) std::atomic<std::size_t> _head = 0;
+    alignas(hi::hardware_destructive_interference_size) std::atomic<std::size_t> _tail = 0;
+    std::atomic<std::size_t> _dropped = 0;
+};
+
+} // namespace detail
+
+/** A timeline of traces.
+ *
+ * When the timeline is enabled, each `trace` records its begin and end time
+ * together with its nesting depth into a per-thread ring buffer. The rings
+ * are drained by a background thread which writes the spans to a file in the
+ * Chrome trace-event JSON format, which can be loaded in `chrome://tracing`
+ * and in the Perfetto UI.
+ */
+class trace_timeline {
+public:
+    /** Check if traces should be recorded on the timeline.
+     */
+    [[nodiscard]] static bool enabled() noexcept
+    {
+        return to_bool(global_state.load(std::memory_order::relaxed) & global_state_type::trace_is_running);
+    }
+
+    /** Record a completed span on the timeline of the current thread.
+     *
+     * When the ring of the current thread could not be allocated the span is dropped,
+     * and counted by the `trace_timeline:no_ring` counter.
+     *
+     * @param name The name of the span, must have static storage duration.
+     * @param begin The time stamp count at the start of the span.
+     * @param end The time stamp count at the end of the span.
+     * @param depth The nesting depth of the span on the current thread.
+     */
+    hi_no_inline static void record(std::string_view name, uint64_t begin, uint64_t end, uint32_t depth) noexcept;
+
+    /** Drain all recorded spans and format them as Chrome trace-event JSON.
+     *
+     * @return A JSON array of trace-events.
+     */
+    [[nodiscard]] static std::string format_chrome_trace() noexcept;
+
+    /** Start the trace timeline.
+     *
+     * Enables the recording of traces, and starts a thread which periodically
+     * writes the recorded spans to a file.
+     *
+     * @param path The path of the Chrome trace-event JSON file to write.
+     * @return true if the timeline is started, false when the system is being shutdown.
+     */
+    static bool start_subsystem(std::filesystem::path path)
+    {
+        _path = std::move(path);
+        return hi::start_subsystem(
+            global_state_type::trace_is_running, trace_timeline::subsystem_init, trace_timeline::subsystem_deinit);
+    }
+
+    /** Stop the trace timeline.
+     *
+     * The remaining spans are written to the file before it is closed.
+     */
+    static void stop_subsystem()
+    {
+        return hi::stop_subsystem(trace_timeline::subsystem_deinit);
+    }
+
+private:
+    static inline std::filesystem::path _path;
+
+    /** The thread which writes the spans to the file.
+     */
+    static inline std::jthread _trace_thread;
+
+    static void trace_thread_main(std::stop_token stop_token) noexcept;
+    static bool subsystem_init() noexcept;
+    static void subsystem_deinit() noexcept;
+};
 
 class trace_base {
 public:
@@ -20,7 +178,10 @@ public:
     trace_base &operator=(trace_base const &) = delete;
     trace_base &operator=(trace_base &&) = delete;
 
-    trace_base() noexcept : _time_stamp(time_stamp_count::inplace{}), _next(std::exchange(_top, this)) {}
+    trace_base() noexcept :
+        _time_stamp(time_stamp_count::inplace{}), _next(std::exchange(_top, this)), _depth(_next ? _next->_depth + 1 : 0)
+    {
+    }
 
     virtual ~trace_base()
     {
@@ -34,6 +195,10 @@ protected:
 
     time_stamp_count _time_stamp;
     trace_base *_next = nullptr;
+
+    /** The nesting depth of this trace on the current thread.
+     */
+    uint32_t _depth = 0;
 };
 
 template<fixed_string Tag, int NumItems = 0>
@@ -49,6 +214,10 @@ public:
 
         hilet current_time_stamp = time_stamp_count{time_stamp_count::inplace{}};
         global_counter<Tag>.add_duration(current_time_stamp.count() - _time_stamp.count());
+
+        if (trace_timeline::enabled()) {
+            trace_timeline::record(Tag, _time_stamp.count(), current_time_stamp.count(), _depth);
+        }
     }
 
     void log() const noexcept override
@@ -86,6 +255,10 @@ public:
 
         hilet current_time_stamp = time_stamp_count{time_stamp_count::inplace{}};
         global_counter<Tag>.add_duration(current_time_stamp.count() - _time_stamp.count());
+
+        if (trace_timeline::enabled()) {
+            trace_timeline::record(Tag, _time_stamp.count(), current_time_stamp.count(), _depth);
+        }
     }
 
     void log() const noexcept override
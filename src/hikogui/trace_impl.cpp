@@ -3,7 +3,206 @@
 
 #include "trace.hpp"
 #include "log.hpp"
+#include "file/file.hpp"
+#include <format>
+#include <memory>
+#include <new>
+#include <mutex>
+#include <vector>
+#include <chrono>
 
 namespace hi::inline v1 {
+namespace detail {
 
+/** The rings of all threads that recorded a trace.
+ *
+ * The rings are shared so that the spans of a thread that has exited
+ * can still be drained, after which the ring is removed.
+ */
+static std::vector<std::shared_ptr<trace_ring>> trace_rings;
+static unfair_mutex trace_rings_mutex;
+
+/** Get the ring of the current thread.
+ *
+ * @return The ring, or nullptr when the ring could not be allocated.
+ */
+[[nodiscard]] static trace_ring *current_trace_ring() noexcept
+{
+    thread_local std::shared_ptr<trace_ring> ring;
+
+    if (not ring) [[unlikely]] {
+        try {
+            auto new_ring = std::make_shared<trace_ring>(current_thread_id());
+
+            hilet lock = std::scoped_lock(trace_rings_mutex);
+            trace_rings.push_back(new_ring);
+            ring = std::move(new_ring);
+
+        } catch (std::bad_alloc const&) {
+            // Try again on the next span.
+            return nullptr;
+        }
+    }
+    return ring.get();
+}
+
+static void append_JSON_string(std::string& r, std::string_view str) noexcept
+{
+    r += '"';
+    for (hilet c : str) {
+        if (c == '"' or c == '\\') {
+            r += '\\';
+            r += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            r += std::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+            r += c;
+        }
+    }
+    r += '"';
+}
+
+[[nodiscard]] static double trace_micro_seconds(uint64_t count) noexcept
+{
+    return std::chrono::duration<double, std::micro>{time_stamp_count::duration_from_count(count)}.count();
+}
+
+static void append_trace_event(std::string& r, std::string_view event) noexcept
+{
+    if (not r.empty()) {
+        r += ",\n";
+    }
+    r += event;
 }
+
+/** Drain the spans of all threads as Chrome trace-events.
+ *
+ * @return The trace-events separated by commas, or an empty string when there are no spans.
+ */
+[[nodiscard]] static std::string drain_trace_events() noexcept
+{
+    auto r = std::string{};
+
+    hilet lock = std::scoped_lock(trace_rings_mutex);
+    for (auto it = trace_rings.begin(); it != trace_rings.end();) {
+        hilet& ring = *it;
+        hilet tid = ring->thread_id();
+
+        // Only the thread_local of the owning thread shares the ring. Check before draining,
+        // so that the last spans of a thread that exits right now are still drained.
+        hilet has_exited = ring.use_count() == 1;
+        auto has_spans = false;
+        auto last_end = uint64_t{0};
+
+        hilet dropped = ring->drain([&](trace_span const& span) {
+            if (not std::exchange(has_spans, true)) {
+                auto event = std::format(R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":)", tid);
+                append_JSON_string(event, get_thread_name(tid));
+                event += "}}";
+                append_trace_event(r, event);
+            }
+
+            auto event = std::string{R"({"name":)"};
+            append_JSON_string(event, std::string_view{span.name, span.name_size});
+            event += std::format(
+                R"(,"ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f},"args":{{"depth":{}}}}})",
+                tid,
+                trace_micro_seconds(span.begin),
+                trace_micro_seconds(span.end - span.begin),
+                span.depth);
+            append_trace_event(r, event);
+            last_end = std::max(last_end, span.end);
+        });
+
+        if (dropped != 0) {
+            // Make the spans that did not fit in the ring visible on the timeline.
+            append_trace_event(
+                r,
+                std::format(
+                    R"({{"name":"trace_dropped","ph":"i","s":"t","pid":1,"tid":{},"ts":{:.3f},"args":{{"count":{}}}}})",
+                    tid,
+                    trace_micro_seconds(last_end),
+                    dropped));
+        }
+
+        if (has_exited) {
+            it = trace_rings.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return r;
+}
+
+} // namespace detail
+
+void trace_timeline::record(std::string_view name, uint64_t begin, uint64_t end, uint32_t depth) noexcept
+{
+    if (auto *ring = detail::current_trace_ring()) {
+        ring->push({name.data(), narrow_cast<uint32_t>(name.size()), depth, begin, end});
+    } else {
+        ++global_counter<"trace_timeline:no_ring">;
+    }
+}
+
+std::string trace_timeline::format_chrome_trace() noexcept
+{
+    auto r = std::string{"[\n"};
+    r += detail::drain_trace_events();
+    r += "\n]\n";
+    return r;
+}
+
+void trace_timeline::trace_thread_main(std::stop_token stop_token) noexcept
+{
+    using namespace std::chrono_literals;
+
+    set_thread_name("trace");
+
+    try {
+        auto f = file{_path, access_mode::truncate_or_create_for_write};
+
+        // The JSON Array Format allows the closing bracket to be missing,
+        // so that the file is usable even when the application crashes.
+        f.write(std::string_view{"["});
+
+        auto first = true;
+        auto write_events = [&] {
+            hilet events = detail::drain_trace_events();
+            if (not events.empty()) {
+                f.write(std::string_view{std::exchange(first, false) ? "\n" : ",\n"});
+                f.write(std::string_view{events});
+            }
+        };
+
+        while (not stop_token.stop_requested()) {
+            write_events();
+            std::this_thread::sleep_for(100ms);
+        }
+
+        write_events();
+        f.write(std::string_view{"\n]\n"});
+        f.close();
+
+    } catch (std::exception const& e) {
+        hi_log_error("Could not write trace file {}: {}", _path.string(), e.what());
+    }
+}
+
+bool trace_timeline::subsystem_init() noexcept
+{
+    _trace_thread = std::jthread(trace_thread_main);
+    return true;
+}
+
+void trace_timeline::subsystem_deinit() noexcept
+{
+    if (global_state_disable(global_state_type::trace_is_running)) {
+        if (_trace_thread.joinable()) {
+            _trace_thread.request_stop();
+            _trace_thread.join();
+        }
+    }
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,58 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "trace.hpp"
+#include "utility/module.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+using namespace hi;
+
+static void trace_tests_inner() noexcept
+{
+    hilet t = trace<"trace_tests_inner">{};
+}
+
+static void trace_tests_outer() noexcept
+{
+    hilet t = trace<"trace_tests_outer">{};
+    trace_tests_inner();
+}
+
+TEST(trace, timeline)
+{
+    global_state_enable(global_state_type::trace_is_running);
+    trace_tests_outer();
+    std::jthread{[] {
+        trace_tests_inner();
+    }}.join();
+    global_state_disable(global_state_type::trace_is_running);
+
+    // Traces are not recorded while the timeline is disabled.
+    trace_tests_outer();
+
+    hilet text = trace_timeline::format_chrome_trace();
+    ASSERT_TRUE(text.starts_with("["));
+    ASSERT_TRUE(text.ends_with("]\n"));
+
+    ASSERT_NE(text.find(R"("name":"trace_tests_outer","ph":"X")"), std::string::npos);
+    ASSERT_NE(text.find(R"("name":"thread_name","ph":"M")"), std::string::npos);
+
+    // The outer trace at depth 0, the inner trace at depth 1 and on the other thread at depth 0.
+    auto outer_count = 0;
+    auto inner_count = 0;
+    for (auto i = text.find("trace_tests_outer"); i != std::string::npos; i = text.find("trace_tests_outer", i + 1)) {
+        ++outer_count;
+    }
+    for (auto i = text.find("trace_tests_inner"); i != std::string::npos; i = text.find("trace_tests_inner", i + 1)) {
+        ++inner_count;
+    }
+    ASSERT_EQ(outer_count, 1);
+    ASSERT_EQ(inner_count, 2);
+    ASSERT_NE(text.find(R"("args":{"depth":1})"), std::string::npos);
+
+    // The rings are drained.
+    ASSERT_EQ(trace_timeline::format_chrome_trace(), "[\n\n]\n");
+}
@@ -13,6 +13,7 @@
 #include "unicode_sentence_break.hpp"
 #include "unicode_east_asian_width.hpp"
 #include "unicode_decomposition_type.hpp"
+#include "unicode_normalization_quick_check.hpp"
 #include "unicode_script.hpp"
 #include "../utility/module.hpp"
 
@@ -50,7 +51,9 @@ public:
         uint8_t canonical_combining_class,
         unicode_decomposition_type decomposition_type,
         uint32_t decomposition_index,
-        uint16_t composition_index) noexcept :
+        uint16_t composition_index,
+        unicode_normalization_quick_check NFC_quick_check,
+        unicode_normalization_quick_check NFD_quick_check) noexcept :
         _general_category(to_underlying(general_category)),
         _grapheme_cluster_break(to_underlying(grapheme_cluster_break)),
         _line_break_class(to_underlying(line_break_class)),
@@ -62,6 +65,8 @@ public:
         _bidi_bracket_type(to_underlying(bidi_bracket_type)),
         _bidi_mirroring_glyph(truncate<uint32_t>(bidi_mirroring_glyph)),
         _canonical_combining_class(truncate<uint32_t>(canonical_combining_class)),
+        _NFC_quick_check(to_underlying(NFC_quick_check)),
+        _NFD_quick_check(to_underlying(NFD_quick_check)),
         _decomposition_type(to_underlying(decomposition_type)),
         _decomposition_index(truncate<uint32_t>(decomposition_index)),
         _composition_index(truncate<uint16_t>(composition_index))
@@ -80,6 +85,8 @@ public:
         hi_assert(to_underlying(decomposition_type) <= 0x1f);
         hi_assert(static_cast<uint32_t>(decomposition_index) <= 0x1f'ffff);
         hi_assert(static_cast<uint32_t>(composition_index) <= 0x3fff);
+        hi_assert(to_underlying(NFC_quick_check) <= 0x3);
+        hi_assert(to_underlying(NFD_quick_check) <= 0x3);
     }
 
     /** The general category of this code-point.
@@ -183,6 +190,27 @@ public:
         return truncate<uint8_t>(_canonical_combining_class);
     }
 
+    /** The NFC quick-check property of this code-point.
+     *
+     * @retval yes The code-point may appear in NFC text.
+     * @retval no The code-point can not appear in NFC text.
+     * @retval maybe The code-point may combine with the code-point before it.
+     */
+    [[nodiscard]] constexpr unicode_normalization_quick_check NFC_quick_check() const noexcept
+    {
+        return static_cast<unicode_normalization_quick_check>(_NFC_quick_check);
+    }
+
+    /** The NFD quick-check property of this code-point.
+     *
+     * @retval yes The code-point may appear in NFD text.
+     * @retval no The code-point can not appear in NFD text.
+     */
+    [[nodiscard]] constexpr unicode_normalization_quick_check NFD_quick_check() const noexcept
+    {
+        return static_cast<unicode_normalization_quick_check>(_NFD_quick_check);
+    }
+
     /** Decompose this code-point.
      *
      * @return The decomposition of this code-point.
@@ -284,7 +312,9 @@ private:
     uint64_t _bidi_bracket_type : 2;
     uint64_t _bidi_mirroring_glyph : 16;
     uint64_t _canonical_combining_class : 8;
-    uint64_t _word0_reserved : 6 = 0;
+    uint64_t _NFC_quick_check : 2;
+    uint64_t _NFD_quick_check : 2;
+    uint64_t _word0_reserved : 2 = 0;
 
     // 2nd qword
     uint64_t _script : 8;
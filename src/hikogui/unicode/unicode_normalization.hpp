@@ -5,11 +5,14 @@
 #pragma once
 
 #include "unicode_decomposition_type.hpp"
+#include "unicode_normalization_quick_check.hpp"
 #include "../utility/module.hpp"
 #include "../algorithm.hpp"
 #include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
+#include <utility>
 
 namespace hi::inline v1 {
 
@@ -130,6 +133,28 @@ operator&(unicode_normalization_mask const& lhs, unicode_decomposition_type cons
     return static_cast<unicode_normalization_mask>(to_underlying(lhs) & (1 << to_underlying(rhs)));
 }
 
+/** Check if text is in Unicode-NFD normal form, without normalizing it.
+ *
+ * This function does not allocate memory.
+ *
+ * @param text The text to check.
+ * @retval yes The text is in NFD.
+ * @retval no The text is not in NFD.
+ */
+[[nodiscard]] unicode_normalization_quick_check unicode_NFD_quick_check(std::u32string_view text) noexcept;
+
+/** Check if text is in Unicode-NFC normal form, without normalizing it.
+ *
+ * This function does not allocate memory.
+ *
+ * @param text The text to check.
+ * @retval yes The text is in NFC.
+ * @retval no The text is not in NFC.
+ * @retval maybe The text contains code-points that may have combined with the code-point before it,
+ *         the text needs to be normalized to find out.
+ */
+[[nodiscard]] unicode_normalization_quick_check unicode_NFC_quick_check(std::u32string_view text) noexcept;
+
 /** Convert text to Unicode-NFD normal form.
  *
  * Code point 0x00'ffff is used internally, do not pass in text.
@@ -168,4 +193,81 @@ unicode_NFKD(std::u32string_view text, unicode_normalization_mask normalization_
 std::u32string
 unicode_NFKC(std::u32string_view text, unicode_normalization_mask normalization_mask = unicode_normalization_mask::NFKD) noexcept;
 
+/** Normalize text incrementally into a buffer of the caller.
+ *
+ * The text is normalized one segment at a time. A segment starts at a code-point
+ * that does not reorder or combine with the code-points before it. Only a single
+ * segment is held by the normalizer, and after the first few segments the
+ * normalizer no longer allocates memory.
+ *
+ * ```cpp
+ * auto normalizer = unicode_normalizer{true};
+ * auto buffer = std::array<char32_t, 256>{};
+ * while (true) {
+ *     hilet [num_read, num_written] = normalizer.normalize(text, buffer, true);
+ *     text = text.substr(num_read);
+ *     write(std::span{buffer.data(), num_written});
+ *     if (num_written == 0) {
+ *         break;
+ *     }
+ * }
+ * ```
+ */
+class unicode_normalizer {
+public:
+    /** Create a normalizer.
+     *
+     * @param compose Compose the text; true for NFC or NFKC, false for NFD or NFKD.
+     * @param normalization_mask The decompositions and extra features for normalization.
+     */
+    unicode_normalizer(bool compose, unicode_normalization_mask normalization_mask = unicode_normalization_mask::NFD) noexcept :
+        _compose(compose), _normalization_mask(normalization_mask)
+    {
+    }
+
+    /** Normalize part of the text.
+     *
+     * The last segment of the text is held back, as it may combine with the text passed
+     * in the next call, until `last` is set.
+     *
+     * @param text The next part of the text.
+     * @param output The buffer to write the normalized text into.
+     * @param last Set to true when @a text contains the end of the text.
+     * @return The number of code-points read from @a text, and the number of code-points
+     *         written to @a output. When the output is full, not all of the text is read.
+     */
+    [[nodiscard]] std::pair<std::size_t, std::size_t>
+    normalize(std::u32string_view text, std::span<char32_t> output, bool last) noexcept;
+
+    /** Forget any text that was held back.
+     */
+    void clear() noexcept
+    {
+        _segment.clear();
+        _normalized.clear();
+        _normalized_offset = 0;
+    }
+
+private:
+    bool _compose;
+    unicode_normalization_mask _normalization_mask;
+
+    /** The decomposed code-points of the current segment, with the combining class in the upper bits.
+     */
+    std::u32string _segment;
+
+    /** The decomposition of a single code-point.
+     */
+    std::u32string _decomposition;
+
+    /** Normalized text which has not been written to the output yet.
+     */
+    std::u32string _normalized;
+    std::size_t _normalized_offset = 0;
+
+    [[nodiscard]] bool is_segment_start(char32_t code_unit) const noexcept;
+    void normalize_segment() noexcept;
+    [[nodiscard]] std::size_t write(std::span<char32_t> output) noexcept;
+};
+
 } // namespace hi::inline v1
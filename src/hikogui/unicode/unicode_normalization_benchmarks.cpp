@@ -0,0 +1,117 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "unicode_normalization.hpp"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <string>
+
+using namespace hi;
+
+namespace {
+
+/** About 100 kB of text in NFC, in a mix of scripts.
+ */
+[[nodiscard]] std::u32string const& unicode_normalization_benchmarks_corpus() noexcept
+{
+    static auto r = [] {
+        constexpr auto sentences = std::array<std::u32string_view, 8>{
+            U"The quick brown fox jumps over the lazy dog. ",
+            U"Français: à bientôt, naïve façade, crème brûlée. ",
+            U"Ελληνικά: άέήίόύώ. ",
+            U"Русский: ёжик и йогурт. ",
+            U"日本語の文章です。ガギグ。",
+            U"한국어 문장입니다. ",
+            U"العربية لغة جميلة. ",
+            U"हिन्दी भाषा। "};
+
+        auto text = std::u32string{};
+        while (text.size() < 25'000) {
+            for (hilet sentence : sentences) {
+                text += sentence;
+            }
+        }
+        return text;
+    }();
+    return r;
+}
+
+[[nodiscard]] std::u32string const& unicode_normalization_benchmarks_corpus_NFD() noexcept
+{
+    static auto r = unicode_NFD(unicode_normalization_benchmarks_corpus());
+    return r;
+}
+
+} // namespace
+
+/** NFC of text that is already in NFC, the common case.
+ */
+static void unicode_NFC_of_NFC(benchmark::State& state)
+{
+    hilet& text = unicode_normalization_benchmarks_corpus();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(unicode_NFC(text));
+    }
+    state.SetItemsProcessed(state.iterations() * text.size());
+}
+BENCHMARK(unicode_NFC_of_NFC);
+
+/** NFC of decomposed text.
+ */
+static void unicode_NFC_of_NFD(benchmark::State& state)
+{
+    hilet& text = unicode_normalization_benchmarks_corpus_NFD();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(unicode_NFC(text));
+    }
+    state.SetItemsProcessed(state.iterations() * text.size());
+}
+BENCHMARK(unicode_NFC_of_NFD);
+
+/** NFD of text that is already in NFD.
+ */
+static void unicode_NFD_of_NFD(benchmark::State& state)
+{
+    hilet& text = unicode_normalization_benchmarks_corpus_NFD();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(unicode_NFD(text));
+    }
+    state.SetItemsProcessed(state.iterations() * text.size());
+}
+BENCHMARK(unicode_NFD_of_NFD);
+
+/** Only check if the text is in NFC.
+ */
+static void unicode_NFC_quick_check_of_NFC(benchmark::State& state)
+{
+    hilet& text = unicode_normalization_benchmarks_corpus();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(unicode_NFC_quick_check(text));
+    }
+    state.SetItemsProcessed(state.iterations() * text.size());
+}
+BENCHMARK(unicode_NFC_quick_check_of_NFC);
+
+/** Streaming NFC of decomposed text into a small buffer.
+ */
+static void unicode_normalizer_NFC_of_NFD(benchmark::State& state)
+{
+    hilet& text = unicode_normalization_benchmarks_corpus_NFD();
+    auto normalizer = unicode_normalizer{true};
+    auto buffer = std::array<char32_t, 256>{};
+
+    for (auto _ : state) {
+        auto todo = std::u32string_view{text};
+        while (true) {
+            hilet[num_read, num_written] = normalizer.normalize(todo, buffer, true);
+            todo = todo.substr(num_read);
+            benchmark::DoNotOptimize(buffer);
+            if (num_written == 0) {
+                break;
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * text.size());
+}
+BENCHMARK(unicode_normalizer_NFC_of_NFD);
@@ -156,8 +156,60 @@ static void unicode_clean(std::u32string &text) noexcept
     }
 }
 
+/** Check if text is normalized.
+ *
+ * @param text The text to check.
+ * @param compose True for NFC, false for NFD.
+ */
+[[nodiscard]] static unicode_normalization_quick_check unicode_quick_check(std::u32string_view text, bool compose) noexcept
+{
+    // Code-points below this are starters and are not changed by normalization.
+    hilet first_code_point = compose ? U'\u0300' : U'\u00c0';
+
+    auto r = unicode_normalization_quick_check::yes;
+    uint8_t previous_combining_class = 0;
+    for (hilet code_point : text) {
+        if (code_point < first_code_point) {
+            previous_combining_class = 0;
+            continue;
+        }
+
+        hilet& description = unicode_description::find(code_point);
+        hilet combining_class = description.canonical_combining_class();
+        if (combining_class != 0 and previous_combining_class > combining_class) {
+            // Combining marks are not in canonical order.
+            return unicode_normalization_quick_check::no;
+        }
+        previous_combining_class = combining_class;
+
+        hilet check = compose ? description.NFC_quick_check() : description.NFD_quick_check();
+        if (check == unicode_normalization_quick_check::no) {
+            return unicode_normalization_quick_check::no;
+        } else if (check == unicode_normalization_quick_check::maybe) {
+            r = unicode_normalization_quick_check::maybe;
+        }
+    }
+    return r;
+}
+
+[[nodiscard]] unicode_normalization_quick_check unicode_NFD_quick_check(std::u32string_view text) noexcept
+{
+    return unicode_quick_check(text, false);
+}
+
+[[nodiscard]] unicode_normalization_quick_check unicode_NFC_quick_check(std::u32string_view text) noexcept
+{
+    return unicode_quick_check(text, true);
+}
+
 std::u32string unicode_NFD(std::u32string_view text, unicode_normalization_mask normalization_mask) noexcept
 {
+    if (normalization_mask == unicode_normalization_mask::NFD and
+        unicode_NFD_quick_check(text) == unicode_normalization_quick_check::yes) {
+        // Most text is already normalized.
+        return std::u32string{text};
+    }
+
     auto r = std::u32string{};
     unicode_decompose(text, normalization_mask, r);
     unicode_reorder(r);
@@ -167,6 +219,12 @@ std::u32string unicode_NFD(std::u32string_view text, unicode_normalization_mask
 
 [[nodiscard]] std::u32string unicode_NFC(std::u32string_view text, unicode_normalization_mask normalization_mask) noexcept
 {
+    if (normalization_mask == unicode_normalization_mask::NFD and
+        unicode_NFC_quick_check(text) == unicode_normalization_quick_check::yes) {
+        // Most text is already normalized.
+        return std::u32string{text};
+    }
+
     auto r = std::u32string{};
     unicode_decompose(text, normalization_mask, r);
     unicode_reorder(r);
@@ -194,4 +252,90 @@ std::u32string unicode_NFKC(std::u32string_view text, unicode_normalization_mask
     return r;
 }
 
+[[nodiscard]] bool unicode_normalizer::is_segment_start(char32_t code_unit) const noexcept
+{
+    if ((code_unit >> 24) != 0) {
+        // Combining marks are reordered with the code-points before it.
+        return false;
+    }
+
+    hilet code_point = code_unit & 0x1f'ffff;
+    if (not _compose) {
+        return true;
+    } else if (to_bool(_normalization_mask & unicode_normalization_mask::compose_CRLF) and code_point == U'\n') {
+        return false;
+    } else {
+        return unicode_description::find(code_point).NFC_quick_check() == unicode_normalization_quick_check::yes;
+    }
+}
+
+void unicode_normalizer::normalize_segment() noexcept
+{
+    hi_axiom(_normalized_offset == _normalized.size());
+
+    // Put the combining marks in canonical order. Segments are short, so use an insertion
+    // sort which, unlike std::stable_sort(), does not allocate.
+    for (auto i = 1_uz; i < _segment.size(); ++i) {
+        hilet code_unit = _segment[i];
+        hilet combining_class = code_unit >> 24;
+        if (combining_class == 0) {
+            // Starters are never reordered.
+            continue;
+        }
+
+        auto j = i;
+        for (; j != 0 and (_segment[j - 1] >> 24) > combining_class; --j) {
+            _segment[j] = _segment[j - 1];
+        }
+        _segment[j] = code_unit;
+    }
+
+    if (_compose) {
+        unicode_compose(_normalization_mask, _segment);
+    }
+    unicode_clean(_segment);
+
+    // Swap the buffers, so that both keep their allocation.
+    std::swap(_segment, _normalized);
+    _segment.clear();
+    _normalized_offset = 0;
+}
+
+[[nodiscard]] std::size_t unicode_normalizer::write(std::span<char32_t> output) noexcept
+{
+    hilet size = std::min(output.size(), _normalized.size() - _normalized_offset);
+    std::copy_n(_normalized.begin() + _normalized_offset, size, output.begin());
+    _normalized_offset += size;
+    return size;
+}
+
+[[nodiscard]] std::pair<std::size_t, std::size_t>
+unicode_normalizer::normalize(std::u32string_view text, std::span<char32_t> output, bool last) noexcept
+{
+    auto num_read = 0_uz;
+    auto num_written = write(output);
+
+    // Stop when the normalized text does not fit in the output.
+    while (_normalized_offset == _normalized.size()) {
+        if (num_read == text.size()) {
+            if (last and not _segment.empty()) {
+                normalize_segment();
+                num_written += write(output.subspan(num_written));
+                continue;
+            }
+            break;
+        }
+
+        _decomposition.clear();
+        unicode_decompose(text[num_read++], _normalization_mask, _decomposition);
+        if (not _decomposition.empty() and not _segment.empty() and is_segment_start(_decomposition.front())) {
+            normalize_segment();
+            num_written += write(output.subspan(num_written));
+        }
+        _segment += _decomposition;
+    }
+
+    return {num_read, num_written};
+}
+
 } // namespace hi::inline v1
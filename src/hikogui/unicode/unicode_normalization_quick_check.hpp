@@ -0,0 +1,21 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstdint>
+
+namespace hi::inline v1 {
+
+/** The result of the normalization quick-check.
+ *
+ * See Unicode Standard Annex #15 "Unicode Normalization Forms", chapter 9 "Detecting Normalization Forms".
+ */
+enum class unicode_normalization_quick_check : uint8_t {
+    yes, ///< The text is normalized.
+    no, ///< The text is not normalized.
+    maybe ///< The text needs to be normalized to find out if it was normalized.
+};
+
+}
@@ -8,6 +8,7 @@
 #include "../generator.hpp"
 #include "../utility/module.hpp"
 #include <gtest/gtest.h>
+#include <array>
 #include <iostream>
 #include <string>
 #include <span>
@@ -205,3 +206,80 @@ TEST(unicode_normalization, Invariant)
         }
     }
 }
+
+TEST(unicode_normalization, quick_check)
+{
+    hilet check = [](std::u32string const& text, std::u32string const& NFC, std::u32string const& NFD, std::string const& comment) {
+        hilet NFC_check = unicode_NFC_quick_check(text);
+        if (NFC_check == unicode_normalization_quick_check::yes) {
+            ASSERT_EQ(text, NFC) << comment;
+        } else if (NFC_check == unicode_normalization_quick_check::no) {
+            ASSERT_NE(text, NFC) << comment;
+        }
+
+        hilet NFD_check = unicode_NFD_quick_check(text);
+        ASSERT_NE(NFD_check, unicode_normalization_quick_check::maybe) << comment;
+        ASSERT_EQ(NFD_check == unicode_normalization_quick_check::yes, text == NFD) << comment;
+    };
+
+    ASSERT_EQ(unicode_NFC_quick_check(U"Audio device:"), unicode_normalization_quick_check::yes);
+    ASSERT_EQ(unicode_NFD_quick_check(U"Audio device:"), unicode_normalization_quick_check::yes);
+    ASSERT_EQ(unicode_NFC_quick_check(U"caf\u00e9"), unicode_normalization_quick_check::yes);
+    ASSERT_EQ(unicode_NFD_quick_check(U"caf\u00e9"), unicode_normalization_quick_check::no);
+    ASSERT_EQ(unicode_NFC_quick_check(U"cafe\u0301"), unicode_normalization_quick_check::maybe);
+    ASSERT_EQ(unicode_NFD_quick_check(U"cafe\u0301"), unicode_normalization_quick_check::yes);
+    // Combining marks in the wrong order.
+    ASSERT_EQ(unicode_NFC_quick_check(U"a\u0301\u0323"), unicode_normalization_quick_check::no);
+    ASSERT_EQ(unicode_NFD_quick_check(U"a\u0301\u0323"), unicode_normalization_quick_check::no);
+
+    for (hilet& test : parseNormalizationTests()) {
+        check(test.c1, test.c2, test.c3, test.comment);
+        check(test.c2, test.c2, test.c3, test.comment);
+        check(test.c3, test.c2, test.c3, test.comment);
+        check(test.c4, test.c4, test.c5, test.comment);
+        check(test.c5, test.c4, test.c5, test.comment);
+    }
+}
+
+/** Normalize text one code-point at a time, with a small output buffer.
+ */
+static std::u32string normalize_streaming(std::u32string_view text, bool compose, unicode_normalization_mask mask)
+{
+    auto normalizer = unicode_normalizer{compose, mask};
+    auto buffer = std::array<char32_t, 3>{};
+
+    auto r = std::u32string{};
+    auto i = 0_uz;
+    while (true) {
+        hilet last = i + 1 >= text.size();
+        hilet [num_read, num_written] = normalizer.normalize(text.substr(i, 1), buffer, last);
+        i += num_read;
+        r.append(buffer.data(), num_written);
+        if (last and num_read == 0 and num_written == 0) {
+            break;
+        }
+    }
+    return r;
+}
+
+TEST(unicode_normalization, streaming)
+{
+    for (hilet& test : parseNormalizationTests()) {
+        ASSERT_EQ(normalize_streaming(test.c1, true, unicode_normalization_mask::NFD), test.c2) << test.comment;
+        ASSERT_EQ(normalize_streaming(test.c5, true, unicode_normalization_mask::NFD), test.c4) << test.comment;
+        ASSERT_EQ(normalize_streaming(test.c1, false, unicode_normalization_mask::NFD), test.c3) << test.comment;
+        ASSERT_EQ(normalize_streaming(test.c1, true, unicode_normalization_mask::NFKD), test.c4) << test.comment;
+        ASSERT_EQ(normalize_streaming(test.c1, false, unicode_normalization_mask::NFKD), test.c5) << test.comment;
+    }
+
+    // All tests as a single text.
+    auto text = std::u32string{};
+    for (hilet& test : parseNormalizationTests()) {
+        text += test.c1;
+        text += U' ';
+    }
+    ASSERT_EQ(normalize_streaming(text, true, unicode_normalization_mask::NFD), unicode_NFC(text));
+    ASSERT_EQ(
+        normalize_streaming(U"a\r\nb", true, unicode_normalization_mask::NFD | unicode_normalization_mask::compose_CRLF),
+        U"a\nb");
+}
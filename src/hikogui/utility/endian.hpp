@@ -194,7 +194,7 @@ template<numeric T>
 }
 
 template<std::endian Endian = std::endian::native, numeric T, byte_like B>
-constexpr void store(T value, B const *dst) noexcept
+constexpr void store(T value, B *dst) noexcept
 {
     if constexpr (Endian != std::endian::native) {
         value = byte_swap(value);
@@ -203,7 +203,7 @@ constexpr void store(T value, B const *dst) noexcept
 }
 
 template<std::endian Endian = std::endian::native, numeric T>
-constexpr void store(T value, void const *dst) noexcept
+constexpr void store(T value, void *dst) noexcept
 {
     if constexpr (Endian != std::endian::native) {
         value = byte_swap(value);
@@ -212,25 +212,25 @@ constexpr void store(T value, void const *dst) noexcept
 }
 
 template<numeric T, byte_like B>
-constexpr void store_le(T value, B const *dst) noexcept
+constexpr void store_le(T value, B *dst) noexcept
 {
     store<std::endian::little>(value, dst);
 }
 
 template<numeric T>
-inline void store_le(T value, void const *dst) noexcept
+inline void store_le(T value, void *dst) noexcept
 {
     store<std::endian::little>(value, dst);
 }
 
 template<numeric T, byte_like B>
-constexpr void store_be(T value, B const *dst) noexcept
+constexpr void store_be(T value, B *dst) noexcept
 {
     store<std::endian::big>(value, dst);
 }
 
 template<numeric T>
-inline void store_be(T value, void const *dst) noexcept
+inline void store_be(T value, void *dst) noexcept
 {
     store<std::endian::big>(value, dst);
 }
@@ -303,7 +303,7 @@ template<numeric T, byte_like B>
 {
     using unsigned_type = std::make_unsigned_t<T>;
 
-    hilet src_ = static_cast<unsigned_type>(src);
+    auto src_ = static_cast<unsigned_type>(src);
 
     if (not std::is_constant_evaluated()) {
         std::memcpy(dst, &src, sizeof(T));
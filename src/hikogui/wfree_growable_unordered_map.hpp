@@ -0,0 +1,526 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "utility/module.hpp"
+#include "concurrency/module.hpp"
+#include <atomic>
+#include <array>
+#include <bit>
+#include <optional>
+#include <vector>
+#include <tuple>
+#include <functional>
+#include <climits>
+
+namespace hi::inline v1 {
+
+/** Unordered map that grows, with wait-free lookup and lock-free insert and erase.
+ *
+ * This is a split-ordered list: all items are in a single sorted linked list,
+ * ordered by the bit-reversed hash of the key. Each bucket points to a dummy node in
+ * the list, so that growing the number of buckets never moves an item; a new
+ * bucket is initialized lazily by inserting its dummy node after the dummy node of its parent.
+ *
+ * Erase removes the node from the list; there are no tombstones. Nodes
+ * that are removed are destroyed after a rcu grace period, so that lookups
+ * never have to help other threads and stay wait-free.
+ *
+ * This class can be instantiated as a global variable without
+ * needing initialization.
+ *
+ * @tparam K The key type.
+ * @tparam V The value type, values are copied on lookup.
+ * @tparam Hash The hash function for the key.
+ * @tparam KeyEqual The comparison function for the key.
+ */
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class wfree_growable_unordered_map {
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    /** The average number of items in a bucket before the number of buckets is doubled.
+     */
+    constexpr static std::size_t max_load_factor = 2;
+
+    constexpr wfree_growable_unordered_map() noexcept = default;
+    wfree_growable_unordered_map(wfree_growable_unordered_map const&) = delete;
+    wfree_growable_unordered_map(wfree_growable_unordered_map&&) = delete;
+    wfree_growable_unordered_map& operator=(wfree_growable_unordered_map const&) = delete;
+    wfree_growable_unordered_map& operator=(wfree_growable_unordered_map&&) = delete;
+
+    /** Destroy the map.
+     *
+     * @note It is undefined behavior to destroy the map while other threads are using it.
+     */
+    ~wfree_growable_unordered_map()
+    {
+        auto *ptr = unmark(_head.next.load(std::memory_order::relaxed));
+        while (ptr) {
+            auto *next = unmark(ptr->next.load(std::memory_order::relaxed));
+            if (is_dummy(ptr->so_key)) {
+                delete ptr;
+            } else {
+                delete static_cast<node_type *>(ptr);
+            }
+            ptr = next;
+        }
+
+        for (auto& segment : _segments) {
+            delete[] segment.load(std::memory_order::relaxed);
+        }
+    }
+
+    /** The number of items in the map.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _size.load(std::memory_order::relaxed);
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** The current number of buckets.
+     */
+    [[nodiscard]] std::size_t bucket_count() const noexcept
+    {
+        return _bucket_count.load(std::memory_order::relaxed);
+    }
+
+    /** Insert or replace an item.
+     *
+     * @param key The key of the item.
+     * @param value The value of the item.
+     * @return true if the item was inserted, false if the value of an existing item was replaced.
+     */
+    bool insert(K key, V value) noexcept
+    {
+        hilet hash = Hash{}(key);
+        hilet so_key = regular_so_key(hash);
+
+        auto *new_node = new node_type{so_key, std::move(key), std::move(value)};
+
+        auto& domain = detail::rcu_domain::global();
+        domain.lock();
+        auto& start = get_or_make_bucket(hash);
+        while (true) {
+            auto [prev, curr, found] = find(start, so_key, new_node->key);
+
+            // When the key exists, insert the new node directly before the old
+            // node, so that lookups find either the old or the new value.
+            new_node->next.store(curr, std::memory_order::relaxed);
+            if (not prev->compare_exchange_strong(curr, new_node, std::memory_order::release, std::memory_order::relaxed)) {
+                continue;
+            }
+
+            // When another thread erased the old node first, this is an insert.
+            if (found and remove(start, curr)) {
+                domain.unlock();
+                return false;
+            }
+
+            domain.unlock();
+            grow(_size.fetch_add(1, std::memory_order::relaxed) + 1);
+            return true;
+        }
+    }
+
+    /** Get a copy of the value of an item.
+     *
+     * This function is wait-free.
+     *
+     * @param key The key of the item.
+     * @return The value, or empty when the key was not found.
+     */
+    [[nodiscard]] std::optional<V> get(K const& key) const noexcept
+    {
+        hilet hash = Hash{}(key);
+        hilet so_key = regular_so_key(hash);
+
+        auto r = std::optional<V>{};
+
+        auto& domain = detail::rcu_domain::global();
+        domain.lock();
+
+        // Skip over deleted nodes without unlinking them; there are no retries.
+        auto *ptr = unmark(get_bucket(hash).next.load(std::memory_order::acquire));
+        while (ptr and ptr->so_key <= so_key) {
+            hilet next = ptr->next.load(std::memory_order::acquire);
+            if (ptr->so_key == so_key and not is_marked(next) and KeyEqual{}(static_cast<node_type *>(ptr)->key, key)) {
+                r = static_cast<node_type *>(ptr)->value;
+                break;
+            }
+            ptr = unmark(next);
+        }
+
+        domain.unlock();
+        return r;
+    }
+
+    /** Get a copy of the value of an item.
+     *
+     * @param key The key of the item.
+     * @param default_value The value to return when the key was not found.
+     * @return The value of the item, or the default value.
+     */
+    [[nodiscard]] V get(K const& key, V const& default_value) const noexcept
+    {
+        if (auto optional_value = get(key)) {
+            return *std::move(optional_value);
+        } else {
+            return default_value;
+        }
+    }
+
+    [[nodiscard]] bool contains(K const& key) const noexcept
+    {
+        return get(key).has_value();
+    }
+
+    /** Erase an item.
+     *
+     * @param key The key of the item.
+     * @return The value of the item that was erased, or empty when the key was not found.
+     */
+    std::optional<V> erase(K const& key) noexcept
+    {
+        hilet hash = Hash{}(key);
+        hilet so_key = regular_so_key(hash);
+
+        auto r = std::optional<V>{};
+
+        auto& domain = detail::rcu_domain::global();
+        domain.lock();
+        auto& start = get_or_make_bucket(hash);
+        while (true) {
+            auto [prev, curr, found] = find(start, so_key, key);
+            if (not found) {
+                break;
+            }
+
+            if (remove(start, curr)) {
+                r = static_cast<node_type *>(curr)->value;
+                _size.fetch_sub(1, std::memory_order::relaxed);
+                break;
+            }
+        }
+
+        domain.unlock();
+        return r;
+    }
+
+    /** Get a list of all the keys.
+     *
+     * @note The list is not a snapshot when other threads modify the map.
+     */
+    [[nodiscard]] std::vector<K> keys() const noexcept
+    {
+        auto r = std::vector<K>{};
+        r.reserve(size());
+
+        auto& domain = detail::rcu_domain::global();
+        domain.lock();
+
+        auto *ptr = unmark(_head.next.load(std::memory_order::acquire));
+        while (ptr) {
+            hilet next = ptr->next.load(std::memory_order::acquire);
+            if (not is_dummy(ptr->so_key) and not is_marked(next)) {
+                r.push_back(static_cast<node_type *>(ptr)->key);
+            }
+            ptr = unmark(next);
+        }
+
+        domain.unlock();
+        return r;
+    }
+
+private:
+    struct node_base {
+        /** The next node, the lowest bit is set when this node is deleted.
+         */
+        std::atomic<node_base *> next = nullptr;
+
+        /** The split-order key; odd for items and even for the dummy nodes of buckets.
+         */
+        std::size_t so_key = 0;
+
+        constexpr node_base() noexcept = default;
+        constexpr node_base(std::size_t so_key) noexcept : so_key(so_key) {}
+    };
+
+    struct node_type : node_base {
+        K key;
+        V value;
+
+        node_type(std::size_t so_key, K key, V value) noexcept : node_base(so_key), key(std::move(key)), value(std::move(value))
+        {
+        }
+    };
+
+    using bucket_type = std::atomic<node_base *>;
+
+    /** The segments of buckets.
+     *
+     * Segment 0 holds bucket 1, segment s holds buckets [2^(s-1), 2^s).
+     * Bucket 0 is the head of the list.
+     */
+    constexpr static std::size_t num_segments = sizeof(std::size_t) * CHAR_BIT;
+
+    /** The dummy node of bucket 0, which is also the head of the list.
+     */
+    node_base _head = {};
+
+    std::array<std::atomic<bucket_type *>, num_segments> _segments = {};
+    std::atomic<std::size_t> _bucket_count = 2;
+    std::atomic<std::size_t> _size = 0;
+
+    [[nodiscard]] constexpr static std::size_t reverse_bits(std::size_t x) noexcept
+    {
+        // Reverse the bits in each byte, then reverse the bytes.
+        constexpr auto m1 = static_cast<std::size_t>(0x5555'5555'5555'5555ULL);
+        constexpr auto m2 = static_cast<std::size_t>(0x3333'3333'3333'3333ULL);
+        constexpr auto m4 = static_cast<std::size_t>(0x0f0f'0f0f'0f0f'0f0fULL);
+        x = ((x >> 1) & m1) | ((x & m1) << 1);
+        x = ((x >> 2) & m2) | ((x & m2) << 2);
+        x = ((x >> 4) & m4) | ((x & m4) << 4);
+        return byte_swap(x);
+    }
+
+    [[nodiscard]] constexpr static std::size_t regular_so_key(std::size_t hash) noexcept
+    {
+        constexpr auto msb = std::size_t{1} << (num_segments - 1);
+        return reverse_bits(hash | msb);
+    }
+
+    [[nodiscard]] constexpr static std::size_t dummy_so_key(std::size_t bucket) noexcept
+    {
+        return reverse_bits(bucket);
+    }
+
+    [[nodiscard]] constexpr static bool is_dummy(std::size_t so_key) noexcept
+    {
+        return (so_key & 1) == 0;
+    }
+
+    [[nodiscard]] static bool is_marked(node_base *ptr) noexcept
+    {
+        return (std::bit_cast<uintptr_t>(ptr) & 1) != 0;
+    }
+
+    [[nodiscard]] static node_base *mark(node_base *ptr) noexcept
+    {
+        return std::bit_cast<node_base *>(std::bit_cast<uintptr_t>(ptr) | 1);
+    }
+
+    [[nodiscard]] static node_base *unmark(node_base *ptr) noexcept
+    {
+        return std::bit_cast<node_base *>(std::bit_cast<uintptr_t>(ptr) & ~uintptr_t{1});
+    }
+
+    static void destroy_node(void *ptr) noexcept
+    {
+        delete static_cast<node_type *>(ptr);
+    }
+
+    /** The segment and the offset in the segment of a bucket.
+     */
+    [[nodiscard]] constexpr static std::pair<std::size_t, std::size_t> segment_index(std::size_t bucket) noexcept
+    {
+        hi_axiom(bucket != 0);
+        hilet segment = narrow_cast<std::size_t>(std::bit_width(bucket)) - 1;
+        return {segment, bucket - (std::size_t{1} << segment)};
+    }
+
+    /** Get the slot of a bucket.
+     *
+     * @return The slot, or nullptr if the segment was not yet allocated.
+     */
+    [[nodiscard]] bucket_type *get_bucket_slot(std::size_t bucket) const noexcept
+    {
+        hilet [segment, offset] = segment_index(bucket);
+        if (auto *ptr = _segments[segment].load(std::memory_order::acquire)) {
+            return ptr + offset;
+        } else {
+            return nullptr;
+        }
+    }
+
+    /** Get the dummy node of the bucket for the hash, or of the closest initialized parent bucket.
+     */
+    [[nodiscard]] node_base const& get_bucket(std::size_t hash) const noexcept
+    {
+        auto bucket = hash & (_bucket_count.load(std::memory_order::relaxed) - 1);
+        while (bucket != 0) {
+            if (hilet slot = get_bucket_slot(bucket)) {
+                if (hilet dummy = slot->load(std::memory_order::acquire)) {
+                    return *dummy;
+                }
+            }
+            // The parent bucket is the bucket without the most significant bit.
+            bucket &= ~std::bit_floor(bucket);
+        }
+        return _head;
+    }
+
+    /** Get the dummy node of the bucket for the hash, initializing the bucket when needed.
+     */
+    [[nodiscard]] node_base& get_or_make_bucket(std::size_t hash) noexcept
+    {
+        return get_or_make_bucket_index(hash & (_bucket_count.load(std::memory_order::relaxed) - 1));
+    }
+
+    [[nodiscard]] node_base& get_or_make_bucket_index(std::size_t bucket) noexcept
+    {
+        if (bucket == 0) {
+            return _head;
+        }
+
+        hilet [segment, offset] = segment_index(bucket);
+        auto *segment_ptr = _segments[segment].load(std::memory_order::acquire);
+        if (not segment_ptr) {
+            [[unlikely]] segment_ptr = make_segment(segment);
+        }
+
+        auto& slot = segment_ptr[offset];
+        if (auto *dummy = slot.load(std::memory_order::acquire)) {
+            return *dummy;
+        }
+        return make_bucket(bucket, slot);
+    }
+
+    hi_no_inline bucket_type *make_segment(std::size_t segment) noexcept
+    {
+        auto *new_segment = new bucket_type[std::size_t{1} << segment]{};
+
+        bucket_type *expected = nullptr;
+        if (_segments[segment].compare_exchange_strong(expected, new_segment, std::memory_order::acq_rel)) {
+            return new_segment;
+        } else {
+            // Another thread allocated the segment first.
+            delete[] new_segment;
+            return expected;
+        }
+    }
+
+    /** Initialize a bucket by inserting its dummy node after the dummy node of the parent bucket.
+     */
+    hi_no_inline node_base& make_bucket(std::size_t bucket, bucket_type& slot) noexcept
+    {
+        auto& parent = get_or_make_bucket_index(bucket & ~std::bit_floor(bucket));
+
+        hilet so_key = dummy_so_key(bucket);
+        auto *dummy = new node_base{so_key};
+        while (true) {
+            auto [prev, curr, found] = find(parent, so_key, std::nullopt);
+            if (found) {
+                // Another thread inserted the dummy node first.
+                delete dummy;
+                dummy = curr;
+                break;
+            }
+
+            dummy->next.store(curr, std::memory_order::relaxed);
+            if (prev->compare_exchange_strong(curr, dummy, std::memory_order::release, std::memory_order::relaxed)) {
+                break;
+            }
+        }
+
+        // Other threads that initialize the same bucket will have found the same dummy node.
+        slot.store(dummy, std::memory_order::release);
+        return *dummy;
+    }
+
+    /** Find the position of a node in the list.
+     *
+     * Deleted nodes that are found on the way are unlinked from the list.
+     *
+     * @note The rcu domain must be locked.
+     * @param start The dummy node to start searching from.
+     * @param so_key The split-order key of the node.
+     * @param key The key of the item, std::nullopt when searching for a dummy node,
+     *            or a node pointer to unlink all deleted nodes with the same split-order key.
+     * @return The link to update when inserting, the first node at or after the position,
+     *         and true if that node matches the key.
+     */
+    template<typename Key>
+    [[nodiscard]] std::tuple<bucket_type *, node_base *, bool>
+    find(node_base const& start, std::size_t so_key, Key const& key) noexcept
+    {
+    retry:
+        auto *prev = const_cast<bucket_type *>(&start.next);
+        auto *curr = prev->load(std::memory_order::acquire);
+        while (curr) {
+            auto *next = curr->next.load(std::memory_order::acquire);
+            if (is_marked(next)) {
+                // curr is deleted, unlink it. This fails when prev itself is deleted, or was changed.
+                if (not prev->compare_exchange_strong(curr, unmark(next), std::memory_order::acq_rel, std::memory_order::relaxed)) {
+                    goto retry;
+                }
+                detail::rcu_domain::global().retire({curr, destroy_node, this});
+                curr = unmark(next);
+                continue;
+            }
+
+            if (curr->so_key > so_key) {
+                break;
+            }
+
+            if (curr->so_key == so_key) {
+                if constexpr (std::is_same_v<Key, std::nullopt_t>) {
+                    return {prev, curr, true};
+                } else if constexpr (std::is_same_v<Key, node_base *>) {
+                    // Continue to unlink all the deleted nodes with this split-order key.
+                } else if (KeyEqual{}(static_cast<node_type *>(curr)->key, key)) {
+                    return {prev, curr, true};
+                }
+            }
+
+            prev = &curr->next;
+            curr = next;
+        }
+        return {prev, curr, false};
+    }
+
+    /** Remove a node from the list.
+     *
+     * @note The rcu domain must be locked.
+     * @param start The dummy node of the bucket of the node.
+     * @param ptr The node to remove.
+     * @return true if this thread removed the node, false if another thread removed it first.
+     */
+    bool remove(node_base const& start, node_base *ptr) noexcept
+    {
+        auto next = ptr->next.load(std::memory_order::acquire);
+        do {
+            if (is_marked(next)) {
+                return false;
+            }
+        } while (not ptr->next.compare_exchange_weak(next, mark(next), std::memory_order::acq_rel, std::memory_order::acquire));
+
+        // The node is now logically deleted, the find() will unlink it. The node may
+        // be after a newer node with the same key, so don't stop at a matching key.
+        [[maybe_unused]] auto _ = find(start, ptr->so_key, ptr);
+        return true;
+    }
+
+    /** Double the number of buckets when the average bucket is too full.
+     */
+    void grow(std::size_t new_size) noexcept
+    {
+        auto count = _bucket_count.load(std::memory_order::relaxed);
+        if (new_size > count * max_load_factor and count < (std::size_t{1} << (num_segments - 1))) {
+            // When this fails another thread has already grown the number of buckets.
+            _bucket_count.compare_exchange_strong(count, count * 2, std::memory_order::relaxed);
+        }
+    }
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,126 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "wfree_growable_unordered_map.hpp"
+#include "wfree_unordered_map.hpp"
+#include <benchmark/benchmark.h>
+#include <unordered_map>
+#include <shared_mutex>
+#include <mutex>
+#include <thread>
+
+using namespace hi;
+
+constexpr auto wfree_growable_unordered_map_benchmarks_num_keys = 1000;
+
+static auto wfree_growable_unordered_map_benchmarks_growable = [] {
+    auto r = std::make_unique<wfree_growable_unordered_map<int, int>>();
+    for (auto i = 0; i != wfree_growable_unordered_map_benchmarks_num_keys; ++i) {
+        r->insert(i, i);
+    }
+    return r;
+}();
+
+static auto wfree_growable_unordered_map_benchmarks_fixed = [] {
+    auto r = std::make_unique<wfree_unordered_map<int, int, wfree_growable_unordered_map_benchmarks_num_keys>>();
+    for (auto i = 0; i != wfree_growable_unordered_map_benchmarks_num_keys; ++i) {
+        r->insert(i, i);
+    }
+    return r;
+}();
+
+static auto wfree_growable_unordered_map_benchmarks_std = [] {
+    auto r = std::unordered_map<int, int>{};
+    for (auto i = 0; i != wfree_growable_unordered_map_benchmarks_num_keys; ++i) {
+        r[i] = i;
+    }
+    return r;
+}();
+static std::shared_mutex wfree_growable_unordered_map_benchmarks_std_mutex;
+
+/** Lookups from all threads, while one in 16 operations replaces a value.
+ */
+static void wfree_growable_unordered_map_contention(benchmark::State& state)
+{
+    auto& map = *wfree_growable_unordered_map_benchmarks_growable;
+
+    auto i = state.thread_index();
+    for (auto _ : state) {
+        hilet key = i % wfree_growable_unordered_map_benchmarks_num_keys;
+        if (i % 16 == 0) {
+            map.insert(key, i);
+        } else {
+            benchmark::DoNotOptimize(map.get(key));
+        }
+        i += 7;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(wfree_growable_unordered_map_contention)
+    ->ThreadRange(1, static_cast<int>(std::thread::hardware_concurrency()))
+    ->UseRealTime();
+
+/** The fixed capacity map with the same operations, for comparison.
+ */
+static void wfree_unordered_map_contention(benchmark::State& state)
+{
+    auto& map = *wfree_growable_unordered_map_benchmarks_fixed;
+
+    auto i = state.thread_index();
+    for (auto _ : state) {
+        hilet key = i % wfree_growable_unordered_map_benchmarks_num_keys;
+        if (i % 16 == 0) {
+            map.insert(key, i);
+        } else {
+            benchmark::DoNotOptimize(map.get(key));
+        }
+        i += 7;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(wfree_unordered_map_contention)
+    ->ThreadRange(1, static_cast<int>(std::thread::hardware_concurrency()))
+    ->UseRealTime();
+
+/** A std::unordered_map behind a reader-writer lock with the same operations, for comparison.
+ */
+static void std_unordered_map_contention(benchmark::State& state)
+{
+    auto& map = wfree_growable_unordered_map_benchmarks_std;
+
+    auto i = state.thread_index();
+    for (auto _ : state) {
+        hilet key = i % wfree_growable_unordered_map_benchmarks_num_keys;
+        if (i % 16 == 0) {
+            hilet lock = std::unique_lock(wfree_growable_unordered_map_benchmarks_std_mutex);
+            map[key] = i;
+        } else {
+            hilet lock = std::shared_lock(wfree_growable_unordered_map_benchmarks_std_mutex);
+            benchmark::DoNotOptimize(map.find(key)->second);
+        }
+        i += 7;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(std_unordered_map_contention)
+    ->ThreadRange(1, static_cast<int>(std::thread::hardware_concurrency()))
+    ->UseRealTime();
+
+/** Inserting and erasing keys from all threads, so that the map keeps growing its number of buckets.
+ */
+static void wfree_growable_unordered_map_insert_erase(benchmark::State& state)
+{
+    auto& map = *wfree_growable_unordered_map_benchmarks_growable;
+
+    auto i = wfree_growable_unordered_map_benchmarks_num_keys + 100 + state.thread_index() * 1'000'000;
+    for (auto _ : state) {
+        map.insert(i, i);
+        map.erase(i - 100);
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(wfree_growable_unordered_map_insert_erase)
+    ->ThreadRange(1, static_cast<int>(std::thread::hardware_concurrency()))
+    ->UseRealTime();
@@ -0,0 +1,113 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "wfree_growable_unordered_map.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace hi;
+
+TEST(wfree_growable_unordered_map, insert_get_erase)
+{
+    auto map = wfree_growable_unordered_map<std::string, int>{};
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.get("foo"));
+
+    ASSERT_TRUE(map.insert("foo", 1));
+    ASSERT_TRUE(map.insert("bar", 2));
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.get("foo"), 1);
+    ASSERT_EQ(map.get("bar"), 2);
+    ASSERT_EQ(map.get("baz", 42), 42);
+
+    // Replace the value of an existing key.
+    ASSERT_FALSE(map.insert("foo", 3));
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.get("foo"), 3);
+
+    ASSERT_EQ(map.erase("foo"), 3);
+    ASSERT_FALSE(map.erase("foo"));
+    ASSERT_FALSE(map.get("foo"));
+    ASSERT_EQ(map.get("bar"), 2);
+    ASSERT_EQ(map.size(), 1);
+
+    auto keys = map.keys();
+    ASSERT_EQ(keys.size(), 1);
+    ASSERT_EQ(keys.front(), "bar");
+}
+
+TEST(wfree_growable_unordered_map, grow)
+{
+    auto map = wfree_growable_unordered_map<int, int>{};
+    for (auto i = 0; i != 10'000; ++i) {
+        ASSERT_TRUE(map.insert(i, i * 2));
+    }
+    ASSERT_EQ(map.size(), 10'000);
+    ASSERT_GE(map.bucket_count() * map.max_load_factor, 10'000);
+
+    for (auto i = 0; i != 10'000; ++i) {
+        ASSERT_EQ(map.get(i), i * 2);
+    }
+
+    // Erase the odd keys, and check that the even keys are unaffected.
+    for (auto i = 1; i < 10'000; i += 2) {
+        ASSERT_EQ(map.erase(i), i * 2);
+    }
+    ASSERT_EQ(map.size(), 5'000);
+    for (auto i = 0; i != 10'000; ++i) {
+        if (i % 2 == 0) {
+            ASSERT_EQ(map.get(i), i * 2);
+        } else {
+            ASSERT_FALSE(map.get(i));
+        }
+    }
+
+    auto keys = map.keys();
+    std::ranges::sort(keys);
+    ASSERT_EQ(keys.size(), 5'000);
+    for (auto i = 0_uz; i != keys.size(); ++i) {
+        ASSERT_EQ(keys[i], narrow_cast<int>(i * 2));
+    }
+}
+
+TEST(wfree_growable_unordered_map, concurrent)
+{
+    auto map = wfree_growable_unordered_map<int, int>{};
+
+    // Each thread inserts, replaces and erases its own range of keys, while
+    // reading the keys of the other threads.
+    auto threads = std::vector<std::jthread>{};
+    for (auto t = 0; t != 4; ++t) {
+        threads.emplace_back([&map, t] {
+            hilet first = t * 10'000;
+            for (auto i = first; i != first + 10'000; ++i) {
+                map.insert(i, i);
+                map.insert(i, i + 1);
+                if (i % 3 == 0) {
+                    map.erase(i);
+                }
+                hilet other = (i + 10'000) % 40'000;
+                if (hilet value = map.get(other)) {
+                    ASSERT_TRUE(*value == other or *value == other + 1);
+                }
+            }
+        });
+    }
+    threads.clear();
+
+    auto num_keys = 0_uz;
+    for (auto i = 0; i != 40'000; ++i) {
+        if (i % 3 == 0) {
+            ASSERT_FALSE(map.get(i));
+        } else {
+            ASSERT_EQ(map.get(i), i + 1);
+            ++num_keys;
+        }
+    }
+    ASSERT_EQ(map.size(), num_keys);
+    ASSERT_EQ(map.keys().size(), num_keys);
+}
@@ -11,6 +11,7 @@
 #include <vector>
 #include <typeinfo>
 #include <typeindex>
+#include <cstring>
 
 namespace hi::inline v1 {
 
@@ -18,7 +18,7 @@ abstract_button_widget::abstract_button_widget(widget *parent, std::shared_ptr<d
     _other_label_widget = std::make_unique<label_widget>(this, other_label, alignment, text_style);
     _delegate_cbt = this->delegate->subscribe([&] {
         ++global_counter<"abstract_button_widget:delegate:relayout">;
-        process_event({gui_event_type::window_relayout});
+        request_relayout();
     });
     this->delegate->init(*this);
 }
@@ -32,9 +32,9 @@ abstract_button_widget::~abstract_button_widget()
 [[nodiscard]] box_constraints abstract_button_widget::update_constraints() noexcept
 {
     _layout = {};
-    _on_label_constraints = _on_label_widget->update_constraints();
-    _off_label_constraints = _off_label_widget->update_constraints();
-    _other_label_constraints = _other_label_widget->update_constraints();
+    _on_label_constraints = _on_label_widget->reconstrain();
+    _off_label_constraints = _off_label_widget->reconstrain();
+    _other_label_constraints = _other_label_widget->reconstrain();
     return max(_on_label_constraints, _off_label_constraints, _other_label_constraints);
 }
 
@@ -45,9 +45,9 @@ void abstract_button_widget::set_layout(widget_layout const& context) noexcept
     _off_label_widget->mode = state_ == button_state::off ? widget_mode::display : widget_mode::invisible;
     _other_label_widget->mode = state_ == button_state::other ? widget_mode::display : widget_mode::invisible;
 
-    _on_label_widget->set_layout(context.transform(_on_label_shape));
-    _off_label_widget->set_layout(context.transform(_off_label_shape));
-    _other_label_widget->set_layout(context.transform(_other_label_shape));
+    _on_label_widget->relayout(context.transform(_on_label_shape));
+    _off_label_widget->relayout(context.transform(_off_label_shape));
+    _other_label_widget->relayout(context.transform(_other_label_shape));
 }
 
 void abstract_button_widget::activate() noexcept
@@ -43,7 +43,7 @@ audio_device_widget::audio_device_widget(widget *parent, hi::audio_system& audio
 [[nodiscard]] box_constraints audio_device_widget::update_constraints() noexcept
 {
     _layout = {};
-    _grid_constraints = _grid_widget->update_constraints();
+    _grid_constraints = _grid_widget->reconstrain();
     return _grid_constraints;
 }
 
@@ -54,7 +54,7 @@ void audio_device_widget::set_layout(widget_layout const& context) noexcept
         _grid_shape = {_grid_constraints, grid_rectangle, theme().baseline_adjustment()};
     }
 
-    _grid_widget->set_layout(context.transform(_grid_shape));
+    _grid_widget->relayout(context.transform(_grid_shape));
 }
 
 void audio_device_widget::draw(draw_context const& context) noexcept
@@ -40,7 +40,7 @@ widget& grid_widget::add_widget(
     hi_log_info("grid_widget::add_widget({}, {}, {}, {})", first_column, first_row, last_column, last_row);
 
     ++global_counter<"grid_widget:add_widget:constrain">;
-    process_event({gui_event_type::window_reconstrain});
+    request_reconstrain();
     return ref;
 }
 
@@ -49,7 +49,7 @@ widget& grid_widget::add_widget(
     _layout = {};
 
     for (auto& cell : _grid) {
-        cell.set_constraints(cell.value->update_constraints());
+        cell.set_constraints(cell.value->reconstrain());
     }
 
     return _grid.constraints(os_settings::left_to_right());
@@ -62,7 +62,7 @@ void grid_widget::set_layout(widget_layout const& context) noexcept
     }
 
     for (hilet& cell : _grid) {
-        cell.value->set_layout(context.transform(cell.shape, 0.0f));
+        cell.value->relayout(context.transform(cell.shape, 0.0f));
     }
 }
 
@@ -14,7 +14,7 @@ icon_widget::icon_widget(widget *parent) noexcept : super(parent)
     _icon_cbt = icon.subscribe([this](auto...) {
         _icon_has_modified = true;
         ++global_counter<"icon_widget:icon:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
     });
 }
 
@@ -36,7 +36,7 @@ icon_widget::icon_widget(widget *parent) noexcept : super(parent)
                 // Could not get an image, retry.
                 _icon_has_modified = true;
                 ++global_counter<"icon_widget:no-backing-image:constrain">;
-                process_event({gui_event_type::window_reconstrain});
+                request_reconstrain();
             }
 
         } else if (hilet g1 = std::get_if<glyph_ids>(&icon.read())) {
@@ -103,7 +103,7 @@ label_widget::label_widget(widget *parent) noexcept : super(parent)
     _icon_widget->maximum = extent2i{icon_size, icon_size};
 
     for (auto& cell : _grid) {
-        cell.set_constraints(cell.value->update_constraints());
+        cell.set_constraints(cell.value->reconstrain());
     }
 
     return _grid.constraints(os_settings::left_to_right());
@@ -116,7 +116,7 @@ void label_widget::set_layout(widget_layout const& context) noexcept
     }
 
     for (hilet& cell : _grid) {
-        cell.value->set_layout(context.transform(cell.shape, 0.0f));
+        cell.value->relayout(context.transform(cell.shape, 0.0f));
     }
 }
 
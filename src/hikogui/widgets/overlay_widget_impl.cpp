@@ -23,13 +23,13 @@ void overlay_widget::set_widget(std::unique_ptr<widget> new_widget) noexcept
 {
     _content = std::move(new_widget);
     ++global_counter<"overlay_widget:set_widget:constrain">;
-    process_event({gui_event_type::window_reconstrain});
+    request_reconstrain();
 }
 
 [[nodiscard]] box_constraints overlay_widget::update_constraints() noexcept
 {
     _layout = {};
-    _content_constraints = _content->update_constraints();
+    _content_constraints = _content->reconstrain();
     return _content_constraints;
 }
 
@@ -44,7 +44,7 @@ void overlay_widget::set_layout(widget_layout const& context) noexcept
     _content_shape = box_shape{_content_constraints, content_rectangle, theme().baseline_adjustment()};
 
     // The content should not draw in the border of the overlay, so give a tight clipping rectangle.
-    _content->set_layout(_layout.transform(_content_shape, 1.0f, context.rectangle()));
+    _content->relayout(_layout.transform(_content_shape, 1.0f, context.rectangle()));
 }
 
 void overlay_widget::draw(draw_context const& context) noexcept
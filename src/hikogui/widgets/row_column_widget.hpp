@@ -79,7 +79,7 @@ public:
         _children.push_back(std::move(tmp));
 
         ++global_counter<"row_column_widget:make_widget:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
         return ref;
     }
 
@@ -90,7 +90,7 @@ public:
         hi_axiom(loop::main().on_thread());
         _children.clear();
         ++global_counter<"row_column_widget:clear:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
     }
 
     /// @privatesection
@@ -106,7 +106,7 @@ public:
         _layout = {};
 
         for (auto& child : _children) {
-            child.set_constraints(child.value->update_constraints());
+            child.set_constraints(child.value->reconstrain());
         }
 
         return _children.constraints(os_settings::left_to_right());
@@ -116,10 +116,10 @@ public:
     {
         if (compare_store(_layout, context)) {
             _children.set_layout(context.shape, theme().baseline_adjustment());
+        }
 
-            for (hilet& child : _children) {
-                child.value->set_layout(context.transform(child.shape, 0.0f));
-            }
+        for (hilet& child : _children) {
+            child.value->relayout(context.transform(child.shape, 0.0f));
         }
     }
 
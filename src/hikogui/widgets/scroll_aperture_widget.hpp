@@ -40,31 +40,31 @@ public:
 
         _content_width_cbt = content_width.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:content_width:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _content_height_cbt = content_height.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:content_height:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _aperture_width_cbt = aperture_width.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:aperture_width:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _aperture_height_cbt = aperture_height.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:aperture_height:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _offset_x_cbt = offset_x.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:offset_x:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _offset_y_cbt = offset_y.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:offset_y:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
         });
         _minimum_cbt = minimum.subscribe([&](auto...) {
             ++global_counter<"scroll_aperture_widget:minimum:reconstrain">;
-            process_event({gui_event_type::window_reconstrain});
+            request_reconstrain();
         });
     }
 
@@ -99,7 +99,7 @@ public:
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
-        _content_constraints = _content->update_constraints();
+        _content_constraints = _content->reconstrain();
 
         // The aperture can scroll so its minimum width and height are zero.
         auto aperture_constraints = _content_constraints;
@@ -142,7 +142,7 @@ public:
 
         // The content needs to be at a higher elevation, so that hitbox check
         // will work correctly for handling scrolling with mouse wheel.
-        _content->set_layout(context.transform(_content_shape, 1.0f, context.rectangle()));
+        _content->relayout(context.transform(_content_shape, 1.0f, context.rectangle()));
     }
 
     void draw(draw_context const& context) noexcept override
@@ -182,7 +182,7 @@ public:
             offset_x = std::clamp(new_offset_x, 0, max_offset_x);
             offset_y = std::clamp(new_offset_y, 0, max_offset_y);
             ++global_counter<"scroll_aperture_widget:mouse_wheel:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
             return true;
         } else {
             return super::handle_event(event);
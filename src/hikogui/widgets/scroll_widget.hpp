@@ -120,7 +120,7 @@ public:
         _layout = {};
 
         for (auto& cell : _grid) {
-            cell.set_constraints(cell.value->update_constraints());
+            cell.set_constraints(cell.value->reconstrain());
         }
         auto grid_constraints = _grid.constraints(os_settings::left_to_right());
         return grid_constraints.constrain(*minimum, *maximum);
@@ -147,7 +147,7 @@ public:
                 }
             }
 
-            cell.value->set_layout(context.transform(shape, 0.0f));
+            cell.value->relayout(context.transform(shape, 0.0f));
         }
     }
 
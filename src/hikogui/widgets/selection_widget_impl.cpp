@@ -31,13 +31,13 @@ selection_widget::selection_widget(widget *parent, std::shared_ptr<delegate_type
 
     _off_label_cbt = this->off_label.subscribe([&](auto...) {
         ++global_counter<"selection_widget:off_label:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
     });
 
     _delegate_cbt = this->delegate->subscribe([&] {
         _notification_from_delegate = true;
         ++global_counter<"selection_widget:delegate:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
     });
 
     this->delegate->init(*this);
@@ -61,9 +61,9 @@ selection_widget::selection_widget(widget *parent, std::shared_ptr<delegate_type
     }
 
     _layout = {};
-    _off_label_constraints = _off_label_widget->update_constraints();
-    _current_label_constraints = _current_label_widget->update_constraints();
-    _overlay_constraints = _overlay_widget->update_constraints();
+    _off_label_constraints = _off_label_widget->reconstrain();
+    _current_label_constraints = _current_label_widget->reconstrain();
+    _overlay_constraints = _overlay_widget->reconstrain();
 
     hilet extra_size = extent2i{theme().size() + theme().margin<int>() * 2, theme().margin<int>() * 2};
 
@@ -128,10 +128,10 @@ void selection_widget::set_layout(widget_layout const& context) noexcept
     hilet overlay_rectangle_request = aarectanglei{overlay_x, overlay_y, overlay_width, overlay_height};
     hilet overlay_rectangle = make_overlay_rectangle(overlay_rectangle_request);
     _overlay_shape = box_shape{_overlay_constraints, overlay_rectangle, theme().baseline_adjustment()};
-    _overlay_widget->set_layout(context.transform(_overlay_shape, 20.0f));
+    _overlay_widget->relayout(context.transform(_overlay_shape, 20.0f));
 
-    _off_label_widget->set_layout(context.transform(_off_label_shape));
-    _current_label_widget->set_layout(context.transform(_current_label_shape));
+    _off_label_widget->relayout(context.transform(_off_label_shape));
+    _current_label_widget->relayout(context.transform(_current_label_shape));
 }
 
 void selection_widget::draw(draw_context const& context) noexcept
@@ -170,7 +170,7 @@ bool selection_widget::handle_event(gui_event const& event) noexcept
             stop_selecting();
         }
         ++global_counter<"selection_widget:gui_activate:relayout">;
-        process_event({gui_event_type::window_relayout});
+        request_relayout();
         return true;
 
     case gui_event_type::gui_cancel:
@@ -178,7 +178,7 @@ bool selection_widget::handle_event(gui_event const& event) noexcept
             stop_selecting();
         }
         ++global_counter<"selection_widget:gui_cancel:relayout">;
-        process_event({gui_event_type::window_relayout});
+        request_relayout();
         return true;
 
     default:;
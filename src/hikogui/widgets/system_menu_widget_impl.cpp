@@ -16,7 +16,7 @@ system_menu_widget::system_menu_widget(widget *parent) noexcept : super(parent)
     hi_assert_not_null(_icon_widget);
 
     _layout = {};
-    _icon_constraints = _icon_widget->update_constraints();
+    _icon_constraints = _icon_widget->reconstrain();
 
     hilet size = extent2i{theme().large_size(), theme().large_size()};
     return {size, size, size};
@@ -34,7 +34,7 @@ void system_menu_widget::set_layout(widget_layout const& context) noexcept
             theme().margin<int>(), 0, context.width() - theme().margin<int>(), context.height() - theme().margin<int>()};
     }
 
-    _icon_widget->set_layout(context.transform(_icon_shape));
+    _icon_widget->relayout(context.transform(_icon_shape));
 }
 
 void system_menu_widget::draw(draw_context const& context) noexcept
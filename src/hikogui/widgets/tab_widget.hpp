@@ -81,7 +81,7 @@ public:
         delegate->add_tab(*this, static_cast<std::size_t>(key), size(_children));
         _children.push_back(std::move(tmp));
         ++global_counter<"tab_widget:make_widget:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
         return ref;
     }
 
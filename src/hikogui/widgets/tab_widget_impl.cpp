@@ -25,7 +25,7 @@ tab_widget::tab_widget(widget *parent, std::shared_ptr<delegate_type> delegate)
     hi_assert_not_null(this->delegate);
     _delegate_cbt = this->delegate->subscribe([&] {
         ++global_counter<"tab_widget:delegate:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
     });
 
     this->delegate->init(*this);
@@ -47,7 +47,7 @@ tab_widget::tab_widget(widget *parent, std::shared_ptr<delegate_type> delegate)
         child->mode = child.get() == &selected_child_ ? widget_mode::enabled : widget_mode::invisible;
     }
 
-    return selected_child_.update_constraints();
+    return selected_child_.reconstrain();
 }
 
 void tab_widget::set_layout(widget_layout const& context) noexcept
@@ -56,7 +56,7 @@ void tab_widget::set_layout(widget_layout const& context) noexcept
 
     for (hilet& child : _children) {
         if (*child->mode > widget_mode::invisible) {
-            child->set_layout(context);
+            child->relayout(context);
         }
     }
 }
@@ -13,7 +13,7 @@ text_field_widget::text_field_widget(widget *parent, std::shared_ptr<delegate_ty
     hi_assert_not_null(this->delegate);
     _delegate_cbt = this->delegate->subscribe([&] {
         ++global_counter<"text_field_widget:delegate:layout">;
-        process_event({gui_event_type::window_relayout});
+        request_relayout();
     });
     this->delegate->init(*this);
 
@@ -25,19 +25,19 @@ text_field_widget::text_field_widget(widget *parent, std::shared_ptr<delegate_ty
 
     _continues_cbt = continues.subscribe([&](auto...) {
         ++global_counter<"text_field_widget:continues:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
     });
     _text_style_cbt = text_style.subscribe([&](auto...) {
         ++global_counter<"text_field_widget:text_style:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
     });
     _text_cbt = _text.subscribe([&](auto...) {
         ++global_counter<"text_field_widget:text:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
     });
     _error_label_cbt = _error_label.subscribe([&](auto const& new_value) {
         ++global_counter<"text_field_widget:error_label:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
     });
 }
 
@@ -68,7 +68,7 @@ text_field_widget::~text_field_widget()
     }
 
     _layout = {};
-    _scroll_constraints =_scroll_widget->update_constraints();
+    _scroll_constraints =_scroll_widget->reconstrain();
 
     hilet scroll_width = 100;
     hilet box_size = extent2i{
@@ -79,11 +79,11 @@ text_field_widget::~text_field_widget()
     auto margins = theme().margin();
     if (_error_label->empty()) {
         _error_label_widget->mode = widget_mode::invisible;
-        _error_label_constraints = _error_label_widget->update_constraints();
+        _error_label_constraints = _error_label_widget->reconstrain();
 
     } else {
         _error_label_widget->mode = widget_mode::display;
-        _error_label_constraints = _error_label_widget->update_constraints();
+        _error_label_constraints = _error_label_widget->reconstrain();
         inplace_max(size.width(), _error_label_constraints.preferred.width());
         size.height() += _error_label_constraints.margins.top() + _error_label_constraints.preferred.height();
         inplace_max(margins.left(), _error_label_constraints.margins.left());
@@ -115,9 +115,9 @@ void text_field_widget::set_layout(widget_layout const& context) noexcept
     }
 
     if (*_error_label_widget->mode > widget_mode::invisible) {
-        _error_label_widget->set_layout(context.transform(_error_label_shape));
+        _error_label_widget->relayout(context.transform(_error_label_shape));
     }
-    _scroll_widget->set_layout(context.transform(_scroll_shape));
+    _scroll_widget->relayout(context.transform(_scroll_shape));
 }
 
 void text_field_widget::draw(draw_context const& context) noexcept
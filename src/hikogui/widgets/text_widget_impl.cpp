@@ -24,32 +24,34 @@ text_widget::text_widget(widget *parent, std::shared_ptr<delegate_type> delegate
             hilet old_constraints = _constraints_cache;
 
             // Constrain and layout according to the old layout.
-            hilet new_constraints = update_constraints();
+            // Go through reconstrain() and relayout() so that the dirty state of the widget stays consistent.
+            request_reconstrain();
+            hilet new_constraints = reconstrain();
             new_layout.shape.rectangle = aarectanglei{
                 new_layout.shape.x(),
                 new_layout.shape.y(),
                 std::max(new_layout.shape.width(), new_constraints.minimum.width()),
                 std::max(new_layout.shape.height(), new_constraints.minimum.height())};
-            set_layout(new_layout);
+            relayout(new_layout);
 
             if (new_constraints != old_constraints) {
                 // The constraints have changed, properly constrain and layout on the next frame.
                 ++global_counter<"text_widget:delegate:constrain">;
                 request_scroll();
-                process_event({gui_event_type::window_reconstrain});
+                request_reconstrain();
             }
         } else {
             // The layout is incomplete, properly constrain and layout on the next frame.
             ++global_counter<"text_widget:delegate:constrain">;
             request_scroll();
-            process_event({gui_event_type::window_reconstrain});
+            request_reconstrain();
         }
     });
 
     _text_style_cbt = text_style.subscribe([&](auto...) {
         ++global_counter<"text_widget:text_style:constrain">;
         request_scroll();
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
     });
 
     _cursor_state_cbt = _cursor_state.subscribe([&](auto...) {
@@ -816,7 +818,7 @@ bool text_widget::handle_event(gui_event const& event) noexcept
             }
 
             ++global_counter<"text_widget:mouse_down:relayout">;
-            process_event({gui_event_type::window_relayout});
+            request_relayout();
             request_scroll();
             return true;
         }
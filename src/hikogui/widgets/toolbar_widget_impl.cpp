@@ -25,7 +25,7 @@ toolbar_widget::toolbar_widget(widget *parent) noexcept : super(parent)
     _layout = {};
 
     for (auto& child : _children) {
-        child.set_constraints(child.value->update_constraints());
+        child.set_constraints(child.value->reconstrain());
     }
 
     auto r = _children.constraints(os_settings::left_to_right());
@@ -55,7 +55,7 @@ void toolbar_widget::set_layout(widget_layout const& context) noexcept
         hilet child_clipping_rectangle =
             aarectanglei{child.shape.x() - overhang, 0, child.shape.width() + overhang * 2, context.height() + overhang * 2};
 
-        child.value->set_layout(context.transform(child.shape, 1.0f, child_clipping_rectangle));
+        child.value->relayout(context.transform(child.shape, 1.0f, child_clipping_rectangle));
     }
 }
 
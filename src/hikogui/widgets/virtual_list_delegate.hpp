@@ -0,0 +1,108 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file widgets/virtual_list_delegate.hpp Defines virtual_list_delegate.
+ * @ingroup widget_delegates
+ */
+
+#pragma once
+
+#include "widget.hpp"
+#include "../notifier.hpp"
+#include <memory>
+
+namespace hi { inline namespace v1 {
+
+/** A delegate that provides the rows of a virtual_list_widget.
+ *
+ * The list only creates widgets for the rows that are visible, the delegate
+ * creates a widget for a row on request and may reuse a widget of a row that
+ * scrolled out of view for another row.
+ *
+ * @ingroup widget_delegates
+ */
+class virtual_list_delegate {
+public:
+    using notifier_type = notifier<>;
+    using callback_token = notifier_type::callback_token;
+    using callback_proto = notifier_type::callback_proto;
+
+    virtual ~virtual_list_delegate() = default;
+
+    virtual void init(widget& sender) noexcept {}
+
+    virtual void deinit(widget& sender) noexcept {}
+
+    /** The number of rows in the list.
+     */
+    [[nodiscard]] virtual std::size_t size(widget const& sender) const noexcept
+    {
+        return 0;
+    }
+
+    /** The estimated extent of a row that has not been shown yet.
+     *
+     * This is the height of a row in a vertical list, or the width of a column in
+     * a horizontal list, including the margins of the widget.
+     *
+     * The estimate is used to size the scroll-bars; once a row is shown its
+     * actual extent is used.
+     *
+     * @param sender The widget that called this function.
+     * @param index The index of the row.
+     */
+    [[nodiscard]] virtual int estimated_extent(widget const& sender, std::size_t index) const noexcept
+    {
+        return sender.theme().size<int>() + sender.theme().margin<int>() * 2;
+    }
+
+    /** Create a widget for a row.
+     *
+     * @param sender The widget that called this function, this should be the parent of the new widget.
+     * @param index The index of the row.
+     * @return The new widget.
+     */
+    [[nodiscard]] virtual std::unique_ptr<widget> make_widget(widget& sender, std::size_t index) noexcept = 0;
+
+    /** The kind of widget that displays a row.
+     *
+     * The widget of a row is only reused for another row of the same kind. A delegate
+     * which creates different types of widgets should return a different kind for
+     * each type.
+     *
+     * @param sender The widget that called this function.
+     * @param index The index of the row.
+     * @return The kind of the row.
+     */
+    [[nodiscard]] virtual std::size_t row_kind(widget const& sender, std::size_t index) const noexcept
+    {
+        return 0;
+    }
+
+    /** Reuse the widget of a row that is no longer visible to display another row.
+     *
+     * @param sender The widget that called this function.
+     * @param row_widget A widget previously created by `make_widget()` for a row of the same kind.
+     * @param index The index of the row to display.
+     * @return True when the widget was reused, false when a new widget must be created; the
+     *         rejected widget is kept for another row.
+     */
+    virtual bool reuse_widget(widget& sender, widget& row_widget, std::size_t index) noexcept
+    {
+        return false;
+    }
+
+    /** Subscribe a callback for notifying the widget that the rows have changed.
+     */
+    [[nodiscard]] callback_token
+    subscribe(forward_of<callback_proto> auto&& callback, callback_flags flags = callback_flags::synchronous) noexcept
+    {
+        return _notifier.subscribe(hi_forward(callback), flags);
+    }
+
+protected:
+    notifier_type _notifier;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,395 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file widgets/virtual_list_widget.hpp Defines virtual_list_widget.
+ * @ingroup widgets
+ */
+
+#pragma once
+
+#include "widget.hpp"
+#include "virtual_list_delegate.hpp"
+#include "../layout/extent_index.hpp"
+#include "../geometry/module.hpp"
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+namespace hi { inline namespace v1 {
+
+/** A list which only creates widgets for the rows that are visible.
+ *
+ * The rows are provided by a `virtual_list_delegate`. The list is designed to be
+ * the content of a `scroll_widget`; the `scroll_aperture_widget` lays out the list at
+ * its full size, and the list uses the clipping rectangle of its layout to find the
+ * rows inside the aperture.
+ *
+ * Only the visible rows, plus `overscan` rows before and after them, have a widget.
+ * The widgets of rows that scroll out of view are recycled for the rows of the same
+ * kind that scroll into view, when the delegate supports it.
+ *
+ * Rows which have not been shown yet use the extent estimated by the delegate, once a
+ * row is shown the preferred size of its widget is used. Finding the rows inside the
+ * aperture is O(log n) in the number of rows, therefor the cost of a frame does not
+ * depend on the number of rows.
+ *
+ * Rows are laid out from top to bottom in a vertical list, and from left to right
+ * in a horizontal list. Each widget is stretched to the full width of a vertical list,
+ * or the full height of a horizontal list.
+ *
+ * @ingroup widgets
+ * @tparam Axis The axis along which the rows are laid out. Either `axis::horizontal` or
+ *              `axis::vertical`.
+ */
+template<axis Axis = axis::vertical>
+class virtual_list_widget final : public widget {
+public:
+    static_assert(Axis == axis::horizontal or Axis == axis::vertical);
+
+    using super = widget;
+    using delegate_type = virtual_list_delegate;
+    static constexpr hi::axis axis = Axis;
+
+    std::shared_ptr<delegate_type> delegate;
+
+    /** The number of rows before and after the visible rows which also have a widget.
+     *
+     * These rows are laid out before they scroll into view, which hides the cost of
+     * creating their widgets while scrolling.
+     */
+    std::size_t overscan = 4;
+
+    ~virtual_list_widget()
+    {
+        hi_assert_not_null(delegate);
+        delegate->deinit(*this);
+    }
+
+    /** Construct a virtual list.
+     *
+     * @param parent The parent widget, normally the aperture of a `scroll_widget`.
+     * @param delegate The delegate which provides the rows.
+     */
+    virtual_list_widget(widget *parent, std::shared_ptr<delegate_type> delegate) noexcept :
+        super(parent), delegate(std::move(delegate))
+    {
+        hi_axiom(loop::main().on_thread());
+        hi_assert_not_null(this->delegate);
+
+        if (parent) {
+            semantic_layer = parent->semantic_layer;
+        }
+
+        _delegate_cbt = this->delegate->subscribe([&] {
+            _reset = true;
+            ++global_counter<"virtual_list_widget:delegate:constrain">;
+            request_reconstrain();
+        });
+
+        this->delegate->init(*this);
+    }
+
+    /** The number of rows.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _extents.size();
+    }
+
+    /** The number of rows which currently have a widget.
+     */
+    [[nodiscard]] std::size_t num_materialized() const noexcept
+    {
+        return _rows.size();
+    }
+
+    /** The rectangle of a row in the local coordinate system.
+     */
+    [[nodiscard]] aarectanglei row_rectangle(std::size_t index) const noexcept
+    {
+        hi_axiom(index < size());
+
+        hilet offset = _extents.offset(index);
+        hilet extent = _extents[index];
+        if constexpr (axis == axis::vertical) {
+            return aarectanglei{0, _layout.height() - offset - extent, _layout.width(), extent};
+        } else {
+            return aarectanglei{offset, 0, extent, _layout.height()};
+        }
+    }
+
+    /** Scroll the list so that a row is visible.
+     *
+     * @param index The index of the row.
+     */
+    void scroll_to_row(std::size_t index) noexcept
+    {
+        hi_axiom(loop::main().on_thread());
+        scroll_to_show(row_rectangle(index));
+    }
+
+    /// @privatesection
+    [[nodiscard]] generator<widget const&> children(bool include_invisible) const noexcept override
+    {
+        for (hilet& row : _rows) {
+            co_yield *row.value;
+        }
+
+        // The recycled widgets are still visited, so that they are removed from the hitbox index.
+        if (include_invisible) {
+            for (hilet& recycled : _recycled) {
+                co_yield *recycled.value;
+            }
+        }
+    }
+
+    [[nodiscard]] box_constraints update_constraints() noexcept override
+    {
+        _layout = {};
+
+        if (std::exchange(_reset, false)) {
+            while (not _rows.empty()) {
+                recycle(std::move(_rows.back()));
+                _rows.pop_back();
+            }
+
+            _extents.assign(delegate->size(*this), [&](std::size_t index) {
+                return delegate->estimated_extent(*this, index);
+            });
+            _cross_minimum = 0;
+            _cross_preferred = 0;
+        }
+
+        if (_rows.empty() and not _extents.empty()) {
+            // Before the first layout the visible rows are not known; the first row is
+            // created so that the list has a size in the cross-axis.
+            materialize(0, 1);
+        }
+
+        for (auto& row : _rows) {
+            measure(row);
+        }
+
+        hilet total = _extents.total();
+        if constexpr (axis == axis::vertical) {
+            return {
+                extent2i{_cross_minimum, 0},
+                extent2i{_cross_preferred, total},
+                extent2i{extent2i::large().width(), std::max(total, extent2i::large().height())}};
+        } else {
+            return {
+                extent2i{0, _cross_minimum},
+                extent2i{total, _cross_preferred},
+                extent2i{std::max(total, extent2i::large().width()), extent2i::large().height()}};
+        }
+    }
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        _layout = context;
+
+        // Find the rows inside the clipping rectangle, which is the aperture of the scroll widget.
+        auto first = 0_uz;
+        auto last = 0_uz;
+        if (hilet clip = intersect(context.clipping_rectangle, context.rectangle()); clip and not _extents.empty()) {
+            hilet begin = axis == axis::vertical ? context.height() - clip.top() : clip.left();
+            hilet end = axis == axis::vertical ? context.height() - clip.bottom() : clip.right();
+
+            first = _extents.find(begin);
+            last = std::min(_extents.find(end - 1) + 1, _extents.size());
+
+            first = first > overscan ? first - overscan : 0_uz;
+            last = std::min(last + overscan, _extents.size());
+        }
+
+        if (materialize(first, last)) {
+            // The rows that were shown for the first time have a different extent than was estimated.
+            ++global_counter<"virtual_list_widget:measure:constrain">;
+            request_reconstrain();
+        }
+
+        for (hilet& row : _rows) {
+            hilet& constraints = row.value->reconstrain();
+            auto rectangle = row_rectangle(row.index);
+            rectangle = aarectanglei{
+                rectangle.left() + constraints.margins.left(),
+                rectangle.bottom() + constraints.margins.bottom(),
+                std::max(0, rectangle.width() - constraints.margins.left() - constraints.margins.right()),
+                std::max(0, rectangle.height() - constraints.margins.bottom() - constraints.margins.top())};
+
+            hilet shape = box_shape{override_t{}, constraints, rectangle, theme().baseline_adjustment()};
+            row.value->relayout(context.transform(shape, 0.0f));
+        }
+    }
+
+    void draw(draw_context const& context) noexcept override
+    {
+        if (*mode > widget_mode::invisible) {
+            for (hilet& row : _rows) {
+                row.value->draw(context);
+            }
+        }
+    }
+
+    [[nodiscard]] hitbox hitbox_test(point2i position) const noexcept override
+    {
+        hi_axiom(loop::main().on_thread());
+
+        if (*mode >= widget_mode::partial) {
+            auto r = hitbox{};
+            for (hilet& row : _rows) {
+                r = row.value->hitbox_test_from_parent(position, r);
+            }
+            return r;
+        } else {
+            return {};
+        }
+    }
+    /// @endprivatesection
+private:
+    struct row_type {
+        std::size_t index;
+
+        /** The kind of the row, as returned by `delegate->row_kind()`.
+         */
+        std::size_t kind;
+
+        std::unique_ptr<widget> value;
+    };
+
+    /** The rows which have a widget, ordered by index.
+     */
+    std::vector<row_type> _rows;
+
+    /** Widgets of rows which are no longer visible.
+     *
+     * The index of a recycled row is no longer used, only its kind.
+     */
+    std::vector<row_type> _recycled;
+
+    /** The extent of each row, either estimated or measured.
+     */
+    extent_index _extents;
+
+    int _cross_minimum = 0;
+    int _cross_preferred = 0;
+
+    /** The rows of the delegate have changed.
+     */
+    bool _reset = true;
+
+    notifier<>::callback_token _delegate_cbt;
+
+    /** Update the extent of a row, and the cross-axis constraints of the list.
+     *
+     * @return True if the extent of the row has changed.
+     */
+    bool measure(row_type const& row) noexcept
+    {
+        hilet& constraints = row.value->reconstrain();
+        hilet& margins = constraints.margins;
+
+        if constexpr (axis == axis::vertical) {
+            inplace_max(_cross_minimum, constraints.minimum.width() + margins.left() + margins.right());
+            inplace_max(_cross_preferred, constraints.preferred.width() + margins.left() + margins.right());
+            return _extents.set(row.index, constraints.preferred.height() + margins.bottom() + margins.top());
+        } else {
+            inplace_max(_cross_minimum, constraints.minimum.height() + margins.bottom() + margins.top());
+            inplace_max(_cross_preferred, constraints.preferred.height() + margins.bottom() + margins.top());
+            return _extents.set(row.index, constraints.preferred.width() + margins.left() + margins.right());
+        }
+    }
+
+    /** Make sure only the rows in the range have a widget.
+     *
+     * @param first The index of the first row.
+     * @param last The index one beyond the last row.
+     * @return True if the extent of one of the new rows was different than estimated.
+     */
+    bool materialize(std::size_t first, std::size_t last) noexcept
+    {
+        if (not _rows.empty() and _rows.front().index == first and _rows.back().index + 1 == last) {
+            return false;
+        }
+
+        auto old_rows = std::exchange(_rows, {});
+        for (auto& row : old_rows) {
+            if (row.index < first or row.index >= last) {
+                recycle(std::move(row));
+            }
+        }
+
+        auto r = false;
+        auto it = std::find_if(old_rows.begin(), old_rows.end(), [](hilet& row) {
+            return row.value != nullptr;
+        });
+        _rows.reserve(last - first);
+        for (auto index = first; index != last; ++index) {
+            if (it != old_rows.end() and it->index == index) {
+                _rows.push_back(std::move(*it++));
+            } else {
+                _rows.push_back(acquire(index));
+                r |= measure(_rows.back());
+            }
+        }
+
+        // Keep enough widgets to replace all the rows when scrolling a full page, drop the
+        // widgets that were recycled the longest ago.
+        if (_recycled.size() > _rows.size()) {
+            _recycled.erase(_recycled.begin(), _recycled.end() - _rows.size());
+        }
+        return r;
+    }
+
+    /** Get a widget for a row, reusing a recycled widget of the same kind when possible.
+     *
+     * Only the most recently recycled widget of the same kind is offered to the delegate;
+     * when the delegate rejects it, it stays recycled and a new widget is created.
+     */
+    [[nodiscard]] row_type acquire(std::size_t index) noexcept
+    {
+        hilet kind = delegate->row_kind(*this, index);
+
+        hilet it = std::find_if(_recycled.rbegin(), _recycled.rend(), [kind](hilet& recycled) {
+            return recycled.kind == kind;
+        });
+        if (it != _recycled.rend() and delegate->reuse_widget(*this, *it->value, index)) {
+            auto r = row_type{index, kind, std::move(it->value)};
+            _recycled.erase(std::next(it).base());
+
+            // The widget shows different data, which may change its size.
+            r.value->request_reconstrain();
+            return r;
+        }
+
+        ++global_counter<"virtual_list_widget:make_widget">;
+        auto r = row_type{index, kind, delegate->make_widget(*this, index)};
+        hi_assert_not_null(r.value);
+        hi_assert(r.value->parent == this);
+        return r;
+    }
+
+    /** Hide the widget of a row that is no longer visible, and keep it for reuse.
+     */
+    void recycle(row_type row) noexcept
+    {
+        if (row.value->layout()) {
+            // An empty clipping rectangle makes sure the widget no longer receives the mouse.
+            row.value->relayout(row.value->layout().override_clip(aarectanglei{}));
+        }
+        _recycled.push_back(std::move(row));
+    }
+};
+
+/** A virtual list of rows laid out from top to bottom.
+ * @ingroup widgets
+ */
+using virtual_column_widget = virtual_list_widget<axis::vertical>;
+
+/** A virtual list of columns laid out from left to right.
+ * @ingroup widgets
+ */
+using virtual_row_widget = virtual_list_widget<axis::horizontal>;
+
+}} // namespace hi::v1
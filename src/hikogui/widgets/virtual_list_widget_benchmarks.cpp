@@ -0,0 +1,209 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "virtual_list_widget.hpp"
+#include "../GUI/hitbox_index.hpp"
+#include "../GFX/draw_context.hpp"
+#include "../concurrency/subsystem.hpp"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace hi;
+
+namespace {
+
+/** A row of 20 pixels high.
+ */
+class virtual_list_benchmarks_row : public hi::widget {
+public:
+    virtual_list_benchmarks_row(widget *parent) noexcept : hi::widget(parent) {}
+
+    [[nodiscard]] box_constraints update_constraints() noexcept override
+    {
+        _layout = {};
+        return {extent2i{50, 20}, extent2i{50, 20}, extent2i{50, 20}};
+    }
+
+    [[nodiscard]] hitbox hitbox_test(point2i position) const noexcept override
+    {
+        if (*mode >= widget_mode::partial and layout().contains(position)) {
+            return {id, _layout.elevation, hitbox_type::button};
+        } else {
+            return {};
+        }
+    }
+};
+
+class virtual_list_benchmarks_delegate : public virtual_list_delegate {
+public:
+    std::size_t num_rows;
+
+    virtual_list_benchmarks_delegate(std::size_t num_rows) noexcept : num_rows(num_rows) {}
+
+    [[nodiscard]] std::size_t size(widget const& sender) const noexcept override
+    {
+        return num_rows;
+    }
+
+    [[nodiscard]] int estimated_extent(widget const& sender, std::size_t index) const noexcept override
+    {
+        return 20;
+    }
+
+    [[nodiscard]] std::unique_ptr<widget> make_widget(widget& sender, std::size_t index) noexcept override
+    {
+        return std::make_unique<virtual_list_benchmarks_row>(&sender);
+    }
+
+    bool reuse_widget(widget& sender, widget& row_widget, std::size_t index) noexcept override
+    {
+        return true;
+    }
+};
+
+/** A top-level widget of 1000 x 1000 pixels, which scrolls the list like a scroll_aperture_widget.
+ */
+class virtual_list_benchmarks_window : public hi::widget {
+public:
+    std::unique_ptr<virtual_column_widget> list;
+    int offset = 0;
+
+    virtual_list_benchmarks_window(std::size_t num_rows) noexcept : hi::widget(nullptr)
+    {
+        list = std::make_unique<virtual_column_widget>(this, std::make_shared<virtual_list_benchmarks_delegate>(num_rows));
+    }
+
+    [[nodiscard]] hi::theme const& theme() const noexcept override
+    {
+        static auto r = hi::theme{};
+        return r;
+    }
+
+    [[nodiscard]] generator<widget const&> children(bool include_invisible) const noexcept override
+    {
+        co_yield *list;
+    }
+
+    [[nodiscard]] box_constraints update_constraints() noexcept override
+    {
+        _layout = {};
+        list->reconstrain();
+        return {extent2i{1000, 1000}, extent2i{1000, 1000}, extent2i{1000, 1000}};
+    }
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        _layout = context;
+
+        hilet height = list->reconstrain().preferred.height();
+        auto shape = box_shape{};
+        shape.rectangle = aarectanglei{0, context.height() - height + offset, context.width(), height};
+        list->relayout(context.transform(shape, 1.0f, context.rectangle()));
+    }
+
+    void draw(draw_context const& context) noexcept override
+    {
+        list->draw(context);
+    }
+};
+
+struct virtual_list_benchmarks_fixture {
+    // The index must outlive the widgets.
+    hitbox_index index;
+    std::unique_ptr<virtual_list_benchmarks_window> window_widget;
+    widget_layout window_layout;
+
+    std::vector<pipeline_box::vertex> box_buffer = std::vector<pipeline_box::vertex>(16);
+    std::vector<pipeline_image::vertex> image_buffer = std::vector<pipeline_image::vertex>(16);
+    std::vector<pipeline_SDF::vertex> sdf_buffer = std::vector<pipeline_SDF::vertex>(16);
+    std::vector<pipeline_alpha::vertex> alpha_buffer = std::vector<pipeline_alpha::vertex>(16);
+    vector_span<pipeline_box::vertex> box_vertices = vector_span<pipeline_box::vertex>{box_buffer};
+    vector_span<pipeline_image::vertex> image_vertices = vector_span<pipeline_image::vertex>{image_buffer};
+    vector_span<pipeline_SDF::vertex> sdf_vertices = vector_span<pipeline_SDF::vertex>{sdf_buffer};
+    vector_span<pipeline_alpha::vertex> alpha_vertices = vector_span<pipeline_alpha::vertex>{alpha_buffer};
+
+    virtual_list_benchmarks_fixture(std::size_t num_rows) noexcept :
+        window_layout(
+            extent2i{1000, 1000},
+            gui_window_size::normal,
+            subpixel_orientation::unknown,
+            std::chrono::utc_clock::now())
+    {
+        hi::start_system();
+
+        window_widget = std::make_unique<virtual_list_benchmarks_window>(num_rows);
+        index.reset(extent2i{1000, 1000});
+        frame();
+    }
+
+    /** Scroll the list and render a frame headless.
+     */
+    void scroll(int offset) noexcept
+    {
+        window_widget->offset = offset;
+        window_widget->request_relayout();
+        frame();
+    }
+
+    void frame() noexcept
+    {
+        window_widget->reconstrain();
+        window_widget->relayout(window_layout);
+        window_widget->reindex(index);
+
+        auto context = draw_context{nullptr, box_vertices, image_vertices, sdf_vertices, alpha_vertices};
+        context.frame_buffer_index = 0;
+        context.scissor_region = aarectanglei{0, 0, 1000, 1000};
+        window_widget->draw(context);
+    }
+
+    /** The maximum scroll offset.
+     */
+    [[nodiscard]] int max_offset() const noexcept
+    {
+        return window_widget->list->layout().height() - 1000;
+    }
+};
+
+} // namespace
+
+/** Scrolling smoothly through the list, 7 pixels per frame.
+ *
+ * The time per frame should not depend on the number of rows.
+ */
+static void virtual_list_scroll(benchmark::State& state)
+{
+    auto fixture = virtual_list_benchmarks_fixture{narrow_cast<std::size_t>(state.range(0))};
+
+    auto offset = 0;
+    for (auto _ : state) {
+        offset += 7;
+        if (offset > fixture.max_offset()) {
+            offset = 0;
+        }
+        fixture.scroll(offset);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(virtual_list_scroll)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+/** Jumping to a different part of the list every frame, which replaces all visible rows.
+ */
+static void virtual_list_jump(benchmark::State& state)
+{
+    auto fixture = virtual_list_benchmarks_fixture{narrow_cast<std::size_t>(state.range(0))};
+
+    auto offset = 0;
+    for (auto _ : state) {
+        // Step a prime number of pixels, larger than the window, so that each frame shows different rows.
+        offset += 7919;
+        if (offset > fixture.max_offset()) {
+            offset %= fixture.max_offset();
+        }
+        fixture.scroll(offset);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(virtual_list_jump)->RangeMultiplier(10)->Range(1'000, 1'000'000);
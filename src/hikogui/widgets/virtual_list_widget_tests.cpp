@@ -0,0 +1,262 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "virtual_list_widget.hpp"
+#include "../concurrency/subsystem.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace hi;
+
+class virtual_list_widget_tests : public ::testing::Test {
+protected:
+    /** A row of 50 x `height` pixels, which remembers which row it displays.
+     */
+    class row_widget_moc : public hi::widget {
+    public:
+        std::size_t index;
+        int height;
+
+        row_widget_moc(widget *parent, std::size_t index, int height) noexcept :
+            hi::widget(parent), index(index), height(height)
+        {
+        }
+
+        [[nodiscard]] box_constraints update_constraints() noexcept override
+        {
+            _layout = {};
+            return {extent2i{50, height}, extent2i{50, height}, extent2i{50, height}};
+        }
+    };
+
+    class delegate_moc : public virtual_list_delegate {
+    public:
+        std::size_t num_rows;
+        int row_height = 20;
+        bool reuse = true;
+        std::size_t num_kinds = 1;
+        std::size_t num_made = 0;
+        std::size_t num_mismatched = 0;
+
+        delegate_moc(std::size_t num_rows) noexcept : num_rows(num_rows) {}
+
+        void set_size(std::size_t new_num_rows) noexcept
+        {
+            num_rows = new_num_rows;
+            _notifier();
+        }
+
+        [[nodiscard]] std::size_t size(widget const& sender) const noexcept override
+        {
+            return num_rows;
+        }
+
+        [[nodiscard]] int estimated_extent(widget const& sender, std::size_t index) const noexcept override
+        {
+            return 20;
+        }
+
+        [[nodiscard]] std::unique_ptr<widget> make_widget(widget& sender, std::size_t index) noexcept override
+        {
+            ++num_made;
+            return std::make_unique<row_widget_moc>(&sender, index, row_height);
+        }
+
+        [[nodiscard]] std::size_t row_kind(widget const& sender, std::size_t index) const noexcept override
+        {
+            return index % num_kinds;
+        }
+
+        bool reuse_widget(widget& sender, widget& row_widget, std::size_t index) noexcept override
+        {
+            if (reuse) {
+                auto& row = dynamic_cast<row_widget_moc&>(row_widget);
+                if (row_kind(sender, row.index) != row_kind(sender, index)) {
+                    ++num_mismatched;
+                }
+                row.index = index;
+                row.height = row_height;
+            }
+            return reuse;
+        }
+    };
+
+    /** A top-level widget of 200 x 100 pixels, which scrolls the list like a scroll_aperture_widget.
+     */
+    class window_widget_moc : public hi::widget {
+    public:
+        std::unique_ptr<virtual_column_widget> list;
+
+        /** The distance between the top of the list and the top of the window.
+         */
+        int offset = 0;
+
+        window_widget_moc(std::shared_ptr<delegate_moc> delegate) noexcept : hi::widget(nullptr)
+        {
+            list = std::make_unique<virtual_column_widget>(this, std::move(delegate));
+        }
+
+        [[nodiscard]] hi::theme const& theme() const noexcept override
+        {
+            static auto r = hi::theme{};
+            return r;
+        }
+
+        [[nodiscard]] generator<widget const&> children(bool include_invisible) const noexcept override
+        {
+            co_yield *list;
+        }
+
+        [[nodiscard]] box_constraints update_constraints() noexcept override
+        {
+            _layout = {};
+            list->reconstrain();
+            return {extent2i{200, 100}, extent2i{200, 100}, extent2i{200, 100}};
+        }
+
+        void set_layout(widget_layout const& context) noexcept override
+        {
+            _layout = context;
+
+            hilet height = list->reconstrain().preferred.height();
+            auto shape = box_shape{};
+            shape.rectangle = aarectanglei{0, context.height() - height + offset, context.width(), height};
+            list->relayout(context.transform(shape, 1.0f, context.rectangle()));
+        }
+    };
+
+    std::shared_ptr<delegate_moc> delegate;
+    std::unique_ptr<window_widget_moc> window_widget;
+
+    void SetUp() override
+    {
+        hi::start_system();
+
+        delegate = std::make_shared<delegate_moc>(100'000);
+        window_widget = std::make_unique<window_widget_moc>(delegate);
+        frame();
+    }
+
+    void frame()
+    {
+        window_widget->reconstrain();
+        window_widget->relayout(widget_layout{
+            extent2i{200, 100}, gui_window_size::normal, subpixel_orientation::unknown, std::chrono::utc_clock::now()});
+    }
+
+    void scroll(int offset)
+    {
+        window_widget->offset = offset;
+        window_widget->request_relayout();
+        frame();
+    }
+
+    /** The index of each row which has a widget.
+     */
+    std::vector<std::size_t> materialized() const
+    {
+        auto r = std::vector<std::size_t>{};
+        for (auto& child : window_widget->list->children(false)) {
+            r.push_back(dynamic_cast<row_widget_moc const&>(child).index);
+        }
+        return r;
+    }
+
+    static std::vector<std::size_t> range(std::size_t first, std::size_t last)
+    {
+        auto r = std::vector<std::size_t>{};
+        for (auto i = first; i != last; ++i) {
+            r.push_back(i);
+        }
+        return r;
+    }
+};
+
+TEST_F(virtual_list_widget_tests, only_visible_rows)
+{
+    ASSERT_EQ(window_widget->list->size(), 100'000);
+    ASSERT_EQ(window_widget->list->layout().height(), 2'000'000);
+
+    // 5 rows are visible, followed by 4 overscan rows.
+    ASSERT_EQ(materialized(), range(0, 9));
+    ASSERT_EQ(delegate->num_made, 9);
+}
+
+TEST_F(virtual_list_widget_tests, scroll_recycles_rows)
+{
+    scroll(1000);
+    ASSERT_EQ(materialized(), range(46, 59));
+    ASSERT_EQ(delegate->num_made, 13);
+
+    scroll(1020);
+    ASSERT_EQ(materialized(), range(47, 60));
+    ASSERT_EQ(delegate->num_made, 13);
+
+    // Jump to the end of the list.
+    scroll(2'000'000 - 100);
+    ASSERT_EQ(materialized(), range(99'991, 100'000));
+    ASSERT_EQ(delegate->num_made, 13);
+}
+
+TEST_F(virtual_list_widget_tests, scroll_without_reuse)
+{
+    delegate->reuse = false;
+
+    scroll(1000);
+    ASSERT_EQ(materialized(), range(46, 59));
+    ASSERT_EQ(delegate->num_made, 22);
+
+    // Only the row that scrolled into view is created.
+    scroll(1020);
+    ASSERT_EQ(materialized(), range(47, 60));
+    ASSERT_EQ(delegate->num_made, 23);
+}
+
+TEST_F(virtual_list_widget_tests, scroll_recycles_row_kinds)
+{
+    delegate->num_kinds = 2;
+
+    // 7 even and 6 odd rows are needed, 5 even and 4 odd rows were recycled.
+    scroll(1000);
+    ASSERT_EQ(materialized(), range(46, 59));
+    ASSERT_EQ(delegate->num_made, 13);
+
+    // Rows 46 and 47 are reused for rows 60 and 59.
+    scroll(1040);
+    ASSERT_EQ(materialized(), range(48, 61));
+    ASSERT_EQ(delegate->num_made, 13);
+    ASSERT_EQ(delegate->num_mismatched, 0);
+}
+
+TEST_F(virtual_list_widget_tests, measured_extent)
+{
+    delegate->row_height = 30;
+    delegate->set_size(1000);
+    frame();
+    frame();
+
+    // The rows that were shown are measured, the other rows use the estimated extent.
+    // After measuring fewer rows fit in the window, but row 8 keeps its measured extent.
+    hilet height = 30 * 9 + 20 * (1000 - 9);
+    ASSERT_EQ(window_widget->list->layout().height(), height);
+    ASSERT_EQ(materialized(), range(0, 8));
+    ASSERT_EQ(window_widget->list->row_rectangle(1), (aarectanglei{0, height - 60, 200, 30}));
+}
+
+TEST_F(virtual_list_widget_tests, delegate_changed)
+{
+    delegate->set_size(3);
+    frame();
+
+    ASSERT_EQ(window_widget->list->size(), 3);
+    ASSERT_EQ(window_widget->list->layout().height(), 60);
+    ASSERT_EQ(materialized(), range(0, 3));
+
+    delegate->set_size(0);
+    frame();
+
+    ASSERT_EQ(window_widget->list->size(), 0);
+    ASSERT_TRUE(materialized().empty());
+}
@@ -33,6 +33,7 @@
 namespace hi { inline namespace v1 {
 class gui_window;
 class gfx_surface;
+class hitbox_index;
 
 /** An interactive graphical object as part of the user-interface.
  *
@@ -41,6 +42,10 @@ class gfx_surface;
  *  2. Updating Layout: `widget::set_layout()`
  *  3. Drawing: `widget::draw()`
  *
+ * The first two phases are incremental, a container calls `widget::reconstrain()`
+ * and `widget::relayout()` on its children, which only call `update_constraints()`
+ * and `set_layout()` for widgets that requested it, or for which something changed.
+ *
  * @ingroup widgets
  */
 class widget : public std::enable_shared_from_this<widget> {
@@ -130,6 +135,11 @@ public:
      * This function will recursively test with visual child widgets, when
      * widgets overlap on the screen the hitbox object with the highest elevation is returned.
      *
+     * The window routes the mouse through a `hitbox_index`, which calls this function directly on
+     * the widgets under the mouse. Therefor a widget should only return a hitbox for itself inside
+     * its own layout rectangle, and a container which returns a hitbox for itself should place its
+     * children at a higher elevation.
+     *
      * @param position The coordinate of the mouse local to the widget.
      * @return A hit_box object with the cursor-type and a reference to the widget.
      */
@@ -203,6 +213,51 @@ public:
         _layout = context;
     }
 
+    /** Get the constraints of the widget, updating them when needed.
+     *
+     * `update_constraints()` is only called when this widget requested a reconstrain,
+     * or when the constraints of one of its children have changed. Children which are
+     * not dirty are not visited at all.
+     *
+     * @return The constraints of the widget.
+     */
+    box_constraints const& reconstrain() noexcept;
+
+    /** Update the layout of the widget, when needed.
+     *
+     * `set_layout()` is only called when this widget requested a relayout, or when
+     * the context is different from the previous layout. When only a descendant
+     * requested a relayout `set_layout()` is called so that it can pass the context to
+     * its children; the children which are not dirty are skipped.
+     *
+     * @param context The layout for this child.
+     */
+    void relayout(widget_layout const& context) noexcept;
+
+    /** Check if the widget or one of its descendants needs to update its constraints.
+     */
+    [[nodiscard]] bool need_reconstrain() const noexcept
+    {
+        return _reconstrain or _reconstrain_descendant;
+    }
+
+    /** Check if the widget or one of its descendants needs to update its layout.
+     */
+    [[nodiscard]] bool need_relayout() const noexcept
+    {
+        return _relayout or _relayout_descendant;
+    }
+
+    /** Update the position of this widget and its descendants in the hitbox index of the window.
+     *
+     * This is called after layout; only the widgets whose layout was updated since
+     * the previous call are visited.
+     *
+     * @param index The hitbox index of the window.
+     * @param force Update every widget, for example after the index was reset.
+     */
+    void reindex(hitbox_index& index, bool force = false) noexcept;
+
     /** Get the current layout for this widget.
      */
     widget_layout const& layout() const noexcept
@@ -242,6 +297,27 @@ public:
         process_event({gui_event_type::window_redraw, layout().clipping_rectangle_on_window()});
     }
 
+    /** Request the constraints of the widget to be updated on the next frame.
+     *
+     * The ancestors are marked so that the constrain phase can find this widget,
+     * their own constraints are only updated when the constraints of their child change.
+     */
+    void request_reconstrain() const noexcept;
+
+    /** Request the layout of the widget to be updated on the next frame.
+     */
+    void request_relayout() const noexcept;
+
+    /** Request the constraints of this widget and all its descendants to be updated on the next frame.
+     *
+     * This is used for changes that affect every widget, like a change of theme.
+     */
+    void request_reconstrain_recursive() noexcept;
+
+    /** Request the layout of this widget and all its descendants to be updated on the next frame.
+     */
+    void request_relayout_recursive() noexcept;
+
     /** Handle command.
      * If a widget does not fully handle a command it should pass the
      * command to the super class' `handle_event()`.
@@ -345,6 +421,34 @@ public:
 protected:
     widget_layout _layout;
 
+    /** The constraints returned by the last call to `update_constraints()`.
+     */
+    box_constraints _constraints;
+
+    /** The widget needs to call `update_constraints()`.
+     */
+    mutable bool _reconstrain = true;
+
+    /** One of the descendants of the widget needs to call `update_constraints()`.
+     */
+    mutable bool _reconstrain_descendant = false;
+
+    /** The widget needs to call `set_layout()`.
+     */
+    mutable bool _relayout = true;
+
+    /** One of the descendants of the widget needs to call `set_layout()`.
+     */
+    mutable bool _relayout_descendant = false;
+
+    /** The layout has been updated and the widget needs to update its position in the hitbox index.
+     */
+    bool _reindex = true;
+
+    /** The hitbox index this widget was added to.
+     */
+    mutable hitbox_index *_hitbox_index = nullptr;
+
     decltype(mode)::callback_token _mode_cbt;
 
     /** Make an overlay rectangle.
@@ -357,6 +461,8 @@ protected:
      * @return A rectangle that fits the window's constraints in the local coordinate system.
      */
     [[nodiscard]] aarectanglei make_overlay_rectangle(aarectanglei requested_rectangle) const noexcept;
+
+    friend class hitbox_index;
 };
 
 inline widget *get_if(widget *start, widget_id id, bool include_invisible) noexcept
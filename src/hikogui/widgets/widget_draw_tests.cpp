@@ -0,0 +1,155 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "widget.hpp"
+#include "../GFX/draw_context.hpp"
+#include "../concurrency/subsystem.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace hi;
+
+class widget_draw_tests : public ::testing::Test {
+protected:
+    /** A widget which records if it was drawn.
+     */
+    class cell_widget_moc : public hi::widget {
+    public:
+        bool drawn = false;
+
+        cell_widget_moc(widget *parent) noexcept : hi::widget(parent) {}
+
+        void draw(draw_context const& context) noexcept override
+        {
+            if (*mode > widget_mode::invisible and overlaps(context, layout())) {
+                drawn = true;
+            }
+        }
+    };
+
+    /** A top-level widget with a grid of 4 x 3 cells of 100 x 100 pixels.
+     */
+    class window_widget_moc : public hi::widget {
+    public:
+        std::vector<std::unique_ptr<cell_widget_moc>> cells;
+
+        window_widget_moc() noexcept : hi::widget(nullptr)
+        {
+            for (auto i = 0; i != 12; ++i) {
+                cells.push_back(std::make_unique<cell_widget_moc>(this));
+            }
+        }
+
+        [[nodiscard]] generator<widget const&> children(bool include_invisible) const noexcept override
+        {
+            for (hilet& cell : cells) {
+                co_yield *cell;
+            }
+        }
+
+        void set_layout(widget_layout const& context) noexcept override
+        {
+            _layout = context;
+            for (auto i = 0; i != 12; ++i) {
+                auto shape = box_shape{};
+                shape.rectangle = aarectanglei{(i % 4) * 100, (i / 4) * 100, 100, 100};
+                cells[i]->relayout(context.transform(shape, 1.0f, shape.rectangle));
+            }
+        }
+
+        void draw(draw_context const& context) noexcept override
+        {
+            for (hilet& cell : cells) {
+                cell->draw(context);
+            }
+        }
+    };
+
+    std::vector<pipeline_box::vertex> box_buffer = std::vector<pipeline_box::vertex>(16);
+    std::vector<pipeline_image::vertex> image_buffer = std::vector<pipeline_image::vertex>(16);
+    std::vector<pipeline_SDF::vertex> sdf_buffer = std::vector<pipeline_SDF::vertex>(16);
+    std::vector<pipeline_alpha::vertex> alpha_buffer = std::vector<pipeline_alpha::vertex>(16);
+    vector_span<pipeline_box::vertex> box_vertices = vector_span<pipeline_box::vertex>{box_buffer};
+    vector_span<pipeline_image::vertex> image_vertices = vector_span<pipeline_image::vertex>{image_buffer};
+    vector_span<pipeline_SDF::vertex> sdf_vertices = vector_span<pipeline_SDF::vertex>{sdf_buffer};
+    vector_span<pipeline_alpha::vertex> alpha_vertices = vector_span<pipeline_alpha::vertex>{alpha_buffer};
+
+    std::unique_ptr<window_widget_moc> window_widget;
+
+    void SetUp() override
+    {
+        hi::start_system();
+
+        window_widget = std::make_unique<window_widget_moc>();
+        window_widget->relayout(widget_layout{
+            extent2i{400, 300}, gui_window_size::normal, subpixel_orientation::unknown, std::chrono::utc_clock::now()});
+    }
+
+    /** Draw the window headless, and return which cells were drawn.
+     */
+    std::vector<bool> draw(damage_region const& region)
+    {
+        // Without a device a draw context can not draw images or glyphs; the cells don't draw those.
+        auto context = draw_context{nullptr, box_vertices, image_vertices, sdf_vertices, alpha_vertices};
+        context.frame_buffer_index = 0;
+        context.scissor_region = region;
+
+        for (auto& cell : window_widget->cells) {
+            cell->drawn = false;
+        }
+        window_widget->draw(context);
+
+        auto r = std::vector<bool>{};
+        for (hilet& cell : window_widget->cells) {
+            r.push_back(cell->drawn);
+        }
+        return r;
+    }
+};
+
+TEST_F(widget_draw_tests, full_redraw)
+{
+    hilet drawn = draw(aarectanglei{0, 0, 400, 300});
+    ASSERT_EQ(drawn, std::vector<bool>(12, true));
+}
+
+TEST_F(widget_draw_tests, nothing_to_redraw)
+{
+    hilet drawn = draw(damage_region{});
+    ASSERT_EQ(drawn, std::vector<bool>(12, false));
+}
+
+TEST_F(widget_draw_tests, opposite_corners)
+{
+    // A blinking cursor in the bottom-left cell, and a progress bar in the top-right cell.
+    auto region = damage_region{aarectanglei{10, 10, 2, 20}};
+    region |= aarectanglei{310, 250, 80, 10};
+    ASSERT_EQ(region.size(), 2);
+
+    // clang-format off
+    hilet expected = std::vector<bool>{
+        true,  false, false, false,
+        false, false, false, false,
+        false, false, false, true};
+    // clang-format on
+    ASSERT_EQ(draw(region), expected);
+
+    // A single bounding rectangle would have redrawn every cell.
+    ASSERT_EQ(draw(bounding_rectangle(region)), std::vector<bool>(12, true));
+}
+
+TEST_F(widget_draw_tests, neighbours)
+{
+    // Damage across the edge of two neighbouring cells in the middle row.
+    hilet drawn = draw(aarectanglei{190, 140, 20, 20});
+
+    // clang-format off
+    hilet expected = std::vector<bool>{
+        false, false, false, false,
+        false, true,  true,  false,
+        false, false, false, false};
+    // clang-format on
+    ASSERT_EQ(drawn, expected);
+}
@@ -4,6 +4,7 @@
 
 #include "widget.hpp"
 #include "../GUI/gui_window.hpp"
+#include "../GUI/hitbox_index.hpp"
 #include "../ranges.hpp"
 #include "../counters.hpp"
 #include <ranges>
@@ -22,11 +23,118 @@ widget::widget(widget *parent) noexcept :
 
     _mode_cbt = mode.subscribe([&](auto...) {
         ++global_counter<"widget:mode:constrain">;
-        process_event({gui_event_type::window_reconstrain});
+        request_reconstrain();
+        // The parent may need to make room for, or remove the space of, a widget that changes visibility.
+        if (parent) {
+            parent->request_reconstrain();
+        }
     });
 }
 
-widget::~widget() {}
+widget::~widget()
+{
+    if (_hitbox_index != nullptr) {
+        _hitbox_index->erase(*this);
+    }
+}
+
+box_constraints const& widget::reconstrain() noexcept
+{
+    hi_axiom(loop::main().on_thread());
+
+    if (std::exchange(_reconstrain_descendant, false) and not _reconstrain) {
+        // Only visit the children that are dirty; this widget only needs to update
+        // its own constraints when the constraints of one of those children changed.
+        for (auto& child : children(true)) {
+            if (child.need_reconstrain()) {
+                hilet old_constraints = child._constraints;
+                if (child.reconstrain() != old_constraints) {
+                    _reconstrain = true;
+                }
+            }
+            if (child.need_relayout()) {
+                _relayout_descendant = true;
+            }
+        }
+    }
+
+    if (std::exchange(_reconstrain, false)) {
+        ++global_counter<"widget:update_constraints">;
+        _constraints = update_constraints();
+        // update_constraints() invalidates the layout.
+        _relayout = true;
+    }
+    return _constraints;
+}
+
+void widget::relayout(widget_layout const& context) noexcept
+{
+    hi_axiom(loop::main().on_thread());
+
+    // The display time point changes every frame; by itself it is not a reason to update the layout.
+    auto old_layout = _layout;
+    old_layout.display_time_point = context.display_time_point;
+
+    hilet relayout_self = std::exchange(_relayout, false);
+    hilet relayout_descendant = std::exchange(_relayout_descendant, false);
+    if (relayout_self or relayout_descendant or old_layout != context) {
+        ++global_counter<"widget:set_layout">;
+        set_layout(context);
+        _reindex = true;
+    }
+}
+
+void widget::reindex(hitbox_index& index, bool force) noexcept
+{
+    hi_axiom(loop::main().on_thread());
+
+    // The layout of a widget only changes when the layout of its parent was updated,
+    // so the sub-trees which were not laid out are skipped.
+    if (not std::exchange(_reindex, false) and not force) {
+        return;
+    }
+
+    index.insert(*this);
+    for (auto& child : children(true)) {
+        child.reindex(index, force);
+    }
+}
+
+void widget::request_reconstrain() const noexcept
+{
+    hi_axiom(loop::main().on_thread());
+
+    _reconstrain = true;
+    for (auto *w = parent; w != nullptr; w = w->parent) {
+        w->_reconstrain_descendant = true;
+    }
+}
+
+void widget::request_relayout() const noexcept
+{
+    hi_axiom(loop::main().on_thread());
+
+    _relayout = true;
+    for (auto *w = parent; w != nullptr; w = w->parent) {
+        w->_relayout_descendant = true;
+    }
+}
+
+void widget::request_reconstrain_recursive() noexcept
+{
+    request_reconstrain();
+    for (auto& child : children(true)) {
+        child.request_reconstrain_recursive();
+    }
+}
+
+void widget::request_relayout_recursive() noexcept
+{
+    request_relayout();
+    for (auto& child : children(true)) {
+        child.request_relayout_recursive();
+    }
+}
 
 [[nodiscard]] color widget::background_color() const noexcept
 {
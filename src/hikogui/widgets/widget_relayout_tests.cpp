@@ -0,0 +1,208 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "row_column_widget.hpp"
+#include "../counters.hpp"
+#include "../concurrency/subsystem.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace hi;
+
+class widget_relayout_tests : public ::testing::Test {
+protected:
+    /** A widget of a fixed size, which counts how often it was laid out.
+     */
+    class leaf_widget_moc : public hi::widget {
+    public:
+        extent2i size = extent2i{100, 50};
+        std::size_t num_set_layout = 0;
+
+        leaf_widget_moc(widget *parent) noexcept : hi::widget(parent) {}
+
+        [[nodiscard]] box_constraints update_constraints() noexcept override
+        {
+            _layout = {};
+            return {size, size, size};
+        }
+
+        void set_layout(widget_layout const& context) noexcept override
+        {
+            _layout = context;
+            ++num_set_layout;
+        }
+    };
+
+    /** A top-level widget of 200 x 300 pixels, with a column of three leaf widgets.
+     */
+    class window_widget_moc : public hi::widget {
+    public:
+        std::unique_ptr<column_widget> column;
+        std::vector<leaf_widget_moc *> leaves;
+
+        window_widget_moc() noexcept : hi::widget(nullptr)
+        {
+            column = std::make_unique<column_widget>(this);
+            for (auto i = 0; i != 3; ++i) {
+                leaves.push_back(&column->make_widget<leaf_widget_moc>());
+            }
+        }
+
+        [[nodiscard]] hi::theme const& theme() const noexcept override
+        {
+            static auto r = hi::theme{};
+            return r;
+        }
+
+        [[nodiscard]] generator<widget const&> children(bool include_invisible) const noexcept override
+        {
+            co_yield *column;
+        }
+
+        [[nodiscard]] box_constraints update_constraints() noexcept override
+        {
+            _layout = {};
+            column->reconstrain();
+            return {extent2i{200, 300}, extent2i{200, 300}, extent2i{200, 300}};
+        }
+
+        void set_layout(widget_layout const& context) noexcept override
+        {
+            _layout = context;
+
+            auto shape = box_shape{};
+            shape.rectangle = context.rectangle();
+            column->relayout(context.transform(shape, 0.0f));
+        }
+    };
+
+    std::unique_ptr<window_widget_moc> window_widget;
+
+    /** The number of widgets that updated their constraints during the last frame.
+     */
+    std::size_t num_constrained_widgets = 0;
+
+    /** The number of widgets that updated their layout during the last frame.
+     */
+    std::size_t num_laid_out_widgets = 0;
+
+    void SetUp() override
+    {
+        hi::start_system();
+
+        window_widget = std::make_unique<window_widget_moc>();
+        frame();
+    }
+
+    /** Constrain and lay out the widgets, counting them in the same way as `gui_window::render()`.
+     */
+    void frame()
+    {
+        hilet constrain_count = static_cast<uint64_t>(global_counter<"widget:update_constraints">);
+        window_widget->reconstrain();
+        num_constrained_widgets = narrow_cast<std::size_t>(global_counter<"widget:update_constraints"> - constrain_count);
+
+        hilet layout_count = static_cast<uint64_t>(global_counter<"widget:set_layout">);
+        window_widget->relayout(widget_layout{
+            extent2i{200, 300}, gui_window_size::normal, subpixel_orientation::unknown, std::chrono::utc_clock::now()});
+        num_laid_out_widgets = narrow_cast<std::size_t>(global_counter<"widget:set_layout"> - layout_count);
+    }
+
+    void reset_leaves()
+    {
+        for (auto leaf : window_widget->leaves) {
+            leaf->num_set_layout = 0;
+        }
+    }
+};
+
+TEST_F(widget_relayout_tests, first_frame)
+{
+    ASSERT_EQ(num_constrained_widgets, 5);
+    ASSERT_EQ(num_laid_out_widgets, 5);
+    for (auto leaf : window_widget->leaves) {
+        ASSERT_EQ(leaf->num_set_layout, 1);
+    }
+}
+
+TEST_F(widget_relayout_tests, clean_frame)
+{
+    reset_leaves();
+
+    // Only the display time point changed.
+    frame();
+    ASSERT_EQ(num_constrained_widgets, 0);
+    ASSERT_EQ(num_laid_out_widgets, 0);
+    for (auto leaf : window_widget->leaves) {
+        ASSERT_EQ(leaf->num_set_layout, 0);
+    }
+}
+
+TEST_F(widget_relayout_tests, dirty_bit_propagation)
+{
+    auto& leaf = *window_widget->leaves[1];
+    ASSERT_FALSE(window_widget->need_reconstrain());
+
+    leaf.request_reconstrain();
+    ASSERT_TRUE(leaf.need_reconstrain());
+    ASSERT_TRUE(window_widget->column->need_reconstrain());
+    ASSERT_TRUE(window_widget->need_reconstrain());
+    ASSERT_FALSE(window_widget->leaves[0]->need_reconstrain());
+    ASSERT_FALSE(window_widget->leaves[2]->need_reconstrain());
+
+    frame();
+    ASSERT_FALSE(window_widget->need_reconstrain());
+    ASSERT_FALSE(window_widget->need_relayout());
+    ASSERT_FALSE(window_widget->column->need_reconstrain());
+    ASSERT_FALSE(window_widget->column->need_relayout());
+    ASSERT_FALSE(leaf.need_reconstrain());
+    ASSERT_FALSE(leaf.need_relayout());
+}
+
+TEST_F(widget_relayout_tests, unchanged_constraints_stop_at_leaf)
+{
+    reset_leaves();
+
+    // The size of the leaf did not change, so the column and window are not reconstrained.
+    window_widget->leaves[1]->request_reconstrain();
+    frame();
+    ASSERT_EQ(num_constrained_widgets, 1);
+
+    // The layout of the column did not change, but it must still lay out its dirty child.
+    ASSERT_EQ(num_laid_out_widgets, 3);
+    ASSERT_EQ(window_widget->leaves[0]->num_set_layout, 0);
+    ASSERT_EQ(window_widget->leaves[1]->num_set_layout, 1);
+    ASSERT_EQ(window_widget->leaves[2]->num_set_layout, 0);
+}
+
+TEST_F(widget_relayout_tests, changed_constraints_propagate)
+{
+    reset_leaves();
+
+    // The column grows, but the window keeps its size.
+    window_widget->leaves[1]->size = extent2i{150, 50};
+    window_widget->leaves[1]->request_reconstrain();
+    frame();
+    ASSERT_EQ(num_constrained_widgets, 3);
+    ASSERT_EQ(window_widget->leaves[1]->num_set_layout, 1);
+
+    // A second frame without changes does nothing.
+    frame();
+    ASSERT_EQ(num_constrained_widgets, 0);
+    ASSERT_EQ(num_laid_out_widgets, 0);
+}
+
+TEST_F(widget_relayout_tests, relayout_leaf)
+{
+    reset_leaves();
+
+    window_widget->leaves[2]->request_relayout();
+    frame();
+    ASSERT_EQ(num_constrained_widgets, 0);
+    ASSERT_EQ(num_laid_out_widgets, 3);
+    ASSERT_EQ(window_widget->leaves[0]->num_set_layout, 0);
+    ASSERT_EQ(window_widget->leaves[1]->num_set_layout, 0);
+    ASSERT_EQ(window_widget->leaves[2]->num_set_layout, 1);
+}
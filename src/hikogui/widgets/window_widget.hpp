@@ -53,6 +53,16 @@ public:
      */
     [[nodiscard]] toolbar_widget& toolbar() noexcept;
 
+    /** Check if the mouse is on the resize border of the window.
+     *
+     * The resize border has priority over the hitboxes of the widgets on the window.
+     *
+     * @param position The coordinate of the mouse local to the window.
+     * @param children_hitbox The hitbox of the toolbar and content at the position.
+     * @return The hitbox of the resize border, or @a children_hitbox.
+     */
+    [[nodiscard]] hitbox resize_border_hitbox_test(point2i position, hitbox children_hitbox) const noexcept;
+
     /// @privatesection
     [[nodiscard]] generator<widget const &> children(bool include_invisible) const noexcept override;
     [[nodiscard]] box_constraints update_constraints() noexcept override;
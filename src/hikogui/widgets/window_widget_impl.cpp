@@ -62,8 +62,8 @@ void window_widget::constructor_implementation() noexcept
     hi_assert_not_null(_toolbar);
 
     _layout = {};
-    _content_constraints =_content->update_constraints();
-    _toolbar_constraints =  _toolbar->update_constraints();
+    _content_constraints =_content->reconstrain();
+    _toolbar_constraints =  _toolbar->reconstrain();
 
     auto r = box_constraints{};
     r.minimum.width() = std::max(
@@ -134,8 +134,8 @@ void window_widget::set_layout(widget_layout const& context) noexcept
             point2i{context.width() - _content_constraints.margins.right(), toolbar_rectangle.bottom() - between_margin}};
         _content_shape = box_shape{_content_constraints, content_rectangle, theme().baseline_adjustment()};
     }
-    _toolbar->set_layout(context.transform(_toolbar_shape));
-    _content->set_layout(context.transform(_content_shape));
+    _toolbar->relayout(context.transform(_toolbar_shape));
+    _content->relayout(context.transform(_content_shape));
 }
 
 void window_widget::draw(draw_context const& context) noexcept
@@ -148,12 +148,18 @@ void window_widget::draw(draw_context const& context) noexcept
 
 hitbox window_widget::hitbox_test(point2i position) const noexcept
 {
-    constexpr float BORDER_WIDTH = 10.0f;
-
     hi_axiom(loop::main().on_thread());
 
     auto r = _toolbar->hitbox_test_from_parent(position);
     r = _content->hitbox_test_from_parent(position, r);
+    return resize_border_hitbox_test(position, r);
+}
+
+hitbox window_widget::resize_border_hitbox_test(point2i position, hitbox children_hitbox) const noexcept
+{
+    constexpr float BORDER_WIDTH = 10.0f;
+
+    hi_axiom(loop::main().on_thread());
 
     hilet is_on_l_edge = position.x() <= BORDER_WIDTH;
     hilet is_on_r_edge = position.x() >= (layout().width() - BORDER_WIDTH);
@@ -196,7 +202,7 @@ hitbox window_widget::hitbox_test(point2i position) const noexcept
     }
 
     // Border resize only has priority if there is no scroll-bar in the way.
-    if (r.type != hitbox_type::scroll_bar) {
+    if (children_hitbox.type != hitbox_type::scroll_bar) {
         if (is_on_l_edge and _can_resize_width) {
             return {id, _layout.elevation, hitbox_type::left_resize_border};
         } else if (is_on_r_edge and _can_resize_width) {
@@ -208,7 +214,7 @@ hitbox window_widget::hitbox_test(point2i position) const noexcept
         }
     }
 
-    return r;
+    return children_hitbox;
 }
 
 [[nodiscard]] color window_widget::background_color() noexcept
@@ -41,6 +41,7 @@ def main():
     ucd.parse_unicode_data(options.unicode_data_path, descriptions)
     ucd.parse_word_break_property(options.word_break_property_path, descriptions)
     ucd.add_hangul_decompositions(descriptions)
+    ucd.derive_normalization_quick_check(descriptions)
 
     compositions = ucd.make_composition_table(descriptions)
     decompositions = ucd.make_decomposition_table(descriptions)
@@ -12,6 +12,7 @@ from .unicode_data_parser import parse_unicode_data
 from .word_break_property_parser import parse_word_break_property
 
 from .hangul_decompositions import add_hangul_decompositions
+from .normalization_quick_check import derive_normalization_quick_check
 
 from .description import initialize_descriptions
 from .chunk import deduplicate_chunks
@@ -51,6 +51,10 @@ class description (object):
         self.emoji_component = False
         self.extended_pictographic = False
 
+        # Derived from UnicodeData.txt and CompositionExclusions.txt
+        self.nfc_quick_check = "yes"
+        self.nfd_quick_check = "yes"
+
         # Index into the composition table.
         self.g_composition_index = None
 
@@ -84,7 +88,9 @@ class description (object):
             self.emoji_modifier == other.emoji_modifier and
             self.emoji_modifier_base == other.emoji_modifier_base and
             self.emoji_component == other.emoji_component and
-            self.extended_pictographic == other.extended_pictographic
+            self.extended_pictographic == other.extended_pictographic and
+            self.nfc_quick_check == other.nfc_quick_check and
+            self.nfd_quick_check == other.nfd_quick_check
         )
 
     def instantiation(self):
@@ -103,6 +109,8 @@ class description (object):
         s += "XDT::{}, ".format(self.decomposition_type if self.decomposition_type != "final" else "_final")
         s += "0x{:x}, ".format(self.g_decomposition_index)
         s += "0x{:x}, ".format(self.g_composition_index + 1 if self.g_composition_index is not None else 0)
+        s += "XQC::{}, ".format(self.nfc_quick_check)
+        s += "XQC::{}, ".format(self.nfd_quick_check)
         s += "}"
         return s
 
@@ -0,0 +1,39 @@
+
+import sys
+
+def derive_normalization_quick_check(descriptions):
+    """Derive the NFC_QC and NFD_QC properties.
+
+    These are the same as in DerivedNormalizationProps.txt, see Unicode Standard Annex #15
+    "Unicode Normalization Forms", chapter 9 "Detecting Normalization Forms".
+
+    Must be called after the canonical Hangul decompositions are added.
+
+     - NFD_QC is "no" for code-points with a canonical decomposition.
+     - NFC_QC is "no" for code-points with a canonical decomposition that are excluded from
+       composition; explicitly, as singletons or as non-starter decompositions.
+     - NFC_QC is "maybe" for code-points that are the second code-point of a composition.
+
+    @param[in,out] descriptions A table of unicode descriptions
+    """
+
+    print("Derive normalization quick check.", file=sys.stderr, flush=True)
+
+    for d in descriptions:
+        if d.decomposition_type != "canonical":
+            continue
+
+        d.nfd_quick_check = "no"
+
+        if (d.composition_exclusion or
+            len(d.decomposition_mapping) == 1 or
+            d.canonical_combining_class != 0 or
+            descriptions[d.decomposition_mapping[0]].canonical_combining_class != 0):
+            d.nfc_quick_check = "no"
+
+    for d in descriptions:
+        if d.decomposition_type == "canonical" and d.nfc_quick_check != "no" and len(d.decomposition_mapping) == 2:
+            second = descriptions[d.decomposition_mapping[1]]
+            if second.nfc_quick_check == "yes":
+                second.nfc_quick_check = "maybe"
+